@@ -16,6 +16,8 @@
 
 #pragma once
 
+#include <string>
+
 #include <silkworm/infra/common/log.hpp>
 #include <silkworm/node/settings.hpp>
 #include <silkworm/node/snapshot/settings.hpp>
@@ -30,6 +32,7 @@ struct SilkwormSettings {
     node::Settings node_settings;
     sentry::Settings sentry_settings;
     rpc::DaemonSettings rpcdaemon_settings;
+    std::string metrics_end_point;  // empty means metrics exposition disabled
     bool force_pow{true};  // TODO(canepat) remove when PoS sync works
 };
 
@@ -0,0 +1,423 @@
+/*
+   Copyright 2023 The Silkworm Authors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#include "block_recording.hpp"
+
+#include <cstring>
+#include <fstream>
+#include <set>
+#include <stdexcept>
+#include <unordered_set>
+
+#include <silkworm/core/common/cast.hpp>
+#include <silkworm/core/common/endian.hpp>
+#include <silkworm/core/execution/processor.hpp>
+#include <silkworm/core/protocol/rule_set.hpp>
+#include <silkworm/infra/common/directories.hpp>
+#include <silkworm/node/db/access_layer.hpp>
+#include <silkworm/node/db/buffer.hpp>
+
+namespace silkworm {
+
+static constexpr std::string_view kRecordingMagic{"silkworm-replay-v1"};
+
+/** @name Recording file (de)serialization
+ *  Fields are either 8-byte big-endian integers or length-prefixed byte strings, RLP is used for blocks and receipts
+ */
+//!@{
+
+static void put_u64(Bytes& to, uint64_t value) {
+    uint8_t buffer[8];
+    endian::store_big_u64(buffer, value);
+    to.append(buffer, 8);
+}
+
+static void put_bytes(Bytes& to, ByteView value) {
+    put_u64(to, value.size());
+    to.append(value);
+}
+
+static uint64_t get_u64(ByteView& from) {
+    if (from.size() < 8) {
+        throw std::runtime_error("truncated recording");
+    }
+    const uint64_t value{endian::load_big_u64(from.data())};
+    from.remove_prefix(8);
+    return value;
+}
+
+static ByteView get_bytes(ByteView& from) {
+    const uint64_t size{get_u64(from)};
+    if (from.size() < size) {
+        throw std::runtime_error("truncated recording");
+    }
+    const ByteView value{from.substr(0, size)};
+    from.remove_prefix(size);
+    return value;
+}
+
+template <class T>
+static T get_fixed(ByteView& from) {
+    const ByteView bytes{get_bytes(from)};
+    T value;
+    if (bytes.size() != sizeof(value.bytes)) {
+        throw std::runtime_error("invalid recording");
+    }
+    std::memcpy(value.bytes, bytes.data(), sizeof(value.bytes));
+    return value;
+}
+
+template <class T>
+static T decode_or_throw(ByteView encoded) {
+    T value;
+    if (!rlp::decode(encoded, value)) {
+        throw std::runtime_error("invalid RLP in recording");
+    }
+    return value;
+}
+
+void save_recording(const Recording& recording, const std::filesystem::path& file_path) {
+    Bytes out{string_view_to_byte_view(kRecordingMagic)};
+    put_bytes(out, string_view_to_byte_view(recording.chain_config.to_json().dump()));
+
+    put_u64(out, recording.accounts.size());
+    for (const auto& [address, account] : recording.accounts) {
+        put_bytes(out, address.bytes);
+        put_bytes(out, account ? account->encode_for_storage() : Bytes{});
+    }
+    put_u64(out, recording.previous_incarnations.size());
+    for (const auto& [address, incarnation] : recording.previous_incarnations) {
+        put_bytes(out, address.bytes);
+        put_u64(out, incarnation);
+    }
+    put_u64(out, recording.storage.size());
+    for (const auto& [key, value] : recording.storage) {
+        const auto& [address, incarnation, location] = key;
+        put_bytes(out, address.bytes);
+        put_u64(out, incarnation);
+        put_bytes(out, location.bytes);
+        put_bytes(out, value.bytes);
+    }
+    put_u64(out, recording.code.size());
+    for (const auto& [code_hash, code] : recording.code) {
+        put_bytes(out, code_hash.bytes);
+        put_bytes(out, code);
+    }
+    put_u64(out, recording.ancestors.size());
+    for (const auto& [_, header] : recording.ancestors) {
+        Bytes encoded;
+        rlp::encode(encoded, header);
+        put_bytes(out, encoded);
+    }
+    put_u64(out, recording.blocks.size());
+    for (size_t i{0}; i < recording.blocks.size(); ++i) {
+        Bytes encoded;
+        rlp::encode(encoded, recording.blocks[i]);
+        put_bytes(out, encoded);
+        put_u64(out, recording.receipts[i].size());
+        for (const auto& receipt : recording.receipts[i]) {
+            put_bytes(out, receipt);
+        }
+    }
+
+    std::ofstream file{file_path, std::ios::binary | std::ios::trunc};
+    file.write(byte_ptr_cast(out.data()), static_cast<std::streamsize>(out.size()));
+    if (!file) {
+        throw std::runtime_error("cannot write " + file_path.string());
+    }
+}
+
+Recording load_recording(const std::filesystem::path& file_path) {
+    std::ifstream file{file_path, std::ios::binary};
+    if (!file) {
+        throw std::runtime_error("cannot open " + file_path.string());
+    }
+    const std::string content{std::istreambuf_iterator<char>{file}, std::istreambuf_iterator<char>{}};
+    ByteView in{string_view_to_byte_view(content)};
+    if (!in.starts_with(string_view_to_byte_view(kRecordingMagic))) {
+        throw std::runtime_error("not a replay recording: " + file_path.string());
+    }
+    in.remove_prefix(kRecordingMagic.size());
+
+    Recording recording;
+    const ByteView chain_config_json{get_bytes(in)};
+    const auto chain_config{ChainConfig::from_json(nlohmann::json::parse(chain_config_json.begin(), chain_config_json.end()))};
+    if (!chain_config) {
+        throw std::runtime_error("invalid chain config in recording");
+    }
+    recording.chain_config = *chain_config;
+
+    for (uint64_t n{get_u64(in)}; n > 0; --n) {
+        const auto address{get_fixed<evmc::address>(in)};
+        const ByteView encoded{get_bytes(in)};
+        std::optional<Account> account;
+        if (!encoded.empty()) {
+            const auto decoded{Account::from_encoded_storage(encoded)};
+            if (!decoded) {
+                throw std::runtime_error("invalid account in recording");
+            }
+            account = *decoded;
+        }
+        recording.accounts.emplace(address, account);
+    }
+    for (uint64_t n{get_u64(in)}; n > 0; --n) {
+        const auto address{get_fixed<evmc::address>(in)};
+        recording.previous_incarnations.emplace(address, get_u64(in));
+    }
+    for (uint64_t n{get_u64(in)}; n > 0; --n) {
+        const auto address{get_fixed<evmc::address>(in)};
+        const uint64_t incarnation{get_u64(in)};
+        const auto location{get_fixed<evmc::bytes32>(in)};
+        recording.storage.emplace(std::make_tuple(address, incarnation, location), get_fixed<evmc::bytes32>(in));
+    }
+    for (uint64_t n{get_u64(in)}; n > 0; --n) {
+        const auto code_hash{get_fixed<evmc::bytes32>(in)};
+        recording.code.emplace(code_hash, Bytes{get_bytes(in)});
+    }
+    for (uint64_t n{get_u64(in)}; n > 0; --n) {
+        auto header{decode_or_throw<BlockHeader>(get_bytes(in))};
+        recording.ancestors.emplace(header.number, std::move(header));
+    }
+    for (uint64_t n{get_u64(in)}; n > 0; --n) {
+        auto& block{recording.blocks.emplace_back(decode_or_throw<Block>(get_bytes(in)))};
+        block.recover_senders();
+        auto& receipts{recording.receipts.emplace_back()};
+        for (uint64_t r{get_u64(in)}; r > 0; --r) {
+            receipts.emplace_back(get_bytes(in));
+        }
+    }
+    return recording;
+}
+
+//!@}
+
+//! State wrapper recording the first read of each item not written before, i.e. the pre-state of a range of blocks
+class RecordingState : public State {
+  public:
+    RecordingState(State& inner, Recording& recording, BlockNum first_block)
+        : inner_{inner}, recording_{recording}, first_block_{first_block} {}
+
+    std::optional<Account> read_account(const evmc::address& address) const noexcept override {
+        auto account{inner_.read_account(address)};
+        if (!written_accounts_.contains(address)) {
+            recording_.accounts.try_emplace(address, account);
+        }
+        return account;
+    }
+
+    ByteView read_code(const evmc::bytes32& code_hash) const noexcept override {
+        const ByteView code{inner_.read_code(code_hash)};
+        recording_.code.try_emplace(code_hash, code);
+        return code;
+    }
+
+    evmc::bytes32 read_storage(const evmc::address& address, uint64_t incarnation,
+                               const evmc::bytes32& location) const noexcept override {
+        const auto value{inner_.read_storage(address, incarnation, location)};
+        auto key{std::make_tuple(address, incarnation, location)};
+        if (!written_storage_.contains(key)) {
+            recording_.storage.try_emplace(std::move(key), value);
+        }
+        return value;
+    }
+
+    uint64_t previous_incarnation(const evmc::address& address) const noexcept override {
+        const uint64_t incarnation{inner_.previous_incarnation(address)};
+        if (!written_accounts_.contains(address) && incarnation > 0) {
+            recording_.previous_incarnations.try_emplace(address, incarnation);
+        }
+        return incarnation;
+    }
+
+    std::optional<BlockHeader> read_header(uint64_t block_number,
+                                           const evmc::bytes32& block_hash) const noexcept override {
+        auto header{inner_.read_header(block_number, block_hash)};
+        if (header && block_number < first_block_) {
+            recording_.ancestors.try_emplace(block_number, *header);
+        }
+        return header;
+    }
+
+    [[nodiscard]] bool read_body(uint64_t block_number, const evmc::bytes32& block_hash,
+                                 BlockBody& out) const noexcept override {
+        return inner_.read_body(block_number, block_hash, out);
+    }
+
+    std::optional<intx::uint256> total_difficulty(uint64_t block_number,
+                                                  const evmc::bytes32& block_hash) const noexcept override {
+        return inner_.total_difficulty(block_number, block_hash);
+    }
+
+    evmc::bytes32 state_root_hash() const override { return inner_.state_root_hash(); }
+    uint64_t current_canonical_block() const override { return inner_.current_canonical_block(); }
+    std::optional<evmc::bytes32> canonical_hash(uint64_t block_number) const override {
+        return inner_.canonical_hash(block_number);
+    }
+
+    void insert_block(const Block& block, const evmc::bytes32& hash) override { inner_.insert_block(block, hash); }
+    void canonize_block(uint64_t block_number, const evmc::bytes32& block_hash) override {
+        inner_.canonize_block(block_number, block_hash);
+    }
+    void decanonize_block(uint64_t block_number) override { inner_.decanonize_block(block_number); }
+    void insert_receipts(uint64_t block_number, const std::vector<Receipt>& receipts) override {
+        inner_.insert_receipts(block_number, receipts);
+    }
+
+    void begin_block(uint64_t block_number) override { inner_.begin_block(block_number); }
+
+    void update_account(const evmc::address& address, std::optional<Account> initial,
+                        std::optional<Account> current) override {
+        written_accounts_.insert(address);
+        inner_.update_account(address, initial, current);
+    }
+
+    void update_account_code(const evmc::address& address, uint64_t incarnation, const evmc::bytes32& code_hash,
+                             ByteView code) override {
+        inner_.update_account_code(address, incarnation, code_hash, code);
+    }
+
+    void update_storage(const evmc::address& address, uint64_t incarnation, const evmc::bytes32& location,
+                        const evmc::bytes32& initial, const evmc::bytes32& current) override {
+        written_storage_.insert(std::make_tuple(address, incarnation, location));
+        inner_.update_storage(address, incarnation, location, initial, current);
+    }
+
+    void unwind_state_changes(uint64_t block_number) override { inner_.unwind_state_changes(block_number); }
+
+  private:
+    State& inner_;
+    Recording& recording_;
+    BlockNum first_block_;
+    std::unordered_set<evmc::address> written_accounts_;
+    std::set<std::tuple<evmc::address, uint64_t, evmc::bytes32>> written_storage_;
+};
+
+Recording record(const std::filesystem::path& chaindata, BlockNum from, BlockNum to) {
+    auto data_dir{DataDirectory::from_chaindata(chaindata)};
+    // Execution goes through a write txn (Buffer needs it) which is never committed, so the database is left untouched
+    db::EnvConfig db_config{data_dir.chaindata().path().string()};
+    auto env{db::open_env(db_config)};
+    db::RWTxn txn{env};
+    txn.disable_commit();
+
+    Recording recording;
+    const auto chain_config{db::read_chain_config(txn)};
+    if (!chain_config) {
+        throw std::runtime_error("unable to retrieve chain config");
+    }
+    recording.chain_config = *chain_config;
+    auto rule_set{protocol::rule_set_factory(*chain_config)};
+    if (!rule_set) {
+        throw std::runtime_error("unable to retrieve protocol rule set");
+    }
+
+    // Changes are kept in the buffer and never flushed, reads of untouched items hit the state before the range
+    db::Buffer buffer{txn, /*prune_history_threshold=*/0, /*historical_block=*/from};
+    RecordingState state{buffer, recording, from};
+    std::vector<Receipt> receipts;
+
+    for (BlockNum block_num{from}; block_num <= to; ++block_num) {
+        Block block;
+        if (!db::read_block_by_number(txn, block_num, /*read_senders=*/true, block)) {
+            throw std::runtime_error("block " + std::to_string(block_num) + " not found");
+        }
+        ExecutionProcessor processor{block, *rule_set, state, *chain_config};
+        if (const auto res{processor.execute_and_write_block(receipts)}; res != ValidationResult::kOk) {
+            throw std::runtime_error("validation error " + std::to_string(static_cast<int>(res)) + " at block " +
+                                     std::to_string(block_num));
+        }
+        auto& encoded_receipts{recording.receipts.emplace_back()};
+        for (const auto& receipt : receipts) {
+            rlp::encode(encoded_receipts.emplace_back(), receipt);
+        }
+        recording.blocks.push_back(std::move(block));
+    }
+    return recording;
+}
+
+void load_pre_state(const Recording& recording, State& state) {
+    const BlockNum first_block{recording.blocks.front().header.number};
+    state.begin_block(first_block - 1);
+    for (const auto& [address, incarnation] : recording.previous_incarnations) {
+        state.update_account(address, Account{.incarnation = incarnation}, std::nullopt);
+    }
+    for (const auto& [address, account] : recording.accounts) {
+        if (account) {
+            state.update_account(address, std::nullopt, account);
+        }
+    }
+    for (const auto& [address, account] : recording.accounts) {
+        if (!account) {
+            continue;
+        }
+        if (const auto it{recording.code.find(account->code_hash)}; it != recording.code.end()) {
+            state.update_account_code(address, account->incarnation, it->first, it->second);
+        }
+    }
+    for (const auto& [key, value] : recording.storage) {
+        const auto& [address, incarnation, location] = key;
+        state.update_storage(address, incarnation, location, {}, value);
+    }
+    for (const auto& [_, header] : recording.ancestors) {
+        Block ancestor;
+        ancestor.header = header;
+        state.insert_block(ancestor, header.hash());
+    }
+}
+
+ReplayStats replay_blocks(const Recording& recording, protocol::IRuleSet& rule_set, State& state,
+                          AnalysisCache& analysis_cache, ObjectPool<evmone::ExecutionState>& state_pool) {
+    ReplayStats stats;
+    std::vector<Receipt> receipts;
+
+    for (size_t i{0}; i < recording.blocks.size(); ++i) {
+        const Block& block{recording.blocks[i]};
+        const auto start{Clock::now()};
+
+        ExecutionProcessor processor{block, rule_set, state, recording.chain_config};
+        processor.evm().analysis_cache = &analysis_cache;
+        processor.evm().state_pool = &state_pool;
+        const auto res{processor.execute_and_write_block(receipts)};
+
+        stats.total_time += Clock::now() - start;
+        stats.gas += block.header.gas_used;
+
+        if (res != ValidationResult::kOk) {
+            throw std::runtime_error("validation error " + std::to_string(static_cast<int>(res)) + " at block " +
+                                     std::to_string(block.header.number));
+        }
+        const auto& expected_receipts{recording.receipts[i]};
+        if (receipts.size() != expected_receipts.size()) {
+            throw std::runtime_error("receipt count mismatch at block " + std::to_string(block.header.number));
+        }
+        for (size_t r{0}; r < receipts.size(); ++r) {
+            Bytes encoded;
+            rlp::encode(encoded, receipts[r]);
+            if (encoded != expected_receipts[r]) {
+                throw std::runtime_error("receipt mismatch at block " + std::to_string(block.header.number));
+            }
+        }
+
+        // Needed by BLOCKHASH in the following blocks
+        Block header_only;
+        header_only.header = block.header;
+        state.insert_block(header_only, block.header.hash());
+    }
+
+    return stats;
+}
+
+}  // namespace silkworm
@@ -0,0 +1,76 @@
+/*
+   Copyright 2023 The Silkworm Authors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#pragma once
+
+#include <chrono>
+#include <filesystem>
+#include <map>
+#include <optional>
+#include <tuple>
+#include <vector>
+
+#include <silkworm/core/chain/config.hpp>
+#include <silkworm/core/common/base.hpp>
+#include <silkworm/core/execution/evm.hpp>
+#include <silkworm/core/protocol/rule_set.hpp>
+#include <silkworm/core/state/state.hpp>
+#include <silkworm/core/types/account.hpp>
+#include <silkworm/core/types/block.hpp>
+
+namespace silkworm {
+
+//! What is needed to replay a range of blocks w/o any other data source
+struct Recording {
+    ChainConfig chain_config;
+    std::map<evmc::address, std::optional<Account>> accounts;  // nullopt for accounts not existing before the range
+    std::map<evmc::address, uint64_t> previous_incarnations;
+    std::map<std::tuple<evmc::address, uint64_t, evmc::bytes32>, evmc::bytes32> storage;
+    std::map<evmc::bytes32, Bytes> code;
+    std::map<BlockNum, BlockHeader> ancestors;  // headers before the range read by BLOCKHASH
+    std::vector<Block> blocks;
+    std::vector<std::vector<Bytes>> receipts;  // RLP-encoded receipts of each block
+};
+
+//! Executes blocks [from, to] on top of the given database and records what is needed to replay them
+Recording record(const std::filesystem::path& chaindata, BlockNum from, BlockNum to);
+
+void save_recording(const Recording& recording, const std::filesystem::path& file_path);
+
+Recording load_recording(const std::filesystem::path& file_path);
+
+//! Loads the pre-state of the recording into the given state, as if it were the result of the block before the range
+void load_pre_state(const Recording& recording, State& state);
+
+using Clock = std::chrono::steady_clock;
+
+//! Figures of one replay, the ones not measured by replay_blocks are left to its caller
+struct ReplayStats {
+    uint64_t gas{0};
+    Clock::duration total_time{};
+    Clock::duration read_time{};
+    Clock::duration write_time{};
+    Clock::duration flush_time{};
+    uint64_t allocations{0};
+    uint64_t allocated_bytes{0};
+};
+
+//! Executes the recorded blocks on top of their pre-state loaded by load_pre_state
+//! \throws std::runtime_error if any block is invalid or its receipts differ from the recorded ones
+ReplayStats replay_blocks(const Recording& recording, protocol::IRuleSet& rule_set, State& state,
+                          AnalysisCache& analysis_cache, ObjectPool<evmone::ExecutionState>& state_pool);
+
+}  // namespace silkworm
@@ -0,0 +1,129 @@
+/*
+   Copyright 2023 The Silkworm Authors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#include "block_recording.hpp"
+
+#include <catch2/catch.hpp>
+
+#include <silkworm/core/chain/genesis.hpp>
+#include <silkworm/core/common/util.hpp>
+#include <silkworm/core/execution/address.hpp>
+#include <silkworm/core/state/in_memory_state.hpp>
+#include <silkworm/infra/common/directories.hpp>
+#include <silkworm/node/db/access_layer.hpp>
+#include <silkworm/node/db/buffer.hpp>
+#include <silkworm/node/db/genesis.hpp>
+#include <silkworm/node/db/tables.hpp>
+
+namespace silkworm {
+
+TEST_CASE("Record blocks from chaindata") {
+    TemporaryDirectory tmp_dir;
+    DataDirectory data_dir{tmp_dir.path(), /*create=*/true};
+
+    const auto sender{0xb685342b8c54347aad148e1f22eff3eb3eb29391_address};
+    const auto miner{0x5a0b54d5dc17e0aadc383d2db43b0a0d3e029c4c_address};
+
+    // Block 1 deploys a contract initially setting its 0th storage to 0x2a and its 1st storage to 0x01c9
+    Block block;
+    block.header.number = 1;
+    block.header.beneficiary = miner;
+    block.header.gas_limit = 100'000;
+    block.header.gas_used = 63'820;
+    block.transactions.resize(1);
+    block.transactions[0].data = *from_hex("602a6000556101c960015560068060166000396000f3600035600055");
+    block.transactions[0].gas_limit = block.header.gas_limit;
+    block.transactions[0].type = TransactionType::kLegacy;
+    block.transactions[0].r = 1;  // dummy
+    block.transactions[0].s = 1;  // dummy
+
+    {
+        auto env{db::open_env(db::EnvConfig{.path = data_dir.chaindata().path().string(), .create = true})};
+        db::RWTxn txn{env};
+        db::table::check_or_create_chaindata_tables(txn);
+        const auto genesis_json{nlohmann::json::parse(read_genesis_data(kMainnetConfig.chain_id))};
+        REQUIRE(db::initialize_genesis(txn, genesis_json, /*allow_exceptions=*/false));
+
+        db::Buffer buffer{txn, /*prune_history_threshold=*/0};
+        buffer.update_account(sender, std::nullopt, Account{.balance = kEther});
+        buffer.write_to_db();
+
+        const auto hash{block.header.hash()};
+        db::write_header(txn, block.header, /*with_header_numbers=*/true);
+        db::write_canonical_hash(txn, block.header.number, hash);
+        db::write_body(txn, block, hash, block.header.number);
+        auto senders{db::open_cursor(txn, db::table::kSenders)};
+        senders.upsert(db::to_slice(db::block_key(block.header.number, hash.bytes)), db::to_slice(sender.bytes));
+        txn.commit_and_stop();
+    }
+
+    const Recording recording{record(data_dir.chaindata().path(), 1, 1)};
+    CHECK(recording.chain_config == kMainnetConfig);
+    REQUIRE(recording.blocks.size() == 1);
+    CHECK(recording.blocks[0].header == block.header);
+    CHECK(recording.blocks[0].transactions[0].from == sender);
+    REQUIRE(recording.receipts.size() == 1);
+    CHECK(recording.receipts[0].size() == 1);
+    REQUIRE(recording.accounts.contains(sender));
+    CHECK(recording.accounts.at(sender)->balance == kEther);
+
+    SECTION("record leaves the database untouched") {
+        auto env{db::open_env(db::EnvConfig{.path = data_dir.chaindata().path().string(), .readonly = true})};
+        db::ROTxn txn{env};
+        const auto account{db::read_account(txn, sender)};
+        REQUIRE(account);
+        CHECK(account->nonce == 0);
+        CHECK(account->balance == kEther);
+    }
+
+    SECTION("recording file round trip") {
+        const auto file_path{tmp_dir.path() / "blocks.replay"};
+        save_recording(recording, file_path);
+        const Recording loaded{load_recording(file_path)};
+        CHECK(loaded.chain_config == recording.chain_config);
+        CHECK(loaded.accounts == recording.accounts);
+        CHECK(loaded.storage == recording.storage);
+        CHECK(loaded.code == recording.code);
+        REQUIRE(loaded.blocks.size() == 1);
+        CHECK(loaded.blocks[0].header == block.header);
+        CHECK(loaded.blocks[0].transactions[0].from == sender);
+        CHECK(loaded.receipts == recording.receipts);
+    }
+
+    SECTION("replay over an in-memory state") {
+        InMemoryState state;
+        load_pre_state(recording, state);
+        auto rule_set{protocol::rule_set_factory(recording.chain_config)};
+        REQUIRE(rule_set);
+        AnalysisCache analysis_cache{/*max_size=*/16};
+        ObjectPool<evmone::ExecutionState> state_pool;
+
+        // Replay fails unless block gas and receipts match the recorded ones
+        const ReplayStats stats{replay_blocks(recording, *rule_set, state, analysis_cache, state_pool)};
+        CHECK(stats.gas == block.header.gas_used);
+
+        const auto sender_account{state.read_account(sender)};
+        REQUIRE(sender_account);
+        CHECK(sender_account->nonce == 1);
+        const auto contract{create_address(sender, /*nonce=*/0)};
+        CHECK(state.read_storage(contract, kDefaultIncarnation, to_bytes32(*from_hex("00"))) ==
+              to_bytes32(*from_hex("2a")));
+        CHECK(state.read_storage(contract, kDefaultIncarnation, to_bytes32(*from_hex("01"))) ==
+              to_bytes32(*from_hex("01c9")));
+    }
+}
+
+}  // namespace silkworm
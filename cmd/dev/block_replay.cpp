@@ -0,0 +1,289 @@
+/*
+   Copyright 2023 The Silkworm Authors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+// Records a range of blocks, together with the pre-state they touch and the receipts they produce, into a compact
+// file and then replays them through ExecutionProcessor, reporting network-free and reproducible performance numbers.
+
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <filesystem>
+#include <iomanip>
+#include <iostream>
+#include <new>
+#include <stdexcept>
+
+#include <CLI/CLI.hpp>
+
+#include <silkworm/core/protocol/rule_set.hpp>
+#include <silkworm/core/state/in_memory_state.hpp>
+#include <silkworm/infra/common/directories.hpp>
+#include <silkworm/node/db/buffer.hpp>
+#include <silkworm/node/db/tables.hpp>
+
+#include "block_recording.hpp"
+
+// Allocation counters, all the allocations of this process go through here
+static std::atomic<uint64_t> allocation_count{0};
+static std::atomic<uint64_t> allocated_bytes{0};
+
+void* operator new(std::size_t size) {
+    allocation_count.fetch_add(1, std::memory_order_relaxed);
+    allocated_bytes.fetch_add(size, std::memory_order_relaxed);
+    if (void* ptr{std::malloc(size ? size : 1)}) {
+        return ptr;
+    }
+    throw std::bad_alloc{};
+}
+
+void operator delete(void* ptr) noexcept { std::free(ptr); }
+void operator delete(void* ptr, std::size_t) noexcept { std::free(ptr); }
+
+namespace silkworm {
+
+//! State wrapper accumulating the time spent reading from and writing to the underlying state
+class TimingState : public State {
+  public:
+    explicit TimingState(State& inner) : inner_{inner} {}
+
+    [[nodiscard]] Clock::duration read_time() const { return read_time_; }
+    [[nodiscard]] Clock::duration write_time() const { return write_time_; }
+
+    std::optional<Account> read_account(const evmc::address& address) const noexcept override {
+        return timed(read_time_, [&] { return inner_.read_account(address); });
+    }
+
+    ByteView read_code(const evmc::bytes32& code_hash) const noexcept override {
+        return timed(read_time_, [&] { return inner_.read_code(code_hash); });
+    }
+
+    evmc::bytes32 read_storage(const evmc::address& address, uint64_t incarnation,
+                               const evmc::bytes32& location) const noexcept override {
+        return timed(read_time_, [&] { return inner_.read_storage(address, incarnation, location); });
+    }
+
+    uint64_t previous_incarnation(const evmc::address& address) const noexcept override {
+        return timed(read_time_, [&] { return inner_.previous_incarnation(address); });
+    }
+
+    std::optional<BlockHeader> read_header(uint64_t block_number,
+                                           const evmc::bytes32& block_hash) const noexcept override {
+        return timed(read_time_, [&] { return inner_.read_header(block_number, block_hash); });
+    }
+
+    [[nodiscard]] bool read_body(uint64_t block_number, const evmc::bytes32& block_hash,
+                                 BlockBody& out) const noexcept override {
+        return timed(read_time_, [&] { return inner_.read_body(block_number, block_hash, out); });
+    }
+
+    std::optional<intx::uint256> total_difficulty(uint64_t block_number,
+                                                  const evmc::bytes32& block_hash) const noexcept override {
+        return timed(read_time_, [&] { return inner_.total_difficulty(block_number, block_hash); });
+    }
+
+    evmc::bytes32 state_root_hash() const override { return inner_.state_root_hash(); }
+    uint64_t current_canonical_block() const override { return inner_.current_canonical_block(); }
+    std::optional<evmc::bytes32> canonical_hash(uint64_t block_number) const override {
+        return timed(read_time_, [&] { return inner_.canonical_hash(block_number); });
+    }
+
+    void insert_block(const Block& block, const evmc::bytes32& hash) override { inner_.insert_block(block, hash); }
+    void canonize_block(uint64_t block_number, const evmc::bytes32& block_hash) override {
+        inner_.canonize_block(block_number, block_hash);
+    }
+    void decanonize_block(uint64_t block_number) override { inner_.decanonize_block(block_number); }
+    void insert_receipts(uint64_t block_number, const std::vector<Receipt>& receipts) override {
+        inner_.insert_receipts(block_number, receipts);
+    }
+
+    void begin_block(uint64_t block_number) override {
+        timed(write_time_, [&] { inner_.begin_block(block_number); });
+    }
+
+    void update_account(const evmc::address& address, std::optional<Account> initial,
+                        std::optional<Account> current) override {
+        timed(write_time_, [&] { inner_.update_account(address, initial, current); });
+    }
+
+    void update_account_code(const evmc::address& address, uint64_t incarnation, const evmc::bytes32& code_hash,
+                             ByteView code) override {
+        timed(write_time_, [&] { inner_.update_account_code(address, incarnation, code_hash, code); });
+    }
+
+    void update_storage(const evmc::address& address, uint64_t incarnation, const evmc::bytes32& location,
+                        const evmc::bytes32& initial, const evmc::bytes32& current) override {
+        timed(write_time_, [&] { inner_.update_storage(address, incarnation, location, initial, current); });
+    }
+
+    void unwind_state_changes(uint64_t block_number) override { inner_.unwind_state_changes(block_number); }
+
+  private:
+    template <class F>
+    static auto timed(Clock::duration& total, F&& f) {
+        const auto start{Clock::now()};
+        if constexpr (std::is_void_v<decltype(f())>) {
+            f();
+            total += Clock::now() - start;
+        } else {
+            auto result{f()};
+            total += Clock::now() - start;
+            return result;
+        }
+    }
+
+    State& inner_;
+    mutable Clock::duration read_time_{};
+    mutable Clock::duration write_time_{};
+};
+
+//! Runs the given replay filling in the allocations it performs
+template <class F>
+static ReplayStats counting_allocations(F&& replay) {
+    const uint64_t allocations_before{allocation_count.load()};
+    const uint64_t allocated_bytes_before{allocated_bytes.load()};
+    ReplayStats stats{replay()};
+    stats.allocations = allocation_count.load() - allocations_before;
+    stats.allocated_bytes = allocated_bytes.load() - allocated_bytes_before;
+    return stats;
+}
+
+static void print_stats(size_t repetition, const ReplayStats& stats, bool profile) {
+    using namespace std::chrono;
+    const double seconds{duration<double>(stats.total_time).count()};
+    std::cout << "#" << repetition << " gas: " << stats.gas << " time: " << std::fixed << std::setprecision(3)
+              << seconds << "s Mgas/s: " << std::setprecision(2) << (static_cast<double>(stats.gas) / 1e6 / seconds)
+              << " allocations: " << stats.allocations << " (" << stats.allocated_bytes / 1024 << " KiB)";
+    if (profile) {
+        const auto evm_time{stats.total_time - stats.read_time - stats.write_time};
+        std::cout << std::setprecision(3) << " evm: " << duration<double>(evm_time).count()
+                  << "s reads: " << duration<double>(stats.read_time).count()
+                  << "s writes: " << duration<double>(stats.write_time).count() << "s";
+    }
+    if (stats.flush_time != Clock::duration{}) {
+        std::cout << std::setprecision(3) << " flush: " << duration<double>(stats.flush_time).count() << "s";
+    }
+    std::cout << "\n";
+}
+
+static void replay(const std::filesystem::path& file_path, size_t repetitions, bool use_mdbx, bool profile) {
+    const Recording recording{load_recording(file_path)};
+    if (recording.blocks.empty()) {
+        throw std::runtime_error("no blocks in recording");
+    }
+    auto rule_set{protocol::rule_set_factory(recording.chain_config)};
+    if (!rule_set) {
+        throw std::runtime_error("unable to retrieve protocol rule set");
+    }
+    std::cout << "Replaying " << recording.blocks.size() << " blocks from " << recording.blocks.front().header.number
+              << " over " << (use_mdbx ? "a temporary MDBX env" : "an in-memory state") << "\n";
+
+    AnalysisCache analysis_cache{/*max_size=*/5'000};
+    ObjectPool<evmone::ExecutionState> state_pool;
+
+    for (size_t repetition{1}; repetition <= repetitions; ++repetition) {
+        ReplayStats stats;
+        if (use_mdbx) {
+            TemporaryDirectory tmp_dir;
+            auto env{db::open_env(db::EnvConfig{.path = tmp_dir.path().string(), .create = true, .exclusive = true})};
+            db::RWTxn txn{env};
+            db::table::check_or_create_chaindata_tables(txn);
+            {
+                db::Buffer pre_state{txn, /*prune_history_threshold=*/0};
+                load_pre_state(recording, pre_state);
+                pre_state.write_to_db();
+            }
+            txn.commit_and_renew();
+
+            db::Buffer buffer{txn, /*prune_history_threshold=*/0};
+            TimingState timing_state{buffer};
+            State& state{profile ? static_cast<State&>(timing_state) : buffer};
+            stats = counting_allocations(
+                [&] { return replay_blocks(recording, *rule_set, state, analysis_cache, state_pool); });
+
+            const auto start{Clock::now()};
+            buffer.write_to_db();
+            txn.commit_and_renew();
+            stats.flush_time = Clock::now() - start;
+            stats.read_time = timing_state.read_time();
+            stats.write_time = timing_state.write_time();
+        } else {
+            InMemoryState in_memory_state;
+            load_pre_state(recording, in_memory_state);
+            TimingState timing_state{in_memory_state};
+            State& state{profile ? static_cast<State&>(timing_state) : in_memory_state};
+            stats = counting_allocations(
+                [&] { return replay_blocks(recording, *rule_set, state, analysis_cache, state_pool); });
+            stats.read_time = timing_state.read_time();
+            stats.write_time = timing_state.write_time();
+        }
+        print_stats(repetition, stats, profile);
+    }
+}
+
+}  // namespace silkworm
+
+int main(int argc, char* argv[]) {
+    using namespace silkworm;
+
+    CLI::App app{"Records blocks with the pre-state they touch and replays them to measure execution performance"};
+    app.require_subcommand(1);
+
+    std::string file{"blocks.replay"};
+
+    auto& record_cmd{*app.add_subcommand("record", "Record a range of blocks from a database populated by Erigon")};
+    std::string chaindata{DataDirectory{}.chaindata().path().string()};
+    record_cmd.add_option("--chaindata", chaindata, "Path to a database populated by Erigon")
+        ->capture_default_str()
+        ->check(CLI::ExistingDirectory);
+    BlockNum from{1};
+    BlockNum to{1};
+    record_cmd.add_option("--from", from, "First block to record (inclusive)")->required();
+    record_cmd.add_option("--to", to, "Last block to record (inclusive)")->required();
+    record_cmd.add_option("--file", file, "Path of the recording to write")->capture_default_str();
+
+    auto& replay_cmd{*app.add_subcommand("replay", "Replay recorded blocks through the execution processor")};
+    size_t repetitions{5};
+    bool use_mdbx{false};
+    bool profile{false};
+    replay_cmd.add_option("--file", file, "Path of the recording to replay")
+        ->capture_default_str()
+        ->check(CLI::ExistingFile);
+    replay_cmd.add_option("--repetitions", repetitions, "Number of replays")->capture_default_str();
+    replay_cmd.add_flag("--mdbx", use_mdbx, "Replay over a temporary MDBX env instead of an in-memory state");
+    replay_cmd.add_flag("--profile", profile, "Split time across EVM, state reads and writes (adds timing overhead)");
+
+    CLI11_PARSE(app, argc, argv);
+
+    try {
+        if (record_cmd) {
+            if (from == 0 || from > to) {
+                std::cerr << "--from (" << from << ") must be positive and less than or equal to --to (" << to << ")\n";
+                return -1;
+            }
+            const Recording recording{record(chaindata, from, to)};
+            save_recording(recording, file);
+            std::cout << "Recorded " << recording.blocks.size() << " blocks, " << recording.accounts.size()
+                      << " accounts, " << recording.storage.size() << " storage slots and " << recording.code.size()
+                      << " contract codes into " << file << "\n";
+        } else {
+            replay(file, repetitions, use_mdbx, profile);
+        }
+    } catch (const std::exception& ex) {
+        std::cerr << ex.what() << "\n";
+        return -1;
+    }
+    return 0;
+}
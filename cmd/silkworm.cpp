@@ -33,6 +33,7 @@
 #include <silkworm/infra/concurrency/awaitable_wait_for_all.hpp>
 #include <silkworm/infra/concurrency/awaitable_wait_for_one.hpp>
 #include <silkworm/infra/grpc/server/server_context_pool.hpp>
+#include <silkworm/infra/metrics/prometheus_server.hpp>
 #include <silkworm/node/db/eth_status_data_provider.hpp>
 #include <silkworm/node/node.hpp>
 #include <silkworm/sentry/api/common/sentry_client.hpp>
@@ -45,6 +46,7 @@
 #include "common/common.hpp"
 #include "common/db_checklist.hpp"
 #include "common/human_size_parser_validator.hpp"
+#include "common/ip_endpoint_option.hpp"
 #include "common/node_options.hpp"
 #include "common/rpcdaemon_options.hpp"
 #include "common/sentry_options.hpp"
@@ -72,6 +74,7 @@ using silkworm::cmd::common::add_logging_options;
 using silkworm::cmd::common::add_node_options;
 using silkworm::cmd::common::add_option_chain;
 using silkworm::cmd::common::add_option_data_dir;
+using silkworm::cmd::common::add_option_ip_endpoint;
 using silkworm::cmd::common::add_option_private_api_address;
 using silkworm::cmd::common::add_option_remote_sentry_addresses;
 using silkworm::cmd::common::add_rpcdaemon_options;
@@ -113,6 +116,10 @@ void parse_silkworm_command_line(CLI::App& cli, int argc, char* argv[], Silkworm
     // Sentry settings
     add_sentry_options(cli, settings.sentry_settings);
 
+    // Metrics settings
+    add_option_ip_endpoint(cli, "--metrics.endpoint", settings.metrics_end_point,
+                           "Prometheus metrics HTTP endpoint (e.g. 127.0.0.1:6060), disabled if empty");
+
     // TODO(canepat) remove when PoS sync works
     cli.add_flag("--sync.force_pow", settings.force_pow, "Force usage of proof-of-work bypassing chain config");
 
@@ -359,9 +366,22 @@ int main(int argc, char* argv[]) {
             chain_sync_process.force_pow(execution_client);
         }
 
+        // Metrics: the Prometheus exposition endpoint
+        std::unique_ptr<metrics::PrometheusServer> metrics_server;
+        if (!settings.metrics_end_point.empty()) {
+            metrics_server = std::make_unique<metrics::PrometheusServer>(
+                context_pool.next_io_context().get_executor(), settings.metrics_end_point);
+        }
+        auto metrics_run_if_needed = [&metrics_server]() -> boost::asio::awaitable<void> {
+            if (metrics_server) {
+                co_await metrics_server->run();
+            }
+        };
+
         auto tasks =
             execution_node.run() &&
             embedded_sentry_run_if_needed() &&
+            metrics_run_if_needed() &&
             chain_sync_process.async_run();
 
         // Trap OS signals
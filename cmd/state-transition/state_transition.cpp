@@ -333,7 +333,7 @@ void StateTransition::run() {
             const evmc_revision rev{config.revision(block.header.number, block.header.timestamp)};
 
             auto pre_block_validation = ruleSet->pre_validate_block_body(block, *state);
-            auto block_validation = ruleSet->validate_block_header(block.header, *state, true);
+            auto block_validation = ruleSet->validate_block_header(block.header, *state, true, true);
             auto pre_txn_validation = protocol::pre_validate_transaction(txn, rev, config.chain_id, block.header.base_fee_per_gas, block.header.data_gas_price());
             auto txn_validation = protocol::validate_transaction(txn, processor.evm().state(), processor.available_gas());
 
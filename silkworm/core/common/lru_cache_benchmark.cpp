@@ -0,0 +1,54 @@
+/*
+   Copyright 2023 The Silkworm Authors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#include <benchmark/benchmark.h>
+
+#include <silkworm/core/common/base.hpp>
+
+#include "lru_cache.hpp"
+
+namespace silkworm {
+
+// Puts keys cycling over twice the capacity, so that half of the puts evict the least recently used entry
+static void lru_cache_put(benchmark::State& state) {
+    const auto capacity{static_cast<size_t>(state.range(0))};
+    lru_cache<uint64_t, evmc::bytes32> cache{capacity};
+    uint64_t key{0};
+    for ([[maybe_unused]] auto _ : state) {
+        cache.put(key, evmc::bytes32{key});
+        key = (key + 1) % (2 * capacity);
+    }
+}
+
+BENCHMARK(lru_cache_put)->Arg(1'024)->Arg(65'536);
+
+// Gets over a full cache, with keys spread so that about half of them miss
+static void lru_cache_get(benchmark::State& state) {
+    const auto capacity{static_cast<size_t>(state.range(0))};
+    lru_cache<uint64_t, evmc::bytes32> cache{capacity};
+    for (uint64_t key{0}; key < capacity; ++key) {
+        cache.put(key, evmc::bytes32{key});
+    }
+    uint64_t key{0};
+    for ([[maybe_unused]] auto _ : state) {
+        benchmark::DoNotOptimize(cache.get(key));
+        key = (key + capacity / 2 + 1) % (2 * capacity);
+    }
+}
+
+BENCHMARK(lru_cache_get)->Arg(1'024)->Arg(65'536);
+
+}  // namespace silkworm
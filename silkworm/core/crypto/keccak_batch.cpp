@@ -0,0 +1,209 @@
+/*
+   Copyright 2023 The Silkworm Authors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#include "keccak_batch.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+
+#include <silkworm/core/common/assert.hpp>
+#include <silkworm/core/common/util.hpp>
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#define SILKWORM_KECCAK_BATCH_SIMD
+#endif
+
+namespace silkworm {
+
+#ifdef SILKWORM_KECCAK_BATCH_SIMD
+
+namespace {
+
+    // Keccak-256 sponge: 1600-bit state, 1088-bit rate, 256-bit output and original Keccak padding (0x01...0x80)
+    constexpr size_t kRateBytes{136};
+    constexpr size_t kRateWords{kRateBytes / sizeof(uint64_t)};
+
+    constexpr std::array<uint64_t, 24> kRoundConstants{
+        0x0000000000000001, 0x0000000000008082, 0x800000000000808a, 0x8000000080008000,
+        0x000000000000808b, 0x0000000080000001, 0x8000000080008081, 0x8000000000008009,
+        0x000000000000008a, 0x0000000000000088, 0x0000000080008009, 0x000000008000000a,
+        0x000000008000808b, 0x800000000000008b, 0x8000000000008089, 0x8000000000008003,
+        0x8000000000008002, 0x8000000000000080, 0x000000000000800a, 0x800000008000000a,
+        0x8000000080008081, 0x8000000000008080, 0x0000000080000001, 0x8000000080008008,
+    };
+
+    // Rotation offsets of the rho step, indexed by x + 5y
+    constexpr std::array<unsigned, 25> kRhoOffsets{
+        0, 1, 62, 28, 27,
+        36, 44, 6, 55, 20,
+        3, 10, 43, 25, 39,
+        41, 45, 15, 21, 8,
+        18, 2, 61, 56, 14,
+    };
+
+    // Destination of lane x + 5y in the pi step, i.e. y + 5((2x + 3y) mod 5)
+    constexpr size_t pi_index(size_t i) {
+        const size_t x{i % 5};
+        const size_t y{i / 5};
+        return y + 5 * ((2 * x + 3 * y) % 5);
+    }
+
+    // Each vector holds the same state word of 4 (or 8) independent sponges, one per lane
+    typedef uint64_t U64x4 __attribute__((vector_size(32)));
+    typedef uint64_t U64x8 __attribute__((vector_size(64)));
+
+    template <class V>
+    [[gnu::always_inline]] inline void keccak_f1600(V (&a)[25]) {
+        V c[5];
+        V d[5];
+        V b[25];
+        for (const uint64_t round_constant : kRoundConstants) {
+            // theta
+            for (size_t x{0}; x < 5; ++x) {
+                c[x] = a[x] ^ a[x + 5] ^ a[x + 10] ^ a[x + 15] ^ a[x + 20];
+            }
+            for (size_t x{0}; x < 5; ++x) {
+                const V& c1{c[(x + 1) % 5]};
+                d[x] = c[(x + 4) % 5] ^ ((c1 << 1) | (c1 >> 63));
+            }
+            for (size_t i{0}; i < 25; ++i) {
+                a[i] ^= d[i % 5];
+            }
+            // rho and pi (lane 0 is neither rotated nor moved)
+            b[0] = a[0];
+            for (size_t i{1}; i < 25; ++i) {
+                b[pi_index(i)] = (a[i] << kRhoOffsets[i]) | (a[i] >> (64 - kRhoOffsets[i]));
+            }
+            // chi
+            for (size_t y{0}; y < 25; y += 5) {
+                for (size_t x{0}; x < 5; ++x) {
+                    a[y + x] = b[y + x] ^ (~b[y + (x + 1) % 5] & b[y + (x + 2) % 5]);
+                }
+            }
+            // iota
+            a[0] ^= round_constant;
+        }
+    }
+
+    //! Hashes exactly kLanes inputs: all sponges absorb in lockstep, each digest is squeezed right after the
+    //! permutation of its last (padded) block while the lanes of shorter inputs keep running idle
+    template <class V, size_t kLanes>
+    [[gnu::always_inline]] inline void keccak256_lanes(const ByteView* inputs, ethash::hash256* hashes) {
+        static_assert(sizeof(V) == kLanes * sizeof(uint64_t));
+
+        size_t last_block[kLanes];
+        size_t num_blocks{0};
+        for (size_t j{0}; j < kLanes; ++j) {
+            last_block[j] = inputs[j].size() / kRateBytes;
+            num_blocks = std::max(num_blocks, last_block[j] + 1);
+        }
+
+        V state[25]{};
+        for (size_t block{0}; block < num_blocks; ++block) {
+            uint64_t words[kRateWords][kLanes]{};
+            for (size_t j{0}; j < kLanes; ++j) {
+                if (block > last_block[j]) {
+                    continue;
+                }
+                const uint8_t* data{inputs[j].data() + block * kRateBytes};
+                uint8_t padded[kRateBytes];
+                if (block == last_block[j]) {
+                    const size_t remaining{inputs[j].size() % kRateBytes};
+                    std::memset(padded, 0, kRateBytes);
+                    if (remaining > 0) {
+                        std::memcpy(padded, data, remaining);
+                    }
+                    padded[remaining] ^= 0x01;
+                    padded[kRateBytes - 1] ^= 0x80;
+                    data = padded;
+                }
+                for (size_t w{0}; w < kRateWords; ++w) {
+                    std::memcpy(&words[w][j], data + w * sizeof(uint64_t), sizeof(uint64_t));
+                }
+            }
+            for (size_t w{0}; w < kRateWords; ++w) {
+                V v;
+                std::memcpy(&v, words[w], sizeof(V));
+                state[w] ^= v;
+            }
+
+            keccak_f1600(state);
+
+            for (size_t j{0}; j < kLanes; ++j) {
+                if (block != last_block[j]) {
+                    continue;
+                }
+                for (size_t w{0}; w < sizeof(ethash::hash256) / sizeof(uint64_t); ++w) {
+                    const uint64_t word{state[w][j]};
+                    std::memcpy(&hashes[j].bytes[w * sizeof(uint64_t)], &word, sizeof(uint64_t));
+                }
+            }
+        }
+    }
+
+    [[gnu::target("avx2")]] void keccak256_x4_avx2(const ByteView* inputs, ethash::hash256* hashes) {
+        keccak256_lanes<U64x4, 4>(inputs, hashes);
+    }
+
+    [[gnu::target("avx512f")]] void keccak256_x8_avx512(const ByteView* inputs, ethash::hash256* hashes) {
+        keccak256_lanes<U64x8, 8>(inputs, hashes);
+    }
+
+    size_t supported_lanes() {
+        static const size_t lanes{[]() -> size_t {
+            __builtin_cpu_init();
+            if (__builtin_cpu_supports("avx512f")) {
+                return 8;
+            }
+            if (__builtin_cpu_supports("avx2")) {
+                return 4;
+            }
+            return 1;
+        }()};
+        return lanes;
+    }
+
+}  // namespace
+
+#endif  // SILKWORM_KECCAK_BATCH_SIMD
+
+void keccak256_batch(std::span<const ByteView> inputs, std::span<ethash::hash256> hashes,
+                     [[maybe_unused]] bool use_cpu_extensions) noexcept {
+    SILKWORM_ASSERT(inputs.size() == hashes.size());
+
+    size_t i{0};
+#ifdef SILKWORM_KECCAK_BATCH_SIMD
+    if (use_cpu_extensions) {
+        const size_t lanes{supported_lanes()};
+        if (lanes >= 8) {
+            for (; i + 8 <= inputs.size(); i += 8) {
+                keccak256_x8_avx512(&inputs[i], &hashes[i]);
+            }
+        }
+        if (lanes >= 4) {
+            for (; i + 4 <= inputs.size(); i += 4) {
+                keccak256_x4_avx2(&inputs[i], &hashes[i]);
+            }
+        }
+    }
+#endif  // SILKWORM_KECCAK_BATCH_SIMD
+    for (; i < inputs.size(); ++i) {
+        hashes[i] = keccak256(inputs[i]);
+    }
+}
+
+}  // namespace silkworm
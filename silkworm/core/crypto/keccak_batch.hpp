@@ -0,0 +1,34 @@
+/*
+   Copyright 2023 The Silkworm Authors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#pragma once
+
+#include <span>
+
+#include <ethash/hash_types.hpp>
+
+#include <silkworm/core/common/base.hpp>
+
+namespace silkworm {
+
+//! Computes the Keccak-256 hashes of many independent inputs, i.e. hashes[i] = keccak256(inputs[i]).
+//! When use_cpu_extensions is true and the CPU supports them, inputs are hashed several at a time in SIMD lanes
+//! (8 with AVX-512F, 4 with AVX2), otherwise one at a time.
+//! \remarks Inputs of similar length are best hashed together: the lanes of a group run as long as its longest input
+void keccak256_batch(std::span<const ByteView> inputs, std::span<ethash::hash256> hashes,
+                     bool use_cpu_extensions = true) noexcept;
+
+}  // namespace silkworm
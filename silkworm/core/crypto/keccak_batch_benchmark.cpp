@@ -0,0 +1,63 @@
+/*
+   Copyright 2023 The Silkworm Authors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <silkworm/core/common/util.hpp>
+#include <silkworm/core/crypto/keccak_batch.hpp>
+
+namespace silkworm {
+
+// Batches of 1024 inputs of state.range(0) bytes each, e.g. addresses (20), storage locations (32) and
+// transactions (~110 for a plain transfer, more than one block of 136 bytes otherwise)
+static std::vector<Bytes> sample_inputs(size_t length) {
+    std::vector<Bytes> inputs(1024, Bytes(length, '\0'));
+    for (size_t i{0}; i < inputs.size(); ++i) {
+        for (size_t j{0}; j < length; ++j) {
+            inputs[i][j] = static_cast<uint8_t>(i + j);
+        }
+    }
+    return inputs;
+}
+
+static void keccak256_one_at_a_time(benchmark::State& state) {
+    const auto inputs{sample_inputs(static_cast<size_t>(state.range(0)))};
+    for ([[maybe_unused]] auto _ : state) {
+        for (const auto& input : inputs) {
+            benchmark::DoNotOptimize(keccak256(input));
+        }
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * inputs.size() * inputs[0].size()));
+}
+
+BENCHMARK(keccak256_one_at_a_time)->Arg(20)->Arg(32)->Arg(110)->Arg(300);
+
+static void keccak256_in_batch(benchmark::State& state) {
+    const auto inputs{sample_inputs(static_cast<size_t>(state.range(0)))};
+    const std::vector<ByteView> views(inputs.begin(), inputs.end());
+    std::vector<ethash::hash256> hashes(inputs.size());
+    for ([[maybe_unused]] auto _ : state) {
+        keccak256_batch(views, hashes);
+        benchmark::DoNotOptimize(hashes.data());
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * inputs.size() * inputs[0].size()));
+}
+
+BENCHMARK(keccak256_in_batch)->Arg(20)->Arg(32)->Arg(110)->Arg(300);
+
+}  // namespace silkworm
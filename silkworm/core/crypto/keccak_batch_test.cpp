@@ -0,0 +1,64 @@
+/*
+   Copyright 2023 The Silkworm Authors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#include "keccak_batch.hpp"
+
+#include <vector>
+
+#include <catch2/catch.hpp>
+
+#include <silkworm/core/common/util.hpp>
+
+namespace silkworm {
+
+TEST_CASE("Keccak-256 batch known answers") {
+    const Bytes abc{*from_hex("616263")};  // "abc"
+    const std::vector<ByteView> inputs{{}, abc, {}, abc, abc, {}, abc, {}, abc};
+    std::vector<ethash::hash256> hashes(inputs.size());
+
+    for (const bool use_cpu_extensions : {false, true}) {
+        keccak256_batch(inputs, hashes, use_cpu_extensions);
+        for (size_t i{0}; i < inputs.size(); ++i) {
+            CHECK(to_hex(hashes[i].bytes) == (inputs[i].empty()
+                                                  ? "c5d2460186f7233c927e7db2dcc703c0e500b653ca82273b7bfad8045d85a470"
+                                                  : "4e03657aea45a94fc7d47ba826c8d667c0d1e6e33a64a036ec44f58fa12d6c45"));
+        }
+    }
+}
+
+TEST_CASE("Keccak-256 batch of inputs with different lengths") {
+    // lengths around multiples of the 136-byte rate, so that lanes run for a different number of blocks
+    std::vector<Bytes> buffers;
+    for (size_t length{0}; length < 300; ++length) {
+        Bytes buffer(length, '\0');
+        for (size_t i{0}; i < length; ++i) {
+            buffer[i] = static_cast<uint8_t>(i * 7 + length);
+        }
+        buffers.push_back(std::move(buffer));
+    }
+    const std::vector<ByteView> inputs(buffers.begin(), buffers.end());
+
+    for (const size_t count : {size_t{0}, size_t{1}, size_t{4}, size_t{13}, inputs.size()}) {
+        const auto batch{std::span<const ByteView>{inputs}.first(count)};
+        std::vector<ethash::hash256> hashes(count);
+        keccak256_batch(batch, hashes);
+        for (size_t i{0}; i < count; ++i) {
+            CHECK(to_hex(hashes[i].bytes) == to_hex(keccak256(batch[i]).bytes));
+        }
+    }
+}
+
+}  // namespace silkworm
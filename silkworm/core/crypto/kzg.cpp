@@ -16,8 +16,12 @@
 
 #include "kzg.hpp"
 
+#include <cstring>
+#include <vector>
+
 #include <blst.h>
 
+#include <silkworm/core/common/assert.hpp>
 #include <silkworm/core/crypto/sha256.h>
 #include <silkworm/core/protocol/param.hpp>
 
@@ -66,6 +70,24 @@ Hash kzg_to_versioned_hash(ByteView kzg) {
     return hash;
 }
 
+void kzg_to_versioned_hashes(std::span<const ByteView> kzgs, std::span<Hash> hashes) {
+    SILKWORM_ASSERT(kzgs.size() == hashes.size());
+    std::vector<const uint8_t*> inputs;
+    std::vector<size_t> lengths;
+    inputs.reserve(kzgs.size());
+    lengths.reserve(kzgs.size());
+    for (const ByteView kzg : kzgs) {
+        inputs.push_back(kzg.data());
+        lengths.push_back(kzg.length());
+    }
+    Bytes digests(kzgs.size() * kHashLength, '\0');
+    silkworm_sha256_batch(digests.data(), inputs.data(), lengths.data(), kzgs.size(), /*use_cpu_extensions=*/true);
+    for (size_t i{0}; i < hashes.size(); ++i) {
+        std::memcpy(hashes[i].bytes, &digests[i * kHashLength], kHashLength);
+        hashes[i].bytes[0] = protocol::kBlobCommitmentVersionKzg;
+    }
+}
+
 /**
  * Multiply a G1 group element by a field element.
  *
@@ -29,6 +29,9 @@ namespace silkworm {
 // https://eips.ethereum.org/EIPS/eip-4844#helpers
 Hash kzg_to_versioned_hash(ByteView kzg);
 
+//! Same as kzg_to_versioned_hash for many commitments, i.e. hashes[i] = kzg_to_versioned_hash(kzgs[i])
+void kzg_to_versioned_hashes(std::span<const ByteView> kzgs, std::span<Hash> hashes);
+
 /**
  * Verify a KZG proof claiming that `p(z) == y`.
  *
@@ -449,6 +449,104 @@ __attribute__((target("sha,sse4.1"))) static void sha_256_x86_sha(uint32_t h[8],
 
 #pragma GCC diagnostic pop
 
+/*
+ * Multi-buffer SHA-256: the same round of MULTI_BUFFER_LANES independent messages is computed at once,
+ * one message per 32-bit lane of AVX2 registers. Lanes run in lockstep for as many chunks as the longest message,
+ * so the hash of each lane is saved right after its last chunk and shorter messages just keep hashing zeroes.
+ */
+#define MULTI_BUFFER_LANES 8
+
+typedef uint32_t u32x8 __attribute__((vector_size(32)));
+
+#define RIGHT_ROT_X8(value, count) ((value) >> (count) | (value) << (32 - (count)))
+
+static bool sha_256_multi_buffer_available = false;
+
+__attribute__((target("avx2"))) static void sha_256_x86_avx2_x8(uint32_t h[MULTI_BUFFER_LANES][8],
+                                                                 const uint8_t* const input[MULTI_BUFFER_LANES],
+                                                                 const size_t len[MULTI_BUFFER_LANES]) {
+    struct buffer_state state[MULTI_BUFFER_LANES];
+    size_t chunks[MULTI_BUFFER_LANES];
+    size_t max_chunks = 0;
+    unsigned i, j, l;
+
+    for (l = 0; l < MULTI_BUFFER_LANES; l++) {
+        init_buf_state(&state[l], input[l], len[l]);
+        /* Message, single one bit and total length, rounded up to whole chunks */
+        chunks[l] = (len[l] + 1 + TOTAL_LEN_LEN + CHUNK_SIZE - 1) / CHUNK_SIZE;
+        if (chunks[l] > max_chunks) {
+            max_chunks = chunks[l];
+        }
+    }
+
+    u32x8 hv[8];
+    for (i = 0; i < 8; i++) {
+        for (l = 0; l < MULTI_BUFFER_LANES; l++) {
+            hv[i][l] = h[l][i];
+        }
+    }
+
+    uint8_t chunk[CHUNK_SIZE];
+
+    for (size_t c = 0; c < max_chunks; c++) {
+        u32x8 w[16];
+        for (l = 0; l < MULTI_BUFFER_LANES; l++) {
+            if (!calc_chunk(chunk, &state[l])) {
+                memset(chunk, 0x00, CHUNK_SIZE);
+            }
+            const uint8_t* p = chunk;
+            for (j = 0; j < 16; j++, p += 4) {
+                w[j][l] = (uint32_t)p[0] << 24 | (uint32_t)p[1] << 16 | (uint32_t)p[2] << 8 | (uint32_t)p[3];
+            }
+        }
+
+        u32x8 ah[8];
+        for (i = 0; i < 8; i++) {
+            ah[i] = hv[i];
+        }
+
+        /* Same compression function as sha_256_implementation, vectorized over lanes */
+        for (i = 0; i < 4; i++) {
+            for (j = 0; j < 16; j++) {
+                if (i > 0) {
+                    const u32x8 s0 = RIGHT_ROT_X8(w[(j + 1) & 0xf], 7) ^ RIGHT_ROT_X8(w[(j + 1) & 0xf], 18) ^
+                                     (w[(j + 1) & 0xf] >> 3);
+                    const u32x8 s1 = RIGHT_ROT_X8(w[(j + 14) & 0xf], 17) ^ RIGHT_ROT_X8(w[(j + 14) & 0xf], 19) ^
+                                     (w[(j + 14) & 0xf] >> 10);
+                    w[j] = w[j] + s0 + w[(j + 9) & 0xf] + s1;
+                }
+                const u32x8 s1 = RIGHT_ROT_X8(ah[4], 6) ^ RIGHT_ROT_X8(ah[4], 11) ^ RIGHT_ROT_X8(ah[4], 25);
+                const u32x8 ch = (ah[4] & ah[5]) ^ (~ah[4] & ah[6]);
+                const u32x8 temp1 = ah[7] + s1 + ch + k[i << 4 | j] + w[j];
+                const u32x8 s0 = RIGHT_ROT_X8(ah[0], 2) ^ RIGHT_ROT_X8(ah[0], 13) ^ RIGHT_ROT_X8(ah[0], 22);
+                const u32x8 maj = (ah[0] & ah[1]) ^ (ah[0] & ah[2]) ^ (ah[1] & ah[2]);
+                const u32x8 temp2 = s0 + maj;
+
+                ah[7] = ah[6];
+                ah[6] = ah[5];
+                ah[5] = ah[4];
+                ah[4] = ah[3] + temp1;
+                ah[3] = ah[2];
+                ah[2] = ah[1];
+                ah[1] = ah[0];
+                ah[0] = temp1 + temp2;
+            }
+        }
+
+        for (i = 0; i < 8; i++) {
+            hv[i] += ah[i];
+        }
+
+        for (l = 0; l < MULTI_BUFFER_LANES; l++) {
+            if (c + 1 == chunks[l]) {
+                for (i = 0; i < 8; i++) {
+                    h[l][i] = hv[i][l];
+                }
+            }
+        }
+    }
+}
+
 // https://stackoverflow.com/questions/6121792/how-to-check-if-a-cpu-supports-the-sse3-instruction-set
 static void cpuid(int info[4], int InfoType) {
     __cpuid_count(InfoType, 0, info[0], info[1], info[2], info[3]);
@@ -480,6 +578,10 @@ __attribute__((constructor)) static void select_sha256_implementation(void) {
     } else if (hw_bmi1 && hw_bmi2) {
         sha_256_best = sha_256_x86_bmi;
     }
+
+    // SHA extensions hash one message faster than AVX2 lanes hash several of them
+    __builtin_cpu_init();
+    sha_256_multi_buffer_available = !(hw_sse41 && hw_sha) && __builtin_cpu_supports("avx2");
 }
 
 #elif defined(__aarch64__) && defined(__APPLE__)
@@ -672,6 +774,23 @@ __attribute__((constructor)) static void select_sha256_implementation(void) {
 
 #endif  // defined(__x86_64__), defined(__aarch64__)
 
+/*
+ * Initial hash values:
+ * (first 32 bits of the fractional parts of the square roots of the first 8 primes 2..19):
+ */
+static const uint32_t h0[8] = {0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a,
+                               0x510e527f, 0x9b05688c, 0x1f83d9ab, 0x5be0cd19};
+
+/* Produce the final hash value (big-endian): */
+static void store_hash(uint8_t hash[32], const uint32_t h[8]) {
+    for (unsigned i = 0, j = 0; i < 8; i++) {
+        hash[j++] = (uint8_t)(h[i] >> 24);
+        hash[j++] = (uint8_t)(h[i] >> 16);
+        hash[j++] = (uint8_t)(h[i] >> 8);
+        hash[j++] = (uint8_t)h[i];
+    }
+}
+
 /*
  * Limitations:
  * - Since input is a pointer in RAM, the data to hash should be in RAM, which could be a problem
@@ -681,11 +800,8 @@ __attribute__((constructor)) static void select_sha256_implementation(void) {
  *   In particular, the len parameter is a number of bytes.
  */
 void silkworm_sha256(uint8_t hash[32], const uint8_t* input, size_t len, bool use_cpu_extensions) {
-    /*
-     * Initialize hash values:
-     * (first 32 bits of the fractional parts of the square roots of the first 8 primes 2..19):
-     */
-    uint32_t h[] = {0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a, 0x510e527f, 0x9b05688c, 0x1f83d9ab, 0x5be0cd19};
+    uint32_t h[8];
+    memcpy(h, h0, sizeof(h));
 
     if (use_cpu_extensions) {
         sha_256_best(h, input, len);
@@ -693,11 +809,29 @@ void silkworm_sha256(uint8_t hash[32], const uint8_t* input, size_t len, bool us
         sha_256_generic(h, input, len);
     }
 
-    /* Produce the final hash value (big-endian): */
-    for (unsigned i = 0, j = 0; i < 8; i++) {
-        hash[j++] = (uint8_t)(h[i] >> 24);
-        hash[j++] = (uint8_t)(h[i] >> 16);
-        hash[j++] = (uint8_t)(h[i] >> 8);
-        hash[j++] = (uint8_t)h[i];
+    store_hash(hash, h);
+}
+
+void silkworm_sha256_batch(uint8_t* hashes, const uint8_t* const* inputs, const size_t* lengths, size_t count,
+                           bool use_cpu_extensions) {
+    size_t n = 0;
+
+#if defined(__x86_64__)
+    if (use_cpu_extensions && sha_256_multi_buffer_available) {
+        for (; n + MULTI_BUFFER_LANES <= count; n += MULTI_BUFFER_LANES) {
+            uint32_t h[MULTI_BUFFER_LANES][8];
+            for (unsigned l = 0; l < MULTI_BUFFER_LANES; l++) {
+                memcpy(h[l], h0, sizeof(h0));
+            }
+            sha_256_x86_avx2_x8(h, inputs + n, lengths + n);
+            for (unsigned l = 0; l < MULTI_BUFFER_LANES; l++) {
+                store_hash(hashes + (n + l) * 32, h[l]);
+            }
+        }
+    }
+#endif  // defined(__x86_64__)
+
+    for (; n < count; n++) {
+        silkworm_sha256(hashes + n * 32, inputs[n], lengths[n], use_cpu_extensions);
     }
 }
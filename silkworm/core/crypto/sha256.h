@@ -26,6 +26,11 @@ extern "C" {
 
 void silkworm_sha256(uint8_t hash[32], const uint8_t* input, size_t len, bool use_cpu_extensions);
 
+// Hashes count independent inputs, writing the 32-byte hash of inputs[i] at hashes + 32 * i.
+// On CPUs with AVX2 but w/o SHA extensions, several inputs are hashed at once in SIMD lanes.
+void silkworm_sha256_batch(uint8_t* hashes, const uint8_t* const* inputs, const size_t* lengths, size_t count,
+                           bool use_cpu_extensions);
+
 #if defined(__cplusplus)
 }
 #endif
@@ -14,6 +14,8 @@
    limitations under the License.
 */
 
+#include <vector>
+
 #include <catch2/catch.hpp>
 
 #include <silkworm/core/common/util.hpp>
@@ -44,4 +46,32 @@ TEST_CASE("SHA256 sample") {
     CHECK(to_hex(hash, 32) == "0x7303caef875be8c39b2c2f1905ea24adcc024bef6830a965fe05370f3170dc52");
 }
 
+TEST_CASE("SHA256 batch") {
+    // lengths spanning one to several chunks, with and without room for the total length in the last one
+    std::vector<Bytes> buffers;
+    for (size_t n{0}; n < 203; ++n) {
+        Bytes buffer((n * 37) % 300, '\0');
+        for (size_t i{0}; i < buffer.size(); ++i) {
+            buffer[i] = static_cast<uint8_t>(i * 13 + n);
+        }
+        buffers.push_back(std::move(buffer));
+    }
+    std::vector<const uint8_t*> inputs;
+    std::vector<size_t> lengths;
+    for (const auto& buffer : buffers) {
+        inputs.push_back(buffer.data());
+        lengths.push_back(buffer.size());
+    }
+
+    for (const bool use_cpu_extensions : {false, true}) {
+        Bytes hashes(buffers.size() * 32, '\0');
+        silkworm_sha256_batch(hashes.data(), inputs.data(), lengths.data(), buffers.size(), use_cpu_extensions);
+        for (size_t n{0}; n < buffers.size(); ++n) {
+            uint8_t hash[32];
+            silkworm_sha256(hash, buffers[n].data(), buffers[n].size(), /*use_cpu_extensions=*/false);
+            CHECK(to_hex(ByteView{&hashes[n * 32], 32}) == to_hex(hash));
+        }
+    }
+}
+
 }  // namespace silkworm
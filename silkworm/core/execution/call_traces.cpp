@@ -0,0 +1,49 @@
+/*
+   Copyright 2023 The Silkworm Authors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#include "call_traces.hpp"
+
+namespace silkworm {
+
+void CallTraces::add_call(const evmc_message& message) {
+    if (message.kind == EVMC_DELEGATECALL || message.kind == EVMC_CALLCODE) {
+        // The code of another account is run in the context of the recipient, which is the actual caller
+        senders.insert(message.recipient);
+        recipients.insert(message.code_address);
+    } else {
+        senders.insert(message.sender);
+        recipients.insert(message.recipient);
+    }
+}
+
+void CallTraces::add_selfdestruct(const evmc::address& address, const evmc::address& beneficiary) {
+    senders.insert(address);
+    recipients.insert(beneficiary);
+}
+
+void CallTraces::add_beneficiaries(const Block& block) {
+    recipients.insert(block.header.beneficiary);
+    for (const BlockHeader& ommer : block.ommers) {
+        recipients.insert(ommer.beneficiary);
+    }
+}
+
+void CallTraces::clear() {
+    senders.clear();
+    recipients.clear();
+}
+
+}  // namespace silkworm
@@ -0,0 +1,45 @@
+/*
+   Copyright 2023 The Silkworm Authors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#pragma once
+
+#include <evmc/evmc.hpp>
+
+#include <silkworm/core/common/base.hpp>
+#include <silkworm/core/common/hash_maps.hpp>
+#include <silkworm/core/types/block.hpp>
+
+namespace silkworm {
+
+//! The accounts involved in the calls executed within a block, either as call senders or as call recipients
+//! \remarks Erigon CallTracer, fed by EVM::call_traces hooks instead of an EVM tracer to keep the fast execution paths
+struct CallTraces {
+    FlatHashSet<evmc::address> senders;
+    FlatHashSet<evmc::address> recipients;
+
+    //! Add caller and callee of a call (precompiles included) or contract creation
+    void add_call(const evmc_message& message);
+
+    //! Add the self-destructing contract as sender and the beneficiary of its balance as recipient
+    void add_selfdestruct(const evmc::address& address, const evmc::address& beneficiary);
+
+    //! Add the beneficiaries of block and ommer rewards as recipients
+    void add_beneficiaries(const Block& block);
+
+    void clear();
+};
+
+}  // namespace silkworm
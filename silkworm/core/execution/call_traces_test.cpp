@@ -0,0 +1,137 @@
+/*
+   Copyright 2023 The Silkworm Authors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#include "call_traces.hpp"
+
+#include <catch2/catch.hpp>
+
+#include <silkworm/core/common/util.hpp>
+#include <silkworm/core/execution/evm.hpp>
+#include <silkworm/core/state/in_memory_state.hpp>
+
+namespace silkworm {
+
+TEST_CASE("EVM collects call senders and recipients") {
+    Block block{};
+    block.header.number = 1'639'560;
+    evmc::address caller_address{0x8e4d1ea201b908ab5e1f5a1c3f9f1b4f6c1e9cf1_address};
+    evmc::address callee_address{0x3589d05a1ec4af9f65b0e5554e645707775ee43c_address};
+
+    // The callee writes the ADDRESS to storage.
+    Bytes callee_code{*from_hex("30600055")};
+
+    // The caller delegate-calls the input contract.
+    Bytes caller_code{*from_hex("6000808080803561eeeef4")};
+
+    InMemoryState db;
+    IntraBlockState state{db};
+    state.set_code(caller_address, caller_code);
+    state.set_code(callee_address, callee_code);
+
+    EVM evm{block, state, kMainnetConfig};
+
+    CallTraces traces;
+    evm.call_traces = &traces;
+
+    Transaction txn{};
+    txn.from = caller_address;
+    txn.to = caller_address;
+    txn.data = ByteView{to_bytes32(callee_address)};
+
+    uint64_t gas{1'000'000};
+    CallResult res{evm.execute(txn, gas)};
+    CHECK(res.status == EVMC_SUCCESS);
+
+    CHECK(traces.senders.size() == 1);
+    CHECK(traces.senders.contains(caller_address));
+    CHECK(traces.recipients.size() == 2);
+    CHECK(traces.recipients.contains(caller_address));
+    CHECK(traces.recipients.contains(callee_address));
+
+    traces.clear();
+    CHECK(traces.senders.empty());
+    CHECK(traces.recipients.empty());
+}
+
+TEST_CASE("EVM collects precompile callees and self-destruct beneficiaries") {
+    Block block{};
+    block.header.number = 10'336'006;
+    evmc::address sender{0x0a6bb546b9208cfab9e8fa2b9b2c042b18df7030_address};
+    evmc::address caller_address{0x8e4d1ea201b908ab5e1f5a1c3f9f1b4f6c1e9cf1_address};
+    evmc::address identity_address{0x0000000000000000000000000000000000000004_address};
+    evmc::address beneficiary{0x5a0b54d5dc17e0aadc383d2db43b0a0d3e029c4c_address};
+
+    InMemoryState db;
+    IntraBlockState state{db};
+    EVM evm{block, state, kMainnetConfig};
+    CallTraces traces;
+    evm.call_traces = &traces;
+
+    Transaction txn{};
+    txn.from = sender;
+    txn.to = caller_address;
+    uint64_t gas{1'000'000};
+
+    SECTION("precompile") {
+        // The caller calls the identity precompile w/o input nor output
+        state.set_code(caller_address, *from_hex("6000600060006000600060045af1"));
+
+        CallResult res{evm.execute(txn, gas)};
+        CHECK(res.status == EVMC_SUCCESS);
+        CHECK(traces.senders.size() == 2);
+        CHECK(traces.senders.contains(sender));
+        CHECK(traces.senders.contains(caller_address));
+        CHECK(traces.recipients.size() == 2);
+        CHECK(traces.recipients.contains(caller_address));
+        CHECK(traces.recipients.contains(identity_address));
+    }
+
+    SECTION("self-destruct") {
+        // The caller self-destructs sending its balance to the beneficiary
+        state.set_code(caller_address, *from_hex("735a0b54d5dc17e0aadc383d2db43b0a0d3e029c4cff"));
+
+        CallResult res{evm.execute(txn, gas)};
+        CHECK(res.status == EVMC_SUCCESS);
+        CHECK(traces.senders.contains(caller_address));
+        CHECK(traces.recipients.contains(beneficiary));
+    }
+
+    SECTION("not collected w/o call traces") {
+        state.set_code(caller_address, *from_hex("6000600060006000600060045af1"));
+        evm.call_traces = nullptr;
+
+        CallResult res{evm.execute(txn, gas)};
+        CHECK(res.status == EVMC_SUCCESS);
+        CHECK(traces.senders.empty());
+        CHECK(traces.recipients.empty());
+    }
+}
+
+TEST_CASE("CallTraces::add_beneficiaries") {
+    Block block{};
+    block.header.beneficiary = 0x5a0b54d5dc17e0aadc383d2db43b0a0d3e029c4c_address;
+    block.ommers.resize(1);
+    block.ommers[0].beneficiary = 0x0a6bb546b9208cfab9e8fa2b9b2c042b18df7030_address;
+
+    CallTraces traces;
+    traces.add_beneficiaries(block);
+    CHECK(traces.senders.empty());
+    CHECK(traces.recipients.size() == 2);
+    CHECK(traces.recipients.contains(block.header.beneficiary));
+    CHECK(traces.recipients.contains(block.ommers[0].beneficiary));
+}
+
+}  // namespace silkworm
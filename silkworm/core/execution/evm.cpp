@@ -29,6 +29,7 @@
 #include <evmone/vm.hpp>
 
 #include <silkworm/core/execution/address.hpp>
+#include <silkworm/core/execution/call_traces.hpp>
 #include <silkworm/core/execution/precompile.hpp>
 #include <silkworm/core/protocol/param.hpp>
 
@@ -151,6 +152,10 @@ evmc::Result EVM::create(const evmc_message& message) noexcept {
         .create2_salt = message.create2_salt,
     };
 
+    if (call_traces) {
+        call_traces->add_call(deploy_message);
+    }
+
     auto evm_res{execute(deploy_message, ByteView{message.input_data, message.input_size}, /*code_hash=*/nullptr)};
 
     if (evm_res.status_code == EVMC_SUCCESS) {
@@ -198,6 +203,10 @@ evmc::Result EVM::call(const evmc_message& message) noexcept {
         return res;
     }
 
+    if (call_traces) {
+        call_traces->add_call(message);
+    }
+
     const auto snapshot{state_.take_snapshot()};
 
     if (message.kind == EVMC_CALL) {
@@ -434,6 +443,9 @@ size_t EvmHost::copy_code(const evmc::address& address, size_t code_offset, uint
 }
 
 bool EvmHost::selfdestruct(const evmc::address& address, const evmc::address& beneficiary) noexcept {
+    if (evm_.call_traces) {
+        evm_.call_traces->add_selfdestruct(address, beneficiary);
+    }
     const bool recorded{evm_.state().record_suicide(address)};
     evm_.state().add_to_balance(beneficiary, evm_.state().get_balance(address));
     evm_.state().set_balance(address, 0);
@@ -33,6 +33,8 @@
 
 namespace silkworm {
 
+struct CallTraces;
+
 struct CallResult {
     evmc_status_code status{EVMC_SUCCESS};
     uint64_t gas_left{0};
@@ -92,6 +94,7 @@ class EVM {
 
     AnalysisCache* analysis_cache{nullptr};                   // provide one for better performance
     ObjectPool<evmone::ExecutionState>* state_pool{nullptr};  // ditto
+    CallTraces* call_traces{nullptr};                         // provide one to collect the accounts involved in calls
 
     evmc_vm* exo_evm{nullptr};  // it's possible to use an exogenous EVMC VM
 
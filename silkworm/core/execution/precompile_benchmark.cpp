@@ -14,9 +14,12 @@
    limitations under the License.
 */
 
+#include <vector>
+
 #include <benchmark/benchmark.h>
 
 #include <silkworm/core/common/util.hpp>
+#include <silkworm/core/crypto/kzg.hpp>
 #include <silkworm/core/execution/precompile.hpp>
 
 static void ec_recovery(benchmark::State& state) {
@@ -31,3 +34,120 @@ static void ec_recovery(benchmark::State& state) {
 }
 
 BENCHMARK(ec_recovery);
+
+static void expmod(benchmark::State& state) {
+    using namespace silkworm;
+    Bytes in{
+        *from_hex("0000000000000000000000000000000000000000000000000000000000000001"
+                  "0000000000000000000000000000000000000000000000000000000000000020"
+                  "0000000000000000000000000000000000000000000000000000000000000020"
+                  "03"
+                  "fffffffffffffffffffffffffffffffffffffffffffffffffffffffefffffc2e"
+                  "fffffffffffffffffffffffffffffffffffffffffffffffffffffffefffffc2f")};
+    for (auto _ : state) {
+        precompile::expmod_run(in);
+    }
+}
+
+BENCHMARK(expmod);
+
+static void bn_add(benchmark::State& state) {
+    using namespace silkworm;
+    Bytes in{
+        *from_hex("00000000000000000000000000000000000000000000000000000000000000010000000000000000000000000000"
+                  "00000000000000000000000000000000000200000000000000000000000000000000000000000000000000000000"
+                  "000000010000000000000000000000000000000000000000000000000000000000000002")};
+    for (auto _ : state) {
+        precompile::bn_add_run(in);
+    }
+}
+
+BENCHMARK(bn_add);
+
+static void bn_mul(benchmark::State& state) {
+    using namespace silkworm;
+    Bytes in{
+        *from_hex("1a87b0584ce92f4593d161480614f2989035225609f08058ccfa3d0f940febe31a2f3c951f6dadcc7ee"
+                  "9007dff81504b0fcd6d7cf59996efdc33d92bf7f9f8f600000000000000000000000000000000000000"
+                  "00000000000000000000000009")};
+    for (auto _ : state) {
+        precompile::bn_mul_run(in);
+    }
+}
+
+BENCHMARK(bn_mul);
+
+static void snarkv(benchmark::State& state) {
+    using namespace silkworm;
+    Bytes in{
+        *from_hex("0f25929bcb43d5a57391564615c9e70a992b10eafa4db109709649cf48c50dd216da2f5cb6be7a0aa72c440c53c9"
+                  "bbdfec6c36c7d515536431b3a865468acbba2e89718ad33c8bed92e210e81d1853435399a271913a6520736a4729"
+                  "cf0d51eb01a9e2ffa2e92599b68e44de5bcf354fa2642bd4f26b259daa6f7ce3ed57aeb314a9a87b789a58af499b"
+                  "314e13c3d65bede56c07ea2d418d6874857b70763713178fb49a2d6cd347dc58973ff49613a20757d0fcc22079f9"
+                  "abd10c3baee245901b9e027bd5cfc2cb5db82d4dc9677ac795ec500ecd47deee3b5da006d6d049b811d7511c7815"
+                  "8de484232fc68daf8a45cf217d1c2fae693ff5871e8752d73b21198e9393920d483a7260bfb731fb5d25f1aa4933"
+                  "35a9e71297e485b7aef312c21800deef121f1e76426a00665e5c4479674322d4f75edadd46debd5cd992f6ed0906"
+                  "89d0585ff075ec9e99ad690c3395bc4b313370b38ef355acdadcd122975b12c85ea5db8c6deb4aab71808dcb408f"
+                  "e3d1e7690c43d37b4ce6cc0166fa7daa")};
+    for (auto _ : state) {
+        precompile::snarkv_run(in);
+    }
+}
+
+BENCHMARK(snarkv);
+
+static void blake2_f(benchmark::State& state) {
+    using namespace silkworm;
+    Bytes in{
+        *from_hex("0000000c48c9bdf267e6096a3ba7ca8485ae67bb2bf894fe72f36e3cf1361d5f3af54fa5d182e6ad7f520e511f6c"
+                  "3e2b8c68059b6bbd41fbabd9831f79217e1319cde05b616263000000000000000000000000000000000000000000"
+                  "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000"
+                  "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000"
+                  "0000000000000000000000000300000000000000000000000000000001")};
+    for (auto _ : state) {
+        precompile::blake2_f_run(in);
+    }
+}
+
+BENCHMARK(blake2_f);
+
+static void point_evaluation(benchmark::State& state) {
+    using namespace silkworm;
+    Bytes in{
+        *from_hex("013c03613f6fc558fb7e61e75602241ed9a2f04e36d8670aadd286e71b5ca9cc"
+                  "0000000000000000000000000000000000000000000000000000000000000042"
+                  "3c8e9f367d9c417c78ca1700993dae1987f44bd5e8ea33a7f62ebc6c35a2e531"
+                  "83fac17c3f237fc51f90e2c660eb202a438bc2025baded5cd193c1a018c5885bc9281ba704d5566082e851235c7be763"
+                  "b2a99adff965e0a121ee972ebc472d02944a74f5c6243e14052e105124b70bf65faf85ad3a494325e269fad097842cba")};
+    for (auto _ : state) {
+        precompile::point_evaluation_run(in);
+    }
+}
+
+BENCHMARK(point_evaluation);
+
+// SHA-256 precompile over inputs of state.range(0) bytes, e.g. 64 for the node hashing of deposit contracts
+static void sha256(benchmark::State& state) {
+    using namespace silkworm;
+    const Bytes in(static_cast<size_t>(state.range(0)), 0x5a);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(precompile::sha256_run(in));
+    }
+    state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+
+BENCHMARK(sha256)->Arg(64)->Arg(1024)->Arg(16 * 1024);
+
+// Versioned hashes of blob commitments (48 bytes each), hashed together at once
+static void kzg_versioned_hashes(benchmark::State& state) {
+    using namespace silkworm;
+    const std::vector<Bytes> commitments(static_cast<size_t>(state.range(0)), Bytes(48, 0xc0));
+    const std::vector<ByteView> kzgs(commitments.begin(), commitments.end());
+    std::vector<Hash> hashes(kzgs.size());
+    for (auto _ : state) {
+        kzg_to_versioned_hashes(kzgs, hashes);
+        benchmark::DoNotOptimize(hashes.data());
+    }
+}
+
+BENCHMARK(kzg_versioned_hashes)->Arg(6)->Arg(64);
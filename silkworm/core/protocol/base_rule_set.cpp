@@ -94,7 +94,8 @@ ValidationResult BaseRuleSet::validate_ommers(const Block& block, const BlockSta
     std::optional<BlockHeader> parent{get_parent_header(state, header)};
 
     for (const BlockHeader& ommer : block.ommers) {
-        if (ValidationResult err{validate_block_header(ommer, state, /*with_future_timestamp_check=*/false)};
+        if (ValidationResult err{validate_block_header(ommer, state, /*with_future_timestamp_check=*/false,
+                                                   /*with_seal_check=*/true)};
             err != ValidationResult::kOk) {
             return ValidationResult::kInvalidOmmerHeader;
         }
@@ -112,7 +113,7 @@ ValidationResult BaseRuleSet::validate_ommers(const Block& block, const BlockSta
 }
 
 ValidationResult BaseRuleSet::validate_block_header(const BlockHeader& header, const BlockState& state,
-                                                    bool with_future_timestamp_check) {
+                                                    bool with_future_timestamp_check, bool with_seal_check) {
     if (with_future_timestamp_check) {
         const std::time_t now{std::time(nullptr)};
         if (header.timestamp > static_cast<uint64_t>(now)) {
@@ -192,6 +193,9 @@ ValidationResult BaseRuleSet::validate_block_header(const BlockHeader& header, c
         return ValidationResult::kWrongExcessDataGas;
     }
 
+    if (!with_seal_check) {
+        return ValidationResult::kOk;
+    }
     return validate_seal(header);
 }
 
@@ -0,0 +1,72 @@
+/*
+   Copyright 2023 The Silkworm Authors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#include "ethash_epoch_cache.hpp"
+
+#include <algorithm>
+
+#ifndef __wasm__
+#define SILKWORM_DETAIL_ETHASH_EPOCH_CACHE_GUARD(lock, m) std::scoped_lock lock{m};
+#else
+#define SILKWORM_DETAIL_ETHASH_EPOCH_CACHE_GUARD(lock, m)
+#endif
+
+namespace silkworm::protocol {
+
+EthashEpochCache& EthashEpochCache::instance() {
+    static EthashEpochCache cache;
+    return cache;
+}
+
+EthashEpochCache::EpochContextPtr EthashEpochCache::find(int epoch_number) {
+    SILKWORM_DETAIL_ETHASH_EPOCH_CACHE_GUARD(lock, mutex_)
+    auto it{std::find_if(contexts_.begin(), contexts_.end(), [&](const auto& entry) { return entry.first == epoch_number; })};
+    if (it == contexts_.end()) {
+        return nullptr;
+    }
+    // Mark as most recently used
+    std::rotate(it, it + 1, contexts_.end());
+    return contexts_.back().second;
+}
+
+bool EthashEpochCache::contains(int epoch_number) const {
+    SILKWORM_DETAIL_ETHASH_EPOCH_CACHE_GUARD(lock, mutex_)
+    return std::any_of(contexts_.begin(), contexts_.end(), [&](const auto& entry) { return entry.first == epoch_number; });
+}
+
+EthashEpochCache::EpochContextPtr EthashEpochCache::get(int epoch_number) {
+    if (EpochContextPtr context{find(epoch_number)}) {
+        return context;
+    }
+
+    // Build one context at a time: whoever misses the same epoch waits for the ongoing build instead of repeating it
+    SILKWORM_DETAIL_ETHASH_EPOCH_CACHE_GUARD(build_lock, build_mutex_)
+    if (EpochContextPtr context{find(epoch_number)}) {
+        return context;
+    }
+
+    EpochContextPtr context{ethash::create_epoch_context(epoch_number).release(), ethash_destroy_epoch_context};
+
+    SILKWORM_DETAIL_ETHASH_EPOCH_CACHE_GUARD(lock, mutex_)
+    contexts_.emplace_back(epoch_number, context);
+    if (contexts_.size() > kMaxEpochs) {
+        // Contexts still in use are released by their last user
+        contexts_.erase(contexts_.begin());
+    }
+    return context;
+}
+
+}  // namespace silkworm::protocol
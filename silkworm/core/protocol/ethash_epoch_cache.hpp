@@ -0,0 +1,64 @@
+/*
+   Copyright 2023 The Silkworm Authors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#ifndef __wasm__
+#include <mutex>
+#endif
+
+#include <ethash/ethash.hpp>
+
+namespace silkworm::protocol {
+
+//! \brief Cache of ethash epoch contexts shared by all the EthashRuleSet instances.
+//! \details Building an epoch context takes seconds, so it is shared between the threads verifying seals in parallel,
+//! and the context of the next epoch can be built ahead of time by calling get() in the background.
+//! \remarks Thread-safe (except in WASM builds, which are single-threaded)
+class EthashEpochCache {
+  public:
+    using EpochContextPtr = std::shared_ptr<const ethash::epoch_context>;
+
+    //! \brief Current and next epoch
+    static constexpr size_t kMaxEpochs{2};
+
+    //! \brief The process-wide cache
+    static EthashEpochCache& instance();
+
+    //! \brief Returns the context of the given epoch, building it if missing.
+    //! Concurrent callers missing the same epoch wait for a single build.
+    EpochContextPtr get(int epoch_number);
+
+    [[nodiscard]] bool contains(int epoch_number) const;
+
+  private:
+    EpochContextPtr find(int epoch_number);
+
+    // Least recently used first
+    std::vector<std::pair<int, EpochContextPtr>> contexts_;
+
+#ifndef __wasm__
+    mutable std::mutex mutex_;
+    std::mutex build_mutex_;
+#endif
+};
+
+}  // namespace silkworm::protocol
@@ -0,0 +1,68 @@
+/*
+   Copyright 2023 The Silkworm Authors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#include "ethash_epoch_cache.hpp"
+
+#include <thread>
+#include <vector>
+
+#include <catch2/catch.hpp>
+
+namespace silkworm::protocol {
+
+TEST_CASE("EthashEpochCache") {
+    EthashEpochCache cache;
+    CHECK_FALSE(cache.contains(0));
+
+    SECTION("get") {
+        const auto context{cache.get(0)};
+        REQUIRE(context);
+        CHECK(context->epoch_number == 0);
+        CHECK(cache.contains(0));
+        CHECK(cache.get(0) == context);
+    }
+
+    SECTION("least recently used epochs are evicted") {
+        const auto context0{cache.get(0)};
+        cache.get(1);
+        cache.get(0);
+        cache.get(2);
+        CHECK(cache.contains(0));
+        CHECK_FALSE(cache.contains(1));
+        CHECK(cache.contains(2));
+
+        cache.get(1);
+        CHECK_FALSE(cache.contains(0));
+        // still usable by whoever holds it
+        CHECK(context0->epoch_number == 0);
+    }
+
+    SECTION("concurrent get builds once") {
+        std::vector<EthashEpochCache::EpochContextPtr> contexts(4);
+        std::vector<std::thread> threads;
+        for (auto& context : contexts) {
+            threads.emplace_back([&cache, &context] { context = cache.get(0); });
+        }
+        for (auto& thread : threads) {
+            thread.join();
+        }
+        for (const auto& context : contexts) {
+            CHECK(context == contexts[0]);
+        }
+    }
+}
+
+}  // namespace silkworm::protocol
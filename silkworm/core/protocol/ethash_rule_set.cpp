@@ -18,6 +18,7 @@
 
 #include <silkworm/core/common/endian.hpp>
 
+#include "ethash_epoch_cache.hpp"
 #include "param.hpp"
 
 namespace silkworm::protocol {
@@ -25,10 +26,7 @@ namespace silkworm::protocol {
 // Ethash ProofOfWork verification
 ValidationResult EthashRuleSet::validate_seal(const BlockHeader& header) {
     const int epoch_number{static_cast<int>(header.number / ethash::epoch_length)};
-    if (!epoch_context_ || epoch_context_->epoch_number != epoch_number) {
-        epoch_context_.reset();  // Firstly release the obsoleted context
-        epoch_context_ = ethash::create_epoch_context(epoch_number);
-    }
+    const auto epoch_context{EthashEpochCache::instance().get(epoch_number)};
 
     const auto nonce{endian::load_big_u64(header.nonce.data())};
     const auto seal_hash(header.hash(/*for_sealing =*/true));
@@ -36,7 +34,7 @@ ValidationResult EthashRuleSet::validate_seal(const BlockHeader& header) {
     const auto sealh256{ethash::hash256_from_bytes(seal_hash.bytes)};
     const auto mixh256{ethash::hash256_from_bytes(header.prev_randao.bytes)};
 
-    const auto ec{ethash::verify_against_difficulty(*epoch_context_, sealh256, mixh256, nonce, diff256)};
+    const auto ec{ethash::verify_against_difficulty(*epoch_context, sealh256, mixh256, nonce, diff256)};
     return ec ? ValidationResult::kInvalidSeal : ValidationResult::kOk;
 }
 
@@ -35,6 +35,7 @@ class EthashRuleSet : public BaseRuleSet {
     explicit EthashRuleSet(const ChainConfig& chain_config) : BaseRuleSet(chain_config, /*prohibit_ommers=*/false) {}
 
     //! \brief Validates the seal of the header
+    //! \remarks Thread-safe, epoch contexts are taken from EthashEpochCache
     ValidationResult validate_seal(const BlockHeader& header) override;
 
     //! \brief See [YP] Section 11.3 "Reward Application".
@@ -53,9 +54,6 @@ class EthashRuleSet : public BaseRuleSet {
 
   protected:
     intx::uint256 difficulty(const BlockHeader& header, const BlockHeader& parent) override;
-
-  private:
-    ethash::epoch_context_ptr epoch_context_{nullptr, ethash_destroy_epoch_context};
 };
 
 std::ostream& operator<<(std::ostream& out, const BlockReward& reward);
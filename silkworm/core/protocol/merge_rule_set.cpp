@@ -34,7 +34,7 @@ ValidationResult MergeRuleSet::pre_validate_block_body(const Block& block, const
 }
 
 ValidationResult MergeRuleSet::validate_block_header(const BlockHeader& header, const BlockState& state,
-                                                     bool with_future_timestamp_check) {
+                                                     bool with_future_timestamp_check, bool with_seal_check) {
     // TODO (Andrew) how will all this work with backwards sync?
 
     const std::optional<BlockHeader> parent{BaseRuleSet::get_parent_header(state, header)};
@@ -53,14 +53,14 @@ ValidationResult MergeRuleSet::validate_block_header(const BlockHeader& header,
         if (ttd_reached) {
             return ValidationResult::kPoWBlockAfterMerge;
         }
-        return pre_merge_rule_set_->validate_block_header(header, state, with_future_timestamp_check);
+        return pre_merge_rule_set_->validate_block_header(header, state, with_future_timestamp_check, with_seal_check);
     }
 
     // PoS block
     if (!ttd_reached) {
         return ValidationResult::kPoSBlockBeforeMerge;
     }
-    return BaseRuleSet::validate_block_header(header, state, with_future_timestamp_check);
+    return BaseRuleSet::validate_block_header(header, state, with_future_timestamp_check, with_seal_check);
 }
 
 ValidationResult MergeRuleSet::validate_seal(const BlockHeader& header) {
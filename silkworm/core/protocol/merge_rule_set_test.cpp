@@ -56,16 +56,16 @@ TEST_CASE("Proof-of-Stake RuleSet") {
     InMemoryState state;
     state.insert_block(parent, header.parent_hash);
 
-    CHECK(rule_set.validate_block_header(header, state, /*with_future_timestamp_check=*/false) ==
+    CHECK(rule_set.validate_block_header(header, state, /*with_future_timestamp_check=*/false, /*with_seal_check=*/true) ==
           ValidationResult::kOk);
 
     header.nonce[2] = 5;
-    CHECK(rule_set.validate_block_header(header, state, /*with_future_timestamp_check=*/false) ==
+    CHECK(rule_set.validate_block_header(header, state, /*with_future_timestamp_check=*/false, /*with_seal_check=*/true) ==
           ValidationResult::kInvalidNonce);
     header.nonce[2] = 0;
 
     header.difficulty = 1000;
-    CHECK(rule_set.validate_block_header(header, state, /*with_future_timestamp_check=*/false) ==
+    CHECK(rule_set.validate_block_header(header, state, /*with_future_timestamp_check=*/false, /*with_seal_check=*/true) ==
           ValidationResult::kPoWBlockAfterMerge);
 }
 
@@ -43,11 +43,14 @@ class IRuleSet {
     //! \param [in] state: current state.
     //! \param [in] with_future_timestamp_check : whether to check header timestamp is in the future wrt host current
     //! time \see https://github.com/torquem-ch/silkworm/issues/448
+    //! \param [in] with_seal_check : whether to validate the seal, false when it has been validated already (e.g. in
+    //! parallel by the header downloader)
     //! \note Shouldn't be used for genesis block.
     virtual ValidationResult validate_block_header(const BlockHeader& header, const BlockState& state,
-                                                   bool with_future_timestamp_check) = 0;
+                                                   bool with_future_timestamp_check, bool with_seal_check) = 0;
 
     //! \brief Validates the seal of the header
+    //! \note Must be thread-safe: seals may be validated concurrently
     virtual ValidationResult validate_seal(const BlockHeader& header) = 0;
 
     //! \brief Performs validation of block ommers only.
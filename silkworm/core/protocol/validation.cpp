@@ -18,6 +18,7 @@
 
 #include <silkworm/core/common/cast.hpp>
 #include <silkworm/core/crypto/secp256k1n.hpp>
+#include <silkworm/core/rlp/decode.hpp>
 #include <silkworm/core/rlp/encode_vector.hpp>
 #include <silkworm/core/trie/vector_root.hpp>
 
@@ -217,6 +218,37 @@ evmc::bytes32 compute_transaction_root(const BlockBody& body) {
     return trie::root_hash(body.transactions, kEncoder);
 }
 
+tl::expected<evmc::bytes32, DecodingError> compute_transaction_root(ByteView transactions_rlp) {
+    const auto list_header{rlp::decode_header(transactions_rlp)};
+    if (!list_header) {
+        return tl::unexpected{list_header.error()};
+    }
+    if (!list_header->list) {
+        return tl::unexpected{DecodingError::kUnexpectedString};
+    }
+    ByteView payload{transactions_rlp.substr(0, list_header->payload_length)};
+
+    std::vector<ByteView> encoded_transactions;
+    while (!payload.empty()) {
+        const ByteView item{payload};
+        const auto item_header{rlp::decode_header(payload)};
+        if (!item_header) {
+            return tl::unexpected{item_header.error()};
+        }
+        if (item_header->list) {
+            // legacy transaction: the whole list item is its encoding
+            const size_t header_length{item.length() - payload.length()};
+            encoded_transactions.push_back(item.substr(0, header_length + item_header->payload_length));
+        } else {
+            // EIP-2718 transaction: type || payload wrapped into a string, hashed unwrapped
+            encoded_transactions.push_back(payload.substr(0, item_header->payload_length));
+        }
+        payload.remove_prefix(item_header->payload_length);
+    }
+
+    return trie::root_hash(encoded_transactions);
+}
+
 std::optional<evmc::bytes32> compute_withdrawals_root(const BlockBody& body) {
     if (!body.withdrawals) {
         return std::nullopt;
@@ -19,7 +19,9 @@
 #include <optional>
 
 #include <evmc/evmc.h>
+#include <tl/expected.hpp>
 
+#include <silkworm/core/common/decoding_result.hpp>
 #include <silkworm/core/state/intra_block_state.hpp>
 #include <silkworm/core/types/block.hpp>
 #include <silkworm/core/types/transaction.hpp>
@@ -130,6 +132,11 @@ namespace protocol {
     //! \brief Calculate the transaction root of a block body
     evmc::bytes32 compute_transaction_root(const BlockBody& body);
 
+    //! \brief Calculate the transaction root straight from the RLP list of transactions of a block body as found
+    //! on the wire, without decoding nor re-encoding them
+    //! \remarks Typed transactions are hashed w/o their wrapping string header, the same as in compute_transaction_root
+    tl::expected<evmc::bytes32, DecodingError> compute_transaction_root(ByteView transactions_rlp);
+
     //! \brief Calculate the withdrawals root of a block body
     std::optional<evmc::bytes32> compute_withdrawals_root(const BlockBody& body);
 
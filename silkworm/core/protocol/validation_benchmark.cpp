@@ -0,0 +1,72 @@
+/*
+   Copyright 2023 The Silkworm Authors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#include <benchmark/benchmark.h>
+
+#include <silkworm/core/common/test_util.hpp>
+#include <silkworm/core/common/util.hpp>
+#include <silkworm/core/protocol/validation.hpp>
+#include <silkworm/core/rlp/encode_vector.hpp>
+
+namespace silkworm::protocol {
+
+//! The only transaction of block 1'500'013 on mainnet, the same contained in the sample transaction snapshot
+static const Bytes kMainnetTxnRlp{*from_hex(
+    "f86f828f938504a817c80083015f9094e9ae6ec1117bbfeb89302ce7e632597bc595efae880e61a774f297bb80801ca031131812a9b210cf"
+    "6033e9420478b72f08251d8c7323dd88bd3a180679fa90b5a028a6d676d77923b19506c7aaae5f1dc2f2244855aabb6672401c1b55b0d844ff")};
+
+//! A body with state.range(0) transactions: the mainnet one repeated, mixed with the typed sample transactions
+static BlockBody sample_body(benchmark::State& state) {
+    ByteView txn_rlp{kMainnetTxnRlp};
+    Transaction mainnet_txn;
+    if (!rlp::decode(txn_rlp, mainnet_txn)) {
+        state.SkipWithError("cannot decode the mainnet transaction");
+    }
+    const auto typed_txns{test::sample_transactions()};
+
+    BlockBody body;
+    for (int64_t i{0}; i < state.range(0); ++i) {
+        body.transactions.push_back(i % 4 == 3 ? typed_txns[static_cast<size_t>(i / 4) % typed_txns.size()] : mainnet_txn);
+    }
+    return body;
+}
+
+// Transaction root of a decoded body, re-encoding every transaction
+static void compute_transaction_root_body(benchmark::State& state) {
+    const BlockBody body{sample_body(state)};
+
+    for ([[maybe_unused]] auto _ : state) {
+        benchmark::DoNotOptimize(compute_transaction_root(body));
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// Transaction root straight from the transactions RLP list, as received in BlockBodies
+static void compute_transaction_root_rlp(benchmark::State& state) {
+    Bytes transactions_rlp;
+    rlp::encode(transactions_rlp, sample_body(state).transactions);
+
+    for ([[maybe_unused]] auto _ : state) {
+        benchmark::DoNotOptimize(compute_transaction_root(transactions_rlp));
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// 200 transactions is in the range of a recent mainnet block
+BENCHMARK(compute_transaction_root_body)->Arg(1)->Arg(200);
+BENCHMARK(compute_transaction_root_rlp)->Arg(1)->Arg(200);
+
+}  // namespace silkworm::protocol
@@ -19,6 +19,8 @@
 #include <catch2/catch.hpp>
 
 #include <silkworm/core/common/test_util.hpp>
+#include <silkworm/core/common/util.hpp>
+#include <silkworm/core/rlp/encode_vector.hpp>
 #include <silkworm/core/state/in_memory_state.hpp>
 
 namespace silkworm::protocol {
@@ -109,6 +111,26 @@ TEST_CASE("Validate withdrawals_root") {
     }
 }
 
+TEST_CASE("Validate transaction root from RLP") {
+    BlockBody body;
+
+    SECTION("no transactions") {
+        Bytes transactions_rlp;
+        rlp::encode(transactions_rlp, body.transactions);
+        CHECK(compute_transaction_root(transactions_rlp) == kEmptyRoot);
+    }
+    SECTION("legacy and typed transactions") {
+        body.transactions = test::sample_transactions();
+        Bytes transactions_rlp;
+        rlp::encode(transactions_rlp, body.transactions);
+        CHECK(compute_transaction_root(transactions_rlp) == compute_transaction_root(body));
+    }
+    SECTION("invalid RLP") {
+        CHECK(compute_transaction_root(*from_hex("80")) == tl::unexpected{DecodingError::kUnexpectedString});
+        CHECK(compute_transaction_root(*from_hex("c3c2")) == tl::unexpected{DecodingError::kInputTooShort});
+    }
+}
+
 TEST_CASE("EIP-3607: Reject transactions from senders with deployed code") {
     const evmc::address sender{0x71562b71999873DB5b286dF957af199Ec94617F7_address};
 
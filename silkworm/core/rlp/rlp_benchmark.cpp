@@ -0,0 +1,109 @@
+/*
+   Copyright 2023 The Silkworm Authors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#include <benchmark/benchmark.h>
+
+#include <silkworm/core/common/test_util.hpp>
+#include <silkworm/core/common/util.hpp>
+#include <silkworm/core/types/block.hpp>
+#include <silkworm/core/types/receipt.hpp>
+#include <silkworm/core/types/transaction.hpp>
+
+namespace silkworm {
+
+//! A post-London header, with the fields sized as on mainnet
+static BlockHeader sample_header() {
+    BlockHeader header;
+    header.parent_hash = 0x374f3a049e006f36f6cf91b02a3b0ee16c858af2f75858733eb0e927b5b7126c_bytes32;
+    header.ommers_hash = kEmptyListHash;
+    header.beneficiary = 0xea674fdde714fd979de3edf0f56aa9716b898ec8_address;
+    header.state_root = 0xc1a3d5b8b8f9ef3e6b9eb7b7d8a14ab89a1fb3b0b3e4b4bf15f5b0d8c2b5b7a9_bytes32;
+    header.transactions_root = 0xd2d4ad1d6b4c4e2d8f2b3ab0e1d6f3bd2a7e0a5a6f4f7c2c1e8b8d2d7e1c4a9f_bytes32;
+    header.receipts_root = 0xe3c2b8f4a5d1c6e7b8a9f0e1d2c3b4a5968778695a4b3c2d1e0f1a2b3c4d5e6f_bytes32;
+    header.logs_bloom[17] = 0x80;
+    header.number = 17'000'000;
+    header.gas_limit = 30'000'000;
+    header.gas_used = 17'356'412;
+    header.timestamp = 1'681'338'455;
+    header.extra_data = *from_hex("6265617665726275696c642e6f7267");
+    header.prev_randao = 0x4c8b8b1ad7c7d2a8b1c9e8f7a6b5c4d3e2f1a0b9c8d7e6f5a4b3c2d1e0f9a8b7_bytes32;
+    header.base_fee_per_gas = 30'000'000'000;
+    header.withdrawals_root = 0xc32381c919dad80afe8fe0df79460418e350725a63f67c55b27ee168ef464e5d_bytes32;
+    return header;
+}
+
+static void rlp_encode_header(benchmark::State& state) {
+    const BlockHeader header{sample_header()};
+    Bytes encoded;
+    for ([[maybe_unused]] auto _ : state) {
+        encoded.clear();
+        rlp::encode(encoded, header);
+        benchmark::DoNotOptimize(encoded.data());
+    }
+}
+
+BENCHMARK(rlp_encode_header);
+
+static void rlp_decode_header(benchmark::State& state) {
+    Bytes encoded;
+    rlp::encode(encoded, sample_header());
+    for ([[maybe_unused]] auto _ : state) {
+        ByteView view{encoded};
+        BlockHeader header;
+        benchmark::DoNotOptimize(rlp::decode(view, header));
+    }
+}
+
+BENCHMARK(rlp_decode_header);
+
+// Legacy (0) and dynamic fee (1) sample transactions
+static void rlp_encode_transaction(benchmark::State& state) {
+    const Transaction txn{test::sample_transactions().at(static_cast<size_t>(state.range(0)))};
+    Bytes encoded;
+    for ([[maybe_unused]] auto _ : state) {
+        encoded.clear();
+        rlp::encode(encoded, txn);
+        benchmark::DoNotOptimize(encoded.data());
+    }
+}
+
+BENCHMARK(rlp_encode_transaction)->Arg(0)->Arg(1);
+
+static void rlp_decode_transaction(benchmark::State& state) {
+    Bytes encoded;
+    rlp::encode(encoded, test::sample_transactions().at(static_cast<size_t>(state.range(0))));
+    for ([[maybe_unused]] auto _ : state) {
+        ByteView view{encoded};
+        Transaction txn;
+        benchmark::DoNotOptimize(rlp::decode(view, txn));
+    }
+}
+
+BENCHMARK(rlp_decode_transaction)->Arg(0)->Arg(1);
+
+static void rlp_encode_receipt(benchmark::State& state) {
+    const Receipt receipt{test::sample_receipts().at(static_cast<size_t>(state.range(0)))};
+    Bytes encoded;
+    for ([[maybe_unused]] auto _ : state) {
+        encoded.clear();
+        rlp::encode(encoded, receipt);
+        benchmark::DoNotOptimize(encoded.data());
+    }
+}
+
+BENCHMARK(rlp_encode_receipt)->Arg(0)->Arg(1);
+
+}  // namespace silkworm
@@ -0,0 +1,77 @@
+/*
+   Copyright 2023 The Silkworm Authors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <silkworm/core/common/endian.hpp>
+#include <silkworm/core/common/util.hpp>
+
+#include "in_memory_state.hpp"
+#include "intra_block_state.hpp"
+
+namespace silkworm {
+
+static constexpr evmc::address kContract{0x00000000219ab540356cbb839cbe05303d7705fa_address};
+
+//! Puts a contract with the given number of non-empty storage slots in the db and returns their locations
+static std::vector<evmc::bytes32> populate_storage(InMemoryState& db, size_t slots) {
+    db.update_account(kContract, std::nullopt, Account{.nonce = 1, .incarnation = 1});
+    std::vector<evmc::bytes32> locations(slots);
+    for (size_t i{0}; i < slots; ++i) {
+        endian::store_big_u64(&locations[i].bytes[24], i);
+        evmc::bytes32 value;
+        endian::store_big_u64(&value.bytes[24], i + 1);
+        db.update_storage(kContract, /*incarnation=*/1, locations[i], {}, value);
+    }
+    return locations;
+}
+
+// SLOAD: first access of each slot goes to the db, the second one hits the intra-block cache
+static void intra_block_state_sload(benchmark::State& state) {
+    InMemoryState db;
+    const auto locations{populate_storage(db, static_cast<size_t>(state.range(0)))};
+    for ([[maybe_unused]] auto _ : state) {
+        IntraBlockState ibs{db};
+        for (const auto& location : locations) {
+            benchmark::DoNotOptimize(ibs.get_current_storage(kContract, location));
+            benchmark::DoNotOptimize(ibs.get_current_storage(kContract, location));
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0) * 2);
+}
+
+BENCHMARK(intra_block_state_sload)->Arg(1'000);
+
+// SSTORE: each slot is written twice, so that both the original and the dirty value paths are exercised
+static void intra_block_state_sstore(benchmark::State& state) {
+    InMemoryState db;
+    const auto locations{populate_storage(db, static_cast<size_t>(state.range(0)))};
+    for ([[maybe_unused]] auto _ : state) {
+        IntraBlockState ibs{db};
+        for (const auto& location : locations) {
+            ibs.set_storage(kContract, location, location);
+            ibs.set_storage(kContract, location, evmc::bytes32{});
+        }
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0) * 2);
+}
+
+BENCHMARK(intra_block_state_sstore)->Arg(1'000);
+
+}  // namespace silkworm
@@ -0,0 +1,52 @@
+/*
+   Copyright 2023 The Silkworm Authors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#include <algorithm>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <silkworm/core/common/endian.hpp>
+#include <silkworm/core/common/util.hpp>
+#include <silkworm/core/trie/hash_builder.hpp>
+#include <silkworm/core/trie/nibbles.hpp>
+
+namespace silkworm::trie {
+
+// Root of a trie with state.range(0) leaves keyed by hashes, as for accounts and storage
+static void hash_builder_root(benchmark::State& state) {
+    std::vector<Bytes> keys;
+    for (uint64_t i{0}; i < static_cast<uint64_t>(state.range(0)); ++i) {
+        Bytes preimage(8, '\0');
+        endian::store_big_u64(preimage.data(), i);
+        keys.emplace_back(keccak256(preimage).bytes, kHashLength);
+    }
+    std::sort(keys.begin(), keys.end());
+    const Bytes value(70, 0xab);  // about the size of an RLP-encoded account
+
+    for ([[maybe_unused]] auto _ : state) {
+        HashBuilder hb;
+        for (const auto& key : keys) {
+            hb.add_leaf(unpack_nibbles(key), value);
+        }
+        benchmark::DoNotOptimize(hb.root_hash());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+BENCHMARK(hash_builder_root)->Arg(100)->Arg(10'000);
+
+}  // namespace silkworm::trie
@@ -58,4 +58,22 @@ evmc::bytes32 root_hash(const std::vector<Value>& v, Encoder&& value_encoder) {
     return hb.root_hash();
 }
 
+// Trie root hash of values already RLP-encoded (e.g. as found on the wire), the keys are RLP-encoded integers.
+// Values are passed to the hash builder as they are, so no copy nor re-encoding takes place.
+inline evmc::bytes32 root_hash(const std::vector<ByteView>& encoded_values) {
+    Bytes index_rlp;
+
+    HashBuilder hb;
+
+    for (size_t j{0}; j < encoded_values.size(); ++j) {
+        const size_t index{adjust_index_for_rlp(j, encoded_values.size())};
+        index_rlp.clear();
+        rlp::encode(index_rlp, index);
+
+        hb.add_leaf(unpack_nibbles(index_rlp), encoded_values[index]);
+    }
+
+    return hb.root_hash();
+}
+
 }  // namespace silkworm::trie
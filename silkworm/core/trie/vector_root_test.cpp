@@ -51,6 +51,27 @@ TEST_CASE("Hardcoded root hash") {
     }
     static constexpr auto kEncoder = [](Bytes& to, const Receipt& r) { rlp::encode(to, r); };
     CHECK(to_hex(root_hash(receipts, kEncoder)) == "7ea023138ee7d80db04eeec9cf436dc35806b00cc5fe8e5f611fb7cf1b35b177");
+
+    std::vector<Bytes> receipts_rlp(receipts.size());
+    std::vector<ByteView> encoded_receipts;
+    for (size_t i{0}; i < receipts.size(); ++i) {
+        rlp::encode(receipts_rlp[i], receipts[i]);
+        encoded_receipts.emplace_back(receipts_rlp[i]);
+    }
+    CHECK(root_hash(encoded_receipts) == root_hash(receipts, kEncoder));
+}
+
+TEST_CASE("Root hash of many encoded values") {
+    // more than 0x80 values, so that the RLP-adjusted ordering of indices is fully exercised
+    std::vector<Bytes> values(300);
+    std::vector<ByteView> encoded_values;
+    for (size_t i{0}; i < values.size(); ++i) {
+        rlp::encode(values[i], i * 1'000'003);
+        encoded_values.emplace_back(values[i]);
+    }
+    static constexpr auto kEncoder = [](Bytes& to, const Bytes& v) { to.append(v); };
+    CHECK(root_hash(std::vector<ByteView>{}) == kEmptyRoot);
+    CHECK(root_hash(encoded_values) == root_hash(values, kEncoder));
 }
 
 }  // namespace silkworm::trie
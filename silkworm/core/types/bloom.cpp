@@ -23,11 +23,18 @@
 namespace silkworm {
 
 void m3_2048(Bloom& bloom, ByteView x) {
+    for (const unsigned bit : m3_2048_bits(x)) {
+        bloom[kBloomByteLength - 1 - bit / 8] |= 1 << (bit % 8);
+    }
+}
+
+std::array<uint16_t, 3> m3_2048_bits(ByteView x) {
     ethash::hash256 hash{keccak256(x)};
+    std::array<uint16_t, 3> bits{};
     for (unsigned i{0}; i < 6; i += 2) {
-        unsigned bit{static_cast<unsigned>(hash.bytes[i + 1] + (hash.bytes[i] << 8)) & 0x7FFu};
-        bloom[kBloomByteLength - 1 - bit / 8] |= 1 << (bit % 8);
+        bits[i / 2] = static_cast<uint16_t>((hash.bytes[i + 1] + (hash.bytes[i] << 8)) & 0x7FF);
     }
+    return bits;
 }
 
 Bloom logs_bloom(const std::vector<Log>& logs) {
@@ -26,12 +26,16 @@
 namespace silkworm {
 
 inline constexpr size_t kBloomByteLength{256};
+inline constexpr size_t kBloomBitLength{kBloomByteLength * 8};
 
 using Bloom = std::array<uint8_t, kBloomByteLength>;
 
 //! See Section 4.3.1 "Transaction Receipt" of the Yellow Paper
 void m3_2048(Bloom& bloom, ByteView x);
 
+//! Indices of the 3 bits set by m3_2048 for x, where bit i is bit (i % 8) of byte kBloomByteLength - 1 - i / 8
+std::array<uint16_t, 3> m3_2048_bits(ByteView x);
+
 Bloom logs_bloom(const std::vector<Log>& logs);
 
 inline void join(Bloom& sum, const Bloom& addend) {
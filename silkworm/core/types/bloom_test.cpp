@@ -45,4 +45,17 @@ TEST_CASE("Hardcoded Bloom") {
           "000000000000000000000000000000000000000000000000000000000000100000100000000000000000000000"
           "00000000001400000000000000008000000000000000000000000000000000");
 }
+
+TEST_CASE("m3_2048 bits") {
+    const auto address{0x22341ae42d6dd7384bc8584e50419ea3ac75b83f_address};
+    Bloom bloom{};
+    m3_2048(bloom, address);
+    Bloom bits_bloom{};
+    for (const auto bit : m3_2048_bits(address)) {
+        CHECK(bit < kBloomBitLength);
+        bits_bloom[kBloomByteLength - 1 - bit / 8] |= static_cast<uint8_t>(1 << (bit % 8));
+    }
+    CHECK(bits_bloom == bloom);
+}
+
 }  // namespace silkworm
@@ -16,6 +16,8 @@
 
 #pragma once
 
+#include <optional>
+
 #include <silkworm/infra/concurrency/coroutine.hpp>
 
 #include <boost/asio/any_io_executor.hpp>
@@ -67,6 +69,16 @@ class Channel {
         }
     }
 
+    std::optional<T> try_receive() {
+        std::optional<T> result;
+        channel_.try_receive([&result](const boost::system::error_code& error, T value) {
+            if (!error) {
+                result = std::move(value);
+            }
+        });
+        return result;
+    }
+
     void close() {
         channel_.close();
     }
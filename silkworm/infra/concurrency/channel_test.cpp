@@ -62,4 +62,15 @@ TEST_CASE("Channel.close_and_receive") {
     CHECK_THROWS_AS(run(context, channel.receive()), boost::system::system_error);
 }
 
+TEST_CASE("Channel.try_receive") {
+    io_context context;
+    Channel<int> channel{context, 2};
+    CHECK_FALSE(channel.try_receive().has_value());
+    CHECK(channel.try_send(1));
+    CHECK(channel.try_send(2));
+    CHECK(channel.try_receive() == 1);
+    CHECK(channel.try_receive() == 2);
+    CHECK_FALSE(channel.try_receive().has_value());
+}
+
 }  // namespace silkworm::concurrency
@@ -0,0 +1,198 @@
+/*
+   Copyright 2023 The Silkworm Authors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#include "metrics.hpp"
+
+#include <bit>
+#include <charconv>
+
+namespace silkworm::metrics {
+
+uint64_t Counter::value() const noexcept {
+    uint64_t total{0};
+    for (const auto& shard : shards_) {
+        total += shard.value.load(std::memory_order_relaxed);
+    }
+    return total;
+}
+
+size_t Counter::shard_index() noexcept {
+    static std::atomic<size_t> next_shard{0};
+    thread_local const size_t index{next_shard.fetch_add(1, std::memory_order_relaxed) % kShards};
+    return index;
+}
+
+uint64_t Histogram::count() const noexcept {
+    uint64_t total{0};
+    for (const auto& bucket : buckets_) {
+        total += bucket.load(std::memory_order_relaxed);
+    }
+    return total;
+}
+
+size_t Histogram::bucket_index(uint64_t value) noexcept {
+    if (value < kSubBuckets) {
+        return static_cast<size_t>(value);
+    }
+    const auto exponent{static_cast<size_t>(std::bit_width(value) - 1)};  // >= kSubBucketBits
+    const auto sub_bucket{static_cast<size_t>(value >> (exponent - kSubBucketBits)) & (kSubBuckets - 1)};
+    return (exponent - kSubBucketBits + 1) * kSubBuckets + sub_bucket;
+}
+
+uint64_t Histogram::bucket_upper_bound(size_t index) noexcept {
+    if (index < kSubBuckets) {
+        return index;
+    }
+    const size_t shift{index / kSubBuckets - 1};  // i.e. exponent - kSubBucketBits
+    const uint64_t lower_bound{(kSubBuckets + index % kSubBuckets) << shift};
+    return lower_bound + ((uint64_t{1} << shift) - 1);
+}
+
+Registry& Registry::instance() {
+    static Registry registry;
+    return registry;
+}
+
+static std::string render_labels(const Labels& labels) {
+    std::string rendered;
+    for (const auto& [name, value] : labels) {
+        rendered += rendered.empty() ? "" : ",";
+        rendered += name;
+        rendered += "=\"";
+        for (const char c : value) {
+            switch (c) {
+                case '\\':
+                    rendered += "\\\\";
+                    break;
+                case '"':
+                    rendered += "\\\"";
+                    break;
+                case '\n':
+                    rendered += "\\n";
+                    break;
+                default:
+                    rendered += c;
+            }
+        }
+        rendered += '"';
+    }
+    return rendered;
+}
+
+Registry::Family& Registry::family(std::string_view name, std::string_view help, Type type) {
+    auto it = families_.find(name);
+    if (it == families_.end()) {
+        it = families_.emplace(std::string{name}, Family{type, std::string{help}, {}, {}, {}}).first;
+    }
+    return it->second;
+}
+
+Counter& Registry::counter(std::string_view name, std::string_view help, const Labels& labels) {
+    std::scoped_lock lock{mutex_};
+    auto& metric = family(name, help, Type::kCounter).counters[render_labels(labels)];
+    if (!metric) metric = std::make_unique<Counter>();
+    return *metric;
+}
+
+Gauge& Registry::gauge(std::string_view name, std::string_view help, const Labels& labels) {
+    std::scoped_lock lock{mutex_};
+    auto& metric = family(name, help, Type::kGauge).gauges[render_labels(labels)];
+    if (!metric) metric = std::make_unique<Gauge>();
+    return *metric;
+}
+
+Histogram& Registry::histogram(std::string_view name, std::string_view help, const Labels& labels, double scale) {
+    std::scoped_lock lock{mutex_};
+    auto& metric = family(name, help, Type::kHistogram).histograms[render_labels(labels)];
+    if (!metric) metric = std::make_unique<Histogram>(scale);
+    return *metric;
+}
+
+static void append_number(std::string& out, double value) {
+    char buffer[32];
+    const auto result{std::to_chars(buffer, buffer + sizeof(buffer), value)};
+    out.append(buffer, result.ptr);
+}
+
+static void append_number(std::string& out, uint64_t value) {
+    out += std::to_string(value);
+}
+
+static void append_number(std::string& out, int64_t value) {
+    out += std::to_string(value);
+}
+
+static void append_sample(std::string& out, std::string_view name, std::string_view labels, auto value) {
+    out += name;
+    if (!labels.empty()) {
+        out += '{';
+        out += labels;
+        out += '}';
+    }
+    out += ' ';
+    append_number(out, value);
+    out += '\n';
+}
+
+static void append_histogram(std::string& out, const std::string& name, const std::string& labels,
+                             const Histogram& histogram) {
+    const std::string bucket_name{name + "_bucket"};
+    const std::string labels_prefix{labels.empty() ? "" : labels + ","};
+    uint64_t cumulative_count{0};
+    for (size_t i{0}; i < Histogram::kBuckets; ++i) {
+        const uint64_t count{histogram.bucket_count(i)};
+        if (count == 0) continue;  // bounds of empty buckets carry no information
+        cumulative_count += count;
+        std::string bucket_labels{labels_prefix + "le=\""};
+        append_number(bucket_labels, static_cast<double>(Histogram::bucket_upper_bound(i)) * histogram.scale());
+        bucket_labels += '"';
+        append_sample(out, bucket_name, bucket_labels, cumulative_count);
+    }
+    append_sample(out, bucket_name, labels_prefix + "le=\"+Inf\"", cumulative_count);
+    append_sample(out, name + "_sum", labels, static_cast<double>(histogram.sum()) * histogram.scale());
+    append_sample(out, name + "_count", labels, cumulative_count);
+}
+
+std::string Registry::to_prometheus() const {
+    std::scoped_lock lock{mutex_};
+    std::string out;
+    for (const auto& [name, family] : families_) {
+        out += "# HELP " + name + " " + family.help + "\n";
+        switch (family.type) {
+            case Type::kCounter:
+                out += "# TYPE " + name + " counter\n";
+                for (const auto& [labels, counter] : family.counters) {
+                    append_sample(out, name, labels, counter->value());
+                }
+                break;
+            case Type::kGauge:
+                out += "# TYPE " + name + " gauge\n";
+                for (const auto& [labels, gauge] : family.gauges) {
+                    append_sample(out, name, labels, gauge->value());
+                }
+                break;
+            case Type::kHistogram:
+                out += "# TYPE " + name + " histogram\n";
+                for (const auto& [labels, histogram] : family.histograms) {
+                    append_histogram(out, name, labels, *histogram);
+                }
+                break;
+        }
+    }
+    return out;
+}
+
+}  // namespace silkworm::metrics
@@ -0,0 +1,161 @@
+/*
+   Copyright 2023 The Silkworm Authors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace silkworm::metrics {
+
+//! Metric labels as (name, value) pairs, e.g. {{"stage", "Execution"}}
+using Labels = std::vector<std::pair<std::string, std::string>>;
+
+//! \brief Monotonically increasing counter
+//! \remarks Increments land on per-thread shards placed on distinct cache lines, so concurrent updates never contend
+class Counter {
+  public:
+    void increment(uint64_t delta = 1) noexcept {
+        shards_[shard_index()].value.fetch_add(delta, std::memory_order_relaxed);
+    }
+
+    [[nodiscard]] uint64_t value() const noexcept;
+
+  private:
+    static constexpr size_t kShards{16};
+
+    struct alignas(64) Shard {
+        std::atomic<uint64_t> value{0};
+    };
+
+    //! The shard assigned to the calling thread, round-robin at its first use
+    static size_t shard_index() noexcept;
+
+    std::array<Shard, kShards> shards_;
+};
+
+//! \brief Value that can arbitrarily go up and down
+class Gauge {
+  public:
+    void set(int64_t value) noexcept { value_.store(value, std::memory_order_relaxed); }
+    void add(int64_t delta) noexcept { value_.fetch_add(delta, std::memory_order_relaxed); }
+
+    [[nodiscard]] int64_t value() const noexcept { return value_.load(std::memory_order_relaxed); }
+
+  private:
+    std::atomic<int64_t> value_{0};
+};
+
+//! \brief Distribution of integer samples into HDR-style log-linear buckets
+//! \details Each power of two is split into kSubBuckets linear sub-buckets, so the relative error of any bucket bound
+//! is at most 1/kSubBuckets whatever the magnitude of the samples: no bucket layout must be guessed upfront
+class Histogram {
+  public:
+    static constexpr size_t kSubBucketBits{3};
+    static constexpr size_t kSubBuckets{size_t{1} << kSubBucketBits};
+    static constexpr size_t kBuckets{(64 - kSubBucketBits + 1) * kSubBuckets};
+
+    //! \param scale [in] : factor applied to sample values when exposed (e.g. 1e-6 for microseconds as seconds)
+    explicit Histogram(double scale = 1.0) : scale_{scale} {}
+
+    void observe(uint64_t value) noexcept {
+        buckets_[bucket_index(value)].fetch_add(1, std::memory_order_relaxed);
+        sum_.fetch_add(value, std::memory_order_relaxed);
+    }
+
+    //! \brief Observes a duration as a number of microseconds
+    template <class Rep, class Period>
+    void observe(std::chrono::duration<Rep, Period> duration) noexcept {
+        const auto us{std::chrono::duration_cast<std::chrono::microseconds>(duration).count()};
+        observe(static_cast<uint64_t>(us > 0 ? us : 0));
+    }
+
+    [[nodiscard]] double scale() const noexcept { return scale_; }
+    [[nodiscard]] uint64_t count() const noexcept;
+    [[nodiscard]] uint64_t sum() const noexcept { return sum_.load(std::memory_order_relaxed); }
+    [[nodiscard]] uint64_t bucket_count(size_t index) const noexcept {
+        return buckets_[index].load(std::memory_order_relaxed);
+    }
+
+    static size_t bucket_index(uint64_t value) noexcept;
+
+    //! The greatest value falling into the bucket having the specified index
+    static uint64_t bucket_upper_bound(size_t index) noexcept;
+
+  private:
+    double scale_;
+    std::array<std::atomic<uint64_t>, kBuckets> buckets_{};
+    std::atomic<uint64_t> sum_{0};
+};
+
+//! \brief Process-wide collection of named metrics, exposed in Prometheus text format
+//! \remarks Lookups take a lock, so hot paths should keep the returned references (which stay valid forever)
+class Registry {
+  public:
+    static Registry& instance();
+
+    Counter& counter(std::string_view name, std::string_view help, const Labels& labels = {});
+    Gauge& gauge(std::string_view name, std::string_view help, const Labels& labels = {});
+    Histogram& histogram(std::string_view name, std::string_view help, const Labels& labels = {}, double scale = 1.0);
+
+    //! \brief Renders all metrics in Prometheus text exposition format (version 0.0.4)
+    [[nodiscard]] std::string to_prometheus() const;
+
+  private:
+    enum class Type {
+        kCounter,
+        kGauge,
+        kHistogram,
+    };
+
+    struct Family {
+        Type type;
+        std::string help;
+        std::map<std::string, std::unique_ptr<Counter>> counters;  // by rendered labels
+        std::map<std::string, std::unique_ptr<Gauge>> gauges;
+        std::map<std::string, std::unique_ptr<Histogram>> histograms;
+    };
+
+    Family& family(std::string_view name, std::string_view help, Type type);
+
+    mutable std::mutex mutex_;
+    std::map<std::string, Family, std::less<>> families_;
+};
+
+//! \brief Observes the lifetime duration of the instance into the specified histogram
+class ScopedTimer {
+  public:
+    explicit ScopedTimer(Histogram& histogram) : histogram_{histogram}, start_{std::chrono::steady_clock::now()} {}
+    ~ScopedTimer() { histogram_.observe(std::chrono::steady_clock::now() - start_); }
+
+    ScopedTimer(const ScopedTimer&) = delete;
+    ScopedTimer& operator=(const ScopedTimer&) = delete;
+
+  private:
+    Histogram& histogram_;
+    std::chrono::steady_clock::time_point start_;
+};
+
+}  // namespace silkworm::metrics
@@ -0,0 +1,117 @@
+/*
+   Copyright 2023 The Silkworm Authors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#include "metrics.hpp"
+
+#include <thread>
+#include <vector>
+
+#include <catch2/catch.hpp>
+
+namespace silkworm::metrics {
+
+TEST_CASE("Counter", "[infra][metrics]") {
+    Counter counter;
+    CHECK(counter.value() == 0);
+
+    static constexpr size_t kThreads{8};
+    static constexpr size_t kIncrements{10'000};
+    std::vector<std::thread> threads;
+    for (size_t i{0}; i < kThreads; ++i) {
+        threads.emplace_back([&]() {
+            for (size_t j{0}; j < kIncrements; ++j) counter.increment();
+        });
+    }
+    for (auto& t : threads) t.join();
+    CHECK(counter.value() == kThreads * kIncrements);
+
+    counter.increment(5);
+    CHECK(counter.value() == kThreads * kIncrements + 5);
+}
+
+TEST_CASE("Gauge", "[infra][metrics]") {
+    Gauge gauge;
+    gauge.set(10);
+    gauge.add(-15);
+    CHECK(gauge.value() == -5);
+}
+
+TEST_CASE("Histogram buckets", "[infra][metrics]") {
+    // small values have their own bucket
+    for (uint64_t value{0}; value < Histogram::kSubBuckets * 2; ++value) {
+        CHECK(Histogram::bucket_upper_bound(Histogram::bucket_index(value)) == value);
+    }
+    // every value falls within its bucket bounds and bucket relative width is bounded
+    for (uint64_t value : {uint64_t{16}, uint64_t{17}, uint64_t{1'000}, uint64_t{123'456'789}, ~uint64_t{0}}) {
+        const size_t index{Histogram::bucket_index(value)};
+        REQUIRE(index < Histogram::kBuckets);
+        CHECK(value <= Histogram::bucket_upper_bound(index));
+        CHECK(value > Histogram::bucket_upper_bound(index - 1));
+        const auto width{Histogram::bucket_upper_bound(index) - Histogram::bucket_upper_bound(index - 1)};
+        CHECK(width <= value / Histogram::kSubBuckets + 1);
+    }
+    CHECK(Histogram::bucket_index(~uint64_t{0}) == Histogram::kBuckets - 1);
+    CHECK(Histogram::bucket_upper_bound(Histogram::kBuckets - 1) == ~uint64_t{0});
+}
+
+TEST_CASE("Histogram observations", "[infra][metrics]") {
+    Histogram histogram;
+    histogram.observe(uint64_t{3});
+    histogram.observe(uint64_t{1'000});
+    histogram.observe(std::chrono::milliseconds{2});
+    CHECK(histogram.count() == 3);
+    CHECK(histogram.sum() == 3 + 1'000 + 2'000);
+    CHECK(histogram.bucket_count(Histogram::bucket_index(3)) == 1);
+}
+
+TEST_CASE("Registry", "[infra][metrics]") {
+    Registry& registry{Registry::instance()};
+
+    SECTION("same name and labels give same metric") {
+        auto& c1{registry.counter("test_registry_total", "Test counter", {{"kind", "a"}})};
+        auto& c2{registry.counter("test_registry_total", "Test counter", {{"kind", "a"}})};
+        auto& c3{registry.counter("test_registry_total", "Test counter", {{"kind", "b"}})};
+        CHECK(&c1 == &c2);
+        CHECK(&c1 != &c3);
+    }
+
+    SECTION("Prometheus exposition") {
+        registry.counter("test_exposition_total", "Test counter", {{"method", "eth_call"}}).increment(7);
+        registry.gauge("test_exposition_gauge", "Test gauge").set(-3);
+        auto& histogram{registry.histogram("test_exposition_seconds", "Test histogram", {}, 1e-6)};
+        histogram.observe(uint64_t{2});
+        histogram.observe(uint64_t{2});
+
+        const std::string text{registry.to_prometheus()};
+        CHECK(text.find("# HELP test_exposition_total Test counter\n") != std::string::npos);
+        CHECK(text.find("# TYPE test_exposition_total counter\n") != std::string::npos);
+        CHECK(text.find("test_exposition_total{method=\"eth_call\"} 7\n") != std::string::npos);
+        CHECK(text.find("# TYPE test_exposition_gauge gauge\n") != std::string::npos);
+        CHECK(text.find("test_exposition_gauge -3\n") != std::string::npos);
+        CHECK(text.find("# TYPE test_exposition_seconds histogram\n") != std::string::npos);
+        CHECK(text.find("test_exposition_seconds_bucket{le=\"2e-06\"} 2\n") != std::string::npos);
+        CHECK(text.find("test_exposition_seconds_bucket{le=\"+Inf\"} 2\n") != std::string::npos);
+        CHECK(text.find("test_exposition_seconds_sum 4e-06\n") != std::string::npos);
+        CHECK(text.find("test_exposition_seconds_count 2\n") != std::string::npos);
+    }
+
+    SECTION("label values are escaped") {
+        registry.counter("test_escaping_total", "Test counter", {{"path", "a\"b\\c"}}).increment();
+        CHECK(registry.to_prometheus().find("test_escaping_total{path=\"a\\\"b\\\\c\"} 1\n") != std::string::npos);
+    }
+}
+
+}  // namespace silkworm::metrics
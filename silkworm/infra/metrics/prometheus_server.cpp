@@ -0,0 +1,114 @@
+/*
+   Copyright 2023 The Silkworm Authors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#include "prometheus_server.hpp"
+
+#include <chrono>
+#include <stdexcept>
+#include <string_view>
+
+#include <boost/asio/co_spawn.hpp>
+#include <boost/asio/detached.hpp>
+#include <boost/asio/read_until.hpp>
+#include <boost/asio/streambuf.hpp>
+#include <boost/asio/this_coro.hpp>
+#include <boost/asio/use_awaitable.hpp>
+#include <boost/asio/write.hpp>
+#include <boost/system/system_error.hpp>
+
+#include <silkworm/infra/common/log.hpp>
+#include <silkworm/infra/concurrency/awaitable_wait_for_one.hpp>
+#include <silkworm/infra/concurrency/timeout.hpp>
+
+#include "metrics.hpp"
+
+namespace silkworm::metrics {
+
+using boost::asio::ip::tcp;
+using namespace std::chrono_literals;
+
+//! Max size of the request line plus headers, way more than any scraper sends
+static constexpr size_t kMaxRequestSize{8 * 1024};
+
+//! Max time for a client to send its request before the connection gets closed
+static constexpr std::chrono::milliseconds kRequestReadTimeout{5s};
+
+static tcp::endpoint make_endpoint(const std::string& end_point) {
+    const auto separator = end_point.rfind(':');
+    if (separator == std::string::npos) {
+        throw std::invalid_argument{"invalid metrics endpoint: " + end_point};
+    }
+    const auto address = boost::asio::ip::make_address(end_point.substr(0, separator));
+    const auto port = static_cast<uint16_t>(std::stoul(end_point.substr(separator + 1)));
+    return {address, port};
+}
+
+PrometheusServer::PrometheusServer(const boost::asio::any_io_executor& executor, const std::string& end_point)
+    : acceptor_{executor} {
+    const tcp::endpoint endpoint{make_endpoint(end_point)};
+    acceptor_.open(endpoint.protocol());
+    acceptor_.set_option(tcp::acceptor::reuse_address(true));
+    acceptor_.bind(endpoint);
+}
+
+Task<void> PrometheusServer::run() {
+    acceptor_.listen();
+    SILK_INFO << "Metrics available at http://" << acceptor_.local_endpoint() << "/metrics";
+
+    try {
+        while (acceptor_.is_open()) {
+            tcp::socket socket = co_await acceptor_.async_accept(boost::asio::use_awaitable);
+            boost::asio::co_spawn(co_await ThisTask::executor, handle_connection(std::move(socket)), boost::asio::detached);
+        }
+    } catch (const boost::system::system_error& se) {
+        if (se.code() != boost::asio::error::operation_aborted) {
+            SILK_ERROR << "PrometheusServer::run system_error: " << se.what();
+            throw;
+        }
+    }
+}
+
+Task<void> PrometheusServer::handle_connection(tcp::socket socket) {
+    using namespace concurrency::awaitable_wait_for_one;
+    try {
+        // Bounded in size and time, so that slow or malicious clients cannot hold memory nor connections
+        boost::asio::streambuf request_buffer{kMaxRequestSize};
+        co_await (boost::asio::async_read_until(socket, request_buffer, "\r\n\r\n", boost::asio::use_awaitable) ||
+                  concurrency::timeout(kRequestReadTimeout));
+        const std::string_view request{static_cast<const char*>(request_buffer.data().data()), request_buffer.size()};
+
+        std::string response;
+        if (request.starts_with("GET /metrics ") || request.starts_with("GET /metrics?")) {
+            const std::string body{Registry::instance().to_prometheus()};
+            response = "HTTP/1.1 200 OK\r\n"
+                       "Content-Type: text/plain; version=0.0.4\r\n"
+                       "Content-Length: " +
+                       std::to_string(body.size()) + "\r\nConnection: close\r\n\r\n" + body;
+        } else {
+            response = "HTTP/1.1 404 Not Found\r\nContent-Length: 0\r\nConnection: close\r\n\r\n";
+        }
+        co_await boost::asio::async_write(socket, boost::asio::buffer(response), boost::asio::use_awaitable);
+
+        boost::system::error_code ec;
+        socket.shutdown(tcp::socket::shutdown_both, ec);
+    } catch (const boost::system::system_error& se) {
+        SILK_DEBUG << "PrometheusServer::handle_connection system_error: " << se.what();
+    } catch (const concurrency::TimeoutExpiredError&) {
+        SILK_DEBUG << "PrometheusServer::handle_connection request read timed out";
+    }
+}
+
+}  // namespace silkworm::metrics
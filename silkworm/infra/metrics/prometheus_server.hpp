@@ -0,0 +1,44 @@
+/*
+   Copyright 2023 The Silkworm Authors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#pragma once
+
+#include <string>
+
+#include <silkworm/infra/concurrency/task.hpp>
+
+#include <boost/asio/any_io_executor.hpp>
+#include <boost/asio/ip/tcp.hpp>
+
+namespace silkworm::metrics {
+
+//! \brief Minimal HTTP server exposing the metrics Registry content at GET /metrics for Prometheus scraping
+//! \remarks Each connection serves exactly one request and then gets closed
+class PrometheusServer {
+  public:
+    //! \param executor [in] : the executor running the server coroutines
+    //! \param end_point [in] : the listening endpoint as <ip_address>:<port> (e.g. 127.0.0.1:6060)
+    PrometheusServer(const boost::asio::any_io_executor& executor, const std::string& end_point);
+
+    Task<void> run();
+
+  private:
+    static Task<void> handle_connection(boost::asio::ip::tcp::socket socket);
+
+    boost::asio::ip::tcp::acceptor acceptor_;
+};
+
+}  // namespace silkworm::metrics
@@ -50,9 +50,10 @@ void StateChangeCollection::start_new_batch(BlockNum block_height, const evmc::b
     SILK_TRACE << "StateChangeCollection::start_new_batch " << this << " block: " << block_height
                << " unwind:" << unwind << " START";
 
-    SILKWORM_ASSERT(latest_change_ == nullptr);
-
+    // Each block gets its own change within the batch, so per-block change indexes start afresh
     latest_change_ = state_changes_.add_change_batch();
+    account_change_index_.clear();
+    storage_change_index_.clear();
     latest_change_->set_block_height(block_height);
     latest_change_->set_allocated_block_hash(rpc::H256_from_bytes32(block_hash).release());
     latest_change_->set_direction(unwind ? remote::Direction::UNWIND : remote::Direction::FORWARD);
@@ -203,6 +203,34 @@ TEST_CASE("StateChangeCollection::start_new_batch", "[silkworm][rpc][state_chang
         scc.start_new_batch(kTestBlockNumber, kTestBlockHash, sample_rlp_buffers(), /*unwind=*/true);
         scc.notify_batch(kTestPendingBaseFee, kTestGasLimit);
     }
+
+    SECTION("OK: two blocks changing the same account in one batch") {
+        scc.reset(kTestDatabaseViewId);
+        scc.subscribe([&](std::optional<remote::StateChangeBatch> batch) {
+            CHECK(batch->state_version_id() == kTestDatabaseViewId);
+            CHECK(batch->change_batch_size() == 2);
+            for (int i{0}; i < batch->change_batch_size(); ++i) {
+                const remote::StateChange& state_change = batch->change_batch(i);
+                CHECK(state_change.direction() == remote::Direction::FORWARD);
+                CHECK(state_change.block_height() == kTestBlockNumber + static_cast<uint64_t>(i));
+                CHECK(state_change.changes_size() == 1);
+                const remote::AccountChange& account_change = state_change.changes(0);
+                CHECK(address_from_H160(account_change.address()) == kTestAddress);
+                CHECK(account_change.action() == remote::Action::UPSERT);
+                CHECK(account_change.storage_changes_size() == 1);
+            }
+            CHECK(batch->change_batch(0).changes(0).data() == to_hex(kTestData1));
+            CHECK(batch->change_batch(1).changes(0).data() == to_hex(kTestData2));
+        },
+                      StateChangeFilter{});
+        scc.start_new_batch(kTestBlockNumber, kTestBlockHash, std::vector<silkworm::Bytes>{}, /*unwind=*/false);
+        scc.change_storage(kTestAddress, kTestIncarnation, kTestHashedLocation1, kTestValue1);
+        scc.change_account(kTestAddress, kTestIncarnation, kTestData1);
+        scc.start_new_batch(kTestBlockNumber + 1, kTestBlockHash, std::vector<silkworm::Bytes>{}, /*unwind=*/false);
+        scc.change_storage(kTestAddress, kTestIncarnation, kTestHashedLocation1, kTestValue2);
+        scc.change_account(kTestAddress, kTestIncarnation, kTestData2);
+        scc.notify_batch(kTestPendingBaseFee, kTestGasLimit);
+    }
 }
 
 TEST_CASE("StateChangeCollection::change_account", "[silkworm][rpc][state_change_collection]") {
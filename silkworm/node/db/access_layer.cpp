@@ -1097,13 +1097,8 @@ std::optional<BlockHeader> DataModel::read_header_from_snapshot(BlockNum height)
         return {};
     }
 
-    std::optional<BlockHeader> block_header;
-    // We know the header snapshot in advance: find it based on target block number
-    const auto header_snapshot = repository_->find_header_segment(height);
-    if (header_snapshot) {
-        block_header = header_snapshot->header_by_number(height);
-    }
-    return block_header;
+    // We know the header snapshot in advance: the repository finds it based on target block number
+    return repository_->header_by_number(height);
 }
 
 std::optional<BlockHeader> DataModel::read_header_from_snapshot(const Hash& hash) {
@@ -1125,11 +1120,8 @@ bool DataModel::read_body_from_snapshot(BlockNum height, bool read_senders, Bloc
         return false;
     }
 
-    // We know the body snapshot in advance: find it based on target block number
-    const auto body_snapshot = repository_->find_body_segment(height);
-    if (!body_snapshot) return false;
-
-    auto stored_body = body_snapshot->body_by_number(height);
+    // We know the body snapshot in advance: the repository finds it based on target block number
+    auto stored_body = repository_->body_by_number(height);
     if (!stored_body) return false;
 
     // Skip first and last *system transactions* in block body
@@ -1151,18 +1143,13 @@ bool DataModel::is_body_in_snapshot(BlockNum height) {
         return false;
     }
 
-    // We know the body snapshot in advance: find it based on target block number
-    const auto body_snapshot = repository_->find_body_segment(height);
-    if (body_snapshot) {
-        const auto stored_body = body_snapshot->body_by_number(height);
-        return stored_body.has_value();
-    }
-
-    return false;
+    // We know the body snapshot in advance: the repository finds it based on target block number
+    const auto stored_body = repository_->body_by_number(height);
+    return stored_body.has_value();
 }
 
 bool DataModel::read_transactions_from_snapshot(BlockNum height, uint64_t base_txn_id, uint64_t txn_count,
-                                                bool read_senders, std::vector<Transaction> txs) {
+                                                bool read_senders, std::vector<Transaction>& txs) {
     txs.reserve(txn_count);
     if (txn_count == 0) {
         return true;
@@ -1177,9 +1164,8 @@ bool DataModel::read_transactions_from_snapshot(BlockNum height, uint64_t base_t
 }
 
 bool DataModel::read_rlp_transactions_from_snapshot(BlockNum height, std::vector<Bytes>& rlp_txs) {
-    const auto body_snapshot = repository_->find_body_segment(height);
-    if (body_snapshot) {
-        auto stored_body = body_snapshot->body_by_number(height);
+    if (repository_) {
+        auto stored_body = repository_->body_by_number(height);
         if (!stored_body) return false;
 
         // Skip first and last *system transactions* in block body
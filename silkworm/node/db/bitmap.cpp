@@ -16,7 +16,11 @@
 
 #include "bitmap.hpp"
 
+#include <algorithm>
+#include <cstring>
+#include <future>
 #include <stdexcept>
+#include <thread>
 
 #include <silkworm/core/common/cast.hpp>
 #include <silkworm/infra/common/binary_search.hpp>
@@ -177,13 +181,85 @@ void IndexLoader::prune_bitmaps(RWTxn& txn, BlockNum threshold) {
     current_key_.clear();
 }
 
-void IndexLoader::flush_bitmaps_to_etl(absl::btree_map<Bytes, roaring::Roaring64Map>& bitmaps,
-                                       etl::Collector* collector, uint16_t flush_count) {
-    for (auto& [key, bitmap] : bitmaps) {
-        Bytes etl_key(key.size() + sizeof(uint16_t), '\0');
-        std::memcpy(&etl_key[0], key.data(), key.size());
-        endian::store_big_u16(&etl_key[key.size()], flush_count);
-        collector->collect({etl_key, db::bitmap::to_bytes(bitmap)});
+void Accumulator::add(ByteView key, BlockNum block_number) {
+    if (block_number > UINT32_MAX) {
+        throw std::invalid_argument("Block number " + std::to_string(block_number) + " exceeds 32 bits");
+    }
+    auto it{bitmaps_.find(byte_view_to_string_view(key))};
+    if (it == bitmaps_.end()) {
+        it = bitmaps_.emplace(intern(key), roaring::Roaring()).first;
+        size_bytes_ += key.size() + sizeof(roaring::Roaring);
+    }
+    it->second.add(static_cast<uint32_t>(block_number));
+    size_bytes_ += sizeof(uint32_t);
+}
+
+void Accumulator::clear() {
+    bitmaps_.clear();
+    arena_.clear();
+    arena_offset_ = 0;
+    size_bytes_ = 0;
+}
+
+std::string_view Accumulator::intern(ByteView key) {
+    if (arena_.empty() || arena_offset_ + key.size() > kArenaChunkSize) {
+        arena_.emplace_back(std::make_unique<char[]>(std::max(kArenaChunkSize, key.size())));
+        arena_offset_ = 0;
+    }
+    char* data{arena_.back().get() + arena_offset_};
+    std::memcpy(data, key.data(), key.size());
+    arena_offset_ += key.size();
+    return {data, key.size()};
+}
+
+//! \brief Serializes a 32-bit bitmap in the portable format of a Roaring64Map holding only it (i.e. the one
+//! expected by parse) without copying it into a Roaring64Map first
+static Bytes to_bytes_as_64(const roaring::Roaring& bitmap) {
+    const uint64_t map_size{1};
+    const uint32_t map_key{0};
+    Bytes ret(sizeof(map_size) + sizeof(map_key) + bitmap.getSizeInBytes(/*portable=*/true), '\0');
+    std::memcpy(&ret[0], &map_size, sizeof(map_size));
+    std::memcpy(&ret[sizeof(map_size)], &map_key, sizeof(map_key));
+    bitmap.write(byte_ptr_cast(&ret[sizeof(map_size) + sizeof(map_key)]), /*portable=*/true);
+    return ret;
+}
+
+void IndexLoader::flush_bitmaps_to_etl(Accumulator& bitmaps, etl::Collector* collector, uint16_t flush_count) {
+    static constexpr size_t kMinEntriesPerWorker{4096};
+
+    std::vector<std::pair<const std::string_view, roaring::Roaring>*> items;
+    items.reserve(bitmaps.bitmaps_.size());
+    for (auto& item : bitmaps.bitmaps_) {
+        items.push_back(&item);
+    }
+
+    std::vector<etl::Entry> entries(items.size());
+    const auto serialize = [&items, &entries, flush_count](size_t begin, size_t end) {
+        for (size_t i{begin}; i < end; ++i) {
+            auto& [key, bitmap] = *items[i];
+            bitmap.runOptimize();
+            entries[i].key.reserve(key.size() + sizeof(uint16_t));
+            entries[i].key.assign(string_view_to_byte_view(key)).append(sizeof(uint16_t), '\0');
+            endian::store_big_u16(&entries[i].key[key.size()], flush_count);
+            entries[i].value = to_bytes_as_64(bitmap);
+        }
+    };
+
+    const size_t workers{std::clamp<size_t>(items.size() / kMinEntriesPerWorker, 1,
+                                            std::max(std::thread::hardware_concurrency(), 1u))};
+    const size_t partition_size{(items.size() + workers - 1) / workers};
+    std::vector<std::future<void>> partitions;
+    for (size_t begin{partition_size}; begin < items.size(); begin += partition_size) {
+        partitions.push_back(
+            std::async(std::launch::async, serialize, begin, std::min(begin + partition_size, items.size())));
+    }
+    serialize(0, std::min(partition_size, items.size()));
+    for (auto& partition : partitions) {
+        partition.get();
+    }
+
+    for (auto& entry : entries) {
+        collector->collect(std::move(entry));
     }
     bitmaps.clear();
 }
@@ -16,9 +16,13 @@
 
 #pragma once
 
+#include <memory>
 #include <optional>
+#include <string_view>
+#include <vector>
 
 #include <absl/container/btree_map.h>
+#include <absl/container/flat_hash_map.h>
 
 #pragma GCC diagnostic push
 #pragma GCC diagnostic ignored "-Wold-style-cast"
@@ -43,6 +47,43 @@
 
 namespace silkworm::db::bitmap {
 
+//! \brief Accumulates block numbers per index key into 32-bit roaring bitmaps, ahead of flushing them into an
+//! etl::Collector by means of IndexLoader::flush_bitmaps_to_etl
+//! \remarks Keys are interned into an arena, so each distinct key is copied only once and looked up by view
+class Accumulator {
+  public:
+    Accumulator() = default;
+
+    // Not copyable nor movable: map keys point into the arena
+    Accumulator(const Accumulator&) = delete;
+    Accumulator& operator=(const Accumulator&) = delete;
+
+    //! \brief Adds a block number to the bitmap of provided key
+    //! \remarks Throws if block number does not fit in 32 bits
+    void add(ByteView key, BlockNum block_number);
+
+    //! \brief Returns the estimated amount of memory held by accumulated data (to account flushing threshold)
+    [[nodiscard]] size_t size_bytes() const { return size_bytes_; }
+
+    [[nodiscard]] bool empty() const { return bitmaps_.empty(); }
+
+    //! \brief Drops all accumulated data
+    void clear();
+
+  private:
+    friend class IndexLoader;
+
+    static constexpr size_t kArenaChunkSize{64 * 1024};
+
+    //! \brief Copies key into the arena and returns a view on the copy
+    std::string_view intern(ByteView key);
+
+    std::vector<std::unique_ptr<char[]>> arena_;  // Storage of keys
+    size_t arena_offset_{0};                      // Used bytes in last arena chunk
+    absl::flat_hash_map<std::string_view, roaring::Roaring> bitmaps_;
+    size_t size_bytes_{0};
+};
+
 class IndexLoader {
   public:
     explicit IndexLoader(const db::MapConfig& index_config) : index_config_{index_config} {}
@@ -71,16 +112,16 @@ class IndexLoader {
         return current_key_;
     }
 
-    //! \brief Flushes a collected map of Bitmaps into an etl::Collector taking care of proper keys sorting
-    //! for subsequent load
-    //! \param bitmaps [in] : A map of keys and related bitmaps
+    //! \brief Flushes accumulated bitmaps into an etl::Collector, serialized as expected by merge_bitmaps, and
+    //! clears the accumulator
+    //! \param bitmaps [in] : The accumulator of keys and related bitmaps
     //! \param collector [in] : The collector to flush to
     //! \param flush_count [in]
     //! \remark Etl collector will sort and process entries lexicographically (using both key and value) for this reason
     //! we add flush_count as suffix of key, so we ensure for same account we process entries in the order
-    //! they've been collected. uint16_t maxes 65K flushes
-    static void flush_bitmaps_to_etl(absl::btree_map<Bytes, roaring::Roaring64Map>& bitmaps,
-                                     etl::Collector* collector, uint16_t flush_count);
+    //! they've been collected. uint16_t maxes 65K flushes. As sorting is left to the collector, bitmaps are
+    //! serialized concurrently in partitions of the hash map when they're many
+    static void flush_bitmaps_to_etl(Accumulator& bitmaps, etl::Collector* collector, uint16_t flush_count);
 
   private:
     const db::MapConfig& index_config_;  // The bucket config holding the index of maps
@@ -118,25 +118,32 @@ TEST_CASE("Bitmap Index Loader") {
     const auto address3{0x00000000000000000003_address};
 
     // Note range is [min,max)
-    roaring::Roaring64Map roaring1{roaring::api::roaring_bitmap_from_range(1, 20'001, 1)};
-    roaring::Roaring64Map roaring2{roaring::api::roaring_bitmap_from_range(1, 50'001, 1)};
-    roaring::Roaring64Map roaring3{roaring::api::roaring_bitmap_from_range(40'000, 50'001, 1)};
-
-    absl::btree_map<Bytes, roaring::Roaring64Map> bitmaps{
-        {Bytes(address1.bytes, kAddressLength), roaring1},
-        {Bytes(address2.bytes, kAddressLength), roaring2},
-        {Bytes(address3.bytes, kAddressLength), roaring3},
-    };
+    db::bitmap::Accumulator bitmaps;
+    for (BlockNum block_number{1}; block_number < 20'001; ++block_number) {
+        bitmaps.add(ByteView{address1.bytes, kAddressLength}, block_number);
+    }
+    for (BlockNum block_number{1}; block_number < 50'001; ++block_number) {
+        bitmaps.add(ByteView{address2.bytes, kAddressLength}, block_number);
+    }
+    for (BlockNum block_number{40'000}; block_number < 50'001; ++block_number) {
+        bitmaps.add(ByteView{address3.bytes, kAddressLength}, block_number);
+    }
+    REQUIRE(bitmaps.size_bytes() > 3 * kAddressLength);
+    const size_t bitmaps_count{3};
 
     etl::Collector collector(context.node_settings().data_directory->etl().path());
     db::bitmap::IndexLoader bm_loader(db::table::kLogAddressIndex);
     bm_loader.flush_bitmaps_to_etl(bitmaps, &collector, /*flush_count=*/1);
     REQUIRE(collector.bytes_size());
+    REQUIRE(collector.size() == bitmaps_count);
+    REQUIRE(bitmaps.empty());
+    REQUIRE(bitmaps.size_bytes() == 0);
+    REQUIRE_THROWS_AS(bitmaps.add(ByteView{address1.bytes, kAddressLength}, UINT64_MAX), std::invalid_argument);
 
     // Load into LogAddressIndex
     REQUIRE_NOTHROW(bm_loader.merge_bitmaps(txn, kAddressLength, &collector));
     PooledCursor log_addresses(txn, table::kLogAddressIndex);
-    REQUIRE(log_addresses.size() > bitmaps.size());
+    REQUIRE(log_addresses.size() > bitmaps_count);
 
     // Check we have an incomplete shard for each key
     Bytes key(address1.bytes, kAddressLength);
@@ -24,6 +24,7 @@
 #include <silkworm/core/common/endian.hpp>
 #include <silkworm/infra/common/log.hpp>
 #include <silkworm/infra/common/stopwatch.hpp>
+#include <silkworm/node/backend/state_change_collection.hpp>
 #include <silkworm/node/db/access_layer.hpp>
 #include <silkworm/node/db/tables.hpp>
 #include <silkworm/node/types/log_cbor.hpp>
@@ -64,6 +65,13 @@ void Buffer::update_account(const evmc::address& address, std::optional<Account>
     if (equal) {
         return;
     }
+    if (state_changes_) {
+        if (current) {
+            state_changes_->change_account(address, current->incarnation, current->encode_for_storage());
+        } else {
+            state_changes_->delete_account(address);
+        }
+    }
     auto it{accounts_.find(address)};
     if (it != accounts_.end()) {
         batch_state_size_ -= it->second.has_value() ? sizeof(Account) : 0;
@@ -92,6 +100,9 @@ void Buffer::update_account_code(const evmc::address& address, uint64_t incarnat
     if (storage_prefix_to_code_hash_.insert_or_assign(storage_prefix(address, incarnation), code_hash).second) {
         batch_state_size_ += kPlainStoragePrefixLength + kHashLength;
     }
+    if (state_changes_) {
+        state_changes_->change_code(address, incarnation, Bytes{code});
+    }
 }
 
 void Buffer::update_storage(const evmc::address& address, uint64_t incarnation, const evmc::bytes32& location,
@@ -112,6 +123,9 @@ void Buffer::update_storage(const evmc::address& address, uint64_t incarnation,
     if (storage_[address][incarnation].insert_or_assign(location, current).second) {
         batch_state_size_ += kPlainStoragePrefixLength + kHashLength + kHashLength;
     }
+    if (state_changes_) {
+        state_changes_->change_storage(address, incarnation, location, Bytes{zeroless_view(current)});
+    }
 }
 
 void Buffer::write_history_to_db() {
@@ -217,6 +231,26 @@ void Buffer::write_history_to_db() {
         written_size = 0;
     }
 
+    if (!call_traces_.empty()) {
+        auto call_traces_table{db::open_cursor(txn_, table::kCallTraceSet)};
+        for (const auto& [block_key, accounts] : call_traces_) {
+            auto k{to_slice(block_key)};
+            written_size += k.length();
+            for (const auto& account : accounts) {
+                auto v{to_slice(account)};
+                mdbx::error::success_or_throw(call_traces_table.put(k, &v, MDBX_APPENDDUP));
+                written_size += v.length();
+            }
+        }
+        call_traces_.clear();
+        total_written_size += written_size;
+        if (should_trace) {
+            auto [_, duration]{sw.lap()};
+            log::Trace("Append Call Traces", {"size", human_size(written_size), "in", StopWatch::format(duration)});
+        }
+        written_size = 0;
+    }
+
     batch_history_size_ = 0;
     auto [finish_time, _]{sw.stop()};
     log::Info("Flushed history",
@@ -365,6 +399,31 @@ void Buffer::insert_receipts(uint64_t block_number, const std::vector<Receipt>&
     batch_history_size_ += key.size() + value.size();
 }
 
+void Buffer::insert_call_traces(BlockNum block_number, const CallTraces& traces) {
+    absl::btree_map<evmc::address, uint8_t> touched_accounts;
+    for (const auto& sender : traces.senders) {
+        touched_accounts[sender] |= kCallTraceFromFlag;
+    }
+    for (const auto& recipient : traces.recipients) {
+        touched_accounts[recipient] |= kCallTraceToFlag;
+    }
+    if (touched_accounts.empty()) {
+        return;
+    }
+
+    Bytes key{block_key(block_number)};
+    auto& values{call_traces_[key]};
+    for (const auto& [address, flags] : touched_accounts) {
+        Bytes value(kAddressLength + 1, '\0');
+        std::memcpy(&value[0], address.bytes, kAddressLength);
+        value[kAddressLength] = flags;
+        if (values.insert(std::move(value)).second) {
+            batch_history_size_ += kAddressLength + 1;
+        }
+    }
+    batch_history_size_ += key.size();
+}
+
 evmc::bytes32 Buffer::state_root_hash() const {
     throw std::runtime_error(std::string(__FUNCTION__).append(" not yet implemented"));
 }
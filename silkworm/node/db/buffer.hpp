@@ -20,9 +20,11 @@
 #include <vector>
 
 #include <absl/container/btree_map.h>
+#include <absl/container/btree_set.h>
 #include <absl/container/flat_hash_map.h>
 #include <absl/container/flat_hash_set.h>
 
+#include <silkworm/core/execution/call_traces.hpp>
 #include <silkworm/core/state/state.hpp>
 #include <silkworm/core/trie/hash_builder.hpp>
 #include <silkworm/core/types/account.hpp>
@@ -31,6 +33,10 @@
 #include <silkworm/node/db/mdbx.hpp>
 #include <silkworm/node/db/util.hpp>
 
+namespace silkworm {
+class StateChangeCollection;
+}
+
 namespace silkworm::db {
 
 class Buffer : public State {
@@ -78,6 +84,9 @@ class Buffer : public State {
 
     void insert_receipts(uint64_t block_number, const std::vector<Receipt>& receipts) override;
 
+    //! \brief Stores the accounts involved in the calls executed within specified block as CallTraceSet entries
+    void insert_call_traces(BlockNum block_number, const CallTraces& traces);
+
     /** @name State changes
      *  Change sets are backward changes of the state, i.e. account/storage values <em>at the beginning of a block</em>.
      */
@@ -111,6 +120,10 @@ class Buffer : public State {
         return block_storage_changes_;
     }
 
+    //! \brief Mirrors the state changes of each block into the provided collection (nullptr to disable)
+    //! \remarks A new batch must be started in the collection before each block gets executed
+    void set_state_change_collection(StateChangeCollection* collection) noexcept { state_changes_ = collection; }
+
     //! \brief Approximate size of accrued state in bytes.
     [[nodiscard]] size_t current_batch_state_size() const noexcept { return batch_state_size_; }
 
@@ -155,10 +168,13 @@ class Buffer : public State {
     absl::btree_map<uint64_t, StorageChanges> block_storage_changes_;  // per block
     absl::btree_map<Bytes, Bytes> receipts_;
     absl::btree_map<Bytes, Bytes> logs_;
+    absl::btree_map<Bytes, absl::btree_set<Bytes>> call_traces_;
 
     mutable size_t batch_state_size_{0};    // Accounts in memory data for state
     mutable size_t batch_history_size_{0};  // Accounts in memory data for history
 
+    StateChangeCollection* state_changes_{nullptr};  // Forward state changes for RPC state caches (if any)
+
     // Current block stuff
     uint64_t block_number_{0};
     absl::flat_hash_set<evmc::address> changed_storage_;
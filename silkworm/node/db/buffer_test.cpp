@@ -17,7 +17,9 @@
 #include <catch2/catch.hpp>
 
 #include <silkworm/core/common/endian.hpp>
+#include <silkworm/infra/grpc/common/conversion.hpp>
 #include <silkworm/infra/test_util/log.hpp>
+#include <silkworm/node/backend/state_change_collection.hpp>
 #include <silkworm/node/db/buffer.hpp>
 #include <silkworm/node/db/tables.hpp>
 #include <silkworm/node/test/context.hpp>
@@ -153,4 +155,97 @@ TEST_CASE("Account update") {
     }
 }
 
+TEST_CASE("Call traces insertion") {
+    test_util::SetLogVerbosityGuard log_guard{log::Level::kNone};
+    test::Context context;
+    auto& txn{context.rw_txn()};
+
+    const auto sender{0xbe00000000000000000000000000000000000000_address};
+    const auto recipient{0xaa00000000000000000000000000000000000000_address};
+    const auto self_caller{0xcc00000000000000000000000000000000000000_address};
+
+    CallTraces traces;
+    traces.senders.insert(sender);
+    traces.senders.insert(self_caller);
+    traces.recipients.insert(recipient);
+    traces.recipients.insert(self_caller);
+
+    Buffer buffer{txn, 0};
+    buffer.insert_call_traces(1, traces);
+    buffer.insert_call_traces(2, CallTraces{});  // no entry for blocks without calls
+    REQUIRE(buffer.current_batch_history_size() != 0);
+    REQUIRE_NOTHROW(buffer.write_to_db());
+
+    auto call_traces{db::open_cursor(txn, table::kCallTraceSet)};
+    REQUIRE(txn->get_map_stat(call_traces.map()).ms_entries == 3);
+
+    // Values are sorted by address
+    const std::vector<std::pair<evmc::address, uint8_t>> expected_values{
+        {recipient, kCallTraceToFlag},
+        {sender, kCallTraceFromFlag},
+        {self_caller, kCallTraceFromFlag | kCallTraceToFlag},
+    };
+    auto data{call_traces.to_first()};
+    for (const auto& [address, flags] : expected_values) {
+        REQUIRE(data);
+        CHECK(endian::load_big_u64(db::from_slice(data.key).data()) == 1);
+        const auto value{db::from_slice(data.value)};
+        REQUIRE(value.size() == kAddressLength + 1);
+        CHECK(to_evmc_address(value) == address);
+        CHECK(value[kAddressLength] == flags);
+        data = call_traces.to_next(/*throw_notfound=*/false);
+    }
+    CHECK(!data);
+}
+
+TEST_CASE("State changes mirroring") {
+    test_util::SetLogVerbosityGuard log_guard{log::Level::kNone};
+    test::Context context;
+    auto& txn{context.rw_txn()};
+
+    const auto address{0xbe00000000000000000000000000000000000000_address};
+    const auto deleted_address{0xaa00000000000000000000000000000000000000_address};
+    const auto location{0x0000000000000000000000000000000000000000000000000000000000000013_bytes32};
+    const auto value{0x000000000000000000000000000000000000000000000000000000000000006b_bytes32};
+    const auto block_hash{0x8e38b4dbf6b11fcc3b9dee84fb7986e29ca0a02cecd8977c161ff7333329681e_bytes32};
+
+    Account initial_account;
+    initial_account.incarnation = kDefaultIncarnation;
+    Account current_account{initial_account};
+    current_account.balance = kEther;
+
+    StateChangeCollection state_changes;
+    std::optional<remote::StateChangeBatch> notified_batch;
+    state_changes.subscribe([&](std::optional<remote::StateChangeBatch> batch) { notified_batch = std::move(batch); },
+                            StateChangeFilter{});
+
+    Buffer buffer{txn, 0};
+    buffer.set_state_change_collection(&state_changes);
+    state_changes.start_new_batch(1, block_hash, {}, /*unwind=*/false);
+    buffer.begin_block(1);
+    buffer.update_storage(address, kDefaultIncarnation, location, /*initial=*/{}, /*current=*/value);
+    buffer.update_account(address, initial_account, current_account);
+    buffer.update_account(deleted_address, initial_account, std::nullopt);
+    state_changes.notify_batch(/*pending_base_fee=*/0, /*gas_limit=*/0);
+
+    REQUIRE(notified_batch);
+    REQUIRE(notified_batch->change_batch_size() == 1);
+    const remote::StateChange& state_change{notified_batch->change_batch(0)};
+    CHECK(state_change.block_height() == 1);
+    CHECK(state_change.direction() == remote::Direction::FORWARD);
+    REQUIRE(state_change.changes_size() == 2);
+
+    const remote::AccountChange& account_change{state_change.changes(0)};
+    CHECK(rpc::address_from_H160(account_change.address()) == address);
+    CHECK(account_change.action() == remote::Action::UPSERT);
+    CHECK(account_change.data() == to_hex(current_account.encode_for_storage()));
+    REQUIRE(account_change.storage_changes_size() == 1);
+    CHECK(rpc::bytes32_from_H256(account_change.storage_changes(0).location()) == location);
+    CHECK(account_change.storage_changes(0).data() == to_hex(zeroless_view(value)));
+
+    const remote::AccountChange& deleted_change{state_change.changes(1)};
+    CHECK(rpc::address_from_H160(deleted_change.address()) == deleted_address);
+    CHECK(deleted_change.action() == remote::Action::REMOVE);
+}
+
 }  // namespace silkworm::db
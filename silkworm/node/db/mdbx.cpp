@@ -18,6 +18,7 @@
 
 #include <stdexcept>
 
+#include <silkworm/infra/metrics/metrics.hpp>
 #include <silkworm/node/db/util.hpp>
 
 namespace silkworm::db {
@@ -241,6 +242,20 @@ std::unique_ptr<RWCursorDupSort> RWTxn::rw_cursor_dup_sort(const MapConfig& conf
     return std::make_unique<PooledCursor>(*this, config);
 }
 
+void RWTxn::commit(const bool renew) {
+    if (!commit_disabled_) {
+        static auto& commit_duration{metrics::Registry::instance().histogram(
+            "silkworm_mdbx_commit_duration_seconds", "Duration of MDBX read-write transaction commits", {},
+            /*scale=*/1e-6)};
+        metrics::ScopedTimer timer{commit_duration};
+        mdbx::env env = db();
+        managed_txn_.commit();
+        if (renew) {
+            managed_txn_ = env.start_write();  // renew transaction
+        }
+    }
+}
+
 thread_local ObjectPool<MDBX_cursor, detail::cursor_handle_deleter> PooledCursor::handles_pool_{};
 
 PooledCursor::PooledCursor() {
@@ -61,6 +61,9 @@ inline constexpr const char* kLogIndexKey{"LogIndex"};
 //! \brief Generating call traces index
 inline constexpr const char* kCallTracesKey{"CallTraces"};
 
+//! \brief Generating bit-sliced logs bloom index (from headers)
+inline constexpr const char* kBloomBitsKey{"BloomBits"};
+
 //! \brief Generating transactions lookup index
 inline constexpr const char* kTxLookupKey{"TxLookup"};
 
@@ -96,6 +99,7 @@ inline constexpr const char* kAllStages[]{
     kStorageHistoryIndexKey,
     kLogIndexKey,
     kCallTracesKey,
+    kBloomBitsKey,
     kTxLookupKey,
     kTxPoolKey,
     kFinishKey,
@@ -106,9 +106,25 @@ inline constexpr db::MapConfig kDifficulty{kDifficultyName};
 inline constexpr const char* kBlockReceiptsName{"Receipt"};
 inline constexpr db::MapConfig kBlockReceipts{kBlockReceiptsName};
 
+//! \details Stores the head of each complete section in BloomBits, i.e. the hash of its last block
+//! \struct
+//! \verbatim
+//!   key   : section_u64 (BE)
+//!   value : header hash of block (section + 1) * kBloomBitsSectionSize - 1
+//! \endverbatim
 inline constexpr const char* kBloomBitsIndexName{"BloomBitsIndex"};
 inline constexpr db::MapConfig kBloomBitsIndex{kBloomBitsIndexName};
 
+//! \details Bit-sliced logs bloom of canonical headers, grouped in sections of kBloomBitsSectionSize blocks
+//! \remarks All-zero rows are not stored. Rows are compressed as in go-ethereum bitutil (see compress_bloom_bits_row):
+//! a value shorter than a row is the bitset of the non-zero row bytes, recursively compressed the same way, followed
+//! by the non-zero row bytes. A value as long as a row is the row itself
+//! \struct
+//! \verbatim
+//!   key   : bloom_bit_u16 (BE) + section_u64 (BE)
+//!   value : compressed row of kBloomBitsSectionSize bits, the (i % 8)-th most significant bit of byte i / 8 being
+//!           the bloom bit of block section * kBloomBitsSectionSize + i
+//! \endverbatim
 inline constexpr const char* kBloomBitsName{"BloomBits"};
 inline constexpr db::MapConfig kBloomBits{kBloomBitsName};
 
@@ -91,6 +91,84 @@ Bytes log_key(BlockNum block_number, uint32_t transaction_id) {
     return key;
 }
 
+Bytes bloom_bits_key(uint16_t bit, uint64_t section) {
+    Bytes key(sizeof(uint16_t) + sizeof(uint64_t), '\0');
+    endian::store_big_u16(&key[0], bit);
+    endian::store_big_u64(&key[2], section);
+    return key;
+}
+
+//! Bitset of the non-zero bytes of data, itself encoded recursively, followed by the non-zero bytes (empty if none)
+static Bytes bitset_encode_bytes(ByteView data) {
+    if (data.size() <= 1) {
+        return data.empty() || !data[0] ? Bytes{} : Bytes{data};
+    }
+    Bytes non_zero_bitset((data.size() + 7) / 8, '\0');
+    Bytes non_zero_bytes;
+    non_zero_bytes.reserve(data.size());
+    for (size_t i{0}; i < data.size(); ++i) {
+        if (data[i]) {
+            non_zero_bitset[i / 8] |= static_cast<uint8_t>(0x80u >> (i % 8));
+            non_zero_bytes.push_back(data[i]);
+        }
+    }
+    if (non_zero_bytes.empty()) {
+        return {};
+    }
+    return bitset_encode_bytes(non_zero_bitset) + non_zero_bytes;
+}
+
+//! Decodes size bytes from the prefix of data encoded by bitset_encode_bytes along with the length of such prefix
+static std::optional<std::pair<Bytes, size_t>> bitset_decode_partial_bytes(ByteView data, size_t size) {
+    if (size == 0) {
+        return std::pair{Bytes{}, size_t{0}};
+    }
+    if (size == 1) {
+        if (data.empty()) {
+            return std::pair{Bytes(1, '\0'), size_t{0}};
+        }
+        if (!data[0]) {
+            return std::nullopt;
+        }
+        return std::pair{Bytes{data.substr(0, 1)}, size_t{1}};
+    }
+    const auto non_zero_bitset{bitset_decode_partial_bytes(data, (size + 7) / 8)};
+    if (!non_zero_bitset) {
+        return std::nullopt;
+    }
+    const auto& [bitset, bitset_length] = *non_zero_bitset;
+    size_t pos{bitset_length};
+    Bytes decoded(size, '\0');
+    for (size_t i{0}; i < size; ++i) {
+        if (bitset[i / 8] & (0x80u >> (i % 8))) {
+            if (pos >= data.size() || !data[pos]) {
+                return std::nullopt;
+            }
+            decoded[i] = data[pos++];
+        }
+    }
+    return std::pair{std::move(decoded), pos};
+}
+
+Bytes compress_bloom_bits_row(ByteView row) {
+    Bytes encoded{bitset_encode_bytes(row)};
+    return encoded.size() < row.size() ? encoded : Bytes{row};
+}
+
+std::optional<Bytes> decompress_bloom_bits_row(ByteView data, size_t row_length) {
+    if (data.size() > row_length) {
+        return std::nullopt;
+    }
+    if (data.size() == row_length) {
+        return Bytes{data};
+    }
+    auto decoded{bitset_decode_partial_bytes(data, row_length)};
+    if (!decoded || decoded->second != data.size()) {
+        return std::nullopt;  // not a compressed row or unreferenced trailing data
+    }
+    return std::move(decoded->first);
+}
+
 std::pair<Bytes, Bytes> changeset_to_plainstate_format(const ByteView key, ByteView value) {
     if (key.size() == sizeof(BlockNum)) {
         if (value.length() < kAddressLength) {
@@ -63,6 +63,10 @@ static_assert(kLocationLength == sizeof(evmc::bytes32));
 inline constexpr size_t kPlainStoragePrefixLength{kAddressLength + kIncarnationLength};
 inline constexpr size_t kHashedStoragePrefixLength{kHashLength + kIncarnationLength};
 
+//! Flags marking the role of an account in CallTraceSet values (i.e. address + flags)
+inline constexpr uint8_t kCallTraceFromFlag{1};
+inline constexpr uint8_t kCallTraceToFlag{2};
+
 // address -> storage-encoded initial value
 using AccountChanges = absl::btree_map<evmc::address, Bytes>;
 
@@ -93,6 +97,20 @@ Bytes storage_history_key(const evmc::address& address, const evmc::bytes32& loc
 // Erigon LogKey
 Bytes log_key(BlockNum block_number, uint32_t transaction_id);
 
+//! Number of blocks in each section of the BloomBits index
+inline constexpr BlockNum kBloomBitsSectionSize{4096};
+
+// Erigon BloomBitsKey without the section head hash
+Bytes bloom_bits_key(uint16_t bit, uint64_t section);
+
+//! \brief Compresses a BloomBits row like go-ethereum bitutil.CompressBytes: the bitset of its non-zero bytes,
+//! itself compressed recursively, followed by the non-zero bytes. The row is kept as is if that is not shorter
+Bytes compress_bloom_bits_row(ByteView row);
+
+//! \brief Decompresses a BloomBits row of specified length compressed by compress_bloom_bits_row
+//! \return The row or std::nullopt if data is not a valid compressed row of such length
+std::optional<Bytes> decompress_bloom_bits_row(ByteView data, size_t row_length);
+
 //! \brief Converts change set (AccountChangeSet/StorageChangeSet) entry to plain state format.
 //! \param [in] key : Change set key.
 //! \param [in] value : Change set value.
@@ -60,4 +60,37 @@ TEST_CASE("BlockBodyForStorage encoding") {
     CHECK(decoded == body);
 }
 
+TEST_CASE("BloomBits row compression") {
+    const size_t row_length{kBloomBitsSectionSize / 8};
+
+    SECTION("all-zero row") {
+        CHECK(compress_bloom_bits_row(Bytes(row_length, '\0')).empty());
+        CHECK(decompress_bloom_bits_row({}, row_length) == Bytes(row_length, '\0'));
+    }
+
+    SECTION("sparse row") {
+        CHECK(compress_bloom_bits_row(*from_hex("0000000000000001")) == *from_hex("0101"));
+
+        Bytes row(row_length, '\0');
+        row[0] = 0x04;
+        const Bytes compressed{compress_bloom_bits_row(row)};
+        CHECK(compressed == *from_hex("80808004"));
+        CHECK(decompress_bloom_bits_row(compressed, row_length) == row);
+    }
+
+    SECTION("dense row") {
+        Bytes row(row_length, 0xab);
+        row[1] = 0;
+        CHECK(compress_bloom_bits_row(row) == row);  // compression would not be shorter
+        CHECK(decompress_bloom_bits_row(row, row_length) == row);
+    }
+
+    SECTION("invalid data") {
+        CHECK(decompress_bloom_bits_row(Bytes(row_length + 1, 0xab), row_length) == std::nullopt);
+        CHECK(decompress_bloom_bits_row(*from_hex("00"), row_length) == std::nullopt);        // zero content
+        CHECK(decompress_bloom_bits_row(*from_hex("808080"), row_length) == std::nullopt);    // missing data
+        CHECK(decompress_bloom_bits_row(*from_hex("8080800401"), row_length) == std::nullopt);  // unreferenced data
+    }
+}
+
 }  // namespace silkworm::db::detail
@@ -25,6 +25,7 @@
 #include <silkworm/infra/common/log.hpp>
 #include <silkworm/infra/common/stopwatch.hpp>
 #include <silkworm/infra/concurrency/signal_handler.hpp>
+#include <silkworm/infra/metrics/metrics.hpp>
 
 namespace silkworm::etl {
 
@@ -50,6 +51,14 @@ void Collector::flush_buffer() {
         file_providers_.back()->flush(buffer_);
         buffer_.clear();
         const auto [_, duration]{sw.stop()};
+
+        static auto& spilled_files{metrics::Registry::instance().counter(
+            "silkworm_etl_spilled_files_total", "Number of ETL buffers flushed to disk")};
+        static auto& spilled_bytes{metrics::Registry::instance().counter(
+            "silkworm_etl_spilled_bytes_total", "Number of bytes of ETL buffers flushed to disk")};
+        spilled_files.increment();
+        spilled_bytes.increment(file_providers_.back()->get_file_size());
+
         log::Info("Collector flushed file", {"path", std::string(file_providers_.back()->get_file_name()),
                                              "size", human_size(file_providers_.back()->get_file_size()),
                                              "in", StopWatch::format(duration)});
@@ -0,0 +1,81 @@
+/*
+   Copyright 2023 The Silkworm Authors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <silkworm/core/common/endian.hpp>
+#include <silkworm/core/common/util.hpp>
+#include <silkworm/infra/test_util/log.hpp>
+#include <silkworm/node/db/tables.hpp>
+#include <silkworm/node/etl/collector.hpp>
+#include <silkworm/node/test/context.hpp>
+
+namespace silkworm::etl {
+
+//! Hash-like keys in random order with block-number values, as collected by TxLookup
+static std::vector<Entry> sample_entries(size_t count) {
+    std::vector<Entry> entries;
+    entries.reserve(count);
+    for (uint64_t i{0}; i < count; ++i) {
+        Bytes value(8, '\0');
+        endian::store_big_u64(value.data(), i);
+        entries.push_back({Bytes{keccak256(value).bytes, kHashLength}, value});
+    }
+    return entries;
+}
+
+// Collection only, with a buffer small enough to be flushed to files several times
+static void etl_collect(benchmark::State& state) {
+    test_util::SetLogVerbosityGuard guard{log::Level::kNone};
+    const auto entries{sample_entries(static_cast<size_t>(state.range(0)))};
+    for ([[maybe_unused]] auto _ : state) {
+        Collector collector{/*optimal_size=*/512_Kibi};
+        for (const auto& entry : entries) {
+            collector.collect(entry);
+        }
+        benchmark::DoNotOptimize(collector.size());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+BENCHMARK(etl_collect)->Arg(100'000);
+
+// Collection plus merge-sorted load of the collected files into a table
+static void etl_collect_and_load(benchmark::State& state) {
+    test_util::SetLogVerbosityGuard guard{log::Level::kNone};
+    test::Context context;
+    const auto entries{sample_entries(static_cast<size_t>(state.range(0)))};
+    for ([[maybe_unused]] auto _ : state) {
+        Collector collector{context.dir().etl().path(), /*optimal_size=*/512_Kibi};
+        for (const auto& entry : entries) {
+            collector.collect(entry);
+        }
+        {
+            db::PooledCursor target{context.rw_txn(), db::table::kTxLookup};
+            collector.load(target);
+        }
+        state.PauseTiming();
+        context.rw_txn()->clear_map(db::table::kTxLookup.name);
+        state.ResumeTiming();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+BENCHMARK(etl_collect_and_load)->Arg(100'000);
+
+}  // namespace silkworm::etl
@@ -63,11 +63,12 @@ class NodeImpl final {
     //! The repository for snapshots
     snapshot::SnapshotRepository snapshot_repository_;
 
+    SentryClientPtr sentry_client_;
+    std::unique_ptr<EthereumBackEnd> backend_;
+
     //! The execution layer server engine
     execution::Server execution_server_;
     execution::LocalClient execution_local_client_;
-    SentryClientPtr sentry_client_;
-    std::unique_ptr<EthereumBackEnd> backend_;
     std::unique_ptr<rpc::BackEndKvServer> backend_kv_rpc_server_;
     ResourceUsageLog resource_usage_log_;
 };
@@ -76,11 +77,11 @@ NodeImpl::NodeImpl(Settings& settings, SentryClientPtr sentry_client, mdbx::env&
     : settings_{settings},
       chaindata_db_{chaindata_db},
       snapshot_repository_{settings_.snapshot_settings},
-      execution_server_{settings_, db::RWAccess{chaindata_db_}},
-      execution_local_client_{execution_server_},
       sentry_client_{std::move(sentry_client)},
+      backend_{std::make_unique<EthereumBackEnd>(settings_, &chaindata_db_, sentry_client_)},
+      execution_server_{settings_, db::RWAccess{chaindata_db_}, backend_->state_change_source()},
+      execution_local_client_{execution_server_},
       resource_usage_log_{settings_} {
-    backend_ = std::make_unique<EthereumBackEnd>(settings_, &chaindata_db_, sentry_client_);
     backend_->set_node_name(settings_.node_name);
     backend_kv_rpc_server_ = std::make_unique<rpc::BackEndKvServer>(settings.server_settings, *backend_);
 }
@@ -17,10 +17,12 @@
 #include "repository.hpp"
 
 #include <algorithm>
+#include <atomic>
 #include <memory>
 #include <utility>
 
 #include <silkworm/core/common/assert.hpp>
+#include <silkworm/core/common/lru_cache.hpp>
 #include <silkworm/infra/common/ensure.hpp>
 #include <silkworm/infra/common/log.hpp>
 
@@ -28,7 +30,34 @@ namespace silkworm::snapshot {
 
 namespace fs = std::filesystem;
 
-SnapshotRepository::SnapshotRepository(SnapshotSettings settings) : settings_(std::move(settings)) {}
+//! The max number of recently decoded items kept in each per-thread cache
+static constexpr std::size_t kMaxCachedItemsPerThread{256};
+
+//! Per-thread cache of recently decoded snapshot items keyed by block number
+template <typename T>
+struct RecentItemCache {
+    uint64_t generation{0};
+    lru_cache<BlockNum, T> items{kMaxCachedItemsPerThread};
+
+    //! Get the cache valid for the specified snapshot generation, discarding any stale content
+    static RecentItemCache& for_generation(uint64_t generation) {
+        thread_local RecentItemCache cache;
+        if (cache.generation != generation) {
+            cache.items.clear();
+            cache.generation = generation;
+        }
+        return cache;
+    }
+};
+
+//! Get a new unique generation for the snapshot content, so that caches are never shared among repository instances
+static uint64_t next_generation() {
+    static std::atomic_uint64_t generation{0};
+    return ++generation;
+}
+
+SnapshotRepository::SnapshotRepository(SnapshotSettings settings)
+    : settings_(std::move(settings)), generation_{next_generation()} {}
 
 SnapshotRepository::~SnapshotRepository() {
     close();
@@ -51,6 +80,7 @@ void SnapshotRepository::close() {
     for (const auto& [_, tx_seg] : this->tx_segments_) {
         tx_seg->close();
     }
+    generation_ = next_generation();
 }
 
 std::vector<BlockNumRange> SnapshotRepository::missing_block_ranges() const {
@@ -91,39 +121,93 @@ bool SnapshotRepository::for_each_body(const BodySnapshot::Walker& fn) {
 }
 
 SnapshotRepository::ViewResult SnapshotRepository::view_header_segment(BlockNum number, const HeaderSnapshotWalker& walker) {
-    return view(header_segments_, number, walker);
+    return view(header_segments_by_range_, number, walker);
 }
 
 SnapshotRepository::ViewResult SnapshotRepository::view_body_segment(BlockNum number, const BodySnapshotWalker& walker) {
-    return view(body_segments_, number, walker);
+    return view(body_segments_by_range_, number, walker);
 }
 
 SnapshotRepository::ViewResult SnapshotRepository::view_tx_segment(BlockNum number, const TransactionSnapshotWalker& walker) {
-    return view(tx_segments_, number, walker);
+    return view(tx_segments_by_range_, number, walker);
 }
 
-std::size_t SnapshotRepository::view_header_segments(const HeaderSnapshotWalker& walker) {
+std::size_t SnapshotRepository::view_header_segments(const HeaderSnapshotWalker& walker) const {
     return view(header_segments_, walker);
 }
 
-std::size_t SnapshotRepository::view_body_segments(const BodySnapshotWalker& walker) {
+std::size_t SnapshotRepository::view_body_segments(const BodySnapshotWalker& walker) const {
     return view(body_segments_, walker);
 }
 
-std::size_t SnapshotRepository::view_tx_segments(const TransactionSnapshotWalker& walker) {
+std::size_t SnapshotRepository::view_tx_segments(const TransactionSnapshotWalker& walker) const {
     return view(tx_segments_, walker);
 }
 
 const HeaderSnapshot* SnapshotRepository::find_header_segment(BlockNum number) const {
-    return find_segment(header_segments_, number);
+    return find_segment(header_segments_by_range_, number);
 }
 
 const BodySnapshot* SnapshotRepository::find_body_segment(BlockNum number) const {
-    return find_segment(body_segments_, number);
+    return find_segment(body_segments_by_range_, number);
 }
 
 const TransactionSnapshot* SnapshotRepository::find_tx_segment(BlockNum number) const {
-    return find_segment(tx_segments_, number);
+    return find_segment(tx_segments_by_range_, number);
+}
+
+std::optional<BlockHeader> SnapshotRepository::header_by_number(BlockNum number) const {
+    auto& cache = RecentItemCache<BlockHeader>::for_generation(generation_.load());
+    if (const auto* cached_header = cache.items.get(number)) {
+        return *cached_header;
+    }
+    const auto header_snapshot = find_header_segment(number);
+    if (!header_snapshot) {
+        return {};
+    }
+    auto header = header_snapshot->header_by_number(number);
+    if (header) {
+        cache.items.put(number, *header);
+    }
+    return header;
+}
+
+std::optional<StoredBlockBody> SnapshotRepository::body_by_number(BlockNum number) const {
+    auto& cache = RecentItemCache<StoredBlockBody>::for_generation(generation_.load());
+    if (const auto* cached_body = cache.items.get(number)) {
+        return *cached_body;
+    }
+    const auto body_snapshot = find_body_segment(number);
+    if (!body_snapshot) {
+        return {};
+    }
+    auto body = body_snapshot->body_by_number(number);
+    if (body) {
+        cache.items.put(number, *body);
+    }
+    return body;
+}
+
+std::optional<BlockNum> SnapshotRepository::find_block_number(const Hash& txn_hash) const {
+    // Search for target transaction in reverse order (from the newest segment to the oldest one)
+    for (auto it = tx_segments_.rbegin(); it != tx_segments_.rend(); ++it) {
+        const auto block_number = it->second->block_num_by_txn_hash(txn_hash);
+        if (block_number) {
+            return block_number;
+        }
+    }
+    return {};
+}
+
+std::optional<Transaction> SnapshotRepository::txn_by_hash(const Hash& txn_hash) const {
+    // Search for target transaction in reverse order (from the newest segment to the oldest one)
+    for (auto it = tx_segments_.rbegin(); it != tx_segments_.rend(); ++it) {
+        auto txn = it->second->txn_by_hash(txn_hash);
+        if (txn) {
+            return txn;
+        }
+    }
+    return {};
 }
 
 std::vector<std::shared_ptr<Index>> SnapshotRepository::missing_indexes() const {
@@ -209,6 +293,9 @@ void SnapshotRepository::reopen_list(const SnapshotPathList& segment_files, bool
     }
     segment_max_block_ = segment_max_block;
     idx_max_block_ = max_idx_available();
+
+    reindex_segments();
+    generation_ = next_generation();
 }
 
 bool SnapshotRepository::reopen_header(const SnapshotPath& seg_file) {
@@ -228,18 +315,14 @@ void SnapshotRepository::close_segments_not_in_list(const SnapshotPathList& /*se
 }
 
 template <ConcreteSnapshot T>
-SnapshotRepository::ViewResult SnapshotRepository::view(const SnapshotsByPath<T>& segments, BlockNum number,
+SnapshotRepository::ViewResult SnapshotRepository::view(const SnapshotsByBlockRange<T>& segments, BlockNum number,
                                                         const SnapshotWalker<T>& walker) {
-    // Search for target segment in reverse order (from the newest segment to the oldest one)
-    for (auto it = segments.rbegin(); it != segments.rend(); ++it) {
-        const auto& snapshot = it->second;
-        // We're looking for the segment containing the target block number in its block range
-        if (snapshot->block_from() <= number && number < snapshot->block_to()) {
-            const bool walk_done = walker(snapshot.get());
-            return walk_done ? kWalkSuccess : kWalkFailed;
-        }
+    const auto snapshot = lookup_segment(segments, number);
+    if (!snapshot) {
+        return kSnapshotNotFound;
     }
-    return kSnapshotNotFound;
+    const bool walk_done = walker(snapshot);
+    return walk_done ? kWalkSuccess : kWalkFailed;
 }
 
 template <ConcreteSnapshot T>
@@ -256,20 +339,38 @@ std::size_t SnapshotRepository::view(const SnapshotsByPath<T>& segments, const S
 }
 
 template <ConcreteSnapshot T>
-const T* SnapshotRepository::find_segment(const SnapshotsByPath<T>& segments, BlockNum number) const {
+const T* SnapshotRepository::find_segment(const SnapshotsByBlockRange<T>& segments, BlockNum number) const {
     if (number > max_block_available()) {
         return nullptr;
     }
+    return lookup_segment(segments, number);
+}
 
-    // Search for target segment in reverse order (from the newest segment to the oldest one)
-    for (auto it = segments.rbegin(); it != segments.rend(); ++it) {
-        const auto& snapshot = it->second;
-        // We're looking for the segment containing the target block number in its block range
-        if (snapshot->block_from() <= number && number < snapshot->block_to()) {
-            return snapshot.get();
-        }
+template <ConcreteSnapshot T>
+const T* SnapshotRepository::lookup_segment(const SnapshotsByBlockRange<T>& segments, BlockNum number) {
+    // We're looking for the first segment whose block range ends after the target block number...
+    const auto it = segments.upper_bound(number);
+    if (it == segments.end()) {
+        return nullptr;
     }
-    return nullptr;
+    // ...and starts not after the target block number
+    const auto snapshot = it->second;
+    return snapshot->block_from() <= number ? snapshot : nullptr;
+}
+
+template <ConcreteSnapshot T>
+void SnapshotRepository::index_segments(const SnapshotsByPath<T>& segments, SnapshotsByBlockRange<T>& index) {
+    index.clear();
+    // Segments are ordered by path, so newest segments override oldest ones having the same block range upper bound
+    for (const auto& [_, snapshot] : segments) {
+        index[snapshot->block_to()] = snapshot.get();
+    }
+}
+
+void SnapshotRepository::reindex_segments() {
+    index_segments(header_segments_, header_segments_by_range_);
+    index_segments(body_segments_, body_segments_by_range_);
+    index_segments(tx_segments_, tx_segments_by_range_);
 }
 
 template <ConcreteSnapshot T>
@@ -16,8 +16,10 @@
 
 #pragma once
 
+#include <atomic>
 #include <filesystem>
 #include <functional>
+#include <map>
 #include <optional>
 #include <string>
 #include <type_traits>
@@ -38,6 +40,10 @@ concept ConcreteSnapshot = std::is_base_of<Snapshot, T>::value;
 template <ConcreteSnapshot T>
 using SnapshotsByPath = std::map<std::filesystem::path, std::unique_ptr<T>>;
 
+//! Interval index of snapshots by block range: the key is the (excluded) upper bound of the snapshot block range
+template <ConcreteSnapshot T>
+using SnapshotsByBlockRange = std::map<BlockNum, const T*>;
+
 template <ConcreteSnapshot T>
 using SnapshotWalker = std::function<bool(const T* snapshot)>;
 using HeaderSnapshotWalker = SnapshotWalker<HeaderSnapshot>;
@@ -80,14 +86,29 @@ class SnapshotRepository {
     ViewResult view_body_segment(BlockNum number, const BodySnapshotWalker& walker);
     ViewResult view_tx_segment(BlockNum number, const TransactionSnapshotWalker& walker);
 
-    std::size_t view_header_segments(const HeaderSnapshotWalker& walker);
-    std::size_t view_body_segments(const BodySnapshotWalker& walker);
-    std::size_t view_tx_segments(const TransactionSnapshotWalker& walker);
+    std::size_t view_header_segments(const HeaderSnapshotWalker& walker) const;
+    std::size_t view_body_segments(const BodySnapshotWalker& walker) const;
+    std::size_t view_tx_segments(const TransactionSnapshotWalker& walker) const;
 
     [[nodiscard]] const HeaderSnapshot* find_header_segment(BlockNum number) const;
     [[nodiscard]] const BodySnapshot* find_body_segment(BlockNum number) const;
     [[nodiscard]] const TransactionSnapshot* find_tx_segment(BlockNum number) const;
 
+    //! Read the header at specified height, using the per-thread cache of recently decoded headers
+    [[nodiscard]] std::optional<BlockHeader> header_by_number(BlockNum number) const;
+
+    //! Read the stored body at specified height, using the per-thread cache of recently decoded bodies
+    [[nodiscard]] std::optional<StoredBlockBody> body_by_number(BlockNum number) const;
+
+    //! Find the number of the block containing the transaction with specified hash, if present in any snapshot
+    //! \remarks Probes each transaction segment from the newest one: see txn_by_hash
+    [[nodiscard]] std::optional<BlockNum> find_block_number(const Hash& txn_hash) const;
+
+    //! Read the transaction with specified hash, if present in any snapshot
+    //! \remarks Probes each transaction segment from the newest one, because the txn hash indexes are per-segment
+    //! MPHFs which cannot tell whether a key belongs to their segment, hence cannot pick the segment upfront
+    [[nodiscard]] std::optional<Transaction> txn_by_hash(const Hash& txn_hash) const;
+
     [[nodiscard]] std::vector<std::shared_ptr<Index>> missing_indexes() const;
 
     [[nodiscard]] BlockNum segment_max_block() const { return segment_max_block_; }
@@ -103,13 +124,21 @@ class SnapshotRepository {
     void close_segments_not_in_list(const SnapshotPathList& segment_files);
 
     template <ConcreteSnapshot T>
-    static ViewResult view(const SnapshotsByPath<T>& segments, BlockNum number, const SnapshotWalker<T>& walker);
+    static ViewResult view(const SnapshotsByBlockRange<T>& segments, BlockNum number, const SnapshotWalker<T>& walker);
 
     template <ConcreteSnapshot T>
     static std::size_t view(const SnapshotsByPath<T>& segments, const SnapshotWalker<T>& walker);
 
     template <ConcreteSnapshot T>
-    const T* find_segment(const SnapshotsByPath<T>& segments, BlockNum number) const;
+    const T* find_segment(const SnapshotsByBlockRange<T>& segments, BlockNum number) const;
+
+    template <ConcreteSnapshot T>
+    static const T* lookup_segment(const SnapshotsByBlockRange<T>& segments, BlockNum number);
+
+    template <ConcreteSnapshot T>
+    static void index_segments(const SnapshotsByPath<T>& segments, SnapshotsByBlockRange<T>& index);
+
+    void reindex_segments();
 
     template <ConcreteSnapshot T>
     static bool reopen(SnapshotsByPath<T>& segments, const SnapshotPath& seg_file);
@@ -143,6 +172,14 @@ class SnapshotRepository {
 
     //! The snapshots containing the Transactions
     SnapshotsByPath<TransactionSnapshot> tx_segments_;
+
+    //! The interval indexes of the snapshots by block range
+    SnapshotsByBlockRange<HeaderSnapshot> header_segments_by_range_;
+    SnapshotsByBlockRange<BodySnapshot> body_segments_by_range_;
+    SnapshotsByBlockRange<TransactionSnapshot> tx_segments_by_range_;
+
+    //! The unique generation of the snapshot content, changed at each reopen/close to invalidate per-thread caches
+    std::atomic_uint64_t generation_{0};
 };
 
 }  // namespace silkworm::snapshot
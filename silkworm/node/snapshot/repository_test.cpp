@@ -70,6 +70,11 @@ TEST_CASE("SnapshotRepository::view", "[silkworm][snapshot][snapshot]") {
         CHECK(repository.find_header_segment(14'500'000) == nullptr);
         CHECK(repository.find_body_segment(11'500'000) == nullptr);
         CHECK(repository.find_tx_segment(15'000'000) == nullptr);
+
+        CHECK_FALSE(repository.header_by_number(14'500'000));
+        CHECK_FALSE(repository.body_by_number(11'500'000));
+        CHECK_FALSE(repository.find_block_number(Hash{}));
+        CHECK_FALSE(repository.txn_by_hash(Hash{}));
     }
 
     SECTION("empty snapshots") {
@@ -112,6 +117,14 @@ TEST_CASE("SnapshotRepository::view", "[silkworm][snapshot][snapshot]") {
         CHECK(repository.view_body_segments(successful_walk) == 1);
         CHECK(repository.view_tx_segments(successful_walk) == 1);
 
+        // Block range lower bound is included and upper bound is excluded
+        CHECK(repository.view_header_segment(14'499'999, successful_walk) == ViewResult::kSnapshotNotFound);
+        CHECK(repository.view_header_segment(14'999'999, successful_walk) == ViewResult::kWalkSuccess);
+        CHECK(repository.view_header_segment(15'000'000, successful_walk) == ViewResult::kSnapshotNotFound);
+        CHECK(repository.view_body_segment(11'499'999, successful_walk) == ViewResult::kSnapshotNotFound);
+        CHECK(repository.view_body_segment(11'999'999, successful_walk) == ViewResult::kWalkSuccess);
+        CHECK(repository.view_body_segment(12'000'000, successful_walk) == ViewResult::kSnapshotNotFound);
+
         // CHECK(repository.find_header_segment(14'500'000) != nullptr);  // needs index after check vs max_block_available
         // CHECK(repository.find_body_segment(11'500'000) != nullptr);
         // CHECK(repository.find_tx_segment(15'000'000) != nullptr);
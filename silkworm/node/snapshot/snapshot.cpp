@@ -152,6 +152,23 @@ std::optional<BlockHeader> HeaderSnapshot::header_by_number(BlockNum block_heigh
     return next_header(block_header_offset);
 }
 
+std::optional<Bytes> HeaderSnapshot::header_rlp_by_number(BlockNum block_height) const {
+    if (!idx_header_hash_ or block_height < block_from_ or block_height >= block_to_) {
+        return {};
+    }
+
+    const auto block_header_position = block_height - idx_header_hash_->base_data_id();
+    const auto block_header_offset = idx_header_hash_->ordinal_lookup(block_header_position);
+    auto item = next_item(block_header_offset);
+    if (!item) {
+        return {};
+    }
+    // First byte in data is first byte of header hash: skip it to obtain encoded header RLP data
+    ensure(!item->value.empty(), "HeaderSnapshot: hash first byte missing at offset=" + std::to_string(block_header_offset));
+    item->value.erase(0, 1);
+    return std::move(item->value);
+}
+
 bool HeaderSnapshot::decode_header(const Snapshot::WordItem& item, BlockHeader& header) const {
     // First byte in data is first byte of header hash.
     ensure(!item.value.empty(), "HeaderSnapshot: hash first byte missing at offset=" + std::to_string(item.offset));
@@ -251,6 +268,20 @@ std::optional<StoredBlockBody> BodySnapshot::body_by_number(BlockNum block_heigh
     return next_body(block_body_offset);
 }
 
+std::optional<Bytes> BodySnapshot::body_rlp_by_number(BlockNum block_height) const {
+    if (!idx_body_number_ or block_height < block_from_ or block_height >= block_to_) {
+        return {};
+    }
+
+    const auto block_body_position = block_height - idx_body_number_->base_data_id();
+    const auto block_body_offset = idx_body_number_->ordinal_lookup(block_body_position);
+    auto item = next_item(block_body_offset);
+    if (!item) {
+        return {};
+    }
+    return std::move(item->value);
+}
+
 DecodingResult BodySnapshot::decode_body(const Snapshot::WordItem& item, StoredBlockBody& body) {
     ByteView body_rlp{item.value.data(), item.value.length()};
     SILK_TRACE << "decode_body offset: " << item.offset << " body_rlp: " << to_hex(body_rlp);
@@ -306,9 +337,17 @@ std::optional<Transaction> TransactionSnapshot::txn_by_hash(const Hash& txn_hash
     // Then, get the transaction offset in snapshot by using ordinal lookup
     const auto txn_offset = idx_txn_hash_->ordinal_lookup(txn_position);
     // Finally, read the next transaction at specified offset
-    auto txn = next_txn(txn_offset);
+    const auto item = next_item(txn_offset);
+    // MPHF returns some position also for keys not present in the index, so first compare the stored txn hash prefix
+    if (!item or item->value.empty() or item->value[0] != txn_hash.bytes[0]) {
+        return {};
+    }
+    Transaction txn;
+    if (!decode_txn(*item, txn)) {
+        return {};
+    }
     // We *must* ensure that the retrieved txn hash matches because there is no way to know if key exists in MPHF
-    if (txn and txn->hash() != txn_hash) {
+    if (txn.hash() != txn_hash) {
         return {};
     }
     return txn;
@@ -354,8 +393,6 @@ std::vector<Transaction> TransactionSnapshot::txn_range(uint64_t base_txn_id, ui
         }
 
         transactions.push_back(std::move(transaction));
-
-        transactions.emplace_back();
         return true;
     });
 
@@ -366,7 +403,16 @@ std::vector<Bytes> TransactionSnapshot::txn_rlp_range(uint64_t base_txn_id, uint
     std::vector<Bytes> rlp_txs;
     rlp_txs.reserve(txn_count);
 
-    for_each_txn(base_txn_id, txn_count, [&rlp_txs](uint64_t i, ByteView /*senders_data*/, ByteView tx_rlp) -> bool {
+    for_each_txn_rlp(base_txn_id, txn_count, [&rlp_txs](uint64_t /*i*/, ByteView tx_rlp) -> bool {
+        rlp_txs.emplace_back(tx_rlp);
+        return true;
+    });
+
+    return rlp_txs;
+}
+
+void TransactionSnapshot::for_each_txn_rlp(uint64_t base_txn_id, uint64_t txn_count, const RlpWalker& walker) const {
+    for_each_txn(base_txn_id, txn_count, [&walker](uint64_t i, ByteView /*senders_data*/, ByteView tx_rlp) -> bool {
         ByteView tx_envelope{tx_rlp};
 
         rlp::Header tx_header;
@@ -378,11 +424,35 @@ std::vector<Bytes> TransactionSnapshot::txn_rlp_range(uint64_t base_txn_id, uint
         const std::size_t tx_payload_offset =
             tx_type == TransactionType::kLegacy ? 0 : (tx_envelope.length() - tx_header.payload_length);
 
-        rlp_txs.emplace_back(tx_rlp.substr(tx_payload_offset));
+        return walker(i, tx_rlp.substr(tx_payload_offset));
+    });
+}
+
+std::vector<evmc::address> TransactionSnapshot::txn_senders_range(uint64_t base_txn_id, uint64_t txn_count) const {
+    std::vector<evmc::address> senders;
+    senders.reserve(txn_count);
+
+    for_each_txn(base_txn_id, txn_count, [&senders](uint64_t /*i*/, ByteView senders_data, ByteView /*tx_rlp*/) -> bool {
+        senders.push_back(to_evmc_address(senders_data));
         return true;
     });
 
-    return rlp_txs;
+    return senders;
+}
+
+std::optional<BlockNum> TransactionSnapshot::block_num_by_txn_hash(const Hash& txn_hash) const {
+    if (!idx_txn_hash_2_block_) {
+        return {};
+    }
+
+    // First, get the candidate block number by using transaction hash as MPHF index
+    const BlockNum block_number = idx_txn_hash_2_block_->lookup(txn_hash);
+
+    // Then, we *must* ensure that the transaction exists because there is no way to know if key exists in MPHF
+    if (!txn_by_hash(txn_hash)) {
+        return {};
+    }
+    return block_number;
 }
 
 //! Decode transaction from snapshot word. Format is: tx_hash_1byte + sender_address_20byte + tx_rlp_bytes
@@ -93,6 +93,9 @@ class HeaderSnapshot : public Snapshot {
     [[nodiscard]] std::optional<BlockHeader> header_by_hash(const Hash& block_hash) const;
     [[nodiscard]] std::optional<BlockHeader> header_by_number(BlockNum block_height) const;
 
+    //! Read the RLP-encoded header at the specified height without decoding it
+    [[nodiscard]] std::optional<Bytes> header_rlp_by_number(BlockNum block_height) const;
+
     void reopen_index() override;
 
   protected:
@@ -124,6 +127,9 @@ class BodySnapshot : public Snapshot {
 
     [[nodiscard]] std::optional<StoredBlockBody> body_by_number(BlockNum block_height) const;
 
+    //! Read the RLP-encoded stored body at the specified height without decoding it
+    [[nodiscard]] std::optional<Bytes> body_rlp_by_number(BlockNum block_height) const;
+
     void reopen_index() override;
 
   protected:
@@ -153,6 +159,15 @@ class TransactionSnapshot : public Snapshot {
     [[nodiscard]] std::vector<Transaction> txn_range(uint64_t base_txn_id, uint64_t txn_count, bool read_senders) const;
     [[nodiscard]] std::vector<Bytes> txn_rlp_range(uint64_t base_txn_id, uint64_t txn_count) const;
 
+    //! Walk the RLP-encoded transactions starting from base_txn_id until txn_count is reached or walker returns false
+    using RlpWalker = std::function<bool(uint64_t i, ByteView txn_rlp)>;
+    void for_each_txn_rlp(uint64_t base_txn_id, uint64_t txn_count, const RlpWalker& walker) const;
+
+    [[nodiscard]] std::vector<evmc::address> txn_senders_range(uint64_t base_txn_id, uint64_t txn_count) const;
+
+    //! Get the number of the block containing the transaction with specified hash, if present in this snapshot
+    [[nodiscard]] std::optional<BlockNum> block_num_by_txn_hash(const Hash& txn_hash) const;
+
     void reopen_index() override;
 
   protected:
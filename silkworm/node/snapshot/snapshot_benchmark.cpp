@@ -0,0 +1,71 @@
+/*
+   Copyright 2023 The Silkworm Authors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#include <benchmark/benchmark.h>
+
+#include <silkworm/core/common/util.hpp>
+#include <silkworm/infra/common/log.hpp>
+#include <silkworm/infra/test_util/log.hpp>
+#include <silkworm/node/db/tables.hpp>
+#include <silkworm/node/db/util.hpp>
+#include <silkworm/node/snapshot/index.hpp>
+#include <silkworm/node/snapshot/snapshot.hpp>
+#include <silkworm/node/test/context.hpp>
+#include <silkworm/node/test/snapshots.hpp>
+
+namespace silkworm::snapshot {
+
+//! The block number of the real body contained in the sample snapshots (the others are fillers)
+static constexpr BlockNum kSampleBlockNumber{1'500'013};
+
+//! The RLP-encoded stored body for block 1'500'013 on mainnet, the same contained in the sample body snapshot
+static const Bytes kSampleStoredBodyRlp{*from_hex("c6837004d901c0")};
+
+static void benchmark_body_rlp_snapshot(benchmark::State& state) {
+    test_util::SetLogVerbosityGuard guard{log::Level::kNone};
+    test::SampleBodySnapshotFile body_snapshot_file{};
+    test::SampleBodySnapshotPath body_snapshot_path{body_snapshot_file.path()};
+    BodyIndex body_index{body_snapshot_path};
+    body_index.build();
+
+    BodySnapshot body_snapshot{body_snapshot_path.path(), body_snapshot_path.block_from(), body_snapshot_path.block_to()};
+    body_snapshot.reopen_segment();
+    body_snapshot.reopen_index();
+
+    for ([[maybe_unused]] auto _ : state) {
+        const auto body_rlp{body_snapshot.body_rlp_by_number(kSampleBlockNumber)};
+        benchmark::DoNotOptimize(body_rlp);
+    }
+}
+
+BENCHMARK(benchmark_body_rlp_snapshot);
+
+static void benchmark_body_rlp_mdbx(benchmark::State& state) {
+    test::Context context;
+    const auto block_key{db::block_key(kSampleBlockNumber)};
+    auto bodies_cursor{context.rw_txn().rw_cursor(db::table::kBlockBodies)};
+    bodies_cursor->upsert(db::to_slice(block_key), db::to_slice(kSampleStoredBodyRlp));
+
+    for ([[maybe_unused]] auto _ : state) {
+        const auto result{bodies_cursor->find(db::to_slice(block_key), /*throw_notfound=*/false)};
+        const Bytes body_rlp{db::from_slice(result.value)};
+        benchmark::DoNotOptimize(body_rlp);
+    }
+}
+
+BENCHMARK(benchmark_body_rlp_mdbx);
+
+}  // namespace silkworm::snapshot
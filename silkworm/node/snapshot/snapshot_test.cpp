@@ -150,4 +150,40 @@ TEST_CASE("BodySnapshot::body_by_number OK", "[silkworm][snapshot][index]") {
     }
 }
 
+TEST_CASE("TransactionSnapshot::txn_by_hash OK", "[silkworm][snapshot][index]") {
+    test_util::SetLogVerbosityGuard guard{log::Level::kNone};
+    test::SampleBodySnapshotFile valid_body_snapshot{};
+    test::SampleTransactionSnapshotFile valid_tx_snapshot{};
+    test::SampleTransactionSnapshotPath tx_snapshot_path{valid_tx_snapshot.path()};  // necessary to tweak the block numbers
+    TransactionIndex tx_index{tx_snapshot_path};
+    CHECK_NOTHROW(tx_index.build());
+
+    TransactionSnapshot tx_snapshot{tx_snapshot_path.path(), tx_snapshot_path.block_from(), tx_snapshot_path.block_to()};
+    tx_snapshot.reopen_segment();
+    tx_snapshot.reopen_index();
+    const auto transaction = tx_snapshot.txn_by_id(7'341'273);
+    REQUIRE(transaction.has_value());
+    const Hash txn_hash{transaction->hash()};
+
+    SECTION("present hash") {
+        const auto txn = tx_snapshot.txn_by_hash(txn_hash);
+        CHECK(txn == transaction);
+        CHECK(tx_snapshot.block_num_by_txn_hash(txn_hash) == 1'500'013);
+    }
+
+    SECTION("absent hash w/ different first byte") {
+        Hash absent_hash{txn_hash};
+        absent_hash.bytes[0] ^= 0xff;
+        CHECK_FALSE(tx_snapshot.txn_by_hash(absent_hash));
+        CHECK_FALSE(tx_snapshot.block_num_by_txn_hash(absent_hash));
+    }
+
+    SECTION("absent hash w/ same first byte") {
+        Hash absent_hash{txn_hash};
+        absent_hash.bytes[kHashLength - 1] ^= 0xff;
+        CHECK_FALSE(tx_snapshot.txn_by_hash(absent_hash));
+        CHECK_FALSE(tx_snapshot.block_num_by_txn_hash(absent_hash));
+    }
+}
+
 }  // namespace silkworm::snapshot
@@ -27,10 +27,11 @@ namespace silkworm::stagedsync {
 
 using namespace boost::asio;
 
-ExecutionEngine::ExecutionEngine(asio::io_context& ctx, NodeSettings& ns, db::RWAccess dba)
+ExecutionEngine::ExecutionEngine(asio::io_context& ctx, NodeSettings& ns, db::RWAccess dba,
+                                 StateChangeCollection* state_change_collection)
     : io_context_{ctx},
       node_settings_{ns},
-      main_chain_(ctx, ns, dba),
+      main_chain_(ctx, ns, dba, state_change_collection),
       block_cache_{kDefaultCacheSize} {
     last_finalized_block_ = main_chain_.last_finalized_head();
     last_fork_choice_ = main_chain_.last_chosen_head();
@@ -213,6 +214,9 @@ bool ExecutionEngine::notify_fork_choice_update(Hash head_block_hash, std::optio
         last_finalized_block_ = {finalized_header->number, *finalized_block_hash};
     }
 
+    // index stages deferred while verifying at chain tip catch up in background, after fork choice has been replied
+    asio::post(io_context_, [this]() { main_chain_.forward_deferred_stages(); });
+
     return true;
 }
 
@@ -56,7 +56,8 @@ namespace asio = boost::asio;
  */
 class ExecutionEngine : public Stoppable {
   public:
-    explicit ExecutionEngine(asio::io_context&, NodeSettings&, db::RWAccess);
+    explicit ExecutionEngine(asio::io_context&, NodeSettings&, db::RWAccess,
+                             StateChangeCollection* state_change_collection = nullptr);
 
     void open();  // needed to circumvent mdbx threading model limitations
     void close();
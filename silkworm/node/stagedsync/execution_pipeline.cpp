@@ -16,12 +16,19 @@
 
 #include "execution_pipeline.hpp"
 
+#include <algorithm>
+#include <future>
+
 #include <boost/format.hpp>
+#include <gsl/util>
 #include <magic_enum.hpp>
 
 #include <silkworm/infra/common/environment.hpp>
+#include <silkworm/infra/metrics/metrics.hpp>
 #include <silkworm/node/stagedsync/stages/stage_blockhashes.hpp>
+#include <silkworm/node/stagedsync/stages/stage_bloom_bits.hpp>
 #include <silkworm/node/stagedsync/stages/stage_bodies.hpp>
+#include <silkworm/node/stagedsync/stages/stage_call_trace_index.hpp>
 #include <silkworm/node/stagedsync/stages/stage_execution.hpp>
 #include <silkworm/node/stagedsync/stages/stage_finish.hpp>
 #include <silkworm/node/stagedsync/stages/stage_hashstate.hpp>
@@ -40,6 +47,16 @@ static const std::chrono::milliseconds kStageDurationThresholdForLog{10};
 static const std::chrono::milliseconds kStageDurationThresholdForLog{0};
 #endif
 
+//! Max number of blocks a forward cycle may span to run in tip mode, i.e. with index stages deferred
+static constexpr BlockNum kTipModeMaxBlocks{1};
+
+static void observe_stage_duration(const char* stage_id, const char* op, StopWatch::Duration duration) {
+    metrics::Registry::instance()
+        .histogram("silkworm_stage_duration_seconds", "Duration of staged sync stage runs",
+                   {{"stage", stage_id}, {"op", op}}, /*scale=*/1e-6)
+        .observe(duration);
+}
+
 class ExecutionPipeline::LogTimer : public Timer {
     ExecutionPipeline* pipeline_;
 
@@ -68,9 +85,11 @@ class ExecutionPipeline::LogTimer : public Timer {
     }
 };
 
-ExecutionPipeline::ExecutionPipeline(silkworm::NodeSettings* node_settings)
+ExecutionPipeline::ExecutionPipeline(silkworm::NodeSettings* node_settings,
+                                     StateChangeCollection* state_change_collection)
     : node_settings_{node_settings},
       sync_context_{std::make_unique<SyncContext>()} {
+    sync_context_->state_change_collection = state_change_collection;
     load_stages();
 }
 
@@ -104,9 +123,12 @@ std::optional<Hash> ExecutionPipeline::bad_block() {
  * 10 StageTrie -> stagedsync::InterHashes
  * 11 StageHistory -> stagedsync::HistoryIndex
  * 12 StageLogIndex -> stagedsync::LogIndex
- * 13 StageCallTraces -> TBD
+ * 13 StageCallTraces -> stagedsync::CallTraceIndex
  * 14 StageTxLookup -> stagedsync::TxLookup
  * 15 StageFinish -> stagedsync::Finish
+ *
+ * Silkworm only stages
+ *  - stagedsync::BloomBitsIndex (after stagedsync::CallTraceIndex)
  */
 
 void ExecutionPipeline::load_stages() {
@@ -128,6 +150,10 @@ void ExecutionPipeline::load_stages() {
                     std::make_unique<stagedsync::HistoryIndex>(node_settings_, sync_context_.get()));
     stages_.emplace(db::stages::kLogIndexKey,
                     std::make_unique<stagedsync::LogIndex>(node_settings_, sync_context_.get()));
+    stages_.emplace(db::stages::kCallTracesKey,
+                    std::make_unique<stagedsync::CallTraceIndex>(node_settings_, sync_context_.get()));
+    stages_.emplace(db::stages::kBloomBitsKey,
+                    std::make_unique<stagedsync::BloomBitsIndex>(node_settings_, sync_context_.get()));
     stages_.emplace(db::stages::kTxLookupKey,
                     std::make_unique<stagedsync::TxLookup>(node_settings_, sync_context_.get()));
     stages_.emplace(db::stages::kFinishKey,
@@ -145,6 +171,8 @@ void ExecutionPipeline::load_stages() {
                                      db::stages::kIntermediateHashesKey,
                                      db::stages::kHistoryIndexKey,
                                      db::stages::kLogIndexKey,
+                                     db::stages::kCallTracesKey,
+                                     db::stages::kBloomBitsKey,
                                      db::stages::kTxLookupKey,
                                      db::stages::kFinishKey,
                                  });
@@ -153,6 +181,8 @@ void ExecutionPipeline::load_stages() {
                                 {
                                     db::stages::kFinishKey,
                                     db::stages::kTxLookupKey,
+                                    db::stages::kBloomBitsKey,
+                                    db::stages::kCallTracesKey,
                                     db::stages::kLogIndexKey,
                                     db::stages::kHistoryIndexKey,
                                     db::stages::kHashStateKey,           // Needs to happen before unwinding Execution
@@ -163,6 +193,26 @@ void ExecutionPipeline::load_stages() {
                                     db::stages::kBlockHashesKey,  // Decanonify block hashes
                                     db::stages::kHeadersKey,
                                 });
+
+    // These stages only read committed data while extracting into etl, hence their extract phases can run
+    // concurrently on separate read-only transactions while load phases are still serialized on the cycle one
+    stages_concurrent_extract_.insert(stages_concurrent_extract_.begin(),
+                                      {
+                                          db::stages::kHistoryIndexKey,
+                                          db::stages::kLogIndexKey,
+                                          db::stages::kTxLookupKey,
+                                      });
+
+    // These stages only build indexes for data already verified, hence at chain tip they can be deferred to keep the
+    // latency of new block verification as low as possible
+    stages_deferred_at_tip_.insert(stages_deferred_at_tip_.begin(),
+                                   {
+                                       db::stages::kHistoryIndexKey,
+                                       db::stages::kLogIndexKey,
+                                       db::stages::kCallTracesKey,
+                                       db::stages::kBloomBitsKey,
+                                       db::stages::kTxLookupKey,
+                                   });
 }
 
 bool ExecutionPipeline::stop() {
@@ -187,6 +237,20 @@ Stage::Result ExecutionPipeline::forward(db::RWTxn& cycle_txn, BlockNum target_h
         Stage::Result result = Stage::Result::kSuccess;
         auto stop_stage_name = Environment::get_stop_before_stage();  // force to stop at any particular stage ?
 
+        std::map<const char*, std::future<Stage::Result>> extractions;  // Pending extract phases by stage
+        // Whatever the exit path, data extracted ahead for stages not forwarded in this cycle must not be reused later
+        auto discard_pending_extractions = gsl::finally([&] {
+            for (auto& [extract_stage_id, extraction] : extractions) {
+                extraction.wait();
+                stages_.at(extract_stage_id)->discard_extraction();
+            }
+        });
+
+        // Tip mode: the whole cycle runs into one transaction to verify just the new block(s) at the chain tip
+        const auto execution_progress{db::stages::read_stage_progress(cycle_txn, db::stages::kExecutionKey)};
+        const bool tip_mode{cycle_txn.commit_disabled() && target_height > execution_progress &&
+                            target_height - execution_progress <= kTipModeMaxBlocks};
+
         current_stages_count_ = stages_forward_order_.size();
         current_stage_number_ = 0;
         for (auto& stage_id : stages_forward_order_) {
@@ -198,6 +262,11 @@ Stage::Result ExecutionPipeline::forward(db::RWTxn& cycle_txn, BlockNum target_h
             ++current_stage_number_;
             current_stage_->second->set_log_prefix(get_log_prefix());
 
+            if (tip_mode && std::find(stages_deferred_at_tip_.cbegin(), stages_deferred_at_tip_.cend(), stage_id) !=
+                                stages_deferred_at_tip_.cend()) {
+                continue;  // will catch up later in forward_deferred
+            }
+
             // check if we have to stop due to environment variable
             if (stop_stage_name && stop_stage_name == stage_id) {
                 log::Warning("Stopping ...", {"STOP_BEFORE_STAGE", stop_stage_name->c_str(), "hit", "true"});
@@ -207,6 +276,35 @@ Stage::Result ExecutionPipeline::forward(db::RWTxn& cycle_txn, BlockNum target_h
 
             log_timer.reset();  // Resets the interval for next log line from now
 
+            // Read-only transactions only see committed data: when commits are disabled (i.e. the whole cycle runs
+            // into one transaction) extract phases cannot run ahead and each stage extracts within forward instead
+            if (!stages_concurrent_extract_.empty() && stage_id == stages_concurrent_extract_.front() &&
+                !cycle_txn.commit_disabled()) {
+                cycle_txn.commit();
+                for (const auto& extract_stage_id : stages_concurrent_extract_) {
+                    auto* stage{stages_.at(extract_stage_id).get()};
+                    auto extract = [stage, extract_stage_id, env = cycle_txn.db()]() mutable {
+                        StopWatch extract_stop_watch(true);
+                        db::ROTxn extract_txn{env};
+                        const auto extract_result = stage->forward_extract(extract_txn);
+                        auto [_, extract_duration] = extract_stop_watch.lap();
+                        observe_stage_duration(extract_stage_id, "extract", extract_duration);
+                        return extract_result;
+                    };
+                    extractions.emplace(extract_stage_id, std::async(std::launch::async, std::move(extract)));
+                }
+            }
+            if (auto extraction{extractions.find(stage_id)}; extraction != extractions.end()) {
+                const auto extract_result = extraction->second.get();
+                extractions.erase(extraction);
+                if (extract_result != Stage::Result::kSuccess) {
+                    auto result_description = std::string(magic_enum::enum_name<Stage::Result>(extract_result));
+                    log::Error(get_log_prefix(), {"op", "Extract", "returned", result_description});
+                    log::Error("ExecPipeline") << "Forward interrupted due to stage " << current_stage_->first << " failure";
+                    return extract_result;
+                }
+            }
+
             // forward
             const auto stage_result = current_stage_->second->forward(cycle_txn);
 
@@ -224,6 +322,7 @@ Stage::Result ExecutionPipeline::forward(db::RWTxn& cycle_txn, BlockNum target_h
             }
 
             auto [_, stage_duration] = stages_stop_watch.lap();
+            observe_stage_duration(current_stage_->first, "forward", stage_duration);
             if (stage_duration > kStageDurationThresholdForLog) {
                 log::Info(get_log_prefix(), {"op", "Forward", "done", StopWatch::format(stage_duration)});
             }
@@ -252,6 +351,35 @@ Stage::Result ExecutionPipeline::forward(db::RWTxn& cycle_txn, BlockNum target_h
     }
 }
 
+Stage::Result ExecutionPipeline::forward_deferred(db::RWTxn& cycle_txn) {
+    try {
+        current_stages_count_ = stages_deferred_at_tip_.size();
+        current_stage_number_ = 0;
+        for (const auto& stage_id : stages_deferred_at_tip_) {
+            current_stage_ = stages_.find(stage_id);
+            if (current_stage_ == stages_.end()) {
+                throw std::runtime_error("Stage " + std::string(stage_id) + " requested but not implemented");
+            }
+            ++current_stage_number_;
+            current_stage_->second->set_log_prefix(get_log_prefix());
+
+            // each stage forwards up to the progress of its upstream stage, which is a no-op if already there
+            const auto stage_result = current_stage_->second->forward(cycle_txn);
+            if (stage_result != Stage::Result::kSuccess) {
+                auto result_description = std::string(magic_enum::enum_name<Stage::Result>(stage_result));
+                log::Error(get_log_prefix(), {"op", "Forward deferred", "returned", result_description});
+                return stage_result;
+            }
+        }
+        return Stage::Result::kSuccess;
+
+    } catch (const std::exception& ex) {
+        log::Error(get_log_prefix(), {"exception", std::string(ex.what())});
+        log::Error("ExecPipeline") << "Forward deferred aborted due to exception: " << ex.what();
+        return Stage::Result::kUnexpectedError;
+    }
+}
+
 Stage::Result ExecutionPipeline::unwind(db::RWTxn& cycle_txn, BlockNum unwind_point) {
     using std::to_string;
     StopWatch stages_stop_watch(true);
@@ -284,6 +412,7 @@ Stage::Result ExecutionPipeline::unwind(db::RWTxn& cycle_txn, BlockNum unwind_po
 
             // Log performances
             auto [_, stage_duration] = stages_stop_watch.lap();
+            observe_stage_duration(current_stage_->first, "unwind", stage_duration);
             if (stage_duration > kStageDurationThresholdForLog) {
                 log::Info(get_log_prefix(), {"op", "Unwind", "done", StopWatch::format(stage_duration)});
             }
@@ -339,6 +468,7 @@ Stage::Result ExecutionPipeline::prune(db::RWTxn& cycle_txn) {
             }
 
             auto [_, stage_duration] = stages_stop_watch.lap();
+            observe_stage_duration(current_stage_->first, "prune", stage_duration);
             if (stage_duration > kStageDurationThresholdForLog) {
                 log::Info(get_log_prefix(), {"op", "Prune", "done", StopWatch::format(stage_duration)});
             }
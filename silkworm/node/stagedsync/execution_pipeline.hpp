@@ -29,10 +29,11 @@ namespace silkworm::stagedsync {
 
 class ExecutionPipeline : public Stoppable {
   public:
-    explicit ExecutionPipeline(NodeSettings*);
+    explicit ExecutionPipeline(NodeSettings*, StateChangeCollection* state_change_collection = nullptr);
     ~ExecutionPipeline() = default;
 
     Stage::Result forward(db::RWTxn&, BlockNum target_height);
+    Stage::Result forward_deferred(db::RWTxn&);  // Catches up the stages deferred by tip-mode forward (if any)
     Stage::Result unwind(db::RWTxn&, BlockNum unwind_point);
     Stage::Result prune(db::RWTxn&);
 
@@ -53,6 +54,8 @@ class ExecutionPipeline : public Stoppable {
     Stage_Container::iterator current_stage_;
     std::vector<const char*> stages_forward_order_;
     std::vector<const char*> stages_unwind_order_;
+    std::vector<const char*> stages_concurrent_extract_;  // Stages whose extract phases run concurrently in forward
+    std::vector<const char*> stages_deferred_at_tip_;     // Stages not needed to verify blocks, skipped in tip mode
     std::atomic<size_t> current_stages_count_{0};
     std::atomic<size_t> current_stage_number_{0};
 
@@ -18,8 +18,12 @@
 
 #include <set>
 
+#include <magic_enum.hpp>
+
 #include <silkworm/core/common/as_range.hpp>
+#include <silkworm/core/protocol/validation.hpp>
 #include <silkworm/infra/common/ensure.hpp>
+#include <silkworm/node/backend/state_change_collection.hpp>
 #include <silkworm/node/db/access_layer.hpp>
 #include <silkworm/node/db/db_utils.hpp>
 
@@ -27,13 +31,15 @@
 
 namespace silkworm::stagedsync {
 
-MainChain::MainChain(asio::io_context& ctx, NodeSettings& ns, const db::RWAccess dba)
+MainChain::MainChain(asio::io_context& ctx, NodeSettings& ns, const db::RWAccess dba,
+                     StateChangeCollection* state_change_collection)
     : io_context_{ctx},
       node_settings_{ns},
       db_access_{dba},
       tx_{db_access_.start_rw_tx()},
       data_model_{tx_},
-      pipeline_{&ns},
+      state_change_collection_{state_change_collection},
+      pipeline_{&ns, state_change_collection},
       canonical_chain_(tx_) {
     auto last_finalized_hash = db::read_last_finalized_block(tx_);
     if (last_finalized_hash) {
@@ -136,6 +142,11 @@ auto MainChain::verify_chain(Hash head_block_hash) -> VerificationResult {
     bool commit_at_each_stage = is_first_sync_;
     if (!commit_at_each_stage) tx_.disable_commit();
 
+    // whole cycle runs into one transaction: execution collects state changes on its behalf until commit
+    if (!commit_at_each_stage && state_change_collection_ && state_change_collection_->tx_id() != tx_.id()) {
+        state_change_collection_->reset(tx_.id());
+    }
+
     // the new head is on a new fork?
     BlockId forking_point = canonical_chain_.find_forking_point(*head_header, head_block_hash);  // the forking origin
 
@@ -220,7 +231,9 @@ bool MainChain::notify_fork_choice_update(Hash head_block_hash, std::optional<Ha
     db::write_last_head_block(tx_, head_block_hash);
     if (finalized_block_hash) db::write_last_finalized_block(tx_, *finalized_block_hash);
 
+    const auto committed_tx_id{tx_.id()};
     tx_.commit_and_renew();
+    notify_state_changes(committed_tx_id);
 
     last_fork_choice_ = canonical_chain_.current_head();
     if (finalized_block_hash) {
@@ -233,6 +246,16 @@ bool MainChain::notify_fork_choice_update(Hash head_block_hash, std::optional<Ha
     return true;
 }
 
+void MainChain::forward_deferred_stages() {
+    // stages commit on their own: do not commit on behalf of a chain verified but not yet chosen
+    if (canonical_chain_.current_head() != last_fork_choice_) return;
+
+    const auto result = pipeline_.forward_deferred(tx_);
+    if (result != Stage::Result::kSuccess) {
+        SILK_WARN << "MainChain: deferred stages failed, will retry: " << magic_enum::enum_name<Stage::Result>(result);
+    }
+}
+
 std::set<Hash> MainChain::collect_bad_headers(db::RWTxn& tx, InvalidChain& invalid_chain) {
     if (!invalid_chain.bad_block) return {};
 
@@ -276,12 +299,36 @@ void MainChain::reintegrate_fork(ExtendingFork& extending_fork) {
 
     fork->flush(tx_);  // this must be done here, in the tx_ thread, due to MDBX limitations
 
+    const auto committed_tx_id{tx_.id()};
     tx_.commit_and_renew();
 
     canonical_chain_.set_current_head(fork->current_head());
     canonical_head_status_ = *fork->head_status();
     last_fork_choice_ = fork->current_head();
     last_finalized_head_ = fork->finalized_head();
+
+    // fork state changes are not collected: an empty batch at least signals the new state version
+    notify_state_changes(committed_tx_id);
+}
+
+void MainChain::notify_state_changes(uint64_t committed_tx_id) {
+    if (!state_change_collection_) return;
+
+    // changes collected on behalf of other transactions (if any) are stale
+    if (state_change_collection_->tx_id() != committed_tx_id) {
+        state_change_collection_->reset(committed_tx_id);
+    }
+
+    uint64_t pending_base_fee{0};
+    uint64_t block_gas_limit{0};
+    const auto head = canonical_chain_.current_head();
+    if (auto head_header = get_header(head.number, head.hash); head_header) {
+        const auto revision{node_settings_.chain_config->revision(head_header->number + 1, head_header->timestamp)};
+        const auto base_fee{protocol::expected_base_fee_per_gas(*head_header, revision)};
+        pending_base_fee = base_fee ? static_cast<uint64_t>(*base_fee) : 0;
+        block_gas_limit = head_header->gas_limit;
+    }
+    state_change_collection_->notify_batch(pending_base_fee, block_gas_limit);
 }
 
 auto MainChain::get_header(Hash header_hash) const -> std::optional<BlockHeader> {
@@ -45,7 +45,8 @@ class ExtendingFork;
 
 class MainChain {
   public:
-    explicit MainChain(asio::io_context&, NodeSettings&, db::RWAccess);
+    explicit MainChain(asio::io_context&, NodeSettings&, db::RWAccess,
+                       StateChangeCollection* state_change_collection = nullptr);
     MainChain(MainChain&&);
 
     void open();  // needed to circumvent mdbx threading model limitations
@@ -65,6 +66,7 @@ class MainChain {
     auto verify_chain(Hash head_block_hash) -> VerificationResult;  // verify chain up to head_block_hash
     bool notify_fork_choice_update(Hash head_block_hash,            // accept the current chain up to head_block_hash
                                    std::optional<Hash> finalized_block_hash = std::nullopt);
+    void forward_deferred_stages();  // catch up the stages deferred by verify_chain at chain tip
 
     // state
     auto last_chosen_head() const -> BlockId;  // set by notify_fork_choice_update(), is always valid
@@ -97,12 +99,16 @@ class MainChain {
 
     std::set<Hash> collect_bad_headers(db::RWTxn& tx, InvalidChain& invalid_chain);
 
+    //! \brief Publishes the state changes committed by the transaction having the specified id
+    void notify_state_changes(uint64_t committed_tx_id);
+
     asio::io_context& io_context_;
     NodeSettings& node_settings_;
     db::RWAccess db_access_;
     mutable db::RWTxn tx_;
     db::DataModel data_model_;
     bool is_first_sync_{true};
+    StateChangeCollection* state_change_collection_;
 
     ExecutionPipeline pipeline_;
     CanonicalChain canonical_chain_;
@@ -17,15 +17,22 @@
 #include "main_chain.hpp"
 
 #include <iostream>
+#include <vector>
 
 #include <boost/asio/io_context.hpp>
 #include <catch2/catch.hpp>
+#include <nlohmann/json.hpp>
 
+#include <silkworm/core/chain/genesis.hpp>
 #include <silkworm/core/common/cast.hpp>
+#include <silkworm/core/execution/processor.hpp>
+#include <silkworm/core/protocol/rule_set.hpp>
+#include <silkworm/core/state/in_memory_state.hpp>
 #include <silkworm/core/types/block.hpp>
 #include <silkworm/infra/common/environment.hpp>
 #include <silkworm/infra/test_util/log.hpp>
 #include <silkworm/node/common/preverified_hashes.hpp>
+#include <silkworm/node/db/bitmap.hpp>
 #include <silkworm/node/db/genesis.hpp>
 #include <silkworm/node/db/stages.hpp>
 #include <silkworm/node/test/context.hpp>
@@ -66,6 +73,24 @@ static Block generateSampleChildrenBlock(const BlockHeader& parent) {
     return block;
 }
 
+//! Set the state root of each block as computed by executing the blocks on top of the mainnet genesis allocations
+static void set_state_roots(std::vector<Block>& blocks) {
+    InMemoryState state;
+    const auto genesis_json = nlohmann::json::parse(read_genesis_data(kMainnetConfig.chain_id));
+    for (const auto& item : genesis_json["alloc"].items()) {
+        const auto address{to_evmc_address(*from_hex(item.key()))};
+        const auto balance{intx::from_string<intx::uint256>(item.value()["balance"].get<std::string>())};
+        state.update_account(address, std::nullopt, Account{0, balance});
+    }
+    const auto rule_set{protocol::rule_set_factory(kMainnetConfig)};
+    for (auto& block : blocks) {
+        ExecutionProcessor processor{block, *rule_set, state, kMainnetConfig};
+        std::vector<Receipt> receipts;
+        REQUIRE(processor.execute_and_write_block(receipts) == ValidationResult::kOk);
+        block.header.state_root = state.state_root_hash();
+    }
+}
+
 TEST_CASE("MainChain") {
     test_util::SetLogVerbosityGuard log_guard(log::Level::kNone);
 
@@ -380,6 +405,127 @@ TEST_CASE("MainChain") {
 
         CHECK(holds_alternative<ValidChain>(main_chain2.canonical_head_status_));
     }
+
+    SECTION("deferred stages after fcu") {
+        Block block1 = generateSampleChildrenBlock(*header0);
+        auto block1_hash = block1.header.hash();
+
+        main_chain.insert_block(block1);
+        auto verification = main_chain.verify_chain(block1_hash);
+        REQUIRE(holds_alternative<ValidChain>(verification));
+
+        // verified but not chosen yet: deferred stages must not commit on its behalf
+        REQUIRE_NOTHROW(main_chain.forward_deferred_stages());
+        CHECK(!main_chain.get_canonical_hash(block1.header.number));
+
+        auto fcu_updated = main_chain.notify_fork_choice_update(block1_hash);
+        CHECK(fcu_updated);
+
+        // index stages are bound to execution progress, hence nothing to catch up here
+        REQUIRE(main_chain.pipeline_.forward_deferred(tx) == Stage::Result::kSuccess);
+        CHECK(db::stages::read_stage_progress(tx, db::stages::kHistoryIndexKey) == 0);
+        CHECK(db::stages::read_stage_progress(tx, db::stages::kTxLookupKey) == 0);
+    }
+}
+
+TEST_CASE("MainChain deferred stages") {
+    test_util::SetLogVerbosityGuard log_guard(log::Level::kNone);
+
+    asio::io_context io;
+    asio::executor_work_guard<decltype(io.get_executor())> work{io.get_executor()};
+
+    test::Context context;
+    context.add_genesis_data();
+    context.commit_txn();
+
+    PreverifiedHashes::current.clear();       // disable preverified hashes
+    Environment::set_stop_before_stage("");  // all stages, so that execution and state roots are verified too
+
+    db::RWAccess db_access{context.env()};
+    MainChain_ForTest main_chain{io, context.node_settings(), db_access};
+    main_chain.open();
+
+    auto& tx = main_chain.tx();
+
+    auto header0 = db::read_canonical_header(tx, 0);
+    REQUIRE(header0.has_value());
+
+    std::vector<Block> blocks{generateSampleChildrenBlock(*header0)};
+    set_state_roots(blocks);
+    blocks.push_back(generateSampleChildrenBlock(blocks[0].header));
+    set_state_roots(blocks);
+    const auto block1_hash{blocks[0].header.hash()};
+    const auto block2_hash{blocks[1].header.hash()};
+
+    // first sync: all the stages run and commit at each stage
+    main_chain.insert_block(blocks[0]);
+    REQUIRE(holds_alternative<ValidChain>(main_chain.verify_chain(block1_hash)));
+    REQUIRE(main_chain.notify_fork_choice_update(block1_hash));
+    CHECK(db::stages::read_stage_progress(tx, db::stages::kExecutionKey) == 1);
+    CHECK(db::stages::read_stage_progress(tx, db::stages::kHistoryIndexKey) == 1);
+
+    // next block at the tip: the whole cycle runs into one transaction and index stages are deferred
+    main_chain.insert_block(blocks[1]);
+    REQUIRE(holds_alternative<ValidChain>(main_chain.verify_chain(block2_hash)));
+    CHECK(db::stages::read_stage_progress(tx, db::stages::kExecutionKey) == 2);
+    CHECK(db::stages::read_stage_progress(tx, db::stages::kIntermediateHashesKey) == 2);
+    CHECK(db::stages::read_stage_progress(tx, db::stages::kHistoryIndexKey) == 1);
+    CHECK(db::stages::read_stage_progress(tx, db::stages::kLogIndexKey) == 1);
+    CHECK(db::stages::read_stage_progress(tx, db::stages::kCallTracesKey) == 1);
+    CHECK(db::stages::read_stage_progress(tx, db::stages::kTxLookupKey) == 1);
+
+    // verified but not chosen yet: no catch-up on its behalf
+    main_chain.forward_deferred_stages();
+    CHECK(db::stages::read_stage_progress(tx, db::stages::kHistoryIndexKey) == 1);
+
+    // chosen: index stages catch up with execution
+    REQUIRE(main_chain.notify_fork_choice_update(block2_hash));
+    main_chain.forward_deferred_stages();
+    CHECK(db::stages::read_stage_progress(tx, db::stages::kHistoryIndexKey) == 2);
+    CHECK(db::stages::read_stage_progress(tx, db::stages::kLogIndexKey) == 2);
+    CHECK(db::stages::read_stage_progress(tx, db::stages::kCallTracesKey) == 2);
+    CHECK(db::stages::read_stage_progress(tx, db::stages::kTxLookupKey) == 2);
+}
+
+TEST_CASE("MainChain first sync extracts index stages ahead") {
+    test_util::SetLogVerbosityGuard log_guard(log::Level::kNone);
+
+    asio::io_context io;
+    asio::executor_work_guard<decltype(io.get_executor())> work{io.get_executor()};
+
+    test::Context context;
+    context.add_genesis_data();
+    context.commit_txn();
+
+    PreverifiedHashes::current.clear();      // disable preverified hashes
+    Environment::set_stop_before_stage("");  // all stages, so that index stages run too
+
+    db::RWAccess db_access{context.env()};
+    MainChain_ForTest main_chain{io, context.node_settings(), db_access};
+    main_chain.open();
+
+    auto& tx = main_chain.tx();
+
+    auto header0 = db::read_canonical_header(tx, 0);
+    REQUIRE(header0.has_value());
+
+    std::vector<Block> blocks{generateSampleChildrenBlock(*header0)};
+    set_state_roots(blocks);
+    const auto block1_hash{blocks[0].header.hash()};
+
+    // first sync commits at each stage, so the pipeline extracts HistoryIndex, LogIndex and TxLookup concurrently
+    main_chain.insert_block(blocks[0]);
+    REQUIRE(holds_alternative<ValidChain>(main_chain.verify_chain(block1_hash)));
+    CHECK(db::stages::read_stage_progress(tx, db::stages::kHistoryIndexKey) == 1);
+    CHECK(db::stages::read_stage_progress(tx, db::stages::kLogIndexKey) == 1);
+    CHECK(db::stages::read_stage_progress(tx, db::stages::kTxLookupKey) == 1);
+
+    // the block reward is the only account change: its extraction has been loaded by HistoryIndex
+    db::PooledCursor account_history{tx, db::table::kAccountHistory};
+    const auto shard_key{db::account_history_key(blocks[0].header.beneficiary, UINT64_MAX)};
+    const auto account_history_data{account_history.find(db::to_slice(shard_key), /*throw_notfound=*/false)};
+    REQUIRE(account_history_data.done);
+    CHECK(db::bitmap::parse(account_history_data.value).toString() == "{1}");
 }
 
 }  // namespace silkworm
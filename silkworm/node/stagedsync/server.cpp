@@ -24,7 +24,8 @@ namespace silkworm::execution {
 using namespace std::chrono;
 namespace asio = boost::asio;
 
-Server::Server(NodeSettings& ns, db::RWAccess dba) : exec_engine_{io_context_, ns, dba} {
+Server::Server(NodeSettings& ns, db::RWAccess dba, StateChangeCollection* state_change_collection)
+    : exec_engine_{io_context_, ns, dba, state_change_collection} {
 }
 
 bool Server::stop() {
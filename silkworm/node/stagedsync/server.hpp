@@ -32,7 +32,7 @@ using namespace stagedsync;
 //! A server for 'execution' gRPC interface.
 class Server : public ActiveComponent {
   public:
-    Server(NodeSettings&, db::RWAccess);
+    Server(NodeSettings&, db::RWAccess, StateChangeCollection* state_change_collection = nullptr);
 
     // actions
     auto insert_headers(const BlockVector& blocks) -> asio::awaitable<void>;  // [[thorax-compliant]]
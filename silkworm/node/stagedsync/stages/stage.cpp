@@ -18,6 +18,7 @@
 
 #include <magic_enum.hpp>
 
+#include <silkworm/node/db/access_layer.hpp>
 #include <silkworm/node/db/stages.hpp>
 
 namespace silkworm::stagedsync {
@@ -41,6 +42,10 @@ void Stage::check_block_sequence(BlockNum actual, BlockNum expected) {
     }
 }
 
+ExtractedRange Stage::make_extracted_range(db::ROTxn& txn, BlockNum from, BlockNum to) {
+    return {from, to, db::read_canonical_hash(txn, to).value_or(evmc::bytes32{})};
+}
+
 void Stage::throw_if_stopping() {
     if (is_stopping()) throw StageError(Stage::Result::kAborted);
 }
@@ -27,6 +27,10 @@
 #include <silkworm/node/db/tables.hpp>
 #include <silkworm/node/etl/collector.hpp>
 
+namespace silkworm {
+class StateChangeCollection;
+}
+
 namespace silkworm::stagedsync {
 
 class StageError;
@@ -47,6 +51,18 @@ struct SyncContext {
     std::optional<BlockNum> previous_unwind_point;
 
     std::optional<evmc::bytes32> bad_block_hash;  // valued if we encountered a bad block
+
+    StateChangeCollection* state_change_collection{nullptr};  // if valued receives state changes when at chain tip
+};
+
+//! \brief Identifies data extracted ahead of forward: the block range and the canonical hash at its upper bound, so
+//! that data extracted from a chain reorged away in the meantime is never loaded
+struct ExtractedRange {
+    BlockNum from{0};
+    BlockNum to{0};
+    evmc::bytes32 to_hash{};
+
+    bool operator==(const ExtractedRange&) const = default;
 };
 
 //! \brief Base Stage interface. All stages MUST inherit from this class and MUST override forward / unwind /
@@ -88,6 +104,18 @@ class Stage : public Stoppable {
     //! \remarks Must be overridden
     [[nodiscard]] virtual Stage::Result forward(db::RWTxn& txn) = 0;
 
+    //! \brief Extract phase of forward, which may be run ahead of forward() on a separate read-only transaction
+    //! and concurrently with other stages. Stages supporting it collect their ETL data here so that forward() is
+    //! left with the load phase only
+    //! \param [in] txn : A read-only db transaction holder
+    //! \return Result
+    //! \remarks Must not write into db. Default implementation does nothing
+    [[nodiscard]] virtual Stage::Result forward_extract(db::ROTxn&) { return Stage::Result::kSuccess; }
+
+    //! \brief Drops any data collected by forward_extract and not consumed by forward yet
+    //! \remarks Called whenever forward is not going to run after forward_extract. Default implementation does nothing
+    virtual void discard_extraction() {}
+
     //! \brief Unwind is called when the stage should be unwound. The unwind logic must be here.
     //! \param [in] txn : A db transaction holder
     //! \param [in] to : New height we need to unwind to
@@ -132,6 +160,9 @@ class Stage : public Stoppable {
 
     //! \brief Throws if actual block != expected block
     static void check_block_sequence(BlockNum actual, BlockNum expected);
+
+    //! \brief Returns the identity of data extracted within provided boundaries on the actual canonical chain
+    static ExtractedRange make_extracted_range(db::ROTxn& txn, BlockNum from, BlockNum to);
 };
 
 //! \brief Stage execution exception
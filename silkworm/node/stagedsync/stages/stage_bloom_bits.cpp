@@ -0,0 +1,250 @@
+/*
+   Copyright 2023 The Silkworm Authors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#include "stage_bloom_bits.hpp"
+
+#include <algorithm>
+
+#include <magic_enum.hpp>
+
+#include <silkworm/core/types/bloom.hpp>
+#include <silkworm/node/db/access_layer.hpp>
+#include <silkworm/node/db/util.hpp>
+
+namespace silkworm::stagedsync {
+
+//! Length in bytes of one section row in BloomBits
+static constexpr size_t kBloomBitsRowLength{db::kBloomBitsSectionSize / 8};
+
+Stage::Result BloomBitsIndex::forward(db::RWTxn& txn) {
+    Stage::Result ret{Stage::Result::kSuccess};
+    operation_ = OperationType::Forward;
+    try {
+        throw_if_stopping();
+
+        // Check stage boundaries from previous execution and previous stage execution
+        const auto previous_progress{get_progress(txn)};
+        const auto target_progress{db::stages::read_stage_progress(txn, db::stages::kExecutionKey)};
+        if (previous_progress == target_progress) {
+            // Nothing to process
+            operation_ = OperationType::None;
+            return ret;
+        } else if (previous_progress > target_progress) {
+            // Something bad had happened.  Maybe we need to unwind ?
+            throw StageError(Stage::Result::kInvalidProgress,
+                             "BloomBitsIndex progress " + std::to_string(previous_progress) +
+                                 " greater than Execution progress " + std::to_string(target_progress));
+        }
+
+        reset_log_progress();
+        const BlockNum segment_width{target_progress - previous_progress};
+        if (segment_width > db::stages::kSmallBlockSegmentWidth) {
+            log::Info(log_prefix_,
+                      {"op", std::string(magic_enum::enum_name<OperationType>(operation_)),
+                       "from", std::to_string(previous_progress),
+                       "to", std::to_string(target_progress),
+                       "span", std::to_string(segment_width)});
+        }
+
+        forward_impl(txn, previous_progress, target_progress);
+
+        reset_log_progress();
+        update_progress(txn, target_progress);
+        txn.commit();
+
+    } catch (const StageError& ex) {
+        log::Error(log_prefix_,
+                   {"function", std::string(__FUNCTION__), "exception", std::string(ex.what())});
+        ret = static_cast<Stage::Result>(ex.err());
+    } catch (const mdbx::exception& ex) {
+        log::Error(log_prefix_,
+                   {"function", std::string(__FUNCTION__), "exception", std::string(ex.what())});
+        ret = Stage::Result::kDbError;
+    } catch (const std::exception& ex) {
+        log::Error(log_prefix_,
+                   {"function", std::string(__FUNCTION__), "exception", std::string(ex.what())});
+        ret = Stage::Result::kUnexpectedError;
+    } catch (...) {
+        log::Error(log_prefix_,
+                   {"function", std::string(__FUNCTION__), "exception", "unexpected and undefined"});
+        ret = Stage::Result::kUnexpectedError;
+    }
+
+    operation_ = OperationType::None;
+    return ret;
+}
+
+Stage::Result BloomBitsIndex::unwind(db::RWTxn& txn) {
+    Stage::Result ret{Stage::Result::kSuccess};
+
+    if (!sync_context_->unwind_point.has_value()) return ret;
+    const BlockNum to{sync_context_->unwind_point.value()};
+
+    operation_ = OperationType::Unwind;
+    try {
+        throw_if_stopping();
+
+        const auto previous_progress{get_progress(txn)};
+        if (previous_progress <= to) {
+            // Nothing to process
+            operation_ = OperationType::None;
+            return ret;
+        }
+
+        reset_log_progress();
+        const BlockNum segment_width{previous_progress - to};
+        if (segment_width > db::stages::kSmallBlockSegmentWidth) {
+            log::Info(log_prefix_,
+                      {"op", std::string(magic_enum::enum_name<OperationType>(operation_)),
+                       "from", std::to_string(previous_progress),
+                       "to", std::to_string(to),
+                       "span", std::to_string(segment_width)});
+        }
+
+        unwind_impl(txn, to);
+
+        reset_log_progress();
+        update_progress(txn, to);
+        txn.commit();
+
+    } catch (const StageError& ex) {
+        log::Error(log_prefix_,
+                   {"function", std::string(__FUNCTION__), "exception", std::string(ex.what())});
+        ret = static_cast<Stage::Result>(ex.err());
+    } catch (const mdbx::exception& ex) {
+        log::Error(log_prefix_,
+                   {"function", std::string(__FUNCTION__), "exception", std::string(ex.what())});
+        ret = Stage::Result::kDbError;
+    } catch (const std::exception& ex) {
+        log::Error(log_prefix_,
+                   {"function", std::string(__FUNCTION__), "exception", std::string(ex.what())});
+        ret = Stage::Result::kUnexpectedError;
+    } catch (...) {
+        log::Error(log_prefix_,
+                   {"function", std::string(__FUNCTION__), "exception", "unexpected and undefined"});
+        ret = Stage::Result::kUnexpectedError;
+    }
+
+    operation_ = OperationType::None;
+    return ret;
+}
+
+// Sections are built from headers, which are never pruned
+Stage::Result BloomBitsIndex::prune(db::RWTxn&) { return Stage::Result::kSuccess; }
+
+void BloomBitsIndex::forward_impl(db::RWTxn& txn, const BlockNum from, const BlockNum to) {
+    // Sections already complete at previous progress have been written, the last partial one is left for next runs
+    const uint64_t first_section{(from + 1) / db::kBloomBitsSectionSize};
+    const uint64_t end_section{(to + 1) / db::kBloomBitsSectionSize};
+    for (uint64_t section{first_section}; section < end_section; ++section) {
+        throw_if_stopping();
+        write_section(txn, section);
+    }
+}
+
+void BloomBitsIndex::unwind_impl(db::RWTxn& txn, const BlockNum to) {
+    // Sections including any block above the unwind point are not complete anymore
+    const uint64_t first_section{(to + 1) / db::kBloomBitsSectionSize};
+    const auto first_section_key{db::block_key(first_section)};
+
+    auto index_cursor{txn.rw_cursor(db::table::kBloomBitsIndex)};
+    if (!index_cursor->lower_bound(db::to_slice(first_section_key), /*throw_notfound=*/false)) {
+        return;
+    }
+    db::cursor_erase(*index_cursor, first_section_key, db::CursorMoveDirection::Forward);
+
+    auto bloom_bits_cursor{txn.rw_cursor(db::table::kBloomBits)};
+    for (size_t bit{0}; bit < kBloomBitLength; ++bit) {
+        throw_if_stopping();
+        const auto start_key{db::bloom_bits_key(static_cast<uint16_t>(bit), first_section)};
+        const ByteView bit_prefix{start_key.data(), sizeof(uint16_t)};
+        auto data{bloom_bits_cursor->lower_bound(db::to_slice(start_key), /*throw_notfound=*/false)};
+        while (data && data.key.starts_with(db::to_slice(bit_prefix))) {
+            bloom_bits_cursor->erase();
+            data = bloom_bits_cursor->to_next(/*throw_notfound=*/false);
+        }
+    }
+}
+
+void BloomBitsIndex::write_section(db::RWTxn& txn, const uint64_t section) {
+    std::unique_lock log_lck(sl_mutex_);
+    current_key_ = std::to_string(section);
+    log_lck.unlock();
+
+    // Transpose the header blooms: row b holds bit b of the logs bloom of each block in the section
+    Bytes rows(kBloomBitLength * kBloomBitsRowLength, '\0');
+    const BlockNum first_block{section * db::kBloomBitsSectionSize};
+    evmc::bytes32 head_hash;
+    for (BlockNum i{0}; i < db::kBloomBitsSectionSize; ++i) {
+        const BlockNum block_num{first_block + i};
+        const auto block_hash{db::read_canonical_hash(txn, block_num)};
+        if (!block_hash) {
+            throw StageError(Stage::Result::kBadChainSequence,
+                             "Canonical hash not found for block " + std::to_string(block_num));
+        }
+        const auto header{db::read_header(txn, block_num, *block_hash)};
+        if (!header) {
+            throw StageError(Stage::Result::kBadChainSequence,
+                             "Header not found for block " + std::to_string(block_num));
+        }
+        for (size_t byte_index{0}; byte_index < kBloomByteLength; ++byte_index) {
+            const uint8_t bloom_byte{header->logs_bloom[byte_index]};
+            if (!bloom_byte) {
+                continue;
+            }
+            for (unsigned bit_index{0}; bit_index < 8; ++bit_index) {
+                if (bloom_byte & (1u << bit_index)) {
+                    const size_t bit{(kBloomByteLength - 1 - byte_index) * 8 + bit_index};
+                    rows[bit * kBloomBitsRowLength + i / 8] |= static_cast<uint8_t>(0x80u >> (i % 8));
+                }
+            }
+        }
+        head_hash = *block_hash;
+    }
+
+    auto bloom_bits_cursor{txn.rw_cursor(db::table::kBloomBits)};
+    for (size_t bit{0}; bit < kBloomBitLength; ++bit) {
+        const ByteView row{&rows[bit * kBloomBitsRowLength], kBloomBitsRowLength};
+        if (std::all_of(row.begin(), row.end(), [](uint8_t b) { return b == 0; })) {
+            continue;
+        }
+        const auto key{db::bloom_bits_key(static_cast<uint16_t>(bit), section)};
+        const auto value{db::compress_bloom_bits_row(row)};
+        bloom_bits_cursor->upsert(db::to_slice(key), db::to_slice(value));
+    }
+
+    auto index_cursor{txn.rw_cursor(db::table::kBloomBitsIndex)};
+    const auto section_key{db::block_key(section)};
+    index_cursor->upsert(db::to_slice(section_key), db::to_slice(ByteView{head_hash.bytes, kHashLength}));
+}
+
+std::vector<std::string> BloomBitsIndex::get_log_progress() {
+    std::vector<std::string> ret{"op", std::string(magic_enum::enum_name<OperationType>(operation_))};
+    std::unique_lock log_lck(sl_mutex_);
+    if (current_key_.empty()) {
+        ret.insert(ret.end(), {"db", "waiting ..."});
+    } else {
+        ret.insert(ret.end(), {"from", db::table::kHeaders.name, "to", db::table::kBloomBits.name, "section", current_key_});
+    }
+    return ret;
+}
+
+void BloomBitsIndex::reset_log_progress() {
+    std::unique_lock log_lck(sl_mutex_);
+    current_key_.clear();
+}
+
+}  // namespace silkworm::stagedsync
@@ -0,0 +1,52 @@
+/*
+   Copyright 2023 The Silkworm Authors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include <silkworm/node/stagedsync/stages/stage.hpp>
+
+namespace silkworm::stagedsync {
+
+//! \brief Builds the BloomBits index transposing the logs bloom of canonical headers into bit-sliced sections
+//! \remarks Only complete sections of db::kBloomBitsSectionSize blocks are indexed, blocks in the last partial section
+//! are left to the RPC log search fallback
+class BloomBitsIndex : public Stage {
+  public:
+    explicit BloomBitsIndex(NodeSettings* node_settings, SyncContext* sync_context)
+        : Stage(sync_context, db::stages::kBloomBitsKey, node_settings){};
+    ~BloomBitsIndex() override = default;
+
+    Stage::Result forward(db::RWTxn& txn) final;
+    Stage::Result unwind(db::RWTxn& txn) final;
+    Stage::Result prune(db::RWTxn& txn) final;
+    std::vector<std::string> get_log_progress() final;
+
+  private:
+    std::string current_key_;  // Actual processing section
+
+    void forward_impl(db::RWTxn& txn, BlockNum from, BlockNum to);
+    void unwind_impl(db::RWTxn& txn, BlockNum to);
+
+    //! \brief Writes the rows of the given section from the canonical headers of its blocks
+    void write_section(db::RWTxn& txn, uint64_t section);
+
+    void reset_log_progress();  // Clears out all logging vars
+};
+
+}  // namespace silkworm::stagedsync
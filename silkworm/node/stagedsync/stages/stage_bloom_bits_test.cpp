@@ -0,0 +1,140 @@
+/*
+   Copyright 2023 The Silkworm Authors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#include <algorithm>
+#include <optional>
+
+#include <catch2/catch.hpp>
+
+#include <silkworm/core/types/bloom.hpp>
+#include <silkworm/infra/test_util/log.hpp>
+#include <silkworm/node/db/access_layer.hpp>
+#include <silkworm/node/db/stages.hpp>
+#include <silkworm/node/db/util.hpp>
+#include <silkworm/node/stagedsync/stages/stage_bloom_bits.hpp>
+#include <silkworm/node/test/context.hpp>
+
+using namespace evmc::literals;
+
+namespace silkworm {
+
+//! Read the decompressed BloomBits row of the given bit and section (if any)
+static std::optional<Bytes> read_row(db::RWTxn& txn, uint16_t bit, uint64_t section) {
+    db::PooledCursor bloom_bits_table{txn, db::table::kBloomBits};
+    const auto key{db::bloom_bits_key(bit, section)};
+    const auto data{bloom_bits_table.find(db::to_slice(key), /*throw_notfound=*/false)};
+    if (!data) {
+        return std::nullopt;
+    }
+    const auto row{db::decompress_bloom_bits_row(db::from_slice(data.value), db::kBloomBitsSectionSize / 8)};
+    REQUIRE(row);
+    CHECK(data.value.size() < row->size());  // sparse rows are stored compressed
+    return row;
+}
+
+//! Read the head hash of the given section in BloomBitsIndex (if any)
+static std::optional<Bytes> read_section_head(db::RWTxn& txn, uint64_t section) {
+    db::PooledCursor index_table{txn, db::table::kBloomBitsIndex};
+    const auto key{db::block_key(section)};
+    const auto data{index_table.find(db::to_slice(key), /*throw_notfound=*/false)};
+    if (!data) {
+        return std::nullopt;
+    }
+    return Bytes{db::from_slice(data.value)};
+}
+
+TEST_CASE("Stage Bloom Bits Index") {
+    test_util::SetLogVerbosityGuard log_guard{log::Level::kNone};
+    test::Context context;
+    db::RWTxn& txn{context.rw_txn()};
+    txn.disable_commit();
+
+    const auto address{0x0a6bb546b9208cfab9e8fa2b9b2c042b18df7030_address};
+    const ByteView address_view{address.bytes, kAddressLength};
+
+    // Canonical headers for section 0 and part of section 1, logs of address in blocks 5 and 4096 + 3
+    constexpr BlockNum kLastBlock{db::kBloomBitsSectionSize + 9};
+    evmc::bytes32 section_0_head;
+    for (BlockNum block_num{0}; block_num <= kLastBlock; ++block_num) {
+        BlockHeader header;
+        header.number = block_num;
+        if (block_num == 5 || block_num == db::kBloomBitsSectionSize + 3) {
+            m3_2048(header.logs_bloom, address_view);
+        }
+        db::write_header(txn, header, /*with_header_numbers=*/true);
+        db::write_canonical_hash(txn, block_num, header.hash());
+        if (block_num == db::kBloomBitsSectionSize - 1) {
+            section_0_head = header.hash();
+        }
+    }
+    db::stages::write_stage_progress(txn, db::stages::kExecutionKey, kLastBlock);
+
+    stagedsync::SyncContext sync_context{};
+    stagedsync::BloomBitsIndex stage_bloom_bits(&context.node_settings(), &sync_context);
+    REQUIRE(stage_bloom_bits.forward(txn) == stagedsync::Stage::Result::kSuccess);
+    REQUIRE(db::stages::read_stage_progress(txn, db::stages::kBloomBitsKey) == kLastBlock);
+
+    const auto address_bits{m3_2048_bits(address_view)};
+    Bytes expected_row(db::kBloomBitsSectionSize / 8, '\0');
+    expected_row[0] = 0x04;  // block 5
+
+    SECTION("Forward") {
+        // Only the complete section is indexed
+        CHECK(read_section_head(txn, 0) == Bytes{section_0_head.bytes, kHashLength});
+        CHECK(read_section_head(txn, 1) == std::nullopt);
+        for (const auto bit : address_bits) {
+            CHECK(read_row(txn, bit, 0) == expected_row);
+            CHECK(read_row(txn, bit, 1) == std::nullopt);
+        }
+        // All-zero rows are not stored
+        for (size_t bit{0}; bit < kBloomBitLength; ++bit) {
+            if (std::find(address_bits.cbegin(), address_bits.cend(), bit) == address_bits.cend()) {
+                CHECK(read_row(txn, static_cast<uint16_t>(bit), 0) == std::nullopt);
+            }
+        }
+    }
+
+    SECTION("Unwind within partial section") {
+        sync_context.unwind_point.emplace(db::kBloomBitsSectionSize);
+        REQUIRE(stage_bloom_bits.unwind(txn) == stagedsync::Stage::Result::kSuccess);
+        REQUIRE(db::stages::read_stage_progress(txn, db::stages::kBloomBitsKey) == db::kBloomBitsSectionSize);
+
+        CHECK(read_section_head(txn, 0) == Bytes{section_0_head.bytes, kHashLength});
+        for (const auto bit : address_bits) {
+            CHECK(read_row(txn, bit, 0) == expected_row);
+        }
+    }
+
+    SECTION("Unwind within complete section") {
+        sync_context.unwind_point.emplace(100);
+        REQUIRE(stage_bloom_bits.unwind(txn) == stagedsync::Stage::Result::kSuccess);
+        REQUIRE(db::stages::read_stage_progress(txn, db::stages::kBloomBitsKey) == 100);
+
+        CHECK(read_section_head(txn, 0) == std::nullopt);
+        for (const auto bit : address_bits) {
+            CHECK(read_row(txn, bit, 0) == std::nullopt);
+        }
+
+        // Section gets indexed again moving forward
+        REQUIRE(stage_bloom_bits.forward(txn) == stagedsync::Stage::Result::kSuccess);
+        CHECK(read_section_head(txn, 0) == Bytes{section_0_head.bytes, kHashLength});
+        for (const auto bit : address_bits) {
+            CHECK(read_row(txn, bit, 0) == expected_row);
+        }
+    }
+}
+
+}  // namespace silkworm
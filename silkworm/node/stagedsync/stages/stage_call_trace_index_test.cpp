@@ -0,0 +1,119 @@
+/*
+   Copyright 2023 The Silkworm Authors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#include <catch2/catch.hpp>
+
+#include <silkworm/infra/test_util/log.hpp>
+#include <silkworm/node/db/bitmap.hpp>
+#include <silkworm/node/db/buffer.hpp>
+#include <silkworm/node/db/stages.hpp>
+#include <silkworm/node/stagedsync/stages/stage_call_trace_index.hpp>
+#include <silkworm/node/test/context.hpp>
+
+using namespace evmc::literals;
+
+namespace silkworm {
+
+//! Read the block numbers stored in the last shard of the specified bitmap index for the given account (if any)
+static std::optional<std::vector<uint64_t>> read_last_shard(db::RWTxn& txn, const db::MapConfig& index,
+                                                            const evmc::address& address) {
+    db::PooledCursor index_table{txn, index};
+    const auto shard_key{db::account_history_key(address, UINT64_MAX)};
+    const auto data{index_table.find(db::to_slice(shard_key), /*throw_notfound=*/false)};
+    if (!data) {
+        return std::nullopt;
+    }
+    const auto bitmap{db::bitmap::parse(data.value)};
+    std::vector<uint64_t> block_numbers;
+    for (const auto block_number : bitmap) {
+        block_numbers.push_back(block_number);
+    }
+    return block_numbers;
+}
+
+TEST_CASE("Stage Call Trace Index") {
+    test_util::SetLogVerbosityGuard log_guard{log::Level::kNone};
+    test::Context context;
+    db::RWTxn& txn{context.rw_txn()};
+    txn.disable_commit();
+
+    const auto address_a{0x0a6bb546b9208cfab9e8fa2b9b2c042b18df7030_address};
+    const auto address_b{0x5a0b54d5dc17e0aadc383d2db43b0a0d3e029c4c_address};
+    const auto address_c{0xb685342b8c54347aad148e1f22eff3eb3eb29391_address};
+
+    // Block 1: A -> B, Block 2: A -> C, Block 3: B -> B
+    db::Buffer buffer{txn, 0};
+    CallTraces traces;
+    traces.senders.insert(address_a);
+    traces.recipients.insert(address_b);
+    buffer.insert_call_traces(1, traces);
+    traces.clear();
+    traces.senders.insert(address_a);
+    traces.recipients.insert(address_c);
+    buffer.insert_call_traces(2, traces);
+    traces.clear();
+    traces.senders.insert(address_b);
+    traces.recipients.insert(address_b);
+    buffer.insert_call_traces(3, traces);
+    buffer.write_to_db();
+
+    db::stages::write_stage_progress(txn, db::stages::kExecutionKey, 3);
+
+    stagedsync::SyncContext sync_context{};
+    stagedsync::CallTraceIndex stage_call_trace_index(&context.node_settings(), &sync_context);
+    REQUIRE(stage_call_trace_index.forward(txn) == stagedsync::Stage::Result::kSuccess);
+    REQUIRE(db::stages::read_stage_progress(txn, db::stages::kCallTracesKey) == 3);
+
+    using BlockNumbers = std::vector<uint64_t>;
+
+    SECTION("Forward") {
+        CHECK(read_last_shard(txn, db::table::kCallFromIndex, address_a) == BlockNumbers{1, 2});
+        CHECK(read_last_shard(txn, db::table::kCallFromIndex, address_b) == BlockNumbers{3});
+        CHECK(read_last_shard(txn, db::table::kCallFromIndex, address_c) == std::nullopt);
+        CHECK(read_last_shard(txn, db::table::kCallToIndex, address_a) == std::nullopt);
+        CHECK(read_last_shard(txn, db::table::kCallToIndex, address_b) == BlockNumbers{1, 3});
+        CHECK(read_last_shard(txn, db::table::kCallToIndex, address_c) == BlockNumbers{2});
+    }
+
+    SECTION("Unwind") {
+        sync_context.unwind_point.emplace(1);
+        REQUIRE(stage_call_trace_index.unwind(txn) == stagedsync::Stage::Result::kSuccess);
+        REQUIRE(db::stages::read_stage_progress(txn, db::stages::kCallTracesKey) == 1);
+
+        CHECK(read_last_shard(txn, db::table::kCallFromIndex, address_a) == BlockNumbers{1});
+        CHECK(read_last_shard(txn, db::table::kCallFromIndex, address_b) == std::nullopt);
+        CHECK(read_last_shard(txn, db::table::kCallToIndex, address_b) == BlockNumbers{1});
+        CHECK(read_last_shard(txn, db::table::kCallToIndex, address_c) == std::nullopt);
+    }
+
+    SECTION("Prune") {
+        db::PruneDistance olderHistory, olderReceipts, olderSenders, olderTxIndex, olderCallTraces;
+        db::PruneThreshold beforeHistory, beforeReceipts, beforeSenders, beforeTxIndex, beforeCallTraces;
+        beforeCallTraces.emplace(2);  // Will delete any call trace before block 2
+        context.node_settings().prune_mode =
+            db::parse_prune_mode("c", olderHistory, olderReceipts, olderSenders, olderTxIndex, olderCallTraces,
+                                 beforeHistory, beforeReceipts, beforeSenders, beforeTxIndex, beforeCallTraces);
+        REQUIRE(context.node_settings().prune_mode->call_traces().enabled());
+        REQUIRE(stage_call_trace_index.prune(txn) == stagedsync::Stage::Result::kSuccess);
+
+        CHECK(read_last_shard(txn, db::table::kCallFromIndex, address_a) == BlockNumbers{2});
+        CHECK(read_last_shard(txn, db::table::kCallFromIndex, address_b) == BlockNumbers{3});
+        CHECK(read_last_shard(txn, db::table::kCallToIndex, address_b) == BlockNumbers{3});
+        CHECK(read_last_shard(txn, db::table::kCallToIndex, address_c) == BlockNumbers{2});
+    }
+}
+
+}  // namespace silkworm
@@ -19,12 +19,14 @@
 #include <span>
 #include <stdexcept>
 
+#include <absl/container/btree_set.h>
 #include <magic_enum.hpp>
 
 #include <silkworm/core/common/endian.hpp>
 #include <silkworm/core/execution/processor.hpp>
 #include <silkworm/infra/common/decoding_exception.hpp>
 #include <silkworm/infra/common/stopwatch.hpp>
+#include <silkworm/node/backend/state_change_collection.hpp>
 #include <silkworm/node/db/access_layer.hpp>
 #include <silkworm/node/db/buffer.hpp>
 
@@ -84,9 +86,11 @@ Stage::Result Execution::forward(db::RWTxn& txn) {
         // prune-able data
         BlockNum prune_history{node_settings_->prune_mode->history().value_from_head(senders_stage_progress)};
         BlockNum prune_receipts{node_settings_->prune_mode->receipts().value_from_head(senders_stage_progress)};
+        BlockNum prune_call_traces{node_settings_->prune_mode->call_traces().value_from_head(senders_stage_progress)};
         if (hashstate_stage_progress) {
             prune_history = std::min(prune_history, hashstate_stage_progress - 1);
             prune_receipts = std::min(prune_receipts, hashstate_stage_progress - 1);
+            prune_call_traces = std::min(prune_call_traces, hashstate_stage_progress - 1);
         }
 
         static constexpr size_t kCacheSize{5'000};
@@ -102,7 +106,8 @@ Stage::Result Execution::forward(db::RWTxn& txn) {
                                                       analysis_cache,
                                                       state_pool,
                                                       prune_history,
-                                                      prune_receipts)};
+                                                      prune_receipts,
+                                                      prune_call_traces)};
 
             // If we return with success we must persist data
             // Though counterintuitive we also must persist on KInvalidBlock to allow subsequent unwind
@@ -113,7 +118,8 @@ Stage::Result Execution::forward(db::RWTxn& txn) {
 
             // Persist forward and prune progresses
             update_progress(txn, block_num_);
-            if (node_settings_->prune_mode->history().enabled() || node_settings_->prune_mode->receipts().enabled()) {
+            if (node_settings_->prune_mode->history().enabled() || node_settings_->prune_mode->receipts().enabled() ||
+                node_settings_->prune_mode->call_traces().enabled()) {
                 db::stages::write_stage_prune_progress(txn, db::stages::kExecutionKey, block_num_);
             }
 
@@ -203,14 +209,18 @@ void Execution::prefetch_blocks(db::RWTxn& txn, const BlockNum from, const Block
 
 Stage::Result Execution::execute_batch(db::RWTxn& txn, BlockNum max_block_num, AnalysisCache& analysis_cache,
                                        ObjectPool<evmone::ExecutionState>& state_pool, BlockNum prune_history_threshold,
-                                       BlockNum prune_receipts_threshold) {
+                                       BlockNum prune_receipts_threshold, BlockNum prune_call_traces_threshold) {
     Stage::Result ret{Stage::Result::kSuccess};
     using namespace std::chrono_literals;
     auto log_time{std::chrono::steady_clock::now()};
 
     try {
         db::Buffer buffer(txn, prune_history_threshold);
+        // State changes are collected only when the whole cycle runs into one transaction (i.e. at chain tip)
+        StateChangeCollection* state_changes{txn.commit_disabled() ? sync_context_->state_change_collection : nullptr};
+        buffer.set_state_change_collection(state_changes);
         std::vector<Receipt> receipts;
+        CallTraces call_traces;
 
         // Transform batch_size limit into Ggas
         size_t gas_max_history_size{node_settings_->batch_size * 1_Kibi / 2};  // 512MB -> 256Ggas roughly
@@ -238,11 +248,25 @@ Stage::Result Execution::execute_batch(db::RWTxn& txn, BlockNum max_block_num, A
                 log_time = now + 5s;
             }
 
+            if (state_changes) {
+                std::vector<Bytes> tx_rlps;
+                tx_rlps.reserve(block.transactions.size());
+                for (const auto& transaction : block.transactions) {
+                    rlp::encode(tx_rlps.emplace_back(), transaction, /*wrap_eip2718_into_string=*/false);
+                }
+                state_changes->start_new_batch(block_num_, block.header.hash(), std::move(tx_rlps), /*unwind=*/false);
+            }
+
             ExecutionProcessor processor(block, *rule_set_, buffer, node_settings_->chain_config.value());
             processor.evm().analysis_cache = &analysis_cache;
             processor.evm().state_pool = &state_pool;
 
-            // TODO Add Tracer and collect call traces
+            // Collect call traces only if they are not going to be pruned
+            const bool collect_call_traces{block_num_ >= prune_call_traces_threshold};
+            if (collect_call_traces) {
+                call_traces.clear();
+                processor.evm().call_traces = &call_traces;
+            }
 
             if (const auto res{processor.execute_and_write_block(receipts)}; res != ValidationResult::kOk) {
                 // Persist work done so far
@@ -267,6 +291,10 @@ Stage::Result Execution::execute_batch(db::RWTxn& txn, BlockNum max_block_num, A
             if (block_num_ >= prune_receipts_threshold) {
                 buffer.insert_receipts(block_num_, receipts);
             }
+            if (collect_call_traces) {
+                call_traces.add_beneficiaries(block);
+                buffer.insert_call_traces(block_num_, call_traces);
+            }
 
             // Stats
             std::unique_lock progress_lock(progress_mtx_);
@@ -361,6 +389,11 @@ Stage::Result Execution::unwind(db::RWTxn& txn) {
             unwind_state_from_changeset(*storage_changeset_cursor, *plain_state_cursor, *plain_code_cursor, to);
         }
 
+        // State changes are collected only when the whole cycle runs into one transaction (i.e. at chain tip)
+        if (sync_context_->state_change_collection && txn.commit_disabled()) {
+            collect_unwound_state_changes(txn, to);
+        }
+
         // Delete records which has keys greater than unwind point
         // Note erasing forward the start key is included that's why we increase unwind_point by 1
         Bytes start_key{db::block_key(to + 1)};
@@ -500,7 +533,7 @@ Stage::Result Execution::prune(db::RWTxn& txn) {
         }
 
         // Prune call traces
-        if (const auto prune_threshold{node_settings_->prune_mode->receipts().value_from_head(forward_progress)}; prune_threshold) {
+        if (const auto prune_threshold{node_settings_->prune_mode->call_traces().value_from_head(forward_progress)}; prune_threshold) {
             if (segment_width > db::stages::kSmallBlockSegmentWidth) {
                 log::Info(log_prefix_,
                           {"op", std::string(magic_enum::enum_name<OperationType>(operation_)),
@@ -614,6 +647,49 @@ void Execution::revert_state(ByteView key, ByteView value, db::RWCursorDupSort&
     }
 }
 
+void Execution::collect_unwound_state_changes(db::RWTxn& txn, BlockNum unwind_to) {
+    StateChangeCollection* state_changes{sync_context_->state_change_collection};
+    const auto unwind_hash{db::read_canonical_hash(txn, unwind_to)};
+    state_changes->start_new_batch(unwind_to, unwind_hash.value_or(evmc::bytes32{}), {}, /*unwind=*/true);
+
+    // Changesets above unwind point tell what has been reverted, plain state already holds the reverted values
+    absl::btree_set<evmc::address> unwound_accounts;
+    absl::btree_set<Bytes> unwound_storage_keys;
+    auto collect_func{[&](ByteView key, ByteView value) {
+        auto [plain_key, _]{db::changeset_to_plainstate_format(key, value)};
+        if (plain_key.length() == kAddressLength) {
+            unwound_accounts.insert(to_evmc_address(plain_key));
+        } else {
+            unwound_storage_keys.insert(std::move(plain_key));
+        }
+    }};
+    const Bytes start_key{db::block_key(unwind_to + 1)};
+    for (const auto& changeset_table : {db::table::kAccountChangeSet, db::table::kStorageChangeSet}) {
+        auto changeset_cursor = txn.ro_cursor(changeset_table);
+        if (changeset_cursor->lower_bound(db::to_slice(start_key), /*throw_notfound=*/false)) {
+            db::cursor_for_each(*changeset_cursor, collect_func);
+        }
+    }
+
+    absl::btree_set<evmc::address> deleted_accounts;
+    for (const auto& address : unwound_accounts) {
+        if (const auto account{db::read_account(txn, address)}; account) {
+            state_changes->change_account(address, account->incarnation, account->encode_for_storage());
+        } else {
+            state_changes->delete_account(address);
+            deleted_accounts.insert(address);
+        }
+    }
+    for (const auto& storage_key : unwound_storage_keys) {
+        const auto address{to_evmc_address(storage_key)};
+        if (deleted_accounts.contains(address)) continue;
+        const auto incarnation{endian::load_big_u64(&storage_key[kAddressLength])};
+        const auto location{to_bytes32(ByteView{storage_key}.substr(db::kPlainStoragePrefixLength))};
+        const auto value{db::read_storage(txn, address, incarnation, location)};
+        state_changes->change_storage(address, incarnation, location, Bytes{zeroless_view(value)});
+    }
+}
+
 void Execution::unwind_state_from_changeset(db::ROCursor& source_changeset, db::RWCursorDupSort& plain_state_table,
                                             db::RWCursor& plain_code_table, BlockNum unwind_to) {
     auto src_data{source_changeset.to_last(/*throw_notfound*/ false)};
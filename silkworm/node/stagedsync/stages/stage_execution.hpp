@@ -18,6 +18,7 @@
 
 #include <boost/circular_buffer.hpp>
 
+#include <silkworm/core/execution/call_traces.hpp>
 #include <silkworm/core/execution/evm.hpp>
 #include <silkworm/core/protocol/rule_set.hpp>
 #include <silkworm/node/stagedsync/stages/stage.hpp>
@@ -55,7 +56,11 @@ class Execution final : public Stage {
     //! \remarks A batch completes when either max block is reached or buffer dimensions overflow
     Stage::Result execute_batch(db::RWTxn& txn, BlockNum max_block_num, AnalysisCache& analysis_cache,
                                 ObjectPool<evmone::ExecutionState>& state_pool, BlockNum prune_history_threshold,
-                                BlockNum prune_receipts_threshold);
+                                BlockNum prune_receipts_threshold, BlockNum prune_call_traces_threshold);
+
+    //! \brief Collects the state reverted by unwinding down to specified block as one unwind state change
+    //! \remarks Must be called after plain state has been reverted but before changesets get erased
+    void collect_unwound_state_changes(db::RWTxn& txn, BlockNum unwind_to);
 
     //! \brief For given changeset cursor/bucket it reverts the changes on states buckets
     static void unwind_state_from_changeset(db::ROCursor& source_changeset, db::RWCursorDupSort& plain_state_table,
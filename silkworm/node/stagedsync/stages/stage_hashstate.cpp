@@ -21,6 +21,7 @@
 #include <magic_enum.hpp>
 
 #include <silkworm/core/common/endian.hpp>
+#include <silkworm/core/crypto/keccak_batch.hpp>
 #include <silkworm/infra/common/decoding_exception.hpp>
 #include <silkworm/node/db/access_layer.hpp>
 
@@ -843,6 +844,8 @@ Stage::Result HashState::write_changes_from_changed_storage(
 
     evmc::address last_address{};
     Bytes hashed_storage_prefix(db::kHashedStoragePrefixLength, '\0');  // One allocation only
+    std::vector<ByteView> locations;
+    std::vector<ethash::hash256> hashed_locations;
     for (const auto& [address, data] : storage_changes) {
         if (address != last_address) {
             throw_if_stopping();
@@ -856,9 +859,17 @@ Stage::Result HashState::write_changes_from_changed_storage(
 
         for (const auto& [incarnation, data1] : data) {
             endian::store_big_u64(&hashed_storage_prefix[kHashLength], incarnation);
-            for (const auto& [location, value] : data1) {
-                auto hashed_location{keccak256(location.bytes)};
-                db::upsert_storage_value(*target_hashed_storage, hashed_storage_prefix, hashed_location.bytes, value);
+            // Locations are independent of each other, so hash them all together
+            locations.clear();
+            for (const auto& [location, _] : data1) {
+                locations.emplace_back(location);
+            }
+            hashed_locations.resize(locations.size());
+            keccak256_batch(locations, hashed_locations);
+
+            size_t i{0};
+            for (const auto& [_, value] : data1) {
+                db::upsert_storage_value(*target_hashed_storage, hashed_storage_prefix, hashed_locations[i++].bytes, value);
             }
         }
     }
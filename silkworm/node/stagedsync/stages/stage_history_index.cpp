@@ -37,6 +37,7 @@ Stage::Result HistoryIndex::forward(db::RWTxn& txn) {
         if (previous_progress == target_progress) {
             // Nothing to process
             operation_ = OperationType::None;
+            discard_extraction();
             return ret;
         } else if (previous_progress > target_progress) {
             // Something bad had happened.  Maybe we need to unwind ?
@@ -64,7 +65,6 @@ Stage::Result HistoryIndex::forward(db::RWTxn& txn) {
                 previous_progress_storage = node_settings_->prune_mode->history().value_from_head(target_progress);
         }
 
-        collector_ = std::make_unique<etl::Collector>(node_settings_);
         if (previous_progress_accounts < target_progress) {
             success_or_throw(forward_impl(txn, previous_progress_accounts, target_progress, false));
             txn.commit();
@@ -95,14 +95,62 @@ Stage::Result HistoryIndex::forward(db::RWTxn& txn) {
         ret = Stage::Result::kUnexpectedError;
     }
 
-    collector_.reset();
+    discard_extraction();
     operation_ = OperationType::None;
     return is_stopping() ? Stage::Result::kAborted : ret;
 }
 
+Stage::Result HistoryIndex::forward_extract(db::ROTxn& txn) {
+    Stage::Result ret{Stage::Result::kSuccess};
+    try {
+        throw_if_stopping();
+
+        // Boundaries are validated by forward: here we only extract when there is something to process
+        auto previous_progress_accounts{db::stages::read_stage_progress(txn, db::stages::kAccountHistoryIndexKey)};
+        auto previous_progress_storage{db::stages::read_stage_progress(txn, db::stages::kStorageHistoryIndexKey)};
+        const auto target_progress{db::stages::read_stage_progress(txn, db::stages::kExecutionKey)};
+        if (get_progress(txn) >= target_progress) return ret;
+
+        if (node_settings_->prune_mode->history().enabled()) {
+            if (!previous_progress_accounts)
+                previous_progress_accounts = node_settings_->prune_mode->history().value_from_head(target_progress);
+            if (!previous_progress_storage)
+                previous_progress_storage = node_settings_->prune_mode->history().value_from_head(target_progress);
+        }
+
+        if (previous_progress_accounts < target_progress)
+            extract_impl(txn, previous_progress_accounts, target_progress, false);
+        if (previous_progress_storage < target_progress)
+            extract_impl(txn, previous_progress_storage, target_progress, true);
+
+    } catch (const StageError& ex) {
+        log::Error(log_prefix_,
+                   {"function", std::string(__FUNCTION__), "exception", std::string(ex.what())});
+        ret = static_cast<Stage::Result>(ex.err());
+    } catch (const mdbx::exception& ex) {
+        log::Error(log_prefix_,
+                   {"function", std::string(__FUNCTION__), "exception", std::string(ex.what())});
+        ret = Stage::Result::kDbError;
+    } catch (const std::exception& ex) {
+        log::Error(log_prefix_,
+                   {"function", std::string(__FUNCTION__), "exception", std::string(ex.what())});
+        ret = Stage::Result::kUnexpectedError;
+    } catch (...) {
+        log::Error(log_prefix_,
+                   {"function", std::string(__FUNCTION__), "exception", "unexpected and undefined"});
+        ret = Stage::Result::kUnexpectedError;
+    }
+
+    if (ret != Stage::Result::kSuccess) discard_extraction();
+    return is_stopping() ? Stage::Result::kAborted : ret;
+}
+
 Stage::Result HistoryIndex::unwind(db::RWTxn& txn) {
     Stage::Result ret{Stage::Result::kSuccess};
 
+    // Data extracted ahead belongs to a forward which is not going to run anymore
+    discard_extraction();
+
     if (!sync_context_->unwind_point.has_value()) return ret;
     const BlockNum to{sync_context_->unwind_point.value()};
 
@@ -160,7 +208,7 @@ Stage::Result HistoryIndex::unwind(db::RWTxn& txn) {
         ret = Stage::Result::kUnexpectedError;
     }
 
-    collector_.reset();
+    discard_extraction();
     operation_ = OperationType::None;
     return is_stopping() ? Stage::Result::kAborted : ret;
 }
@@ -238,26 +286,28 @@ Stage::Result HistoryIndex::prune(db::RWTxn& txn) {
 }
 
 Stage::Result HistoryIndex::forward_impl(db::RWTxn& txn, const BlockNum from, const BlockNum to, const bool storage) {
-    const db::MapConfig source_config{storage ? db::table::kStorageChangeSet : db::table::kAccountChangeSet};
     const db::MapConfig target_config{storage ? db::table::kStorageHistory : db::table::kAccountHistory};
     const size_t target_key_size{kAddressLength + (storage ? kHashLength : 0)};
 
+    auto& collector{storage ? storage_collector_ : account_collector_};
+    auto& extracted_range{storage ? storage_extracted_range_ : account_extracted_range_};
+
+    // Into etl unless already done ahead by forward_extract
+    if (!collector || extracted_range != make_extracted_range(txn, from, to)) {
+        extract_impl(txn, from, to, storage);
+    }
+
     std::unique_lock log_lck(sl_mutex_);
-    loading_ = false;
-    current_source_ = std::string(source_config.name);
     current_target_ = std::string(target_config.name);
     current_key_.clear();
     log_lck.unlock();
 
-    // Into etl
-    collect_bitmaps_from_changeset(txn, source_config, from, to, storage);
-
-    if (!collector_->empty()) {
+    if (!collector->empty()) {
         log_lck.lock();
         loading_ = true;
         index_loader_ = std::make_unique<db::bitmap::IndexLoader>(target_config);
         log_lck.unlock();
-        index_loader_->merge_bitmaps(txn, target_key_size, collector_.get());
+        index_loader_->merge_bitmaps(txn, target_key_size, collector.get());
 
         log_lck.lock();
         loading_ = false;
@@ -267,12 +317,32 @@ Stage::Result HistoryIndex::forward_impl(db::RWTxn& txn, const BlockNum from, co
         log_lck.unlock();
     }
 
+    collector.reset();
+    extracted_range.reset();
+
     db::stages::write_stage_progress(
         txn, (storage ? db::stages::kStorageHistoryIndexKey : db::stages::kAccountHistoryIndexKey), to);
 
     return Stage::Result::kSuccess;
 }
 
+void HistoryIndex::extract_impl(db::ROTxn& txn, const BlockNum from, const BlockNum to, const bool storage) {
+    const db::MapConfig source_config{storage ? db::table::kStorageChangeSet : db::table::kAccountChangeSet};
+    auto& collector{storage ? storage_collector_ : account_collector_};
+    auto& extracted_range{storage ? storage_extracted_range_ : account_extracted_range_};
+
+    std::unique_lock log_lck(sl_mutex_);
+    loading_ = false;
+    collector = std::make_unique<etl::Collector>(node_settings_);
+    extracted_range.reset();
+    current_source_ = std::string(source_config.name);
+    current_key_.clear();
+    log_lck.unlock();
+
+    collect_bitmaps_from_changeset(txn, source_config, from, to, storage, collector.get());
+    extracted_range = make_extracted_range(txn, from, to);
+}
+
 Stage::Result HistoryIndex::unwind_impl(db::RWTxn& txn, const BlockNum from, const BlockNum to, const bool storage) {
     const db::MapConfig source_config{storage ? db::table::kStorageChangeSet : db::table::kAccountChangeSet};
     const db::MapConfig target_config{storage ? db::table::kStorageHistory : db::table::kAccountHistory};
@@ -331,15 +401,14 @@ Stage::Result HistoryIndex::prune_impl(db::RWTxn& txn, const BlockNum threshold,
     return Stage::Result::kSuccess;
 }
 
-void HistoryIndex::collect_bitmaps_from_changeset(db::RWTxn& txn, const db::MapConfig& source_config,
-                                                  const BlockNum from, const BlockNum to, bool storage) {
+void HistoryIndex::collect_bitmaps_from_changeset(db::ROTxn& txn, const db::MapConfig& source_config,
+                                                  const BlockNum from, const BlockNum to, bool storage,
+                                                  etl::Collector* collector) {
     using namespace std::chrono_literals;
     auto log_time{std::chrono::steady_clock::now()};
 
-    absl::btree_map<Bytes, roaring::Roaring64Map> bitmaps;
-    auto bitmaps_it{bitmaps.begin()};
+    db::bitmap::Accumulator bitmaps;
     Bytes bitmaps_key{};
-    size_t bitmaps_size{0};   // To account flushing threshold
     uint16_t flush_count{0};  // To account number of flushings
 
     const BlockNum max_block_number{to};
@@ -376,31 +445,21 @@ void HistoryIndex::collect_bitmaps_from_changeset(db::RWTxn& txn, const db::MapC
                 bitmaps_key.assign(source_data_value_view.substr(0, kAddressLength));
             }
 
-            bitmaps_it = bitmaps.find(bitmaps_key);
-            if (bitmaps_it == bitmaps.end()) {
-                bitmaps_it = bitmaps.emplace(bitmaps_key, roaring::Roaring64Map()).first;
-                bitmaps_size += bitmaps_key.size();
-                bitmaps_size += sizeof(uint64_t);  // see Roaring64Map()::getSizeInBytes()
-            }
-            bitmaps_it->second.add(reached_block_number);
-            bitmaps_size += sizeof(uint32_t);  // All blocks <= UINT32_MAX
-                                               // Is there a chain exceeding that height ?
+            bitmaps.add(bitmaps_key, reached_block_number);
 
             source_data = source->to_current_next_multi(false);
         }
 
         // Flush bitmaps to etl if necessary
-        if (bitmaps_size >= node_settings_->batch_size) {
-            db::bitmap::IndexLoader::flush_bitmaps_to_etl(bitmaps, collector_.get(), flush_count++);
-            bitmaps_size = 0;
+        if (bitmaps.size_bytes() >= node_settings_->batch_size) {
+            db::bitmap::IndexLoader::flush_bitmaps_to_etl(bitmaps, collector, flush_count++);
         }
 
         source_data = source->to_next(false);
     }
 
-    if (bitmaps_size) {
-        db::bitmap::IndexLoader::flush_bitmaps_to_etl(bitmaps, collector_.get(), flush_count++);
-        bitmaps_size = 0;
+    if (!bitmaps.empty()) {
+        db::bitmap::IndexLoader::flush_bitmaps_to_etl(bitmaps, collector, flush_count++);
     }
 }
 
@@ -470,7 +529,7 @@ std::vector<std::string> HistoryIndex::get_log_progress() {
         switch (operation_) {
             case OperationType::Forward:
                 if (loading_) {
-                    current_key_ = collector_ ? abridge(collector_->get_load_key(), kAddressLength) : "";
+                    current_key_ = index_loader_ ? index_loader_->get_current_key() : "";
                     ret.insert(ret.end(), {"from", "etl", "to", current_target_, "key", current_key_});
                 } else {
                     ret.insert(ret.end(), {"from", current_source_, "to", "etl", "key", current_key_});
@@ -499,6 +558,13 @@ std::vector<std::string> HistoryIndex::get_log_progress() {
     return ret;
 }
 
+void HistoryIndex::discard_extraction() {
+    account_collector_.reset();
+    storage_collector_.reset();
+    account_extracted_range_.reset();
+    storage_extracted_range_.reset();
+}
+
 void HistoryIndex::reset_log_progress() {
     std::unique_lock log_lck(sl_mutex_);
     loading_ = false;
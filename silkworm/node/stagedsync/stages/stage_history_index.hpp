@@ -16,6 +16,8 @@
 
 #pragma once
 
+#include <optional>
+
 #include <silkworm/node/db/bitmap.hpp>
 #include <silkworm/node/stagedsync/stages/stage.hpp>
 
@@ -28,12 +30,17 @@ class HistoryIndex : public Stage {
     ~HistoryIndex() override = default;
 
     Stage::Result forward(db::RWTxn& txn) final;
+    Stage::Result forward_extract(db::ROTxn& txn) final;
+    void discard_extraction() final;
     Stage::Result unwind(db::RWTxn& txn) final;
     Stage::Result prune(db::RWTxn& txn) final;
     std::vector<std::string> get_log_progress() final;
 
   private:
-    std::unique_ptr<etl::Collector> collector_{nullptr};
+    std::unique_ptr<etl::Collector> account_collector_{nullptr};
+    std::unique_ptr<etl::Collector> storage_collector_{nullptr};
+    std::optional<ExtractedRange> account_extracted_range_;  // Range held by account_collector_
+    std::optional<ExtractedRange> storage_extracted_range_;  // Range held by storage_collector_
     std::unique_ptr<db::bitmap::IndexLoader> index_loader_{nullptr};
 
     std::atomic_bool loading_{false};  // Whether we're in ETL loading phase
@@ -42,13 +49,14 @@ class HistoryIndex : public Stage {
     std::string current_key_;          // Actual processing key
 
     Stage::Result forward_impl(db::RWTxn& txn, BlockNum from, BlockNum to, bool storage);
+    void extract_impl(db::ROTxn& txn, BlockNum from, BlockNum to, bool storage);
     Stage::Result unwind_impl(db::RWTxn& txn, BlockNum from, BlockNum to, bool storage);
     Stage::Result prune_impl(db::RWTxn& txn, BlockNum threshold, BlockNum to, bool storage);
 
     //! \brief Collects bitmaps of block numbers changes for each account within provided
     //! changeset boundaries
-    void collect_bitmaps_from_changeset(db::RWTxn& txn, const db::MapConfig& source_config, BlockNum from, BlockNum to,
-                                        bool storage);
+    void collect_bitmaps_from_changeset(db::ROTxn& txn, const db::MapConfig& source_config, BlockNum from, BlockNum to,
+                                        bool storage, etl::Collector* collector);
 
     //! \brief Collects unique keys touched by changesets within provided boundaries
     std::map<Bytes, bool> collect_unique_keys_from_changeset(
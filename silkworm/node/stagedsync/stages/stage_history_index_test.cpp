@@ -212,6 +212,32 @@ TEST_CASE("Stage History Index") {
             REQUIRE(storage_history_bitmap.toString() == "{1,2}");
         }
 
+        SECTION("Forward with extract ahead") {
+            stagedsync::SyncContext sync_context{};
+            stagedsync::HistoryIndex stage_history_index(&context.node_settings(), &sync_context);
+            REQUIRE(stage_history_index.forward_extract(txn) == stagedsync::Stage::Result::kSuccess);
+            db::PooledCursor account_history(txn, db::table::kAccountHistory);
+            db::PooledCursor storage_history(txn, db::table::kStorageHistory);
+            REQUIRE(account_history.empty());  // Extract phase must not write
+            REQUIRE(storage_history.empty());
+
+            REQUIRE(stage_history_index.forward(txn) == stagedsync::Stage::Result::kSuccess);
+            REQUIRE(db::stages::read_stage_progress(txn, db::stages::kHistoryIndexKey) == 3);
+            account_history.bind(txn, db::table::kAccountHistory);
+            storage_history.bind(txn, db::table::kStorageHistory);
+
+            auto account_history_data{account_history.lower_bound(db::to_slice(sender), /*throw_notfound=*/false)};
+            REQUIRE(account_history_data.done);
+            auto account_history_bitmap{db::bitmap::parse(account_history_data.value)};
+            REQUIRE(account_history_bitmap.toString() == "{1,2,3}");
+
+            auto storage_history_data{
+                storage_history.lower_bound(db::to_slice(contract_address), /*throw_notfound=*/false)};
+            REQUIRE(storage_history_data.done);
+            auto storage_history_bitmap{db::bitmap::parse(storage_history_data.value)};
+            REQUIRE(storage_history_bitmap.toString() == "{1,2,3}");
+        }
+
         SECTION("Prune") {
             // Prune from second block, so we delete block 1
             // Alter node settings pruning
@@ -32,6 +32,7 @@ Stage::Result LogIndex::forward(db::RWTxn& txn) {
         if (previous_progress == target_progress) {
             // Nothing to process
             operation_ = OperationType::None;
+            discard_extraction();
             return ret;
         } else if (previous_progress > target_progress) {
             // Something bad had happened.  Maybe we need to unwind ?
@@ -83,14 +84,52 @@ Stage::Result LogIndex::forward(db::RWTxn& txn) {
     }
 
     operation_ = OperationType::None;
-    addresses_collector_.reset();
-    topics_collector_.reset();
+    discard_extraction();
     return ret;
 }
 
+Stage::Result LogIndex::forward_extract(db::ROTxn& txn) {
+    Stage::Result ret{Stage::Result::kSuccess};
+    try {
+        throw_if_stopping();
+
+        // Boundaries are validated by forward: here we only extract when there is something to process
+        auto previous_progress{get_progress(txn)};
+        const auto target_progress{db::stages::read_stage_progress(txn, db::stages::kExecutionKey)};
+        if (!previous_progress && node_settings_->prune_mode->history().enabled())
+            previous_progress = node_settings_->prune_mode->history().value_from_head(target_progress);
+
+        if (previous_progress < target_progress)
+            extract_impl(txn, previous_progress, target_progress);
+
+    } catch (const StageError& ex) {
+        log::Error(log_prefix_,
+                   {"function", std::string(__FUNCTION__), "exception", std::string(ex.what())});
+        ret = static_cast<Stage::Result>(ex.err());
+    } catch (const mdbx::exception& ex) {
+        log::Error(log_prefix_,
+                   {"function", std::string(__FUNCTION__), "exception", std::string(ex.what())});
+        ret = Stage::Result::kDbError;
+    } catch (const std::exception& ex) {
+        log::Error(log_prefix_,
+                   {"function", std::string(__FUNCTION__), "exception", std::string(ex.what())});
+        ret = Stage::Result::kUnexpectedError;
+    } catch (...) {
+        log::Error(log_prefix_,
+                   {"function", std::string(__FUNCTION__), "exception", "unexpected and undefined"});
+        ret = Stage::Result::kUnexpectedError;
+    }
+
+    if (ret != Stage::Result::kSuccess) discard_extraction();
+    return is_stopping() ? Stage::Result::kAborted : ret;
+}
+
 Stage::Result LogIndex::unwind(db::RWTxn& txn) {
     Stage::Result ret{Stage::Result::kSuccess};
 
+    // Data extracted ahead belongs to a forward which is not going to run anymore
+    discard_extraction();
+
     if (!sync_context_->unwind_point.has_value()) return ret;
     const BlockNum to{sync_context_->unwind_point.value()};
 
@@ -142,8 +181,7 @@ Stage::Result LogIndex::unwind(db::RWTxn& txn) {
         ret = Stage::Result::kUnexpectedError;
     }
 
-    addresses_collector_.reset();
-    topics_collector_.reset();
+    discard_extraction();
     operation_ = OperationType::None;
     return ret;
 }
@@ -217,22 +255,13 @@ Stage::Result LogIndex::prune(db::RWTxn& txn) {
 }
 
 void LogIndex::forward_impl(db::RWTxn& txn, const BlockNum from, const BlockNum to) {
-    const db::MapConfig source_config{db::table::kLogs};
+    // Into etl collectors unless already done ahead by forward_extract
+    if (!addresses_collector_ || !topics_collector_ || extracted_range_ != make_extracted_range(txn, from, to)) {
+        extract_impl(txn, from, to);
+    }
 
     std::unique_lock log_lck(sl_mutex_);
     operation_ = OperationType::Forward;
-    loading_ = false;
-    topics_collector_ = std::make_unique<etl::Collector>(node_settings_);
-    addresses_collector_ = std::make_unique<etl::Collector>(node_settings_);
-    current_source_ = std::string(source_config.name);
-    current_target_.clear();
-    current_key_.clear();
-    log_lck.unlock();
-
-    // Into etl collectors
-    collect_bitmaps_from_logs(txn, source_config, from, to);
-
-    log_lck.lock();
     loading_ = true;
     current_key_.clear();
     current_target_ = db::table::kLogAddressIndex.name;
@@ -253,7 +282,31 @@ void LogIndex::forward_impl(db::RWTxn& txn, const BlockNum from, const BlockNum
     loading_ = false;
     current_target_.clear();
     index_loader_.reset();
+    extracted_range_.reset();
+    log_lck.unlock();
+}
+
+void LogIndex::discard_extraction() {
+    addresses_collector_.reset();
+    topics_collector_.reset();
+    extracted_range_.reset();
+}
+
+void LogIndex::extract_impl(db::ROTxn& txn, const BlockNum from, const BlockNum to) {
+    const db::MapConfig source_config{db::table::kLogs};
+
+    std::unique_lock log_lck(sl_mutex_);
+    loading_ = false;
+    topics_collector_ = std::make_unique<etl::Collector>(node_settings_);
+    addresses_collector_ = std::make_unique<etl::Collector>(node_settings_);
+    extracted_range_.reset();
+    current_source_ = std::string(source_config.name);
+    current_target_.clear();
+    current_key_.clear();
     log_lck.unlock();
+
+    collect_bitmaps_from_logs(txn, source_config, from, to);
+    extracted_range_ = make_extracted_range(txn, from, to);
 }
 
 void LogIndex::unwind_impl(db::RWTxn& txn, BlockNum from, BlockNum to) {
@@ -292,7 +345,7 @@ void LogIndex::unwind_impl(db::RWTxn& txn, BlockNum from, BlockNum to) {
     log_lck.unlock();
 }
 
-void LogIndex::collect_bitmaps_from_logs(db::RWTxn& txn,
+void LogIndex::collect_bitmaps_from_logs(db::ROTxn& txn,
                                          const db::MapConfig& source_config,
                                          BlockNum from, BlockNum to) {
     using namespace std::chrono_literals;
@@ -301,40 +354,21 @@ void LogIndex::collect_bitmaps_from_logs(db::RWTxn& txn,
     const BlockNum max_block_number{to};
     BlockNum reached_block_number{0};
 
-    absl::btree_map<Bytes, roaring::Roaring64Map> topics_bitmaps;
-    absl::btree_map<Bytes, roaring::Roaring64Map> addresses_bitmaps;
-    size_t topics_bitmaps_size{0};
-    size_t addresses_bitmaps_size{0};
+    db::bitmap::Accumulator topics_bitmaps;
+    db::bitmap::Accumulator addresses_bitmaps;
     uint16_t topics_flush_count{0};
     uint16_t addresses_flush_count{0};
 
     // The function we use to collect decoded data into bitmaps
     cbor_function on_log_bytes{[&topics_bitmaps,
-                                &topics_bitmaps_size,
                                 &addresses_bitmaps,
-                                &addresses_bitmaps_size,
                                 &reached_block_number](unsigned char* data, int size) -> void {
         // We need either a hash or an address
         auto s{static_cast<size_t>(size)};
-        if (s != kHashLength && s != kAddressLength) return;
-
-        Bytes key(data, s);
-        if (key.size() == kHashLength) {
-            auto it{topics_bitmaps.find(key)};
-            if (it == topics_bitmaps.end()) {
-                it = topics_bitmaps.emplace(key, roaring::Roaring64Map()).first;
-                topics_bitmaps_size += key.size() + sizeof(BlockNum);
-            }
-            it->second.add(reached_block_number);
-            topics_bitmaps_size += sizeof(uint32_t);
-        } else {
-            auto it{addresses_bitmaps.find(key)};
-            if (it == addresses_bitmaps.end()) {
-                it = addresses_bitmaps.emplace(key, roaring::Roaring64Map()).first;
-                addresses_bitmaps_size += key.size() + sizeof(BlockNum);
-            }
-            it->second.add(reached_block_number);
-            addresses_bitmaps_size += sizeof(uint32_t);
+        if (s == kHashLength) {
+            topics_bitmaps.add(ByteView{data, s}, reached_block_number);
+        } else if (s == kAddressLength) {
+            addresses_bitmaps.add(ByteView{data, s}, reached_block_number);
         }
     }};
 
@@ -362,22 +396,32 @@ void LogIndex::collect_bitmaps_from_logs(db::RWTxn& txn,
         decoder.run();
 
         // Flushes
-        if (topics_bitmaps_size > node_settings_->batch_size) {
+        if (topics_bitmaps.size_bytes() > node_settings_->batch_size) {
             db::bitmap::IndexLoader::flush_bitmaps_to_etl(topics_bitmaps,
                                                           topics_collector_.get(),
                                                           topics_flush_count++);
-            topics_bitmaps_size = 0;
         }
 
-        if (addresses_bitmaps_size > node_settings_->batch_size) {
+        if (addresses_bitmaps.size_bytes() > node_settings_->batch_size) {
             db::bitmap::IndexLoader::flush_bitmaps_to_etl(addresses_bitmaps,
                                                           addresses_collector_.get(),
                                                           addresses_flush_count++);
-            addresses_bitmaps_size = 0;
         }
 
         source_data = source->to_next(/*throw_notfound=*/false);
     }
+
+    // Flush remaining bitmaps
+    if (!topics_bitmaps.empty()) {
+        db::bitmap::IndexLoader::flush_bitmaps_to_etl(topics_bitmaps,
+                                                      topics_collector_.get(),
+                                                      topics_flush_count++);
+    }
+    if (!addresses_bitmaps.empty()) {
+        db::bitmap::IndexLoader::flush_bitmaps_to_etl(addresses_bitmaps,
+                                                      addresses_collector_.get(),
+                                                      addresses_flush_count++);
+    }
 }
 
 void LogIndex::collect_unique_keys_from_logs(db::RWTxn& txn,
@@ -16,6 +16,7 @@
 
 #pragma once
 
+#include <optional>
 #include <stdexcept>
 
 #include <cbor/cbor.h>
@@ -32,6 +33,8 @@ class LogIndex : public Stage {
     ~LogIndex() override = default;
 
     Stage::Result forward(db::RWTxn& txn) final;
+    Stage::Result forward_extract(db::ROTxn& txn) final;
+    void discard_extraction() final;
     Stage::Result unwind(db::RWTxn& txn) final;
     Stage::Result prune(db::RWTxn& txn) final;
     std::vector<std::string> get_log_progress() final;
@@ -40,6 +43,7 @@ class LogIndex : public Stage {
     std::unique_ptr<etl::Collector> topics_collector_{nullptr};
     std::unique_ptr<etl::Collector> addresses_collector_{nullptr};
     std::unique_ptr<db::bitmap::IndexLoader> index_loader_{nullptr};
+    std::optional<ExtractedRange> extracted_range_;  // Range held by collectors ahead of forward
 
     std::atomic_bool loading_{false};  // Whether we're in ETL loading phase
     std::string current_source_;       // Current source of data
@@ -47,11 +51,12 @@ class LogIndex : public Stage {
     std::string current_key_;          // Actual processing key
 
     void forward_impl(db::RWTxn& txn, BlockNum from, BlockNum to);
+    void extract_impl(db::ROTxn& txn, BlockNum from, BlockNum to);
     void unwind_impl(db::RWTxn& txn, BlockNum from, BlockNum to);
     void prune_impl(db::RWTxn& txn, BlockNum threshold, const db::MapConfig& target);
 
     //! \brief Collects bitmaps of block numbers for each log entry
-    void collect_bitmaps_from_logs(db::RWTxn& txn, const db::MapConfig& source_config, BlockNum from, BlockNum to);
+    void collect_bitmaps_from_logs(db::ROTxn& txn, const db::MapConfig& source_config, BlockNum from, BlockNum to);
 
     //! \brief Collects unique keys for log entries within provided boundaries
     void collect_unique_keys_from_logs(
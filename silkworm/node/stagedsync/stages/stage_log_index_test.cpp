@@ -0,0 +1,150 @@
+/*
+   Copyright 2023 The Silkworm Authors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#include <catch2/catch.hpp>
+
+#include <silkworm/infra/test_util/log.hpp>
+#include <silkworm/node/db/access_layer.hpp>
+#include <silkworm/node/db/bitmap.hpp>
+#include <silkworm/node/db/stages.hpp>
+#include <silkworm/node/db/util.hpp>
+#include <silkworm/node/stagedsync/stages/stage_log_index.hpp>
+#include <silkworm/node/test/context.hpp>
+#include <silkworm/node/types/log_cbor.hpp>
+
+using namespace evmc::literals;
+
+namespace silkworm {
+
+//! Read the block numbers stored in the last shard of the specified bitmap index for the given key (if any)
+static std::optional<std::vector<uint64_t>> read_last_shard(db::RWTxn& txn, const db::MapConfig& index, ByteView key) {
+    db::PooledCursor index_table{txn, index};
+    const Bytes shard_key{Bytes{key} + db::block_key(UINT64_MAX)};
+    const auto data{index_table.find(db::to_slice(shard_key), /*throw_notfound=*/false)};
+    if (!data) {
+        return std::nullopt;
+    }
+    const auto bitmap{db::bitmap::parse(data.value)};
+    std::vector<uint64_t> block_numbers;
+    for (const auto block_number : bitmap) {
+        block_numbers.push_back(block_number);
+    }
+    return block_numbers;
+}
+
+//! Write the logs of one transaction at the given block
+static void write_logs(db::RWTxn& txn, BlockNum block_number, const std::vector<Log>& logs) {
+    db::PooledCursor logs_table{txn, db::table::kLogs};
+    logs_table.upsert(db::to_slice(db::log_key(block_number, 0)), db::to_slice(cbor_encode(logs)));
+}
+
+TEST_CASE("Stage Log Index") {
+    test_util::SetLogVerbosityGuard log_guard{log::Level::kNone};
+    test::Context context;
+    db::RWTxn& txn{context.rw_txn()};
+    txn.disable_commit();
+
+    const auto address_a{0x0a6bb546b9208cfab9e8fa2b9b2c042b18df7030_address};
+    const auto address_b{0x5a0b54d5dc17e0aadc383d2db43b0a0d3e029c4c_address};
+    const auto topic_x{0xddf252ad1be2c89b69c2b068fc378daa952ba7f163c4a11628f55a4df523b3ef_bytes32};
+
+    // Block 1: A emits X, Block 2: B emits no topic, Block 3: A and B emit X
+    write_logs(txn, 1, {Log{address_a, {topic_x}, {}}});
+    write_logs(txn, 2, {Log{address_b, {}, {}}});
+    write_logs(txn, 3, {Log{address_a, {topic_x}, {}}, Log{address_b, {topic_x}, {}}});
+    db::stages::write_stage_progress(txn, db::stages::kExecutionKey, 3);
+
+    stagedsync::SyncContext sync_context{};
+    stagedsync::LogIndex stage_log_index(&context.node_settings(), &sync_context);
+
+    using BlockNumbers = std::vector<uint64_t>;
+    const ByteView key_a{address_a.bytes};
+    const ByteView key_b{address_b.bytes};
+    const ByteView key_x{topic_x.bytes};
+
+    SECTION("Forward") {
+        REQUIRE(stage_log_index.forward(txn) == stagedsync::Stage::Result::kSuccess);
+        REQUIRE(db::stages::read_stage_progress(txn, db::stages::kLogIndexKey) == 3);
+
+        CHECK(read_last_shard(txn, db::table::kLogAddressIndex, key_a) == BlockNumbers{1, 3});
+        CHECK(read_last_shard(txn, db::table::kLogAddressIndex, key_b) == BlockNumbers{2, 3});
+        CHECK(read_last_shard(txn, db::table::kLogTopicIndex, key_x) == BlockNumbers{1, 3});
+    }
+
+    SECTION("Forward with extract ahead") {
+        REQUIRE(stage_log_index.forward_extract(txn) == stagedsync::Stage::Result::kSuccess);
+        // Extract phase must not write
+        CHECK(db::PooledCursor{txn, db::table::kLogAddressIndex}.empty());
+        CHECK(db::PooledCursor{txn, db::table::kLogTopicIndex}.empty());
+        CHECK(db::stages::read_stage_progress(txn, db::stages::kLogIndexKey) == 0);
+
+        REQUIRE(stage_log_index.forward(txn) == stagedsync::Stage::Result::kSuccess);
+        REQUIRE(db::stages::read_stage_progress(txn, db::stages::kLogIndexKey) == 3);
+
+        CHECK(read_last_shard(txn, db::table::kLogAddressIndex, key_a) == BlockNumbers{1, 3});
+        CHECK(read_last_shard(txn, db::table::kLogAddressIndex, key_b) == BlockNumbers{2, 3});
+        CHECK(read_last_shard(txn, db::table::kLogTopicIndex, key_x) == BlockNumbers{1, 3});
+    }
+
+    SECTION("Forward after extract ahead of a stale range") {
+        REQUIRE(stage_log_index.forward_extract(txn) == stagedsync::Stage::Result::kSuccess);
+
+        // Execution moves on after the extraction: forward must not load the extracted range only
+        write_logs(txn, 4, {Log{address_b, {topic_x}, {}}});
+        db::stages::write_stage_progress(txn, db::stages::kExecutionKey, 4);
+
+        REQUIRE(stage_log_index.forward(txn) == stagedsync::Stage::Result::kSuccess);
+        REQUIRE(db::stages::read_stage_progress(txn, db::stages::kLogIndexKey) == 4);
+
+        CHECK(read_last_shard(txn, db::table::kLogAddressIndex, key_a) == BlockNumbers{1, 3});
+        CHECK(read_last_shard(txn, db::table::kLogAddressIndex, key_b) == BlockNumbers{2, 3, 4});
+        CHECK(read_last_shard(txn, db::table::kLogTopicIndex, key_x) == BlockNumbers{1, 3, 4});
+    }
+
+    SECTION("Forward after extract ahead of a reorged chain") {
+        db::write_canonical_hash(txn, 3, 0x01_bytes32);
+        REQUIRE(stage_log_index.forward_extract(txn) == stagedsync::Stage::Result::kSuccess);
+
+        // Block 3 is replaced on the same range: forward must not load what was extracted from the old chain
+        write_logs(txn, 3, {Log{address_b, {}, {}}});
+        db::write_canonical_hash(txn, 3, 0x02_bytes32);
+
+        REQUIRE(stage_log_index.forward(txn) == stagedsync::Stage::Result::kSuccess);
+        REQUIRE(db::stages::read_stage_progress(txn, db::stages::kLogIndexKey) == 3);
+
+        CHECK(read_last_shard(txn, db::table::kLogAddressIndex, key_a) == BlockNumbers{1});
+        CHECK(read_last_shard(txn, db::table::kLogAddressIndex, key_b) == BlockNumbers{2, 3});
+        CHECK(read_last_shard(txn, db::table::kLogTopicIndex, key_x) == BlockNumbers{1});
+    }
+
+    SECTION("Unwind discards extract ahead") {
+        REQUIRE(stage_log_index.forward_extract(txn) == stagedsync::Stage::Result::kSuccess);
+
+        // Nothing to unwind, yet the data extracted ahead must not survive it
+        sync_context.unwind_point = 3;
+        REQUIRE(stage_log_index.unwind(txn) == stagedsync::Stage::Result::kSuccess);
+        write_logs(txn, 3, {Log{address_b, {}, {}}});
+
+        REQUIRE(stage_log_index.forward(txn) == stagedsync::Stage::Result::kSuccess);
+        REQUIRE(db::stages::read_stage_progress(txn, db::stages::kLogIndexKey) == 3);
+
+        CHECK(read_last_shard(txn, db::table::kLogAddressIndex, key_a) == BlockNumbers{1});
+        CHECK(read_last_shard(txn, db::table::kLogAddressIndex, key_b) == BlockNumbers{2, 3});
+        CHECK(read_last_shard(txn, db::table::kLogTopicIndex, key_x) == BlockNumbers{1});
+    }
+}
+
+}  // namespace silkworm
@@ -21,6 +21,7 @@
 #include <magic_enum.hpp>
 
 #include <silkworm/core/common/endian.hpp>
+#include <silkworm/core/crypto/keccak_batch.hpp>
 #include <silkworm/node/db/access_layer.hpp>
 
 namespace silkworm::stagedsync {
@@ -37,6 +38,7 @@ Stage::Result TxLookup::forward(db::RWTxn& txn) {
         if (previous_progress == target_progress) {
             // Nothing to process
             operation_ = OperationType::None;
+            discard_extraction();
             return ret;
         } else if (previous_progress > target_progress) {
             // Something bad had happened.  Maybe we need to unwind ?
@@ -86,13 +88,52 @@ Stage::Result TxLookup::forward(db::RWTxn& txn) {
     }
 
     operation_ = OperationType::None;
-    collector_.reset();
+    discard_extraction();
     return ret;
 }
 
+Stage::Result TxLookup::forward_extract(db::ROTxn& txn) {
+    Stage::Result ret{Stage::Result::kSuccess};
+    try {
+        throw_if_stopping();
+
+        // Boundaries are validated by forward: here we only extract when there is something to process
+        auto previous_progress{get_progress(txn)};
+        const auto target_progress{db::stages::read_stage_progress(txn, db::stages::kExecutionKey)};
+        if (!previous_progress && node_settings_->prune_mode->tx_index().enabled())
+            previous_progress = node_settings_->prune_mode->tx_index().value_from_head(target_progress);
+
+        if (previous_progress < target_progress)
+            extract_impl(txn, previous_progress, target_progress);
+
+    } catch (const StageError& ex) {
+        log::Error(log_prefix_,
+                   {"function", std::string(__FUNCTION__), "exception", std::string(ex.what())});
+        ret = static_cast<Stage::Result>(ex.err());
+    } catch (const mdbx::exception& ex) {
+        log::Error(log_prefix_,
+                   {"function", std::string(__FUNCTION__), "exception", std::string(ex.what())});
+        ret = Stage::Result::kDbError;
+    } catch (const std::exception& ex) {
+        log::Error(log_prefix_,
+                   {"function", std::string(__FUNCTION__), "exception", std::string(ex.what())});
+        ret = Stage::Result::kUnexpectedError;
+    } catch (...) {
+        log::Error(log_prefix_,
+                   {"function", std::string(__FUNCTION__), "exception", "unexpected and undefined"});
+        ret = Stage::Result::kUnexpectedError;
+    }
+
+    if (ret != Stage::Result::kSuccess) discard_extraction();
+    return is_stopping() ? Stage::Result::kAborted : ret;
+}
+
 Stage::Result TxLookup::unwind(db::RWTxn& txn) {
     Stage::Result ret{Stage::Result::kSuccess};
 
+    // Data extracted ahead belongs to a forward which is not going to run anymore
+    discard_extraction();
+
     if (!sync_context_->unwind_point.has_value()) return ret;
     const BlockNum to{sync_context_->unwind_point.value()};
 
@@ -145,7 +186,7 @@ Stage::Result TxLookup::unwind(db::RWTxn& txn) {
     }
 
     operation_ = OperationType::None;
-    collector_.reset();
+    discard_extraction();
     return ret;
 }
 
@@ -218,19 +259,13 @@ Stage::Result TxLookup::prune(db::RWTxn& txn) {
 }
 
 void TxLookup::forward_impl(db::RWTxn& txn, const BlockNum from, const BlockNum to) {
+    // Into etl collector unless already done ahead by forward_extract
+    if (!collector_ || extracted_range_ != make_extracted_range(txn, from, to)) {
+        extract_impl(txn, from, to);
+    }
+
     std::unique_lock log_lck(sl_mutex_);
     operation_ = OperationType::Forward;
-    loading_ = false;
-    collector_ = std::make_unique<etl::Collector>(node_settings_);
-    current_source_ = std::string(db::table::kBlockBodies.name);
-    current_target_.clear();
-    current_key_.clear();
-    log_lck.unlock();
-
-    // Into etl collector
-    collect_transaction_hashes_from_canonical_bodies(txn, from, to, /*for_deletion=*/false);
-
-    log_lck.lock();
     loading_ = true;
     current_target_ = std::string(db::table::kTxLookup.name);
     current_key_.clear();
@@ -246,9 +281,29 @@ void TxLookup::forward_impl(db::RWTxn& txn, const BlockNum from, const BlockNum
     current_target_.clear();
     current_key_.clear();
     collector_.reset();
+    extracted_range_.reset();
     log_lck.unlock();
 }
 
+void TxLookup::discard_extraction() {
+    collector_.reset();
+    extracted_range_.reset();
+}
+
+void TxLookup::extract_impl(db::ROTxn& txn, const BlockNum from, const BlockNum to) {
+    std::unique_lock log_lck(sl_mutex_);
+    loading_ = false;
+    collector_ = std::make_unique<etl::Collector>(node_settings_);
+    extracted_range_.reset();
+    current_source_ = std::string(db::table::kBlockBodies.name);
+    current_target_.clear();
+    current_key_.clear();
+    log_lck.unlock();
+
+    collect_transaction_hashes_from_canonical_bodies(txn, from, to, /*for_deletion=*/false);
+    extracted_range_ = make_extracted_range(txn, from, to);
+}
+
 void TxLookup::unwind_impl(db::RWTxn& txn, BlockNum from, BlockNum to) {
     std::unique_lock log_lck(sl_mutex_);
     operation_ = OperationType::Unwind;
@@ -313,7 +368,7 @@ void TxLookup::prune_impl(db::RWTxn& txn, BlockNum from, BlockNum to) {
     log_lck.unlock();
 }
 
-void TxLookup::collect_transaction_hashes_from_canonical_bodies(db::RWTxn& txn,
+void TxLookup::collect_transaction_hashes_from_canonical_bodies(db::ROTxn& txn,
                                                                 const BlockNum from, const BlockNum to,
                                                                 const bool for_deletion) {
     using namespace std::chrono_literals;
@@ -325,6 +380,8 @@ void TxLookup::collect_transaction_hashes_from_canonical_bodies(db::RWTxn& txn,
     BlockNum start_block_num{std::min(from, to) + 1};
 
     Bytes etl_value{};
+    std::vector<ByteView> rlp_encoded_views;
+    std::vector<ethash::hash256> transaction_hashes;
 
     for (BlockNum current_block_num = start_block_num; current_block_num <= target_block_num; ++current_block_num) {
         auto current_hash = db::read_canonical_hash(txn, current_block_num);
@@ -353,9 +410,11 @@ void TxLookup::collect_transaction_hashes_from_canonical_bodies(db::RWTxn& txn,
             etl_value.assign(zeroless_view(block_num_as_bytes));
         }
 
-        for (auto& rlp_encoded_tx : rlp_encoded_txs) {
-            // Hash transaction rlp
-            auto transaction_hash = keccak256(rlp_encoded_tx);  // see Transaction::hash()
+        // Hash transactions rlp (see Transaction::hash()) all together, so that they can share SIMD lanes
+        rlp_encoded_views.assign(rlp_encoded_txs.begin(), rlp_encoded_txs.end());
+        transaction_hashes.resize(rlp_encoded_views.size());
+        keccak256_batch(rlp_encoded_views, transaction_hashes);
+        for (const auto& transaction_hash : transaction_hashes) {
             collector_->collect({Bytes(transaction_hash.bytes, kHashLength), etl_value});
         }
     }
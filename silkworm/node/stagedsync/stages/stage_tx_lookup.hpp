@@ -16,6 +16,8 @@
 
 #pragma once
 
+#include <optional>
+
 #include <silkworm/node/db/bitmap.hpp>
 #include <silkworm/node/stagedsync/stages/stage.hpp>
 
@@ -28,12 +30,15 @@ class TxLookup : public Stage {
     ~TxLookup() override = default;
 
     Stage::Result forward(db::RWTxn& txn) final;
+    Stage::Result forward_extract(db::ROTxn& txn) final;
+    void discard_extraction() final;
     Stage::Result unwind(db::RWTxn& txn) final;
     Stage::Result prune(db::RWTxn& txn) final;
     std::vector<std::string> get_log_progress() final;
 
   private:
     std::unique_ptr<etl::Collector> collector_{nullptr};
+    std::optional<ExtractedRange> extracted_range_;  // Range held by collector ahead of forward
 
     std::atomic_bool loading_{false};  // Whether we're in ETL loading phase
     std::string current_source_;       // Current source of data
@@ -41,12 +46,13 @@ class TxLookup : public Stage {
     std::string current_key_;          // Actual processing key
 
     void forward_impl(db::RWTxn& txn, BlockNum from, BlockNum to);
+    void extract_impl(db::ROTxn& txn, BlockNum from, BlockNum to);
     void unwind_impl(db::RWTxn& txn, BlockNum from, BlockNum to);
     void prune_impl(db::RWTxn& txn, BlockNum from, BlockNum to);
 
     void reset_log_progress();  // Clears out all logging vars
 
-    void collect_transaction_hashes_from_canonical_bodies(db::RWTxn& txn,
+    void collect_transaction_hashes_from_canonical_bodies(db::ROTxn& txn,
                                                           BlockNum from, BlockNum to,
                                                           bool for_deletion);
 };
@@ -111,6 +111,27 @@ TEST_CASE("Stage Transaction Lookups") {
         REQUIRE_THROWS(lookup_table.find(db::to_slice(tx_hash_2.bytes), true));
     }
 
+    SECTION("Forward with extract ahead") {
+        // Unwind everything, then extract ahead of forward like the pipeline does
+        sync_context.unwind_point.emplace(0);
+        REQUIRE(stage_tx_lookup.unwind(txn) == stagedsync::Stage::Result::kSuccess);
+        sync_context.unwind_point.reset();
+        db::PooledCursor lookup_table(txn, db::table::kTxLookup);
+        REQUIRE(lookup_table.empty());
+
+        REQUIRE(stage_tx_lookup.forward_extract(txn) == stagedsync::Stage::Result::kSuccess);
+        REQUIRE(lookup_table.empty());  // Extract phase must not write
+        REQUIRE(stage_tx_lookup.forward(txn) == stagedsync::Stage::Result::kSuccess);
+        lookup_table.bind(txn, db::table::kTxLookup);
+        REQUIRE(lookup_table.size() == 2);
+
+        BlockNum lookup_data_block_num{0};
+        auto lookup_data{lookup_table.find(db::to_slice(tx_hash_2.bytes), false)};
+        REQUIRE(lookup_data.done);
+        REQUIRE(endian::from_big_compact(db::from_slice(lookup_data.value), lookup_data_block_num));
+        REQUIRE(lookup_data_block_num == 2u);
+    }
+
     SECTION("Prune") {
         // Prune from second block, so we delete block 1
         // Alter node settings pruning
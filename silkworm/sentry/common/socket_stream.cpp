@@ -31,6 +31,10 @@ Task<void> SocketStream::send(Bytes data) {
     co_await async_write(socket_, buffer(data), use_awaitable);
 }
 
+Task<void> SocketStream::send(ByteView data) {
+    co_await async_write(socket_, buffer(data.data(), data.size()), use_awaitable);
+}
+
 Task<uint16_t> SocketStream::receive_short() {
     Bytes data = co_await receive_fixed(sizeof(uint16_t));
     uint16_t value = endian::load_big_u16(data.data());
@@ -55,4 +59,8 @@ Task<ByteView> SocketStream::receive_size_and_data(Bytes& raw_data) {
     co_return ByteView(data_ptr, size);
 }
 
+Task<size_t> SocketStream::receive_some(uint8_t* data, size_t size) {
+    co_return (co_await socket_.async_read_some(buffer(data, size), use_awaitable));
+}
+
 }  // namespace silkworm::sentry
@@ -39,10 +39,14 @@ class SocketStream {
     [[nodiscard]] const boost::asio::ip::tcp::socket& socket() const { return socket_; }
 
     Task<void> send(Bytes data);
+    //! Send data from a buffer that is kept alive by the caller until the completion
+    Task<void> send(ByteView data);
 
     Task<uint16_t> receive_short();
     Task<Bytes> receive_fixed(std::size_t size);
     Task<ByteView> receive_size_and_data(Bytes& raw_data);
+    //! Receive whatever is available (at least 1 byte) up to the given size
+    Task<size_t> receive_some(uint8_t* data, size_t size);
 
   private:
     boost::asio::ip::tcp::socket socket_;
@@ -16,63 +16,474 @@
 
 #include "discovery.hpp"
 
+#include <algorithm>
+#include <chrono>
+#include <map>
+#include <mutex>
+#include <optional>
+#include <set>
+#include <utility>
+
+#include <boost/asio/co_spawn.hpp>
+#include <boost/asio/deferred.hpp>
+#include <boost/asio/experimental/parallel_group.hpp>
+#include <boost/asio/this_coro.hpp>
+#include <boost/asio/use_awaitable.hpp>
+#include <gsl/util>
+
 #include <silkworm/infra/common/log.hpp>
+#include <silkworm/infra/concurrency/awaitable_future.hpp>
+#include <silkworm/infra/concurrency/awaitable_wait_for_all.hpp>
+#include <silkworm/infra/concurrency/awaitable_wait_for_one.hpp>
+#include <silkworm/infra/concurrency/channel.hpp>
+#include <silkworm/infra/concurrency/parallel_group_utils.hpp>
+#include <silkworm/infra/concurrency/task_group.hpp>
+#include <silkworm/infra/concurrency/timeout.hpp>
+#include <silkworm/sentry/common/sleep.hpp>
 
+#include "common/message_expiration.hpp"
+#include "find/find_node_handler.hpp"
 #include "message_handler.hpp"
 #include "ping/ping_handler.hpp"
+#include "routing_table.hpp"
 #include "server.hpp"
 
 namespace silkworm::sentry::discovery::disc_v4 {
 
+using namespace boost::asio;
+using namespace std::chrono_literals;
+
 class DiscoveryImpl : private MessageHandler {
   public:
     DiscoveryImpl(
+        any_io_executor executor,
         uint16_t server_port,
         std::function<EccKeyPair()> node_key,
-        node_db::NodeDb& node_db)
-        : server_(server_port, std::move(node_key), *this),
-          node_db_(node_db) {}
+        node_db::NodeDb& node_db,
+        std::vector<EnodeUrl> bootnodes)
+        : server_(executor, server_port, node_key, *this),
+          node_key_(std::move(node_key)),
+          node_db_(node_db),
+          bootnodes_(std::move(bootnodes)),
+          ping_tasks_(executor, kMaxPingTasks) {}
     ~DiscoveryImpl() override = default;
 
     DiscoveryImpl(const DiscoveryImpl&) = delete;
     DiscoveryImpl& operator=(const DiscoveryImpl&) = delete;
 
+    void setup() {
+        {
+            std::scoped_lock lock{mutex_};
+            routing_table_.emplace(node_key_().public_key());
+        }
+
+        server_.setup();
+    }
+
+    uint16_t port() const {
+        return server_.port();
+    }
+
     Task<void> run() {
-        co_await server_.run();
+        using namespace concurrency::awaitable_wait_for_all;
+        co_await (server_.run() && discover_more() && ping_tasks_.wait());
     }
 
   private:
-    Task<void> on_find_node(find::FindNodeMessage /*message*/) override {
-        co_return;
+    //! The "alpha" of Kademlia: max concurrent FIND_NODE queries of a lookup
+    static constexpr size_t kAlpha = 3;
+    static constexpr auto kPingTimeout = 500ms;
+    static constexpr auto kFindNodeTimeout = 500ms;
+    //! Nodes that replied to a ping within this period are not pinged again before querying them
+    static constexpr auto kBondExpiration = 24h;
+    //! Pause between lookups while they are finding new nodes
+    static constexpr auto kLookupPause = 1s;
+    //! Pause between lookups when no new nodes were found by the last one
+    static constexpr auto kIdleLookupPause = 10s;
+    static constexpr size_t kMaxPingTasks = 1000;
+    static constexpr size_t kMaxKnownNodesOnStart = 256;
+
+    Task<void> on_find_node(find::FindNodeMessage message, EccPublicKey sender_public_key, ip::udp::endpoint sender_endpoint) override {
+        // reply only to the nodes whose endpoint is verified to avoid being used for traffic amplification
+        if (!co_await is_bonded(sender_public_key)) {
+            co_return;
+        }
+
+        std::vector<EccPublicKey> closest_node_ids;
+        {
+            std::scoped_lock lock{mutex_};
+            closest_node_ids = routing_table_->closest_nodes(message.target_public_key, RoutingTable::kBucketSize);
+        }
+
+        co_await find::FindNodeHandler::handle(std::move(message), std::move(sender_endpoint), std::move(closest_node_ids), node_db_, server_);
     }
 
-    Task<void> on_neighbors(find::NeighborsMessage /*message*/) override {
+    Task<void> on_neighbors(find::NeighborsMessage message, EccPublicKey sender_public_key) override {
+        std::scoped_lock lock{mutex_};
+        auto it = pending_neighbors_.find(sender_public_key);
+        if (it != pending_neighbors_.end()) {
+            it->second->try_send(std::move(message));
+        }
         co_return;
     }
 
-    Task<void> on_ping(ping::PingMessage message, boost::asio::ip::udp::endpoint sender_endpoint, Bytes ping_packet_hash) override {
-        return ping::PingHandler::handle(std::move(message), std::move(sender_endpoint), std::move(ping_packet_hash), server_);
+    Task<void> on_ping(ping::PingMessage message, EccPublicKey sender_public_key, ip::udp::endpoint sender_endpoint, Bytes ping_packet_hash) override {
+        if (is_expired_message_expiration(message.expiration)) {
+            co_return;
+        }
+
+        node_db::NodeAddress address{
+            sender_endpoint.address(),
+            sender_endpoint.port(),
+            message.sender_port_rlpx,
+        };
+        co_await ping::PingHandler::handle(std::move(message), sender_endpoint, std::move(ping_packet_hash), server_);
+        co_await node_db_.upsert_node_address(sender_public_key, std::move(address));
+
+        // ping back unknown nodes to verify their endpoint and add them to the routing table,
+        // this is done in the background, because the pong is received by the same loop that is calling this handler
+        if (!co_await is_bonded(sender_public_key)) {
+            {
+                std::scoped_lock lock{mutex_};
+                if (ping_tasks_count_ >= kMaxPingTasks) {
+                    log::Debug("sentry") << "disc_v4::Discovery too many nodes to verify, dropping a ping from " << sender_endpoint;
+                    co_return;
+                }
+                ping_tasks_count_++;
+            }
+            auto executor = co_await this_coro::executor;
+            ping_tasks_.spawn(executor, verify_ping_sender(std::move(sender_public_key), std::move(sender_endpoint)));
+        }
     }
 
-    Task<void> on_pong(ping::PongMessage /*message*/) override {
-        co_return;
+    Task<void> on_pong(ping::PongMessage message, EccPublicKey sender_public_key) override {
+        if (is_expired_message_expiration(message.expiration)) {
+            co_return;
+        }
+
+        std::shared_ptr<concurrency::AwaitablePromise<bool>> pong_promise;
+        {
+            std::scoped_lock lock{mutex_};
+            auto it = pending_pongs_.find(sender_public_key);
+            if (it == pending_pongs_.end()) {
+                co_return;
+            }
+            pong_promise = std::move(it->second);
+            pending_pongs_.erase(it);
+        }
+
+        co_await node_db_.update_last_pong_time(sender_public_key, std::chrono::system_clock::now());
+        pong_promise->set_value(true);
+    }
+
+    Task<bool> is_bonded(const EccPublicKey& id) {
+        auto last_pong_time = co_await node_db_.find_last_pong_time(id);
+        co_return last_pong_time && (*last_pong_time > std::chrono::system_clock::now() - kBondExpiration);
+    }
+
+    //! Sends a ping and waits for the pong
+    Task<bool> ping_check(EccPublicKey id, ip::udp::endpoint endpoint) {
+        auto executor = co_await this_coro::executor;
+        auto pong_promise = std::make_shared<concurrency::AwaitablePromise<bool>>(executor);
+        auto pong_future = pong_promise->get_future();
+        {
+            std::scoped_lock lock{mutex_};
+            pending_pongs_.insert_or_assign(id, pong_promise);
+        }
+
+        ping::PingMessage ping{
+            ip::udp::endpoint{ip::udp::v4(), server_.port()},
+            server_.port(),
+            endpoint,
+            make_message_expiration(),
+        };
+
+        bool is_pong_received = false;
+        try {
+            using namespace concurrency::awaitable_wait_for_one;
+            co_await server_.send_ping(std::move(ping), endpoint);
+            co_await (pong_future.get_async() || concurrency::timeout(kPingTimeout));
+            is_pong_received = true;
+        } catch (const concurrency::TimeoutExpiredError&) {
+        } catch (const boost::system::system_error& ex) {
+            if (ex.code() == boost::system::errc::operation_canceled) {
+                throw;
+            }
+            log::Debug("sentry") << "disc_v4::Discovery ping failed: " << ex.what();
+        }
+
+        if (!is_pong_received) {
+            std::scoped_lock lock{mutex_};
+            auto it = pending_pongs_.find(id);
+            if ((it != pending_pongs_.end()) && (it->second == pong_promise)) {
+                pending_pongs_.erase(it);
+            }
+        }
+        co_return is_pong_received;
+    }
+
+    //! Pings a node and adds it to the routing table if it replies.
+    //! If its bucket is full, the least recently seen node is evicted only if it doesn't reply to a ping.
+    Task<bool> verify_node(EccPublicKey id, ip::udp::endpoint endpoint) {
+        if (!co_await ping_check(id, endpoint)) {
+            std::scoped_lock lock{mutex_};
+            routing_table_->remove(id);
+            co_return false;
+        }
+
+        std::optional<EccPublicKey> oldest_id;
+        {
+            std::scoped_lock lock{mutex_};
+            oldest_id = routing_table_->add(id);
+        }
+        if (!oldest_id) {
+            co_return true;
+        }
+
+        bool is_oldest_alive = false;
+        auto oldest_address = co_await node_db_.find_node_address_v4(*oldest_id);
+        if (oldest_address) {
+            is_oldest_alive = co_await ping_check(*oldest_id, ip::udp::endpoint{oldest_address->ip, oldest_address->port_disc});
+        }
+
+        std::scoped_lock lock{mutex_};
+        if (is_oldest_alive) {
+            routing_table_->add(*oldest_id);
+        } else {
+            routing_table_->replace(*oldest_id, id);
+        }
+        co_return true;
+    }
+
+    Task<void> verify_node_in_background(EccPublicKey id, ip::udp::endpoint endpoint) {
+        co_await verify_node(std::move(id), std::move(endpoint));
+    }
+
+    //! Verifies the sender of a ping, accounted in ping_tasks_count_ by on_ping before spawning
+    Task<void> verify_ping_sender(EccPublicKey id, ip::udp::endpoint endpoint) {
+        auto _ = gsl::finally([this] {
+            std::scoped_lock lock{mutex_};
+            this->ping_tasks_count_--;
+        });
+        co_await verify_node_in_background(std::move(id), std::move(endpoint));
+    }
+
+    //! Sends FIND_NODE and collects the NEIGHBORS replies until a full bucket is received or a timeout
+    Task<void> find_neighbors(EccPublicKey id, EccPublicKey target, std::map<EccPublicKey, NodeAddress>& neighbors) {
+        auto address = co_await node_db_.find_node_address_v4(id);
+        if (!address || (address->port_disc == 0)) {
+            co_return;
+        }
+        ip::udp::endpoint endpoint{address->ip, address->port_disc};
+
+        bool is_verified = co_await is_bonded(id);
+        if (!is_verified) {
+            is_verified = co_await verify_node(id, endpoint);
+        }
+        if (!is_verified) {
+            co_return;
+        }
+
+        auto executor = co_await this_coro::executor;
+        auto replies = std::make_shared<concurrency::Channel<find::NeighborsMessage>>(executor, RoutingTable::kBucketSize);
+        {
+            std::scoped_lock lock{mutex_};
+            pending_neighbors_.insert_or_assign(id, replies);
+        }
+
+        try {
+            using namespace concurrency::awaitable_wait_for_one;
+            co_await server_.send_find_node(find::FindNodeMessage{std::move(target), make_message_expiration()}, endpoint);
+            while (neighbors.size() < RoutingTable::kBucketSize) {
+                auto message = std::get<0>(co_await (replies->receive() || concurrency::timeout(kFindNodeTimeout)));
+                if (!is_expired_message_expiration(message.expiration)) {
+                    neighbors.merge(message.node_addresses);
+                }
+            }
+        } catch (const concurrency::TimeoutExpiredError&) {
+        } catch (const boost::system::system_error& ex) {
+            if (ex.code() == boost::system::errc::operation_canceled) {
+                throw;
+            }
+            log::Debug("sentry") << "disc_v4::Discovery find_neighbors failed: " << ex.what();
+        }
+
+        std::scoped_lock lock{mutex_};
+        auto it = pending_neighbors_.find(id);
+        if ((it != pending_neighbors_.end()) && (it->second == replies)) {
+            pending_neighbors_.erase(it);
+        }
+    }
+
+    static Task<void> wait_for_all(std::vector<Task<void>> tasks) {
+        auto executor = co_await this_coro::executor;
+        using OperationType = decltype(co_spawn(executor, ([]() -> Task<void> { co_return; })(), deferred));
+        std::vector<OperationType> operations;
+        operations.reserve(tasks.size());
+        for (auto& task : tasks) {
+            operations.push_back(co_spawn(executor, std::move(task), deferred));
+        }
+
+        auto group = experimental::make_parallel_group(std::move(operations));
+        auto [order, exceptions] = co_await group.async_wait(experimental::wait_for_all(), use_awaitable);
+        concurrency::rethrow_first_exception_if_any(exceptions, order);
+    }
+
+    //! Iterative Kademlia lookup: queries the closest known nodes to the target, alpha at a time,
+    //! until the k closest found nodes are all queried.
+    //! \return The number of found nodes that were not in the routing table.
+    Task<size_t> lookup(EccPublicKey target) {
+        const auto target_hash = node_id_hash(target);
+        const auto local_node_id = node_key_().public_key();
+
+        std::map<EccPublicKey, ethash::hash256> candidates;
+        std::set<EccPublicKey> queried_ids;
+        size_t new_nodes_count = 0;
+
+        {
+            std::scoped_lock lock{mutex_};
+            for (auto& id : routing_table_->closest_nodes(target, RoutingTable::kBucketSize)) {
+                candidates.emplace(id, node_id_hash(id));
+            }
+        }
+
+        while (true) {
+            std::vector<std::pair<EccPublicKey, ethash::hash256>> closest(candidates.begin(), candidates.end());
+            std::sort(closest.begin(), closest.end(), [&target_hash](const auto& c1, const auto& c2) {
+                return is_closer(target_hash, c1.second, c2.second);
+            });
+            if (closest.size() > RoutingTable::kBucketSize) {
+                closest.resize(RoutingTable::kBucketSize);
+            }
+
+            std::vector<EccPublicKey> query_ids;
+            for (auto& [id, _] : closest) {
+                if ((query_ids.size() < kAlpha) && !queried_ids.contains(id)) {
+                    query_ids.push_back(id);
+                }
+            }
+            if (query_ids.empty()) {
+                break;
+            }
+
+            std::vector<std::map<EccPublicKey, NodeAddress>> results(query_ids.size());
+            std::vector<Task<void>> queries;
+            for (size_t i = 0; i < query_ids.size(); ++i) {
+                queried_ids.insert(query_ids[i]);
+                queries.push_back(find_neighbors(query_ids[i], target, results[i]));
+            }
+            co_await wait_for_all(std::move(queries));
+
+            for (auto& neighbors : results) {
+                for (auto& [id, address] : neighbors) {
+                    if ((id == local_node_id) || candidates.contains(id)) {
+                        continue;
+                    }
+                    if (!routing_table_contains(id)) {
+                        ++new_nodes_count;
+                    }
+                    co_await node_db_.upsert_node_address(
+                        id,
+                        node_db::NodeAddress{
+                            address.endpoint.address(),
+                            address.endpoint.port(),
+                            address.port_rlpx,
+                        });
+                    candidates.emplace(id, node_id_hash(id));
+                }
+            }
+        }
+
+        co_return new_nodes_count;
+    }
+
+    //! Seeds the routing table with the nodes known from the previous runs and the bootnodes
+    Task<void> bootstrap() {
+        auto min_pong_time = std::chrono::system_clock::now() - kBondExpiration;
+        auto known_ids = co_await node_db_.find_useful_nodes(min_pong_time, kMaxKnownNodesOnStart);
+        {
+            std::scoped_lock lock{mutex_};
+            for (auto& id : known_ids) {
+                routing_table_->add(id);
+            }
+        }
+
+        std::vector<Task<void>> pings;
+        for (auto& url : bootnodes_) {
+            co_await node_db_.upsert_node_address(url.public_key(), node_db::NodeAddress{url.ip(), url.port(), url.port()});
+            pings.push_back(verify_node_in_background(url.public_key(), ip::udp::endpoint{url.ip(), url.port()}));
+        }
+        co_await wait_for_all(std::move(pings));
+    }
+
+    Task<void> discover_more() {
+        auto start_time = std::chrono::steady_clock::now();
+        size_t next_milestone = RoutingTable::kBucketSize;
+
+        co_await bootstrap();
+
+        while (true) {
+            // a random target explores a random region of the network
+            size_t new_nodes_count = co_await lookup(EccKeyPair{}.public_key());
+
+            size_t table_size = routing_table_size();
+            auto elapsed = std::chrono::duration_cast<std::chrono::seconds>(std::chrono::steady_clock::now() - start_time);
+            log::Debug("sentry") << "disc_v4::Discovery lookup found " << new_nodes_count
+                                 << " new nodes, routing table size: " << table_size;
+            if (table_size >= next_milestone) {
+                log::Info("sentry") << "disc_v4::Discovery found " << table_size << " nodes in " << elapsed.count() << "s";
+                while (next_milestone <= table_size) {
+                    next_milestone *= 2;
+                }
+            }
+
+            co_await sleep((new_nodes_count > 0) ? kLookupPause : kIdleLookupPause);
+        }
+    }
+
+    bool routing_table_contains(const EccPublicKey& id) {
+        std::scoped_lock lock{mutex_};
+        return routing_table_->contains(id);
+    }
+
+    size_t routing_table_size() {
+        std::scoped_lock lock{mutex_};
+        return routing_table_->size();
     }
 
-  private:
     Server server_;
-    [[maybe_unused]] node_db::NodeDb& node_db_;
+    std::function<EccKeyPair()> node_key_;
+    node_db::NodeDb& node_db_;
+    const std::vector<EnodeUrl> bootnodes_;
+    concurrency::TaskGroup ping_tasks_;
+    size_t ping_tasks_count_{0};
+
+    std::mutex mutex_;
+    std::optional<RoutingTable> routing_table_;
+    std::map<EccPublicKey, std::shared_ptr<concurrency::AwaitablePromise<bool>>> pending_pongs_;
+    std::map<EccPublicKey, std::shared_ptr<concurrency::Channel<find::NeighborsMessage>>> pending_neighbors_;
 };
 
 Discovery::Discovery(
+    any_io_executor executor,
     uint16_t server_port,
     std::function<EccKeyPair()> node_key,
-    node_db::NodeDb& node_db)
-    : p_impl_(std::make_unique<DiscoveryImpl>(server_port, std::move(node_key), node_db)) {}
+    node_db::NodeDb& node_db,
+    std::vector<EnodeUrl> bootnodes)
+    : p_impl_(std::make_unique<DiscoveryImpl>(std::move(executor), server_port, std::move(node_key), node_db, std::move(bootnodes))) {}
 
 Discovery::~Discovery() {
     log::Trace("sentry") << "silkworm::sentry::discovery::disc_v4::Discovery::~Discovery";
 }
 
+void Discovery::setup() {
+    p_impl_->setup();
+}
+
+uint16_t Discovery::port() const {
+    return p_impl_->port();
+}
+
 Task<void> Discovery::run() {
     return p_impl_->run();
 }
@@ -18,27 +18,39 @@
 
 #include <functional>
 #include <memory>
+#include <vector>
 
 #include <silkworm/infra/concurrency/task.hpp>
 
+#include <boost/asio/any_io_executor.hpp>
+
 #include <silkworm/sentry/common/ecc_key_pair.hpp>
+#include <silkworm/sentry/common/enode_url.hpp>
 #include <silkworm/sentry/discovery/node_db/node_db.hpp>
 
 namespace silkworm::sentry::discovery::disc_v4 {
 
 class DiscoveryImpl;
 
+//! Kademlia-like node discovery: keeps a routing table of live nodes and runs iterative lookups
+//! to find more of them. Nodes replying to pings are recorded in the NodeDb (see NodeDb::find_useful_nodes).
 class Discovery {
   public:
     Discovery(
+        boost::asio::any_io_executor executor,
         uint16_t server_port,
         std::function<EccKeyPair()> node_key,
-        node_db::NodeDb& node_db);
+        node_db::NodeDb& node_db,
+        std::vector<EnodeUrl> bootnodes);
     ~Discovery();
 
     Discovery(const Discovery&) = delete;
     Discovery& operator=(const Discovery&) = delete;
 
+    //! Binds the socket, must be called before run()
+    void setup();
+    //! The UDP port the discovery is listening on, available after setup()
+    uint16_t port() const;
     Task<void> run();
 
   private:
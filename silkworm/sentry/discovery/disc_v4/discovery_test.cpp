@@ -0,0 +1,173 @@
+/*
+   Copyright 2023 The Silkworm Authors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#include "discovery.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <memory>
+#include <vector>
+
+#include <catch2/catch.hpp>
+
+#include <boost/asio/ip/address.hpp>
+#include <boost/asio/ip/udp.hpp>
+
+#include <silkworm/infra/concurrency/awaitable_wait_for_all.hpp>
+#include <silkworm/infra/concurrency/awaitable_wait_for_one.hpp>
+#include <silkworm/infra/concurrency/timeout.hpp>
+#include <silkworm/infra/test_util/task_runner.hpp>
+#include <silkworm/sentry/common/sleep.hpp>
+#include <silkworm/sentry/discovery/node_db/node_db_sqlite.hpp>
+
+#include "common/message_expiration.hpp"
+#include "server.hpp"
+
+namespace silkworm::sentry::discovery::disc_v4 {
+
+using namespace boost::asio;
+using namespace std::chrono_literals;
+
+// Several discovery instances on localhost, all of them knowing only the first one as a bootnode
+TEST_CASE("Discovery.find_nodes_on_localhost") {
+    constexpr size_t kNodeCount = 4;
+
+    test_util::TaskRunner runner;
+    any_io_executor executor{runner.context().get_executor()};
+
+    std::vector<EccKeyPair> node_keys(kNodeCount);
+    std::vector<std::unique_ptr<node_db::NodeDbSqlite>> node_dbs;
+    std::vector<std::unique_ptr<Discovery>> discoveries;
+    for (size_t i = 0; i < kNodeCount; ++i) {
+        node_dbs.push_back(std::make_unique<node_db::NodeDbSqlite>(executor));
+        node_dbs.back()->setup_in_memory();
+
+        // the bootnode is bound first, so its port is known when the others are created
+        std::vector<EnodeUrl> bootnodes;
+        if (i > 0) {
+            bootnodes.emplace_back(node_keys[0].public_key(), ip::make_address("127.0.0.1"), discoveries[0]->port());
+        }
+        // port 0 lets the OS pick a free port
+        discoveries.push_back(std::make_unique<Discovery>(
+            executor,
+            0,
+            [key = node_keys[i]] { return key; },
+            node_dbs.back()->interface(),
+            std::move(bootnodes)));
+        discoveries.back()->setup();
+        CHECK(discoveries.back()->port() != 0);
+    }
+
+    auto run_discoveries = [&]() -> Task<void> {
+        using namespace concurrency::awaitable_wait_for_all;
+        co_await (discoveries[0]->run() && discoveries[1]->run() && discoveries[2]->run() && discoveries[3]->run());
+    };
+
+    // the time it takes for every node to find and verify all the others
+    std::chrono::steady_clock::duration time_to_all_nodes{};
+    auto wait_for_all_nodes = [&]() -> Task<void> {
+        auto start_time = std::chrono::steady_clock::now();
+        while (true) {
+            size_t min_found_count = kNodeCount;
+            for (auto& db : node_dbs) {
+                auto found_ids = co_await db->interface().find_useful_nodes(node_db::Time{}, kNodeCount);
+                min_found_count = std::min(min_found_count, found_ids.size());
+            }
+            if (min_found_count == kNodeCount - 1) {
+                break;
+            }
+            co_await sleep(100ms);
+        }
+        time_to_all_nodes = std::chrono::steady_clock::now() - start_time;
+    };
+
+    auto test = [&]() -> Task<void> {
+        using namespace concurrency::awaitable_wait_for_one;
+        co_await (run_discoveries() || (wait_for_all_nodes() || concurrency::timeout(30s)));
+    };
+
+    CHECK_NOTHROW(runner.run(test()));
+    INFO("time to find all nodes: " << std::chrono::duration_cast<std::chrono::milliseconds>(time_to_all_nodes).count() << "ms");
+    CHECK(time_to_all_nodes > std::chrono::steady_clock::duration{});
+}
+
+//! Records the pings received by a bare disc_v4::Server
+struct PingRecorder : public MessageHandler {
+    Task<void> on_ping(ping::PingMessage, EccPublicKey, ip::udp::endpoint, Bytes) override {
+        ++pings_count;
+        co_return;
+    }
+    Task<void> on_pong(ping::PongMessage, EccPublicKey) override { co_return; }
+    Task<void> on_find_node(find::FindNodeMessage, EccPublicKey, ip::udp::endpoint) override { co_return; }
+    Task<void> on_neighbors(find::NeighborsMessage, EccPublicKey) override { co_return; }
+
+    size_t pings_count{0};
+};
+
+// A node whose bootstrap is over must still ping back (i.e. verify) the unknown nodes pinging it
+TEST_CASE("Discovery.verify_ping_sender_after_bootstrap") {
+    test_util::TaskRunner runner;
+    any_io_executor executor{runner.context().get_executor()};
+
+    // the bootnode never replies, so that its verification fails on timeout
+    ip::udp::socket silent_socket{executor, ip::udp::endpoint{ip::make_address("127.0.0.1"), 0}};
+    std::vector<EnodeUrl> bootnodes;
+    bootnodes.emplace_back(EccKeyPair{}.public_key(), ip::make_address("127.0.0.1"), silent_socket.local_endpoint().port());
+
+    node_db::NodeDbSqlite node_db{executor};
+    node_db.setup_in_memory();
+    EccKeyPair node_key;
+    Discovery discovery{executor, 0, [node_key] { return node_key; }, node_db.interface(), std::move(bootnodes)};
+    discovery.setup();
+
+    PingRecorder recorder;
+    EccKeyPair sender_key;
+    Server sender{executor, 0, [sender_key] { return sender_key; }, recorder};
+    sender.setup();
+
+    auto ping_after_bootstrap = [&]() -> Task<void> {
+        // wait for the bootnode ping to time out
+        co_await sleep(1s);
+
+        ip::udp::endpoint node_endpoint{ip::make_address("127.0.0.1"), discovery.port()};
+        ping::PingMessage ping{
+            ip::udp::endpoint{ip::make_address("127.0.0.1"), sender.port()},
+            sender.port(),
+            node_endpoint,
+            make_message_expiration(),
+        };
+        co_await sender.send_ping(std::move(ping), node_endpoint);
+
+        while (recorder.pings_count == 0) {
+            co_await sleep(100ms);
+        }
+    };
+
+    auto run_nodes = [&]() -> Task<void> {
+        using namespace concurrency::awaitable_wait_for_all;
+        co_await (discovery.run() && sender.run());
+    };
+
+    auto test = [&]() -> Task<void> {
+        using namespace concurrency::awaitable_wait_for_one;
+        co_await (run_nodes() || (ping_after_bootstrap() || concurrency::timeout(10s)));
+    };
+
+    CHECK_NOTHROW(runner.run(test()));
+    CHECK(recorder.pings_count > 0);
+}
+
+}  // namespace silkworm::sentry::discovery::disc_v4
@@ -0,0 +1,68 @@
+/*
+   Copyright 2023 The Silkworm Authors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#include "find_node_handler.hpp"
+
+#include <map>
+#include <optional>
+
+#include <silkworm/sentry/discovery/disc_v4/common/message_expiration.hpp>
+
+#include "neighbors_message.hpp"
+
+namespace silkworm::sentry::discovery::disc_v4::find {
+
+Task<void> FindNodeHandler::handle(
+    FindNodeMessage message,
+    boost::asio::ip::udp::endpoint sender_endpoint,
+    std::vector<node_db::NodeId> closest_node_ids,
+    node_db::NodeDb& db,
+    MessageSender& sender) {
+    if (is_expired_message_expiration(message.expiration)) {
+        co_return;
+    }
+
+    std::map<EccPublicKey, NodeAddress> node_addresses;
+    for (auto& id : closest_node_ids) {
+        std::optional<node_db::NodeAddress> address;
+        if (sender_endpoint.address().is_v6()) {
+            address = co_await db.find_node_address_v6(id);
+        } else {
+            address = co_await db.find_node_address_v4(id);
+        }
+        if (!address || (address->port_disc == 0)) {
+            continue;
+        }
+
+        node_addresses.emplace(
+            std::move(id),
+            NodeAddress{
+                boost::asio::ip::udp::endpoint{address->ip, address->port_disc},
+                address->port_rlpx,
+            });
+
+        if (node_addresses.size() == kMaxNeighborsPerPacket) {
+            co_await sender.send_neighbors(NeighborsMessage{std::move(node_addresses), make_message_expiration()}, sender_endpoint);
+            node_addresses.clear();
+        }
+    }
+
+    if (!node_addresses.empty()) {
+        co_await sender.send_neighbors(NeighborsMessage{std::move(node_addresses), make_message_expiration()}, sender_endpoint);
+    }
+}
+
+}  // namespace silkworm::sentry::discovery::disc_v4::find
@@ -0,0 +1,45 @@
+/*
+   Copyright 2023 The Silkworm Authors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#pragma once
+
+#include <vector>
+
+#include <silkworm/infra/concurrency/task.hpp>
+
+#include <boost/asio/ip/udp.hpp>
+
+#include <silkworm/sentry/discovery/node_db/node_db.hpp>
+
+#include "find_node_message.hpp"
+#include "message_sender.hpp"
+
+namespace silkworm::sentry::discovery::disc_v4::find {
+
+struct FindNodeHandler {
+    //! Max node addresses per NEIGHBORS packet, so that it fits in 1280 bytes
+    static constexpr size_t kMaxNeighborsPerPacket = 12;
+
+    //! Replies with the addresses of the given nodes closest to the message target
+    static Task<void> handle(
+        FindNodeMessage message,
+        boost::asio::ip::udp::endpoint sender_endpoint,
+        std::vector<node_db::NodeId> closest_node_ids,
+        node_db::NodeDb& db,
+        MessageSender& sender);
+};
+
+}  // namespace silkworm::sentry::discovery::disc_v4::find
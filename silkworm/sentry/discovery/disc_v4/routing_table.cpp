@@ -0,0 +1,133 @@
+/*
+   Copyright 2023 The Silkworm Authors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#include "routing_table.hpp"
+
+#include <algorithm>
+#include <bit>
+
+#include <silkworm/core/common/util.hpp>
+
+namespace silkworm::sentry::discovery::disc_v4 {
+
+ethash::hash256 node_id_hash(const EccPublicKey& id) {
+    return keccak256(id.serialized());
+}
+
+size_t node_distance(const ethash::hash256& hash1, const ethash::hash256& hash2) {
+    for (size_t i = 0; i < sizeof(hash1.bytes); ++i) {
+        auto diff = static_cast<uint8_t>(hash1.bytes[i] ^ hash2.bytes[i]);
+        if (diff) {
+            return (sizeof(hash1.bytes) - i - 1) * 8 + static_cast<size_t>(std::bit_width(diff));
+        }
+    }
+    return 0;
+}
+
+bool is_closer(const ethash::hash256& target, const ethash::hash256& hash1, const ethash::hash256& hash2) {
+    for (size_t i = 0; i < sizeof(target.bytes); ++i) {
+        auto diff1 = static_cast<uint8_t>(target.bytes[i] ^ hash1.bytes[i]);
+        auto diff2 = static_cast<uint8_t>(target.bytes[i] ^ hash2.bytes[i]);
+        if (diff1 != diff2) {
+            return diff1 < diff2;
+        }
+    }
+    return false;
+}
+
+RoutingTable::RoutingTable(const EccPublicKey& local_node_id)
+    : local_node_id_hash_(node_id_hash(local_node_id)) {}
+
+RoutingTable::Bucket* RoutingTable::bucket_for(const ethash::hash256& id_hash) {
+    size_t distance = node_distance(local_node_id_hash_, id_hash);
+    return (distance > 0) ? &buckets_[distance - 1] : nullptr;
+}
+
+const RoutingTable::Bucket* RoutingTable::bucket_for(const ethash::hash256& id_hash) const {
+    size_t distance = node_distance(local_node_id_hash_, id_hash);
+    return (distance > 0) ? &buckets_[distance - 1] : nullptr;
+}
+
+std::optional<EccPublicKey> RoutingTable::add(const EccPublicKey& id) {
+    auto id_hash = node_id_hash(id);
+    Bucket* bucket = bucket_for(id_hash);
+    if (!bucket) {
+        return std::nullopt;
+    }
+
+    auto it = std::find_if(bucket->begin(), bucket->end(), [&id](const Entry& entry) { return entry.id == id; });
+    if (it != bucket->end()) {
+        bucket->erase(it);
+    } else if (bucket->size() >= kBucketSize) {
+        return bucket->front().id;
+    }
+    bucket->push_back({id, id_hash});
+    return std::nullopt;
+}
+
+void RoutingTable::replace(const EccPublicKey& old_id, const EccPublicKey& new_id) {
+    remove(old_id);
+    add(new_id);
+}
+
+void RoutingTable::remove(const EccPublicKey& id) {
+    Bucket* bucket = bucket_for(node_id_hash(id));
+    if (!bucket) {
+        return;
+    }
+    std::erase_if(*bucket, [&id](const Entry& entry) { return entry.id == id; });
+}
+
+bool RoutingTable::contains(const EccPublicKey& id) const {
+    const Bucket* bucket = bucket_for(node_id_hash(id));
+    if (!bucket) {
+        return false;
+    }
+    return std::any_of(bucket->cbegin(), bucket->cend(), [&id](const Entry& entry) { return entry.id == id; });
+}
+
+std::vector<EccPublicKey> RoutingTable::closest_nodes(const EccPublicKey& target, size_t max_count) const {
+    auto target_hash = node_id_hash(target);
+
+    std::vector<const Entry*> entries;
+    for (auto& bucket : buckets_) {
+        for (auto& entry : bucket) {
+            entries.push_back(&entry);
+        }
+    }
+
+    size_t count = std::min(max_count, entries.size());
+    std::partial_sort(entries.begin(), entries.begin() + static_cast<std::ptrdiff_t>(count), entries.end(), [&target_hash](const Entry* entry1, const Entry* entry2) {
+        return is_closer(target_hash, entry1->id_hash, entry2->id_hash);
+    });
+
+    std::vector<EccPublicKey> ids;
+    ids.reserve(count);
+    for (size_t i = 0; i < count; ++i) {
+        ids.push_back(entries[i]->id);
+    }
+    return ids;
+}
+
+size_t RoutingTable::size() const {
+    size_t count = 0;
+    for (auto& bucket : buckets_) {
+        count += bucket.size();
+    }
+    return count;
+}
+
+}  // namespace silkworm::sentry::discovery::disc_v4
@@ -0,0 +1,81 @@
+/*
+   Copyright 2023 The Silkworm Authors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <deque>
+#include <optional>
+#include <vector>
+
+#include <ethash/hash_types.hpp>
+
+#include <silkworm/sentry/common/ecc_public_key.hpp>
+
+namespace silkworm::sentry::discovery::disc_v4 {
+
+//! Kademlia routing table of k-buckets, where bucket i holds the nodes at log distance i + 1 from the local node.
+//! Within a bucket nodes are ordered from the least to the most recently seen.
+//! Not thread-safe.
+class RoutingTable {
+  public:
+    //! The "k" of Kademlia: bucket capacity and the number of nodes returned by a lookup
+    static constexpr size_t kBucketSize = 16;
+
+    explicit RoutingTable(const EccPublicKey& local_node_id);
+
+    //! Adds a node or marks it as the most recently seen one of its bucket.
+    //! \return If the bucket is full, the least recently seen node of the bucket,
+    //! which should be evicted by replace() if it doesn't reply to a ping.
+    std::optional<EccPublicKey> add(const EccPublicKey& id);
+
+    //! Replaces an unresponsive node by a new one from the same bucket
+    void replace(const EccPublicKey& old_id, const EccPublicKey& new_id);
+
+    void remove(const EccPublicKey& id);
+
+    [[nodiscard]] bool contains(const EccPublicKey& id) const;
+
+    //! Nodes closest to the target, closest first
+    [[nodiscard]] std::vector<EccPublicKey> closest_nodes(const EccPublicKey& target, size_t max_count) const;
+
+    [[nodiscard]] size_t size() const;
+
+  private:
+    struct Entry {
+        EccPublicKey id;
+        ethash::hash256 id_hash;
+    };
+    using Bucket = std::deque<Entry>;
+
+    Bucket* bucket_for(const ethash::hash256& id_hash);
+    [[nodiscard]] const Bucket* bucket_for(const ethash::hash256& id_hash) const;
+
+    ethash::hash256 local_node_id_hash_;
+    std::array<Bucket, 256> buckets_;
+};
+
+//! Node IDs are compared by the keccak256 hash of their public keys
+ethash::hash256 node_id_hash(const EccPublicKey& id);
+
+//! Log distance between hashed node IDs: the 1-based index of the highest differing bit, 0 if they are equal
+size_t node_distance(const ethash::hash256& hash1, const ethash::hash256& hash2);
+
+//! Whether hash1 is strictly closer to the target than hash2 by the XOR metric
+bool is_closer(const ethash::hash256& target, const ethash::hash256& hash1, const ethash::hash256& hash2);
+
+}  // namespace silkworm::sentry::discovery::disc_v4
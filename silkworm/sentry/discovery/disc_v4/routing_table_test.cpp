@@ -0,0 +1,134 @@
+/*
+   Copyright 2023 The Silkworm Authors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#include "routing_table.hpp"
+
+#include <algorithm>
+
+#include <catch2/catch.hpp>
+
+#include <silkworm/sentry/common/ecc_key_pair.hpp>
+
+namespace silkworm::sentry::discovery::disc_v4 {
+
+TEST_CASE("node_distance") {
+    ethash::hash256 hash1{};
+    ethash::hash256 hash2{};
+    CHECK(node_distance(hash1, hash2) == 0);
+
+    hash2.bytes[31] = 1;
+    CHECK(node_distance(hash1, hash2) == 1);
+
+    hash2.bytes[31] = 0x80;
+    CHECK(node_distance(hash1, hash2) == 8);
+
+    hash2.bytes[0] = 0x01;
+    CHECK(node_distance(hash1, hash2) == 249);
+
+    hash2.bytes[0] = 0xFF;
+    CHECK(node_distance(hash1, hash2) == 256);
+}
+
+TEST_CASE("is_closer") {
+    ethash::hash256 target{};
+    ethash::hash256 hash1{};
+    ethash::hash256 hash2{};
+    hash1.bytes[1] = 0x01;
+    hash2.bytes[0] = 0x01;
+    CHECK(is_closer(target, hash1, hash2));
+    CHECK_FALSE(is_closer(target, hash2, hash1));
+    CHECK_FALSE(is_closer(target, hash1, hash1));
+}
+
+TEST_CASE("RoutingTable") {
+    EccPublicKey local_id = EccKeyPair{}.public_key();
+    RoutingTable table{local_id};
+
+    SECTION("ignores the local node") {
+        CHECK_FALSE(table.add(local_id).has_value());
+        CHECK(table.size() == 0);
+        CHECK_FALSE(table.contains(local_id));
+    }
+
+    SECTION("add_and_remove") {
+        EccPublicKey id = EccKeyPair{}.public_key();
+        CHECK_FALSE(table.add(id).has_value());
+        CHECK_FALSE(table.add(id).has_value());
+        CHECK(table.size() == 1);
+        CHECK(table.contains(id));
+
+        table.remove(id);
+        CHECK(table.size() == 0);
+        CHECK_FALSE(table.contains(id));
+    }
+
+    SECTION("full_bucket") {
+        // about half of random nodes fall into the farthest bucket
+        std::vector<EccPublicKey> farthest_ids;
+        auto local_id_hash = node_id_hash(local_id);
+        while (farthest_ids.size() <= RoutingTable::kBucketSize) {
+            EccPublicKey id = EccKeyPair{}.public_key();
+            if (node_distance(local_id_hash, node_id_hash(id)) == 256) {
+                farthest_ids.push_back(id);
+            }
+        }
+
+        for (size_t i = 0; i < RoutingTable::kBucketSize; ++i) {
+            CHECK_FALSE(table.add(farthest_ids[i]).has_value());
+        }
+        // mark the first one as the most recently seen
+        CHECK_FALSE(table.add(farthest_ids[0]).has_value());
+
+        auto& new_id = farthest_ids.back();
+        auto oldest_id = table.add(new_id);
+        REQUIRE(oldest_id.has_value());
+        CHECK(*oldest_id == farthest_ids[1]);
+        CHECK_FALSE(table.contains(new_id));
+
+        table.replace(*oldest_id, new_id);
+        CHECK(table.contains(new_id));
+        CHECK_FALSE(table.contains(farthest_ids[1]));
+        CHECK(table.size() == RoutingTable::kBucketSize);
+    }
+
+    SECTION("closest_nodes") {
+        std::vector<EccPublicKey> ids;
+        for (size_t i = 0; i < 50; ++i) {
+            ids.push_back(EccKeyPair{}.public_key());
+            table.add(ids.back());
+        }
+        size_t size = table.size();
+        CHECK(size > 0);
+
+        EccPublicKey target = EccKeyPair{}.public_key();
+        auto target_hash = node_id_hash(target);
+        auto closest = table.closest_nodes(target, 5);
+        REQUIRE(closest.size() == std::min<size_t>(5, size));
+        for (size_t i = 1; i < closest.size(); ++i) {
+            CHECK(is_closer(target_hash, node_id_hash(closest[i - 1]), node_id_hash(closest[i])));
+        }
+
+        auto all = table.closest_nodes(target, 100);
+        CHECK(all.size() == size);
+        for (auto& id : all) {
+            if (std::find(closest.begin(), closest.end(), id) == closest.end()) {
+                CHECK(is_closer(target_hash, node_id_hash(closest.back()), node_id_hash(id)));
+            }
+        }
+    }
+}
+
+}  // namespace silkworm::sentry::discovery::disc_v4
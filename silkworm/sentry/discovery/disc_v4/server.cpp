@@ -23,7 +23,6 @@
 #include <boost/asio/ip/address.hpp>
 #include <boost/asio/ip/address_v4.hpp>
 #include <boost/asio/ip/udp.hpp>
-#include <boost/asio/this_coro.hpp>
 
 #include <silkworm/core/common/base.hpp>
 #include <silkworm/infra/common/decoding_exception.hpp>
@@ -40,21 +39,21 @@ using namespace boost::asio;
 
 class ServerImpl {
   public:
-    explicit ServerImpl(uint16_t port, std::function<EccKeyPair()> node_key, MessageHandler& handler)
+    ServerImpl(any_io_executor executor, uint16_t port, std::function<EccKeyPair()> node_key, MessageHandler& handler)
         : ip_(ip::address{ip::address_v4::any()}),
           port_(port),
+          socket_(std::move(executor)),
           node_key_(std::move(node_key)),
           handler_(handler) {}
 
     ServerImpl(const ServerImpl&) = delete;
     ServerImpl& operator=(const ServerImpl&) = delete;
 
-    Task<void> run() {
-        auto executor = co_await this_coro::executor;
-
+    void setup() {
         auto endpoint = listen_endpoint();
 
-        ip::udp::socket socket{executor, endpoint.protocol()};
+        auto& socket = socket_;
+        socket.open(endpoint.protocol());
         socket.set_option(ip::udp::socket::reuse_address(true));
 
 #if defined(_WIN32)
@@ -67,8 +66,15 @@ class ServerImpl {
 
         socket.bind(endpoint);
 
-        log::Info("sentry") << "disc_v4::Server is listening at " << endpoint;
+        log::Info("sentry") << "disc_v4::Server is listening at " << socket.local_endpoint();
+    }
+
+    uint16_t port() const {
+        return socket_.local_endpoint().port();
+    }
 
+    Task<void> run() {
+        auto& socket = socket_;
         Bytes packet_data_buffer(1280, 0);
 
         while (socket.is_open()) {
@@ -94,17 +100,25 @@ class ServerImpl {
                     case PacketType::kPing:
                         co_await handler_.on_ping(
                             ping::PingMessage::rlp_decode(data),
+                            std::move(envelope->public_key),
                             std::move(sender_endpoint),
                             std::move(envelope->packet_hash));
                         break;
                     case PacketType::kPong:
-                        co_await handler_.on_pong(ping::PongMessage::rlp_decode(data));
+                        co_await handler_.on_pong(
+                            ping::PongMessage::rlp_decode(data),
+                            std::move(envelope->public_key));
                         break;
                     case PacketType::kFindNode:
-                        co_await handler_.on_find_node(find::FindNodeMessage::rlp_decode(data));
+                        co_await handler_.on_find_node(
+                            find::FindNodeMessage::rlp_decode(data),
+                            std::move(envelope->public_key),
+                            std::move(sender_endpoint));
                         break;
                     case PacketType::kNeighbors:
-                        co_await handler_.on_neighbors(find::NeighborsMessage::rlp_decode(data));
+                        co_await handler_.on_neighbors(
+                            find::NeighborsMessage::rlp_decode(data),
+                            std::move(envelope->public_key));
                         break;
                     case PacketType::kEnrRequest:
                         break;
@@ -130,29 +144,36 @@ class ServerImpl {
         return ip::udp::endpoint{ip_, port_};
     }
 
+    //! Packets are sent from the listening socket, because the replies are addressed to the sender endpoint
     Task<void> send_packet(Bytes data, ip::udp::endpoint recipient) {
         using namespace std::chrono_literals;
         using namespace concurrency::awaitable_wait_for_one;
 
-        auto executor = co_await this_coro::executor;
-        ip::udp::socket socket{executor};
-        co_await socket.async_connect(recipient, use_awaitable);
-        co_await (socket.async_send(buffer(data), use_awaitable) || concurrency::timeout(1s));
+        co_await (socket_.async_send_to(buffer(data), recipient, use_awaitable) || concurrency::timeout(1s));
     }
 
     boost::asio::ip::address ip_;
     uint16_t port_;
+    ip::udp::socket socket_;
     std::function<EccKeyPair()> node_key_;
     MessageHandler& handler_;
 };
 
-Server::Server(uint16_t port, std::function<EccKeyPair()> node_key, MessageHandler& handler)
-    : p_impl_(std::make_unique<ServerImpl>(port, std::move(node_key), handler)) {}
+Server::Server(any_io_executor executor, uint16_t port, std::function<EccKeyPair()> node_key, MessageHandler& handler)
+    : p_impl_(std::make_unique<ServerImpl>(std::move(executor), port, std::move(node_key), handler)) {}
 
 Server::~Server() {
     log::Trace("sentry") << "silkworm::sentry::discovery::disc_v4::Server::~Server";
 }
 
+void Server::setup() {
+    p_impl_->setup();
+}
+
+uint16_t Server::port() const {
+    return p_impl_->port();
+}
+
 Task<void> Server::run() {
     return p_impl_->run();
 }
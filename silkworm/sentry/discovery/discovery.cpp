@@ -17,7 +17,9 @@
 #include "discovery.hpp"
 
 #include <algorithm>
+#include <chrono>
 #include <iterator>
+#include <set>
 
 #include <silkworm/infra/common/directories.hpp>
 #include <silkworm/infra/common/log.hpp>
@@ -36,7 +38,7 @@ class DiscoveryImpl {
         std::vector<EnodeUrl> peer_urls,
         bool with_dynamic_discovery,
         const std::filesystem::path& data_dir_path,
-        boost::asio::any_io_executor node_db_executor,
+        boost::asio::any_io_executor executor,
         std::function<EccKeyPair()> node_key,
         uint16_t disc_v4_port);
 
@@ -54,6 +56,9 @@ class DiscoveryImpl {
   private:
     void setup_node_db();
 
+    //! Nodes that replied to a ping within this period are dialed
+    static constexpr auto kPeerCandidateMaxAge = std::chrono::hours{24};
+
     const std::vector<EnodeUrl> peer_urls_;
     bool with_dynamic_discovery_;
     std::filesystem::path data_dir_path_;
@@ -65,20 +70,21 @@ DiscoveryImpl::DiscoveryImpl(
     std::vector<EnodeUrl> peer_urls,
     bool with_dynamic_discovery,
     const std::filesystem::path& data_dir_path,
-    boost::asio::any_io_executor node_db_executor,
+    boost::asio::any_io_executor executor,
     std::function<EccKeyPair()> node_key,
     uint16_t disc_v4_port)
     : peer_urls_(std::move(peer_urls)),
       with_dynamic_discovery_(with_dynamic_discovery),
       data_dir_path_(data_dir_path),
-      node_db_(std::move(node_db_executor)),
-      disc_v4_discovery_(disc_v4_port, node_key, node_db_.interface()) {
+      node_db_(executor),
+      disc_v4_discovery_(executor, disc_v4_port, node_key, node_db_.interface(), peer_urls_) {
 }
 
 Task<void> DiscoveryImpl::run() {
     setup_node_db();
 
     if (with_dynamic_discovery_) {
+        disc_v4_discovery_.setup();
         co_await disc_v4_discovery_.run();
     }
 }
@@ -105,8 +111,39 @@ static std::vector<T> exclude_vector_items(
 Task<std::vector<EnodeUrl>> DiscoveryImpl::request_peer_urls(
     size_t max_count,
     std::vector<EnodeUrl> exclude_urls) {
-    auto peer_urls = exclude_vector_items(peer_urls_, std::move(exclude_urls));
-    co_return random_vector_items(peer_urls, max_count);
+    auto static_peer_urls = exclude_vector_items(peer_urls_, exclude_urls);
+    auto peer_urls = random_vector_items(static_peer_urls, max_count);
+    if (!with_dynamic_discovery_ || (peer_urls.size() >= max_count)) {
+        co_return peer_urls;
+    }
+
+    std::set<EccPublicKey> exclude_ids;
+    for (auto& url : exclude_urls) {
+        exclude_ids.insert(url.public_key());
+    }
+    for (auto& url : peer_urls_) {
+        exclude_ids.insert(url.public_key());
+    }
+
+    // complete with the nodes found by disc_v4, most recently seen first
+    auto& node_db = node_db_.interface();
+    auto min_pong_time = std::chrono::system_clock::now() - kPeerCandidateMaxAge;
+    auto candidate_ids = co_await node_db.find_useful_nodes(min_pong_time, max_count + exclude_ids.size());
+    for (auto& id : candidate_ids) {
+        if (peer_urls.size() >= max_count) {
+            break;
+        }
+        if (exclude_ids.contains(id)) {
+            continue;
+        }
+        auto address = co_await node_db.find_node_address_v4(id);
+        if (!address || (address->port_rlpx == 0)) {
+            continue;
+        }
+        peer_urls.emplace_back(id, address->ip, address->port_rlpx);
+    }
+
+    co_return peer_urls;
 }
 
 bool DiscoveryImpl::is_static_peer_url(const EnodeUrl& peer_url) {
@@ -119,14 +156,14 @@ Discovery::Discovery(
     std::vector<EnodeUrl> peer_urls,
     bool with_dynamic_discovery,
     const std::filesystem::path& data_dir_path,
-    boost::asio::any_io_executor node_db_executor,
+    boost::asio::any_io_executor executor,
     std::function<EccKeyPair()> node_key,
     uint16_t disc_v4_port)
     : p_impl_(std::make_unique<DiscoveryImpl>(
           std::move(peer_urls),
           with_dynamic_discovery,
           data_dir_path,
-          std::move(node_db_executor),
+          std::move(executor),
           std::move(node_key),
           disc_v4_port)) {}
 
@@ -38,7 +38,7 @@ class Discovery {
         std::vector<EnodeUrl> peer_urls,
         bool with_dynamic_discovery,
         const std::filesystem::path& data_dir_path,
-        boost::asio::any_io_executor node_db_executor,
+        boost::asio::any_io_executor executor,
         std::function<EccKeyPair()> node_key,
         uint16_t disc_v4_port);
     ~Discovery();
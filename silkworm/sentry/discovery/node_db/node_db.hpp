@@ -18,6 +18,7 @@
 
 #include <chrono>
 #include <optional>
+#include <vector>
 
 #include <silkworm/infra/concurrency/task.hpp>
 
@@ -44,6 +45,10 @@ struct NodeDb {
     virtual Task<std::optional<NodeAddress>> find_node_address_v6(NodeId id) = 0;
 
     virtual Task<void> update_last_pong_time(NodeId id, Time value) = 0;
+    virtual Task<std::optional<Time>> find_last_pong_time(NodeId id) = 0;
+
+    //! Nodes that replied to a ping since min_pong_time, most recent first
+    virtual Task<std::vector<NodeId>> find_useful_nodes(Time min_pong_time, size_t limit) = 0;
 
     virtual Task<void> delete_node(NodeId id) = 0;
 };
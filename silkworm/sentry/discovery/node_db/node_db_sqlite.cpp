@@ -184,6 +184,41 @@ class NodeDbSqliteImpl : public NodeDb {
         co_return;
     }
 
+    Task<std::optional<Time>> find_last_pong_time(NodeId id) override {
+        static const char* sql = R"sql(
+            SELECT last_pong_time FROM nodes WHERE id = ?
+        )sql";
+
+        SQLite::Statement query{*db_, sql};
+        query.bind(1, id.hex());
+
+        if (!query.executeStep() || query.isColumnNull(0)) {
+            co_return std::nullopt;
+        }
+        int64_t value = query.getColumn(0);
+        co_return time_point_from_unix_timestamp(static_cast<uint64_t>(value));
+    }
+
+    Task<std::vector<NodeId>> find_useful_nodes(Time min_pong_time, size_t limit) override {
+        static const char* sql = R"sql(
+            SELECT id FROM nodes
+            WHERE last_pong_time >= ?
+            ORDER BY last_pong_time DESC
+            LIMIT ?
+        )sql";
+
+        SQLite::Statement query{*db_, sql};
+        query.bind(1, static_cast<int64_t>(unix_timestamp_from_time_point(min_pong_time)));
+        query.bind(2, static_cast<int64_t>(limit));
+
+        std::vector<NodeId> ids;
+        while (query.executeStep()) {
+            std::string id = query.getColumn(0);
+            ids.push_back(NodeId::deserialize_hex(id));
+        }
+        co_return ids;
+    }
+
     Task<void> delete_node(NodeId id) override {
         static const char* sql = R"sql(
             DELETE FROM nodes WHERE id = ?
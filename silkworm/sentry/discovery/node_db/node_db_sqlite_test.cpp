@@ -19,7 +19,9 @@
 #include <catch2/catch.hpp>
 
 #include <silkworm/core/common/util.hpp>
+#include <silkworm/infra/common/unix_timestamp.hpp>
 #include <silkworm/infra/test_util/task_runner.hpp>
+#include <silkworm/sentry/common/ecc_key_pair.hpp>
 
 namespace silkworm::sentry::discovery::node_db {
 
@@ -97,6 +99,41 @@ TEST_CASE("NodeDbSqlite") {
         runner.run(db.upsert_node_address(test_id, test_address));
         runner.run(db.update_last_pong_time(test_id, std::chrono::system_clock::system_clock::now()));
     }
+
+    SECTION("find_last_pong_time") {
+        runner.run(db.upsert_node_address(test_id, test_address));
+        CHECK_FALSE(runner.run(db.find_last_pong_time(test_id)).has_value());
+
+        auto time = time_point_from_unix_timestamp(1'700'000'000);
+        runner.run(db.update_last_pong_time(test_id, time));
+        auto last_pong_time = runner.run(db.find_last_pong_time(test_id));
+        REQUIRE(last_pong_time.has_value());
+        CHECK(*last_pong_time == time);
+    }
+
+    SECTION("find_useful_nodes") {
+        // valid public keys are needed to parse the ids back
+        NodeId test_id1 = EccKeyPair{}.public_key();
+        NodeId test_id2 = EccKeyPair{}.public_key();
+        NodeId test_id3 = EccKeyPair{}.public_key();
+        runner.run(db.upsert_node_address(test_id1, test_address));
+        runner.run(db.upsert_node_address(test_id2, test_address));
+        runner.run(db.upsert_node_address(test_id3, test_address));
+        runner.run(db.update_last_pong_time(test_id1, time_point_from_unix_timestamp(1'700'000'001)));
+        runner.run(db.update_last_pong_time(test_id2, time_point_from_unix_timestamp(1'700'000'002)));
+
+        auto ids = runner.run(db.find_useful_nodes(time_point_from_unix_timestamp(1'700'000'000), 10));
+        REQUIRE(ids.size() == 2);
+        CHECK(ids[0] == test_id2);
+        CHECK(ids[1] == test_id1);
+
+        ids = runner.run(db.find_useful_nodes(time_point_from_unix_timestamp(1'700'000'002), 10));
+        REQUIRE(ids.size() == 1);
+        CHECK(ids[0] == test_id2);
+
+        ids = runner.run(db.find_useful_nodes(time_point_from_unix_timestamp(1'700'000'000), 1));
+        CHECK(ids.size() == 1);
+    }
 }
 
 }  // namespace silkworm::sentry::discovery::node_db
@@ -39,6 +39,14 @@ Task<void> SerialNodeDb::update_last_pong_time(NodeId id, Time value) {
     return co_spawn(strand_, db_.update_last_pong_time(std::move(id), std::move(value)), use_awaitable);
 }
 
+Task<std::optional<Time>> SerialNodeDb::find_last_pong_time(NodeId id) {
+    return co_spawn(strand_, db_.find_last_pong_time(std::move(id)), use_awaitable);
+}
+
+Task<std::vector<NodeId>> SerialNodeDb::find_useful_nodes(Time min_pong_time, size_t limit) {
+    return co_spawn(strand_, db_.find_useful_nodes(min_pong_time, limit), use_awaitable);
+}
+
 Task<void> SerialNodeDb::delete_node(NodeId id) {
     return co_spawn(strand_, db_.delete_node(std::move(id)), use_awaitable);
 }
@@ -36,6 +36,8 @@ class SerialNodeDb : public NodeDb {
     Task<std::optional<NodeAddress>> find_node_address_v4(NodeId id) override;
     Task<std::optional<NodeAddress>> find_node_address_v6(NodeId id) override;
     Task<void> update_last_pong_time(NodeId id, Time value) override;
+    Task<std::optional<Time>> find_last_pong_time(NodeId id) override;
+    Task<std::vector<NodeId>> find_useful_nodes(Time min_pong_time, size_t limit) override;
     Task<void> delete_node(NodeId id) override;
 
   private:
@@ -105,6 +105,21 @@ Bytes AESCipher::decrypt(ByteView cipher_text) {
     return plain_text;
 }
 
+void AESCipher::encrypt_in_place(uint8_t* data, size_t size) {
+    if (size % kAESBlockSize)
+        throw std::runtime_error("AESCipher: plain_text is not padded");
+
+    int cipher_text_len = 0;
+    EVP_EncryptUpdate(ctx_, data, &cipher_text_len, data, static_cast<int>(size));
+    assert(static_cast<size_t>(cipher_text_len) == size);
+}
+
+void AESCipher::decrypt_in_place(uint8_t* data, size_t size) {
+    int plain_text_len = 0;
+    EVP_DecryptUpdate(ctx_, data, &plain_text_len, data, static_cast<int>(size));
+    assert(static_cast<size_t>(plain_text_len) == size);
+}
+
 Bytes aes_encrypt(ByteView plain_text, ByteView key, ByteView iv) {
     AESCipher cipher{key, {iv}, AESCipher::Direction::kEncrypt};
     return cipher.encrypt(plain_text);
@@ -39,6 +39,10 @@ class AESCipher final {
     Bytes encrypt(ByteView plain_text);
     Bytes decrypt(ByteView cipher_text);
 
+    //! Encrypt/decrypt the data in its buffer (CTR and ECB modes keep the size)
+    void encrypt_in_place(uint8_t* data, size_t size);
+    void decrypt_in_place(uint8_t* data, size_t size);
+
   private:
     gsl::owner<EVP_CIPHER_CTX*> ctx_;
 };
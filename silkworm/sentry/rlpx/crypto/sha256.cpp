@@ -22,7 +22,7 @@ namespace silkworm::sentry::rlpx::crypto {
 
 Bytes sha256(ByteView data) {
     Bytes hash(32, 0);
-    silkworm_sha256(hash.data(), data.data(), data.size(), /* use_cpu_extensions = */ false);
+    silkworm_sha256(hash.data(), data.data(), data.size(), /* use_cpu_extensions = */ true);
     return hash;
 }
 
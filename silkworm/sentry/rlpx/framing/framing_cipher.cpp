@@ -34,9 +34,10 @@ class FramingCipherImpl {
   public:
     FramingCipherImpl(const KeyMaterial& key_material, Bytes aes_secret, Bytes mac_secret);
 
-    [[nodiscard]] Bytes encrypt_frame(Bytes frame_data);
+    void encrypt_frame(ByteView frame_data, Bytes& output);
     [[nodiscard]] size_t decrypt_header(ByteView header_cipher_text, ByteView header_mac);
     [[nodiscard]] Bytes decrypt_frame(ByteView frame_cipher_text, ByteView frame_mac, size_t frame_size);
+    [[nodiscard]] ByteView decrypt_frame_in_place(uint8_t* frame_cipher_text, size_t frame_cipher_text_size, ByteView frame_mac, size_t frame_size);
 
   private:
     static void init_mac_hashers(
@@ -144,34 +145,25 @@ size_t FramingCipherImpl::deserialize_frame_size(ByteView data) {
     return endian::load_big_u32(data1.data());
 }
 
-Bytes FramingCipherImpl::encrypt_frame(Bytes frame_data) {
+void FramingCipherImpl::encrypt_frame(ByteView frame_data, Bytes& output) {
     Bytes header_data;
     rlp::encode(header_data, 0u, 0u);
 
-    Bytes header;
-    header.reserve(kAESBlockSize);
-    header += serialize_frame_size(frame_data.size());
-    header += header_data;
-
-    header.resize(kAESBlockSize, 0);
-    Bytes header_cipher_text = egress_data_cipher_.encrypt(header);
-    Bytes header_mac = this->header_mac(egress_mac_hasher_, header_cipher_text);
-
-    frame_data.resize(aes_round_up_to_block_size(frame_data.size()), 0);
-    Bytes frame_cipher_text = egress_data_cipher_.encrypt(frame_data);
-    Bytes frame_mac = this->frame_mac(egress_mac_hasher_, frame_cipher_text);
-
-    Bytes data;
-    data.reserve(
-        header_cipher_text.size() +
-        header_mac.size() +
-        frame_cipher_text.size() +
-        frame_mac.size());
-    data.append(header_cipher_text);
-    data.append(header_mac);
-    data.append(frame_cipher_text);
-    data.append(frame_mac);
-    return data;
+    const size_t header_offset = output.size();
+    const size_t frame_offset = header_offset + kAESBlockSize * 2;
+    const size_t frame_cipher_text_size = aes_round_up_to_block_size(frame_data.size());
+    output.reserve(frame_offset + frame_cipher_text_size + kAESBlockSize);
+
+    output += serialize_frame_size(frame_data.size());
+    output += header_data;
+    output.resize(header_offset + kAESBlockSize, 0);
+    egress_data_cipher_.encrypt_in_place(&output[header_offset], kAESBlockSize);
+    output += this->header_mac(egress_mac_hasher_, ByteView{&output[header_offset], kAESBlockSize});
+
+    output += frame_data;
+    output.resize(frame_offset + frame_cipher_text_size, 0);
+    egress_data_cipher_.encrypt_in_place(&output[frame_offset], frame_cipher_text_size);
+    output += this->frame_mac(egress_mac_hasher_, ByteView{&output[frame_offset], frame_cipher_text_size});
 }
 
 size_t FramingCipherImpl::decrypt_header(ByteView header_cipher_text, ByteView header_mac) {
@@ -195,6 +187,17 @@ Bytes FramingCipherImpl::decrypt_frame(ByteView frame_cipher_text, ByteView fram
     return frame_data;
 }
 
+ByteView FramingCipherImpl::decrypt_frame_in_place(uint8_t* frame_cipher_text, size_t frame_cipher_text_size, ByteView frame_mac, size_t frame_size) {
+    assert(frame_cipher_text_size >= frame_size);
+
+    Bytes expected_frame_mac = this->frame_mac(ingress_mac_hasher_, ByteView{frame_cipher_text, frame_cipher_text_size});
+    if (frame_mac != expected_frame_mac)
+        throw std::runtime_error("rlpx::framing::FramingCipher: invalid frame MAC");
+
+    ingress_data_cipher_.decrypt_in_place(frame_cipher_text, frame_cipher_text_size);
+    return ByteView{frame_cipher_text, frame_size};
+}
+
 FramingCipher::FramingCipher(const KeyMaterial& key_material) {
     Bytes aes_secret, mac_secret;
     make_secrets(key_material, aes_secret, mac_secret);
@@ -214,7 +217,13 @@ FramingCipher& FramingCipher::operator=(FramingCipher&& other) noexcept {
 }
 
 Bytes FramingCipher::encrypt_frame(Bytes frame_data) {
-    return impl_->encrypt_frame(std::move(frame_data));
+    Bytes output;
+    impl_->encrypt_frame(frame_data, output);
+    return output;
+}
+
+void FramingCipher::encrypt_frame(ByteView frame_data, Bytes& output) {
+    impl_->encrypt_frame(frame_data, output);
 }
 
 size_t FramingCipher::header_size() {
@@ -244,4 +253,14 @@ Bytes FramingCipher::decrypt_frame(ByteView data, size_t header_frame_size) {
         header_frame_size);
 }
 
+ByteView FramingCipher::decrypt_frame_in_place(uint8_t* data, size_t size, size_t header_frame_size) {
+    if (size < FramingCipher::frame_size(header_frame_size))
+        throw std::runtime_error("rlpx::framing::FramingCipher: frame size data is too short");
+    return impl_->decrypt_frame_in_place(
+        data,
+        size - kAESBlockSize,
+        ByteView{data + size - kAESBlockSize, kAESBlockSize},
+        header_frame_size);
+}
+
 }  // namespace silkworm::sentry::rlpx::framing
@@ -42,11 +42,16 @@ class FramingCipher final {
     FramingCipher& operator=(FramingCipher&&) noexcept;
 
     [[nodiscard]] Bytes encrypt_frame(Bytes frame_data);
+    //! Encrypt a frame appending it to the output, allows to coalesce multiple frames in one buffer
+    void encrypt_frame(ByteView frame_data, Bytes& output);
 
     [[nodiscard]] static size_t header_size();
     [[nodiscard]] size_t decrypt_header(ByteView data);
     [[nodiscard]] static size_t frame_size(size_t header_frame_size);
     [[nodiscard]] Bytes decrypt_frame(ByteView data, size_t header_frame_size);
+    //! Verify and decrypt a frame in its receive buffer
+    //! \return A view of the plain text frame data within the buffer
+    [[nodiscard]] ByteView decrypt_frame_in_place(uint8_t* data, size_t size, size_t header_frame_size);
 
   private:
     std::unique_ptr<FramingCipherImpl> impl_;
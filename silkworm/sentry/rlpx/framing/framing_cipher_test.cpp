@@ -0,0 +1,78 @@
+/*
+   Copyright 2023 The Silkworm Authors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#include "framing_cipher.hpp"
+
+#include <catch2/catch.hpp>
+
+#include <silkworm/core/common/util.hpp>
+
+namespace silkworm::sentry::rlpx::framing {
+
+static FramingCipher::KeyMaterial make_test_key_material(bool is_initiator) {
+    return FramingCipher::KeyMaterial{
+        Bytes(32, 0x01),
+        is_initiator,
+        Bytes(32, 0x02),
+        Bytes(32, 0x03),
+        *from_hex("0a0b0c"),
+        *from_hex("0d0e0f"),
+    };
+}
+
+static ByteView decrypt_next_frame(FramingCipher& cipher, Bytes& data, size_t& offset) {
+    size_t header_frame_size = cipher.decrypt_header(ByteView{data}.substr(offset, FramingCipher::header_size()));
+    offset += FramingCipher::header_size();
+    size_t frame_size = FramingCipher::frame_size(header_frame_size);
+    ByteView frame_data = cipher.decrypt_frame_in_place(&data[offset], frame_size, header_frame_size);
+    offset += frame_size;
+    return frame_data;
+}
+
+TEST_CASE("FramingCipher.decrypt_frame_in_place") {
+    FramingCipher initiator{make_test_key_material(true)};
+    FramingCipher recipient{make_test_key_material(false)};
+
+    Bytes frame1 = *from_hex("c0ffee");
+    Bytes frame2(100, 0x42);
+
+    Bytes data = initiator.encrypt_frame(frame1);
+    size_t offset = 0;
+    CHECK(decrypt_next_frame(recipient, data, offset) == frame1);
+    CHECK(offset == data.size());
+
+    // coalesced frames
+    data.clear();
+    initiator.encrypt_frame(frame1, data);
+    initiator.encrypt_frame(frame2, data);
+    offset = 0;
+    CHECK(decrypt_next_frame(recipient, data, offset) == frame1);
+    CHECK(decrypt_next_frame(recipient, data, offset) == frame2);
+    CHECK(offset == data.size());
+}
+
+TEST_CASE("FramingCipher.invalid_frame_mac") {
+    FramingCipher initiator{make_test_key_material(true)};
+    FramingCipher recipient{make_test_key_material(false)};
+
+    Bytes data = initiator.encrypt_frame(*from_hex("c0ffee"));
+    data.back() ^= 0xFF;
+
+    size_t offset = 0;
+    CHECK_THROWS_AS(decrypt_next_frame(recipient, data, offset), std::runtime_error);
+}
+
+}  // namespace silkworm::sentry::rlpx::framing
@@ -69,12 +69,16 @@ static Bytes snappy_decompress(ByteView data) {
 }
 
 Bytes MessageFrameCodec::encode(const Message& message) const {
+    return encode(message, is_compression_enabled_);
+}
+
+Bytes MessageFrameCodec::encode(const Message& message, bool is_compression_enabled) {
     Bytes frame_data;
     frame_data.reserve(message.data.size() + 1);
 
     rlp::encode(frame_data, message.id);
 
-    if (!is_compression_enabled_) {
+    if (!is_compression_enabled) {
         frame_data += message.data;
     } else {
         frame_data += snappy_compress(message.data);
@@ -23,9 +23,11 @@ namespace silkworm::sentry::rlpx::framing {
 class MessageFrameCodec {
   public:
     [[nodiscard]] Bytes encode(const Message& message) const;
+    [[nodiscard]] static Bytes encode(const Message& message, bool is_compression_enabled);
     [[nodiscard]] Message decode(ByteView frame_data) const;
 
     void enable_compression() { is_compression_enabled_ = true; }
+    [[nodiscard]] bool is_compression_enabled() const { return is_compression_enabled_; }
 
     static const size_t kMaxFrameSize;
 
@@ -16,28 +16,89 @@
 
 #include "message_stream.hpp"
 
+#include <algorithm>
+#include <cstring>
 #include <stdexcept>
 
 #include "message_frame_codec.hpp"
 
 namespace silkworm::sentry::rlpx::framing {
 
+static constexpr size_t kReceiveBufferSize = 64 * 1024;
+static constexpr size_t kMaxRetainedBufferSize = 1024 * 1024;
+
 Task<void> MessageStream::send(Message message) {
     co_await stream_.send(cipher_.encrypt_frame(message_frame_codec_.encode(message)));
 }
 
+Task<void> MessageStream::send(SharedMessagePtr message) {
+    Bytes data;
+    cipher_.encrypt_frame(message->frame_data(message_frame_codec_.is_compression_enabled()), data);
+    co_await stream_.send(std::move(data));
+}
+
+Task<void> MessageStream::send(const std::vector<SharedMessagePtr>& messages) {
+    send_buffer_.clear();
+    for (auto& message : messages) {
+        cipher_.encrypt_frame(message->frame_data(message_frame_codec_.is_compression_enabled()), send_buffer_);
+    }
+    co_await stream_.send(ByteView{send_buffer_});
+
+    // don't hold on to the memory of an exceptionally large batch
+    if (send_buffer_.capacity() > kMaxRetainedBufferSize) {
+        Bytes{}.swap(send_buffer_);
+    }
+}
+
+Task<void> MessageStream::fill_receive_buffer(size_t size) {
+    if (receive_buffer_end_ - receive_buffer_begin_ >= size) {
+        co_return;
+    }
+
+    if (receive_buffer_begin_ + size > receive_buffer_.size()) {
+        size_t unread_size = receive_buffer_end_ - receive_buffer_begin_;
+        std::memmove(receive_buffer_.data(), receive_buffer_.data() + receive_buffer_begin_, unread_size);
+        receive_buffer_begin_ = 0;
+        receive_buffer_end_ = unread_size;
+        if (size > receive_buffer_.size()) {
+            receive_buffer_.resize(std::max(size, kReceiveBufferSize));
+        }
+    }
+
+    while (receive_buffer_end_ - receive_buffer_begin_ < size) {
+        receive_buffer_end_ += co_await stream_.receive_some(
+            receive_buffer_.data() + receive_buffer_end_,
+            receive_buffer_.size() - receive_buffer_end_);
+    }
+}
+
+void MessageStream::consume_receive_buffer(size_t size) {
+    receive_buffer_begin_ += size;
+    if (receive_buffer_begin_ == receive_buffer_end_) {
+        receive_buffer_begin_ = 0;
+        receive_buffer_end_ = 0;
+        // shrink back after an exceptionally large frame
+        if (receive_buffer_.size() > kMaxRetainedBufferSize) {
+            Bytes(kReceiveBufferSize, 0).swap(receive_buffer_);
+        }
+    }
+}
+
 Task<Message> MessageStream::receive() {
-    Bytes header_data = co_await stream_.receive_fixed(FramingCipher::header_size());
-    size_t header_frame_size = cipher_.decrypt_header(header_data);
+    co_await fill_receive_buffer(FramingCipher::header_size());
+    size_t header_frame_size = cipher_.decrypt_header(ByteView{receive_buffer_.data() + receive_buffer_begin_, FramingCipher::header_size()});
+    consume_receive_buffer(FramingCipher::header_size());
 
     size_t frame_size = FramingCipher::frame_size(header_frame_size);
     if (frame_size > MessageFrameCodec::kMaxFrameSize)
         throw std::runtime_error("rlpx::framing::MessageStream: frame is too large");
 
-    Bytes encrypted_frame_data = co_await stream_.receive_fixed(frame_size);
-    Bytes frame_data = cipher_.decrypt_frame(encrypted_frame_data, header_frame_size);
+    co_await fill_receive_buffer(frame_size);
+    ByteView frame_data = cipher_.decrypt_frame_in_place(receive_buffer_.data() + receive_buffer_begin_, frame_size, header_frame_size);
+    Message message = message_frame_codec_.decode(frame_data);
+    consume_receive_buffer(frame_size);
 
-    co_return message_frame_codec_.decode(frame_data);
+    co_return message;
 }
 
 void MessageStream::enable_compression() {
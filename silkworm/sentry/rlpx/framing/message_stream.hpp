@@ -16,6 +16,8 @@
 
 #pragma once
 
+#include <vector>
+
 #include <silkworm/infra/concurrency/task.hpp>
 
 #include <silkworm/sentry/common/message.hpp>
@@ -23,6 +25,7 @@
 
 #include "framing_cipher.hpp"
 #include "message_frame_codec.hpp"
+#include "shared_message.hpp"
 
 namespace silkworm::sentry::rlpx::framing {
 
@@ -35,14 +38,31 @@ class MessageStream {
     MessageStream(MessageStream&&) = default;
 
     Task<void> send(Message message);
+    Task<void> send(SharedMessagePtr message);
+    //! Send multiple messages in one socket write
+    Task<void> send(const std::vector<SharedMessagePtr>& messages);
     Task<Message> receive();
 
     void enable_compression();
 
   private:
+    //! Reads from the socket until at least the given number of bytes is buffered
+    Task<void> fill_receive_buffer(size_t size);
+    void consume_receive_buffer(size_t size);
+
     FramingCipher cipher_;
     SocketStream& stream_;
     MessageFrameCodec message_frame_codec_;
+
+    //! Received data is decrypted in place, so frames must be contiguous,
+    //! the unread data is moved to the beginning when a frame doesn't fit at the end.
+    //! A single read often brings multiple frames when a peer sends messages in bursts.
+    Bytes receive_buffer_;
+    size_t receive_buffer_begin_{0};
+    size_t receive_buffer_end_{0};
+
+    //! Encrypted frames of a batch send, reused between sends
+    Bytes send_buffer_;
 };
 
 }  // namespace silkworm::sentry::rlpx::framing
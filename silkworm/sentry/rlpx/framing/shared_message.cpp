@@ -0,0 +1,31 @@
+/*
+   Copyright 2023 The Silkworm Authors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#include "shared_message.hpp"
+
+#include "message_frame_codec.hpp"
+
+namespace silkworm::sentry::rlpx::framing {
+
+ByteView SharedMessage::frame_data(bool is_compression_enabled) const {
+    auto& cached = is_compression_enabled ? compressed_ : uncompressed_;
+    std::call_once(cached.once, [&] {
+        cached.data = MessageFrameCodec::encode(message_, is_compression_enabled);
+    });
+    return cached.data;
+}
+
+}  // namespace silkworm::sentry::rlpx::framing
@@ -0,0 +1,54 @@
+/*
+   Copyright 2023 The Silkworm Authors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#pragma once
+
+#include <memory>
+#include <mutex>
+
+#include <silkworm/sentry/common/message.hpp>
+
+namespace silkworm::sentry::rlpx::framing {
+
+//! An immutable message shared by all the peers it is broadcast to.
+//! The frame data (message ID + payload, compressed or not) is encoded once by the first peer that needs it,
+//! so that the other peers only have to apply their own FramingCipher.
+class SharedMessage {
+  public:
+    explicit SharedMessage(Message message) : message_(std::move(message)) {}
+
+    SharedMessage(const SharedMessage&) = delete;
+    SharedMessage& operator=(const SharedMessage&) = delete;
+
+    [[nodiscard]] const Message& message() const { return message_; }
+
+    //! Thread-safe, peers might be served by different strands
+    [[nodiscard]] ByteView frame_data(bool is_compression_enabled) const;
+
+  private:
+    struct CachedFrameData {
+        std::once_flag once;
+        Bytes data;
+    };
+
+    const Message message_;
+    mutable CachedFrameData compressed_;
+    mutable CachedFrameData uncompressed_;
+};
+
+using SharedMessagePtr = std::shared_ptr<const SharedMessage>;
+
+}  // namespace silkworm::sentry::rlpx::framing
@@ -0,0 +1,96 @@
+/*
+   Copyright 2023 The Silkworm Authors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "framing_cipher.hpp"
+#include "message_frame_codec.hpp"
+#include "shared_message.hpp"
+
+namespace silkworm::sentry::rlpx::framing {
+
+static constexpr size_t kPeerCount{100};
+
+// Compressible like a NewBlock payload: 32-byte words made of 12 zero bytes followed by 20 varying bytes
+static Message sample_message() {
+    Bytes data(128 * 1024, 0);
+    for (size_t i{0}; i < data.size(); ++i) {
+        if (i % 32 >= 12) {
+            data[i] = static_cast<uint8_t>((i * 2654435761u) >> 24);
+        }
+    }
+    return Message{0x07, std::move(data)};
+}
+
+static std::vector<FramingCipher> sample_ciphers() {
+    std::vector<FramingCipher> ciphers;
+    ciphers.reserve(kPeerCount);
+    for (size_t i{0}; i < kPeerCount; ++i) {
+        const auto seed{static_cast<uint8_t>(i)};
+        ciphers.emplace_back(FramingCipher::KeyMaterial{
+            .ephemeral_shared_secret = Bytes(32, seed),
+            .is_initiator = true,
+            .initiator_nonce = Bytes(32, 1),
+            .recipient_nonce = Bytes(32, 2),
+            .initiator_first_message_data = Bytes(100, 3),
+            .recipient_first_message_data = Bytes(100, 4),
+        });
+    }
+    return ciphers;
+}
+
+// Each peer gets its own copy of the message and compresses it
+static void broadcast_per_peer_encoding(benchmark::State& state) {
+    const Message message{sample_message()};
+    auto ciphers{sample_ciphers()};
+    MessageFrameCodec codec;
+    codec.enable_compression();
+
+    size_t retained_bytes{0};
+    for ([[maybe_unused]] auto _ : state) {
+        retained_bytes = 0;
+        for (auto& cipher : ciphers) {
+            const Message peer_message{message};
+            Bytes frame_data{codec.encode(peer_message)};
+            retained_bytes += peer_message.data.size() + frame_data.size();
+            benchmark::DoNotOptimize(cipher.encrypt_frame(std::move(frame_data)));
+        }
+    }
+    state.counters["retained_bytes"] = static_cast<double>(retained_bytes);
+}
+BENCHMARK(broadcast_per_peer_encoding);
+
+// All peers share one message and its compressed frame data, only the encryption is per peer
+static void broadcast_shared_encoding(benchmark::State& state) {
+    const Message message{sample_message()};
+    auto ciphers{sample_ciphers()};
+
+    size_t retained_bytes{0};
+    for ([[maybe_unused]] auto _ : state) {
+        const SharedMessagePtr shared_message{std::make_shared<SharedMessage>(message)};
+        for (auto& cipher : ciphers) {
+            Bytes frame_data{shared_message->frame_data(/*is_compression_enabled=*/true)};
+            benchmark::DoNotOptimize(cipher.encrypt_frame(std::move(frame_data)));
+        }
+        retained_bytes = shared_message->message().data.size() + shared_message->frame_data(true).size();
+    }
+    state.counters["retained_bytes"] = static_cast<double>(retained_bytes);
+}
+BENCHMARK(broadcast_shared_encoding);
+
+}  // namespace silkworm::sentry::rlpx::framing
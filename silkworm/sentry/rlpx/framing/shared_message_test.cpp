@@ -0,0 +1,43 @@
+/*
+   Copyright 2023 The Silkworm Authors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#include "shared_message.hpp"
+
+#include <catch2/catch.hpp>
+
+#include "message_frame_codec.hpp"
+
+namespace silkworm::sentry::rlpx::framing {
+
+TEST_CASE("SharedMessage.frame_data") {
+    Message message{0x17, Bytes(1000, 0x42)};
+    SharedMessage shared_message{message};
+
+    MessageFrameCodec codec;
+    CHECK(shared_message.frame_data(false) == codec.encode(message));
+    codec.enable_compression();
+    CHECK(shared_message.frame_data(true) == codec.encode(message));
+    CHECK(shared_message.frame_data(true).size() < shared_message.frame_data(false).size());
+
+    // encoded once: the same data is returned to every caller
+    CHECK(shared_message.frame_data(true).data() == shared_message.frame_data(true).data());
+
+    auto decoded = codec.decode(shared_message.frame_data(true));
+    CHECK(decoded.id == message.id);
+    CHECK(decoded.data == message.data);
+}
+
+}  // namespace silkworm::sentry::rlpx::framing
@@ -16,7 +16,10 @@
 
 #include "peer.hpp"
 
+#include <array>
 #include <chrono>
+#include <string>
+#include <vector>
 
 #include <boost/asio/co_spawn.hpp>
 #include <boost/asio/this_coro.hpp>
@@ -28,6 +31,7 @@
 #include <silkworm/infra/concurrency/awaitable_wait_for_all.hpp>
 #include <silkworm/infra/concurrency/awaitable_wait_for_one.hpp>
 #include <silkworm/infra/concurrency/timeout.hpp>
+#include <silkworm/infra/metrics/metrics.hpp>
 #include <silkworm/sentry/common/sleep.hpp>
 
 #include "auth/handshake.hpp"
@@ -271,14 +275,18 @@ void Peer::close() {
 }
 
 void Peer::post_message(const std::shared_ptr<Peer>& peer, const Message& message) {
-    peer->send_message_tasks_.spawn(peer->strand_, Peer::send_message(peer, message));
+    post_message(peer, std::make_shared<framing::SharedMessage>(message));
+}
+
+void Peer::post_message(const std::shared_ptr<Peer>& peer, framing::SharedMessagePtr message) {
+    peer->send_message_tasks_.spawn(peer->strand_, Peer::send_message(peer, std::move(message)));
 }
 
 Task<void> Peer::send_message_tasks_wait(std::shared_ptr<Peer> self) {
     co_await self->send_message_tasks_.wait();
 }
 
-Task<void> Peer::send_message(std::shared_ptr<Peer> peer, Message message) {
+Task<void> Peer::send_message(std::shared_ptr<Peer> peer, framing::SharedMessagePtr message) {
     try {
         co_await peer->send_message(std::move(message));
     } catch (const DisconnectedError& ex) {
@@ -296,7 +304,7 @@ Task<void> Peer::send_message(std::shared_ptr<Peer> peer, Message message) {
     }
 }
 
-Task<void> Peer::send_message(Message message) {
+Task<void> Peer::send_message(framing::SharedMessagePtr message) {
     try {
         co_await send_message_channel_.send(std::move(message));
     } catch (const boost::system::system_error& ex) {
@@ -309,7 +317,7 @@ Task<void> Peer::send_message(Message message) {
 Task<void> Peer::send_messages(framing::MessageStream& message_stream) {
     // loop until message_stream exception
     while (true) {
-        Message message;
+        framing::SharedMessagePtr message;
         try {
             message = co_await send_message_channel_.receive();
         } catch (const boost::system::system_error& ex) {
@@ -317,7 +325,24 @@ Task<void> Peer::send_messages(framing::MessageStream& message_stream) {
                 throw DisconnectedError();
             throw;
         }
-        co_await message_stream.send(std::move(message));
+
+        // coalesce the messages that are already queued into one socket write
+        std::vector<framing::SharedMessagePtr> messages{std::move(message)};
+        while (messages.size() < kMaxCoalescedMessages) {
+            auto next_message = send_message_channel_.try_receive();
+            if (!next_message) break;
+            messages.push_back(std::move(*next_message));
+        }
+
+        static auto& sent_messages{metrics::Registry::instance().counter(
+            "silkworm_sentry_sent_messages_total", "Number of messages sent to peers")};
+        sent_messages.increment(messages.size());
+
+        if (messages.size() == 1) {
+            co_await message_stream.send(std::move(messages.front()));
+        } else {
+            co_await message_stream.send(messages);
+        }
     }
 }
 
@@ -331,10 +356,27 @@ Task<Message> Peer::receive_message() {
     }
 }
 
+//! Tracks the rate of received messages by RLPx message id, caching per thread the counters of the ids seen so far
+static void count_received_message(const Message& message) {
+    thread_local std::array<metrics::Counter*, 256> counters{};
+    auto& counter = counters[message.id];
+    if (!counter) {
+        counter = &metrics::Registry::instance().counter(
+            "silkworm_sentry_received_messages_total", "Number of messages received from peers by RLPx message id",
+            {{"id", std::to_string(message.id)}});
+    }
+    counter->increment();
+
+    static auto& received_bytes{metrics::Registry::instance().counter(
+        "silkworm_sentry_received_bytes_total", "Number of message payload bytes received from peers")};
+    received_bytes.increment(message.data.size());
+}
+
 Task<void> Peer::receive_messages(framing::MessageStream& message_stream) {
     // loop until message_stream exception
     while (true) {
         auto message = co_await message_stream.receive();
+        count_received_message(message);
 
         if (message.id == DisconnectMessage::kId) {
             throw auth::Handshake::DisconnectError();
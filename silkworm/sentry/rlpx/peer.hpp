@@ -112,6 +112,7 @@ class Peer {
     static Task<bool> wait_for_handshake(std::shared_ptr<Peer> self);
 
     static void post_message(const std::shared_ptr<Peer>& peer, const Message& message);
+    static void post_message(const std::shared_ptr<Peer>& peer, framing::SharedMessagePtr message);
     Task<Message> receive_message();
 
     class DisconnectedError : public std::runtime_error {
@@ -143,6 +144,9 @@ class Peer {
     }
 
   private:
+    //! Max number of queued messages written to the socket at once
+    static constexpr size_t kMaxCoalescedMessages = 64;
+
     static Task<void> handle(std::shared_ptr<Peer> peer);
     Task<void> handle();
     static Task<void> drop_in_strand(std::shared_ptr<Peer> peer, DisconnectReason reason);
@@ -151,8 +155,8 @@ class Peer {
     void close();
 
     static Task<void> send_message_tasks_wait(std::shared_ptr<Peer> self);
-    static Task<void> send_message(std::shared_ptr<Peer> peer, Message message);
-    Task<void> send_message(Message message);
+    static Task<void> send_message(std::shared_ptr<Peer> peer, framing::SharedMessagePtr message);
+    Task<void> send_message(framing::SharedMessagePtr message);
     Task<void> send_messages(framing::MessageStream& message_stream);
     Task<void> receive_messages(framing::MessageStream& message_stream);
     Task<void> ping_periodically(framing::MessageStream& message_stream);
@@ -173,7 +177,7 @@ class Peer {
 
     boost::asio::strand<boost::asio::any_io_executor> strand_;
     concurrency::TaskGroup send_message_tasks_;
-    concurrency::Channel<Message> send_message_channel_;
+    concurrency::Channel<framing::SharedMessagePtr> send_message_channel_;
     concurrency::Channel<Message> receive_message_channel_;
     concurrency::Channel<Message> pong_channel_;
 };
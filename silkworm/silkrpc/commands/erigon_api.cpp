@@ -24,7 +24,6 @@
 #include <silkworm/core/common/util.hpp>
 #include <silkworm/core/protocol/ethash_rule_set.hpp>
 #include <silkworm/infra/common/log.hpp>
-#include <silkworm/silkrpc/common/binary_search.hpp>
 #include <silkworm/silkrpc/common/util.hpp>
 #include <silkworm/silkrpc/core/blocks.hpp>
 #include <silkworm/silkrpc/core/cached_chain.hpp>
@@ -59,31 +58,16 @@ awaitable<void> ErigonRpcApi::handle_erigon_get_block_by_timestamp(const nlohman
     try {
         ethdb::TransactionDatabase tx_database{*tx};
 
-        // Lookup the first and last block headers
-        const auto first_header = co_await core::rawdb::read_header_by_number(tx_database, core::kEarliestBlockNumber);
+        // Lookup the last block header, then the highest block not newer than provided timestamp using the shared index
         const auto current_header = co_await core::rawdb::read_current_header(tx_database);
-        const uint64_t current_block_number = current_header.number;
-
-        // Find the lowest block header w/ timestamp greater or equal to provided timestamp
-        uint64_t block_number;
-        if (current_header.timestamp <= timestamp) {
-            block_number = current_block_number;
-        } else if (first_header.timestamp >= timestamp) {
-            block_number = core::kEarliestBlockNumber;
-        } else {
-            // Good-old binary search to find the lowest block header matching timestamp
-            const auto matching_block_number = co_await binary_search(current_block_number, [&](uint64_t i) -> awaitable<bool> {
-                const auto header = co_await core::rawdb::read_header_by_number(tx_database, i);
-                co_return header.timestamp >= timestamp;
+        const auto block_number = co_await timestamp_index_->find_block_number(
+            timestamp, current_header.number, [&](uint64_t n) -> awaitable<uint64_t> {
+                if (n == current_header.number) {
+                    co_return current_header.timestamp;
+                }
+                const auto header = co_await core::rawdb::read_header_by_number(tx_database, n);
+                co_return header.timestamp;
             });
-            // TODO(canepat) we should try to avoid this block header lookup (just done in search)
-            const auto matching_header = co_await core::rawdb::read_header_by_number(tx_database, matching_block_number);
-            if (matching_header.timestamp > timestamp) {
-                block_number = matching_block_number - 1;
-            } else {
-                block_number = matching_block_number;
-            }
-        }
 
         // Lookup and return the matching block
         const auto block_with_hash = co_await core::read_block_by_number(*block_cache_, tx_database, block_number);
@@ -25,6 +25,7 @@
 #include <silkworm/infra/concurrency/private_service.hpp>
 #include <silkworm/infra/concurrency/shared_service.hpp>
 #include <silkworm/silkrpc/common/block_cache.hpp>
+#include <silkworm/silkrpc/common/timestamp_index.hpp>
 #include <silkworm/silkrpc/core/rawdb/accessors.hpp>
 #include <silkworm/silkrpc/ethbackend/backend.hpp>
 #include <silkworm/silkrpc/ethdb/database.hpp>
@@ -43,6 +44,7 @@ class ErigonRpcApi {
   public:
     explicit ErigonRpcApi(boost::asio::io_context& io_context)
         : block_cache_{must_use_shared_service<BlockCache>(io_context)},
+          timestamp_index_{must_use_shared_service<TimestampIndex>(io_context)},
           database_{must_use_private_service<ethdb::Database>(io_context)},
           backend_{must_use_private_service<ethbackend::BackEnd>(io_context)} {}
     virtual ~ErigonRpcApi() = default;
@@ -63,6 +65,7 @@ class ErigonRpcApi {
 
   private:
     BlockCache* block_cache_;
+    TimestampIndex* timestamp_index_;
     ethdb::Database* database_;
     ethbackend::BackEnd* backend_;
 
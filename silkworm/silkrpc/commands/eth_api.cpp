@@ -20,11 +20,18 @@
 #include <cstring>
 #include <exception>
 #include <iostream>
+#include <iterator>
 #include <limits>
 #include <map>
 #include <string>
 #include <utility>
 
+#include <boost/asio/co_spawn.hpp>
+#include <boost/asio/compose.hpp>
+#include <boost/asio/deferred.hpp>
+#include <boost/asio/experimental/parallel_group.hpp>
+#include <boost/asio/post.hpp>
+#include <boost/asio/this_coro.hpp>
 #include <boost/endian/conversion.hpp>
 #include <evmc/evmc.hpp>
 
@@ -34,6 +41,7 @@
 #include <silkworm/core/execution/address.hpp>
 #include <silkworm/core/types/transaction.hpp>
 #include <silkworm/infra/common/log.hpp>
+#include <silkworm/infra/concurrency/parallel_group_utils.hpp>
 #include <silkworm/node/db/stages.hpp>
 #include <silkworm/node/db/tables.hpp>
 #include <silkworm/node/db/util.hpp>
@@ -50,6 +58,7 @@
 #include <silkworm/silkrpc/core/receipts.hpp>
 #include <silkworm/silkrpc/core/state_reader.hpp>
 #include <silkworm/silkrpc/ethdb/bitmap.hpp>
+#include <silkworm/silkrpc/ethdb/bloom_bits.hpp>
 #include <silkworm/silkrpc/ethdb/cbor.hpp>
 #include <silkworm/silkrpc/ethdb/kv/cached_database.hpp>
 #include <silkworm/silkrpc/ethdb/transaction_database.hpp>
@@ -219,12 +228,12 @@ awaitable<void> EthereumRpcApi::handle_eth_gas_price(const nlohmann::json& reque
 }
 
 // https://eth.wiki/json-rpc/API#eth_getblockbyhash
-awaitable<void> EthereumRpcApi::handle_eth_get_block_by_hash(const nlohmann::json& request, nlohmann::json& reply) {
-    auto params = request["params"];
+awaitable<void> EthereumRpcApi::handle_eth_get_block_by_hash(const json::RequestView& request, std::string& reply) {
+    const auto params = request.parse_params();
     if (params.size() != 2) {
         auto error_msg = "invalid eth_getBlockByHash params: " + params.dump();
         SILK_ERROR << error_msg;
-        reply = make_json_error(request["id"], 100, error_msg);
+        make_glaze_json_error(reply, request.id(), 100, error_msg);
         co_return;
     }
     auto block_hash = params[0].get<evmc::bytes32>();
@@ -241,16 +250,16 @@ awaitable<void> EthereumRpcApi::handle_eth_get_block_by_hash(const nlohmann::jso
         const auto total_difficulty = co_await core::rawdb::read_total_difficulty(tx_database, block_hash, block_number);
         const Block extended_block{*block_with_hash, total_difficulty, full_tx};
 
-        reply = make_json_content(request["id"], extended_block);
+        make_glaze_json_content(reply, request.id(), extended_block);
     } catch (const std::invalid_argument& iv) {
-        SILK_WARN << "invalid_argument: " << iv.what() << " processing request: " << request.dump();
-        reply = make_json_content(request["id"], {});
+        SILK_WARN << "invalid_argument: " << iv.what() << " processing request: " << request.content();
+        make_glaze_json_null_content(reply, request.id());
     } catch (const std::exception& e) {
-        SILK_ERROR << "exception: " << e.what() << " processing request: " << request.dump();
-        reply = make_json_error(request["id"], 100, e.what());
+        SILK_ERROR << "exception: " << e.what() << " processing request: " << request.content();
+        make_glaze_json_error(reply, request.id(), 100, e.what());
     } catch (...) {
-        SILK_ERROR << "unexpected exception processing request: " << request.dump();
-        reply = make_json_error(request["id"], 100, "unexpected exception");
+        SILK_ERROR << "unexpected exception processing request: " << request.content();
+        make_glaze_json_error(reply, request.id(), 100, "unexpected exception");
     }
 
     co_await tx->close();  // RAII not (yet) available with coroutines
@@ -258,12 +267,12 @@ awaitable<void> EthereumRpcApi::handle_eth_get_block_by_hash(const nlohmann::jso
 }
 
 // https://eth.wiki/json-rpc/API#eth_getblockbynumber
-awaitable<void> EthereumRpcApi::handle_eth_get_block_by_number(const nlohmann::json& request, nlohmann::json& reply) {
-    const auto& params = request["params"];
+awaitable<void> EthereumRpcApi::handle_eth_get_block_by_number(const json::RequestView& request, std::string& reply) {
+    const auto params = request.parse_params();
     if (params.size() != 2) {
         auto error_msg = "invalid getBlockByNumber params: " + params.dump();
         SILK_ERROR << error_msg;
-        reply = make_json_error(request["id"], 100, error_msg);
+        make_glaze_json_error(reply, request.id(), 100, error_msg);
         co_return;
     }
     const auto block_id = params[0].get<std::string>();
@@ -280,16 +289,16 @@ awaitable<void> EthereumRpcApi::handle_eth_get_block_by_number(const nlohmann::j
         const auto total_difficulty = co_await core::rawdb::read_total_difficulty(tx_database, block_with_hash->hash, block_number);
         const Block extended_block{*block_with_hash, total_difficulty, full_tx};
 
-        reply = make_json_content(request["id"], extended_block);
+        make_glaze_json_content(reply, request.id(), extended_block);
     } catch (const std::invalid_argument& iv) {
-        SILK_WARN << "invalid_argument: " << iv.what() << " processing request: " << request.dump();
-        reply = make_json_content(request["id"], nlohmann::detail::value_t::null);
+        SILK_WARN << "invalid_argument: " << iv.what() << " processing request: " << request.content();
+        make_glaze_json_null_content(reply, request.id());
     } catch (const std::exception& e) {
-        SILK_ERROR << "exception: " << e.what() << " processing request: " << request.dump();
-        reply = make_json_error(request["id"], 100, e.what());
+        SILK_ERROR << "exception: " << e.what() << " processing request: " << request.content();
+        make_glaze_json_error(reply, request.id(), 100, e.what());
     } catch (...) {
-        SILK_ERROR << "unexpected exception processing request: " << request.dump();
-        reply = make_json_error(request["id"], 100, "unexpected exception");
+        SILK_ERROR << "unexpected exception processing request: " << request.content();
+        make_glaze_json_error(reply, request.id(), 100, "unexpected exception");
     }
 
     co_await tx->close();  // RAII not (yet) available with coroutines
@@ -524,12 +533,12 @@ awaitable<void> EthereumRpcApi::handle_eth_get_uncle_count_by_block_number(const
 }
 
 // https://eth.wiki/json-rpc/API#eth_gettransactionbyhash
-awaitable<void> EthereumRpcApi::handle_eth_get_transaction_by_hash(const nlohmann::json& request, nlohmann::json& reply) {
-    auto params = request["params"];
+awaitable<void> EthereumRpcApi::handle_eth_get_transaction_by_hash(const json::RequestView& request, std::string& reply) {
+    const auto params = request.parse_params();
     if (params.size() != 1) {
         auto error_msg = "invalid eth_getTransactionByHash params: " + params.dump();
         SILK_ERROR << error_msg;
-        reply = make_json_error(request["id"], 100, error_msg);
+        make_glaze_json_error(reply, request.id(), 100, error_msg);
         co_return;
     }
     auto transaction_hash = params[0].get<evmc::bytes32>();
@@ -548,29 +557,29 @@ awaitable<void> EthereumRpcApi::handle_eth_get_transaction_by_hash(const nlohman
                 const auto decoding_result = silkworm::rlp::decode(encoded_tx_view, transaction);
                 if (decoding_result) {
                     transaction.queued_in_pool = true;
-                    reply = make_json_content(request["id"], transaction);
+                    make_glaze_json_content(reply, request.id(), transaction);
                 } else {
                     const auto error_msg = "invalid RLP decoding for tx hash: " + silkworm::to_hex(transaction_hash);
                     SILK_ERROR << error_msg;
-                    reply = make_json_error(request["id"], 100, error_msg);
+                    make_glaze_json_error(reply, request.id(), 100, error_msg);
                 }
             } else {
                 const auto error_msg = "tx hash: " + silkworm::to_hex(transaction_hash) + " does not exist in pool";
                 SILK_ERROR << error_msg;
-                reply = make_json_error(request["id"], 100, error_msg);
+                make_glaze_json_error(reply, request.id(), 100, error_msg);
             }
         } else {
-            reply = make_json_content(request["id"], tx_with_block->transaction);
+            make_glaze_json_content(reply, request.id(), tx_with_block->transaction);
         }
     } catch (const std::invalid_argument& iv) {
-        SILK_WARN << "invalid_argument: " << iv.what() << " processing request: " << request.dump();
-        reply = make_json_content(request["id"], {});
+        SILK_WARN << "invalid_argument: " << iv.what() << " processing request: " << request.content();
+        make_glaze_json_null_content(reply, request.id());
     } catch (const std::exception& e) {
-        SILK_ERROR << "exception: " << e.what() << " processing request: " << request.dump();
-        reply = make_json_error(request["id"], 100, e.what());
+        SILK_ERROR << "exception: " << e.what() << " processing request: " << request.content();
+        make_glaze_json_error(reply, request.id(), 100, e.what());
     } catch (...) {
-        SILK_ERROR << "unexpected exception processing request: " << request.dump();
-        reply = make_json_error(request["id"], 100, "unexpected exception");
+        SILK_ERROR << "unexpected exception processing request: " << request.content();
+        make_glaze_json_error(reply, request.id(), 100, "unexpected exception");
     }
 
     co_await tx->close();  // RAII not (yet) available with coroutines
@@ -803,12 +812,12 @@ awaitable<void> EthereumRpcApi::handle_eth_get_raw_transaction_by_block_number_a
 }
 
 // https://eth.wiki/json-rpc/API#eth_gettransactionreceipt
-awaitable<void> EthereumRpcApi::handle_eth_get_transaction_receipt(const nlohmann::json& request, nlohmann::json& reply) {
-    auto params = request["params"];
+awaitable<void> EthereumRpcApi::handle_eth_get_transaction_receipt(const json::RequestView& request, std::string& reply) {
+    const auto params = request.parse_params();
     if (params.size() != 1) {
         auto error_msg = "invalid eth_getTransactionReceipt params: " + params.dump();
         SILK_ERROR << error_msg;
-        reply = make_json_error(request["id"], 100, error_msg);
+        make_glaze_json_error(reply, request.id(), 100, error_msg);
         co_return;
     }
     auto transaction_hash = params[0].get<evmc::bytes32>();
@@ -842,16 +851,16 @@ awaitable<void> EthereumRpcApi::handle_eth_get_transaction_receipt(const nlohman
         if (!tx_index) {
             throw std::invalid_argument{"Unexpected transaction index in handle_eth_get_transaction_receipt"};
         }
-        reply = make_json_content(request["id"], receipts[*tx_index]);
+        make_glaze_json_content(reply, request.id(), receipts[*tx_index]);
     } catch (const std::invalid_argument& iv) {
-        SILK_WARN << "invalid_argument: " << iv.what() << " processing request: " << request.dump();
-        reply = make_json_content(request["id"], {});
+        SILK_WARN << "invalid_argument: " << iv.what() << " processing request: " << request.content();
+        make_glaze_json_null_content(reply, request.id());
     } catch (const std::exception& e) {
-        SILK_ERROR << "exception: " << e.what() << " processing request: " << request.dump();
-        reply = make_json_error(request["id"], 100, e.what());
+        SILK_ERROR << "exception: " << e.what() << " processing request: " << request.content();
+        make_glaze_json_error(reply, request.id(), 100, e.what());
     } catch (...) {
-        SILK_ERROR << "unexpected exception processing request: " << request.dump();
-        reply = make_json_error(request["id"], 100, "unexpected exception");
+        SILK_ERROR << "unexpected exception processing request: " << request.content();
+        make_glaze_json_error(reply, request.id(), 100, "unexpected exception");
     }
 
     co_await tx->close();  // RAII not (yet) available with coroutines
@@ -1081,22 +1090,24 @@ awaitable<void> EthereumRpcApi::handle_eth_get_storage_at(const nlohmann::json&
 }
 
 // https://eth.wiki/json-rpc/API#eth_call
-awaitable<void> EthereumRpcApi::handle_eth_call(const nlohmann::json& request, std::string& reply) {
-    if (!request.contains("params")) {
+awaitable<void> EthereumRpcApi::handle_eth_call(const json::RequestView& request, std::string& reply) {
+    if (request.params().empty()) {
         auto error_msg = "missing value for required argument 0";
-        SILK_ERROR << error_msg << request.dump();
-        make_glaze_json_error(reply, request["id"], -32602, error_msg);
+        SILK_ERROR << error_msg << request.content();
+        make_glaze_json_error(reply, request.id(), -32602, error_msg);
         co_return;
     }
-    const auto& params = request["params"];
-    if (params.size() != 2) {
-        auto error_msg = "invalid eth_call params: " + params.dump();
+    // Just the call object gets parsed into a DOM, the block id is taken straight from the request text
+    const auto params = request.param_items();
+    const auto block_id_value = params && params->size() == 2 ? json::string_value((*params)[1]) : std::nullopt;
+    if (!block_id_value) {
+        auto error_msg = "invalid eth_call params: " + std::string{request.params()};
         SILK_ERROR << error_msg;
-        make_glaze_json_error(reply, request["id"], -32602, error_msg);
+        make_glaze_json_error(reply, request.id(), -32602, error_msg);
         co_return;
     }
-    const auto call = params[0].get<Call>();
-    const auto block_id = params[1].get<std::string>();
+    const auto call = nlohmann::json::parse((*params)[0]).get<Call>();
+    const std::string block_id{*block_id_value};
     SILK_DEBUG << "call: " << call << " block_id: " << block_id;
 
     auto tx = co_await database_->begin();
@@ -1119,21 +1130,21 @@ awaitable<void> EthereumRpcApi::handle_eth_call(const nlohmann::json& request, s
             });
 
         if (execution_result.success()) {
-            make_glaze_json_content(reply, request["id"], execution_result.data);
+            make_glaze_json_content(reply, request.id(), execution_result.data);
         } else {
             const auto error_message = execution_result.error_message();
             if (execution_result.data.empty()) {
-                make_glaze_json_error(reply, request["id"], -32000, error_message);
+                make_glaze_json_error(reply, request.id(), -32000, error_message);
             } else {
-                make_glaze_json_error(reply, request["id"], RevertError{{3, error_message}, execution_result.data});
+                make_glaze_json_error(reply, request.id(), RevertError{{3, error_message}, execution_result.data});
             }
         }
     } catch (const std::exception& e) {
-        SILK_ERROR << "exception: " << e.what() << " processing request: " << request.dump();
-        make_glaze_json_error(reply, request["id"], 100, e.what());
+        SILK_ERROR << "exception: " << e.what() << " processing request: " << request.content();
+        make_glaze_json_error(reply, request.id(), 100, e.what());
     } catch (...) {
-        SILK_ERROR << "unexpected exception processing request: " << request.dump();
-        make_glaze_json_error(reply, request["id"], 100, "unexpected exception");
+        SILK_ERROR << "unexpected exception processing request: " << request.content();
+        make_glaze_json_error(reply, request.id(), 100, "unexpected exception");
     }
 
     co_await tx->close();  // RAII not (yet) available with coroutines
@@ -1648,22 +1659,29 @@ awaitable<void> EthereumRpcApi::handle_eth_uninstall_filter(const nlohmann::json
 }
 
 // https://eth.wiki/json-rpc/API#eth_getlogs
-awaitable<void> EthereumRpcApi::handle_eth_get_logs(const nlohmann::json& request, std::string& reply) {
-    if (!request.contains("params")) {
+awaitable<void> EthereumRpcApi::handle_eth_get_logs(const json::RequestView& request, std::string& reply) {
+    if (request.params().empty()) {
         auto error_msg = "missing value for required argument 0";
-        SILK_ERROR << error_msg << request.dump();
-        make_glaze_json_error(reply, request["id"], -32602, error_msg);
+        SILK_ERROR << error_msg << request.content();
+        make_glaze_json_error(reply, request.id(), -32602, error_msg);
         co_return;
     }
-    auto params = request["params"];
-    if (params.size() > 1) {
+    // Just the filter object gets parsed into a DOM
+    const auto params = request.param_items();
+    if (!params || params->empty()) {
+        auto error_msg = "missing value for required argument 0";
+        SILK_ERROR << error_msg << request.content();
+        make_glaze_json_error(reply, request.id(), -32602, error_msg);
+        co_return;
+    }
+    if (params->size() > 1) {
         auto error_msg = "too many arguments, want at most 1";
-        SILK_ERROR << error_msg << request.dump();
-        make_glaze_json_error(reply, request["id"], -32602, error_msg);
+        SILK_ERROR << error_msg << request.content();
+        make_glaze_json_error(reply, request.id(), -32602, error_msg);
         co_return;
     }
 
-    auto filter = params[0].get<Filter>();
+    auto filter = nlohmann::json::parse(params->front()).get<Filter>();
     SILK_DEBUG << "filter: " << filter;
 
     auto tx = co_await database_->begin();
@@ -1675,25 +1693,32 @@ awaitable<void> EthereumRpcApi::handle_eth_get_logs(const nlohmann::json& reques
         if (start == end && start == std::numeric_limits<std::uint64_t>::max()) {
             auto error_msg = "invalid eth_getLogs filter block_hash: " + filter.block_hash.value();
             SILK_ERROR << error_msg;
-            reply = make_json_error(request["id"], 100, error_msg);
+            make_glaze_json_error(reply, request.id(), 100, error_msg);
             co_await tx->close();  // RAII not (yet) available with coroutines
             co_return;
         }
 
         std::vector<Log> logs;
-        co_await get_logs(tx_database, start, end, filter.addresses, filter.topics, logs);
+        co_await get_logs(tx_database, start, end, filter.addresses, filter.topics, logs, kMaxGetLogsResults);
+        if (logs.size() > kMaxGetLogsResults) {
+            const auto error_msg = "query returned more than " + std::to_string(kMaxGetLogsResults) + " results";
+            SILK_ERROR << error_msg;
+            make_glaze_json_error(reply, request.id(), -32005, error_msg);
+            co_await tx->close();  // RAII not (yet) available with coroutines
+            co_return;
+        }
 
-        make_glaze_json_content(reply, request["id"], logs);
+        make_glaze_json_content(reply, request.id(), logs);
     } catch (const std::invalid_argument& iv) {
-        SILK_WARN << "invalid_argument: " << iv.what() << " processing request: " << request.dump();
+        SILK_WARN << "invalid_argument: " << iv.what() << " processing request: " << request.content();
         std::vector<silkworm::rpc::Log> log{};
-        make_glaze_json_content(reply, request["id"], log);
+        make_glaze_json_content(reply, request.id(), log);
     } catch (const std::exception& e) {
-        SILK_ERROR << "exception: " << e.what() << " processing request: " << request.dump();
-        make_glaze_json_error(reply, request["id"], 100, e.what());
+        SILK_ERROR << "exception: " << e.what() << " processing request: " << request.content();
+        make_glaze_json_error(reply, request.id(), 100, e.what());
     } catch (...) {
-        SILK_ERROR << "unexpected exception processing request: " << request.dump();
-        make_glaze_json_error(reply, request["id"], 100, "unexpected exception");
+        SILK_ERROR << "unexpected exception processing request: " << request.content();
+        make_glaze_json_error(reply, request.id(), 100, "unexpected exception");
     }
 
     co_await tx->close();  // RAII not (yet) available with coroutines
@@ -1701,20 +1726,21 @@ awaitable<void> EthereumRpcApi::handle_eth_get_logs(const nlohmann::json& reques
 }
 
 // https://eth.wiki/json-rpc/API#eth_sendrawtransaction
-awaitable<void> EthereumRpcApi::handle_eth_send_raw_transaction(const nlohmann::json& request, nlohmann::json& reply) {
-    const auto& params = request["params"];
-    if (params.size() != 1) {
-        auto error_msg = "invalid eth_sendRawTransaction params: " + params.dump();
+awaitable<void> EthereumRpcApi::handle_eth_send_raw_transaction(const json::RequestView& request, std::string& reply) {
+    // The only param is decoded straight from the request text, so raw transactions never get copied into any DOM
+    const auto params = request.param_items();
+    if (!params || params->size() != 1) {
+        auto error_msg = "invalid eth_sendRawTransaction params: " + std::string{request.params()};
         SILK_ERROR << error_msg;
-        reply = make_json_error(request["id"], 100, error_msg);
+        make_glaze_json_error(reply, request.id(), 100, error_msg);
         co_return;
     }
-    const auto encoded_tx_string = params[0].get<std::string>();
-    const auto encoded_tx_bytes = silkworm::from_hex(encoded_tx_string);
+    const auto encoded_tx_string = json::string_value(params->front());
+    const auto encoded_tx_bytes = encoded_tx_string ? silkworm::from_hex(*encoded_tx_string) : std::nullopt;
     if (!encoded_tx_bytes.has_value()) {
-        const auto error_msg = "invalid eth_sendRawTransaction encoded tx: " + encoded_tx_string;
+        const auto error_msg = "invalid eth_sendRawTransaction encoded tx: " + std::string{params->front()};
         SILK_ERROR << error_msg;
-        reply = make_json_error(request["id"], -32602, error_msg);
+        make_glaze_json_error(reply, request.id(), -32602, error_msg);
         co_return;
     }
 
@@ -1724,7 +1750,7 @@ awaitable<void> EthereumRpcApi::handle_eth_send_raw_transaction(const nlohmann::
     if (!decoding_result) {
         const auto error_msg = decoding_result_to_string(decoding_result.error());
         SILK_ERROR << error_msg;
-        reply = make_json_error(request["id"], -32000, error_msg);
+        make_glaze_json_error(reply, request.id(), -32000, error_msg);
         co_return;
     }
 
@@ -1733,14 +1759,14 @@ awaitable<void> EthereumRpcApi::handle_eth_send_raw_transaction(const nlohmann::
     if (!check_tx_fee_less_cap(kTxFeeCap, txn.max_fee_per_gas, txn.gas_limit)) {
         const auto error_msg = "tx fee exceeds the configured cap";
         SILK_ERROR << error_msg;
-        reply = make_json_error(request["id"], -32000, error_msg);
+        make_glaze_json_error(reply, request.id(), -32000, error_msg);
         co_return;
     }
 
     if (!is_replay_protected(txn)) {
         const auto error_msg = "only replay-protected (EIP-155) transactions allowed over RPC";
         SILK_ERROR << error_msg;
-        reply = make_json_error(request["id"], -32000, error_msg);
+        make_glaze_json_error(reply, request.id(), -32000, error_msg);
         co_return;
     }
 
@@ -1748,7 +1774,7 @@ awaitable<void> EthereumRpcApi::handle_eth_send_raw_transaction(const nlohmann::
     const auto result = co_await tx_pool_->add_transaction(encoded_tx);
     if (!result.success) {
         SILK_ERROR << "cannot add transaction: " << result.error_descr;
-        reply = make_json_error(request["id"], -32000, result.error_descr);
+        make_glaze_json_error(reply, request.id(), -32000, result.error_descr);
         co_return;
     }
 
@@ -1756,7 +1782,7 @@ awaitable<void> EthereumRpcApi::handle_eth_send_raw_transaction(const nlohmann::
     if (!txn.from.has_value()) {
         const auto error_msg = "cannot recover sender";
         SILK_ERROR << error_msg;
-        reply = make_json_error(request["id"], -32000, error_msg);
+        make_glaze_json_error(reply, request.id(), -32000, error_msg);
         co_return;
     }
 
@@ -1769,7 +1795,7 @@ awaitable<void> EthereumRpcApi::handle_eth_send_raw_transaction(const nlohmann::
         SILK_DEBUG << "submitted transaction hash: " << hash << " from: " << *txn.from << " nonce: " << txn.nonce << " recipient: " << *txn.to << " value: " << txn.value;
     }
 
-    reply = make_json_content(request["id"], hash);
+    make_glaze_json_content(reply, request.id(), hash);
 
     co_return;
 }
@@ -2082,16 +2108,37 @@ awaitable<void> EthereumRpcApi::handle_fee_history(const nlohmann::json& request
 }
 
 awaitable<void> EthereumRpcApi::get_logs(ethdb::TransactionDatabase& tx_database, std::uint64_t start, std::uint64_t end,
-                                         FilterAddresses& addresses, FilterTopics& topics, std::vector<Log>& logs) {
+                                         FilterAddresses& addresses, FilterTopics& topics, std::vector<Log>& logs,
+                                         std::size_t max_logs) {
     SILK_INFO << "start block: " << start << " end block: " << end;
 
     roaring::Roaring block_numbers;
     block_numbers.addRange(start, end + 1);  // [min, max)
 
+    // The BloomBits index is a cheap prefilter complementing the exact index bitmaps below: blocks ruled out by the
+    // header blooms in the indexed sections are dropped, so that the bitmaps are read only over the remaining range
+    uint64_t bitmap_start{start};
+    uint64_t bitmap_end{end};
+    if (ethdb::bloom_bits::has_criteria(addresses, topics)) {
+        auto bloom_bits_match = co_await ethdb::bloom_bits::match(tx_database, addresses, topics, start, end);
+        if (bloom_bits_match.next_block > start) {
+            block_numbers = std::move(bloom_bits_match.block_numbers);
+            if (bloom_bits_match.next_block <= end) {
+                block_numbers.addRange(bloom_bits_match.next_block, end + 1);
+            }
+            SILK_DEBUG << "bloom bits block_numbers.cardinality(): " << block_numbers.cardinality() << " next_block: " << bloom_bits_match.next_block;
+            if (block_numbers.isEmpty()) {
+                co_return;
+            }
+            bitmap_start = block_numbers.minimum();
+            bitmap_end = block_numbers.maximum();
+        }
+    }
+
     SILK_DEBUG << "block_numbers.cardinality(): " << block_numbers.cardinality();
 
     if (!topics.empty()) {
-        auto topics_bitmap = co_await ethdb::bitmap::from_topics(tx_database, db::table::kLogTopicIndexName, topics, start, end);
+        auto topics_bitmap = co_await ethdb::bitmap::from_topics(tx_database, db::table::kLogTopicIndexName, topics, bitmap_start, bitmap_end);
         SILK_TRACE << "topics_bitmap: " << topics_bitmap.toString();
         if (topics_bitmap.isEmpty()) {
             block_numbers = topics_bitmap;
@@ -2103,109 +2150,142 @@ awaitable<void> EthereumRpcApi::get_logs(ethdb::TransactionDatabase& tx_database
     SILK_TRACE << "block_numbers: " << block_numbers.toString();
 
     if (!addresses.empty()) {
-        auto addresses_bitmap = co_await ethdb::bitmap::from_addresses(tx_database, db::table::kLogAddressIndexName, addresses, start, end);
+        auto addresses_bitmap = co_await ethdb::bitmap::from_addresses(tx_database, db::table::kLogAddressIndexName, addresses, bitmap_start, bitmap_end);
         if (addresses_bitmap.isEmpty()) {
             block_numbers = addresses_bitmap;
         } else {
             block_numbers &= addresses_bitmap;
         }
     }
-    SILK_DEBUG << "block_numbers.cardinality(): " << block_numbers.cardinality();
     SILK_TRACE << "block_numbers: " << block_numbers.toString();
+    SILK_DEBUG << "block_numbers.cardinality(): " << block_numbers.cardinality();
 
     if (block_numbers.cardinality() == 0) {
         co_return;
     }
 
-    Logs chunk_logs;
-    Logs filtered_chunk_logs;
-    Logs filtered_block_logs{};
-    chunk_logs.reserve(512);
-    filtered_chunk_logs.reserve(64);
-    filtered_block_logs.reserve(256);
-
-    for (const auto& block_to_match : block_numbers) {
-        uint32_t log_index{0};
-
-        filtered_block_logs.clear();
-        const auto block_key = silkworm::db::block_key(block_to_match);
-        SILK_TRACE << "block_to_match: " << block_to_match << " block_key: " << silkworm::to_hex(block_key);
-        co_await tx_database.for_prefix(db::table::kLogsName, block_key, [&](const silkworm::Bytes& k, const silkworm::Bytes& v) {
-            chunk_logs.clear();
-            const bool decoding_ok{cbor_decode(v, chunk_logs)};
-            if (!decoding_ok) {
-                return false;
-            }
-            for (auto& log : chunk_logs) {
-                log.index = log_index++;
-            }
-            SILK_DEBUG << "chunk_logs.size(): " << chunk_logs.size();
-            filtered_chunk_logs.clear();
-            filter_logs(std::move(chunk_logs), addresses, topics, filtered_chunk_logs);
-            SILK_DEBUG << "filtered_chunk_logs.size(): " << filtered_chunk_logs.size();
-            if (filtered_chunk_logs.size() > 0) {
+    // Raw log chunks are read in block order, then decoded and filtered in parallel on the workers. Batch size doubles up
+    // to the in-flight limit, so that few blocks are decoded in excess when max_logs stops the query early
+    const auto current_executor = co_await boost::asio::this_coro::executor;
+    std::size_t batch_size{1};
+    auto block_it = block_numbers.begin();
+    while (block_it != block_numbers.end() && logs.size() <= max_logs) {
+        std::vector<BlockLogChunks> batch;
+        batch.reserve(batch_size);
+        for (; block_it != block_numbers.end() && batch.size() < batch_size; ++block_it) {
+            const auto block_to_match = *block_it;
+            const auto block_key = silkworm::db::block_key(block_to_match);
+            SILK_TRACE << "block_to_match: " << block_to_match << " block_key: " << silkworm::to_hex(block_key);
+            auto& block_chunks = batch.emplace_back(BlockLogChunks{block_to_match, {}});
+            co_await tx_database.for_prefix(db::table::kLogsName, block_key, [&](const silkworm::Bytes& k, const silkworm::Bytes& v) {
                 const auto tx_id = boost::endian::load_big_u32(&k[sizeof(uint64_t)]);
-                SILK_DEBUG << "tx_id: " << tx_id;
-                for (auto& log : filtered_chunk_logs) {
-                    log.tx_index = tx_id;
-                }
-                filtered_block_logs.insert(filtered_block_logs.end(), filtered_chunk_logs.begin(), filtered_chunk_logs.end());
-            }
-            return true;
-        });
-        SILK_DEBUG << "filtered_block_logs.size(): " << filtered_block_logs.size();
+                block_chunks.chunks.emplace_back(tx_id, v);
+                return true;
+            });
+        }
 
-        if (!filtered_block_logs.empty()) {
-            const auto block_with_hash = co_await core::read_block_by_number(*block_cache_, tx_database, block_to_match);
+        using DecodeLogsOperation = decltype(boost::asio::co_spawn(current_executor, decode_block_logs(batch[0], addresses, topics), boost::asio::deferred));
+        std::vector<DecodeLogsOperation> operations;
+        operations.reserve(batch.size());
+        for (const auto& block_chunks : batch) {
+            operations.push_back(boost::asio::co_spawn(current_executor, decode_block_logs(block_chunks, addresses, topics), boost::asio::deferred));
+        }
+        auto [order, exceptions, batch_logs] = co_await boost::asio::experimental::make_parallel_group(std::move(operations))
+                                                   .async_wait(boost::asio::experimental::wait_for_all(), boost::asio::use_awaitable);
+        concurrency::rethrow_first_exception_if_any(exceptions, order);
+
+        for (std::size_t i{0}; i < batch.size() && logs.size() <= max_logs; ++i) {
+            auto& filtered_block_logs = batch_logs[i];
+            SILK_DEBUG << "filtered_block_logs.size(): " << filtered_block_logs.size();
+            if (filtered_block_logs.empty()) {
+                continue;
+            }
+            const auto block_number = batch[i].block_number;
+            const auto block_with_hash = co_await core::read_block_by_number(*block_cache_, tx_database, block_number);
             SILK_DEBUG << "block_hash: " << silkworm::to_hex(block_with_hash->hash);
             for (auto& log : filtered_block_logs) {
                 const auto tx_hash{hash_of_transaction(block_with_hash->block.transactions[log.tx_index])};
-                log.block_number = block_to_match;
+                log.block_number = block_number;
                 log.block_hash = block_with_hash->hash;
                 log.tx_hash = silkworm::to_bytes32({tx_hash.bytes, silkworm::kHashLength});
             }
-            logs.insert(logs.end(), filtered_block_logs.begin(), filtered_block_logs.end());
+            logs.insert(logs.end(), std::make_move_iterator(filtered_block_logs.begin()), std::make_move_iterator(filtered_block_logs.end()));
         }
+
+        batch_size = std::min(batch_size * 2, kMaxLogBlocksInFlight);
     }
     SILK_INFO << "logs.size(): " << logs.size();
 
     co_return;
 }
 
-void EthereumRpcApi::filter_logs(std::vector<Log>&& logs, FilterAddresses& addresses, FilterTopics& topics, std::vector<Log>& filtered_logs) {
-    SILK_DEBUG << "addresses: " << addresses;
-    for (auto& log : logs) {
-        SILK_DEBUG << "log: " << log;
-        if (!addresses.empty() && std::find(addresses.begin(), addresses.end(), log.address) == addresses.end()) {
-            SILK_DEBUG << "skipped log for address: 0x" << silkworm::to_hex(log.address);
-            continue;
-        }
-        auto matches = true;
-        if (!topics.empty()) {
-            if (topics.size() > log.topics.size()) {
-                SILK_DEBUG << "#topics: " << topics.size() << " #log.topics: " << log.topics.size();
-                continue;
-            }
-            for (size_t i{0}; i < topics.size(); i++) {
-                SILK_DEBUG << "log.topics[i]: " << log.topics[i];
-                auto subtopics = topics[i];
-                auto matches_subtopics = subtopics.empty();  // empty rule set == wildcard
-                SILK_TRACE << "matches_subtopics: " << std::boolalpha << matches_subtopics;
-                for (auto& topic : subtopics) {
-                    SILK_DEBUG << "topic: " << topic;
-                    if (log.topics[i] == topic) {
-                        matches_subtopics = true;
-                        SILK_TRACE << "matches_subtopics: " << matches_subtopics;
-                        break;
+awaitable<Logs> EthereumRpcApi::decode_block_logs(const BlockLogChunks& block_chunks, const FilterAddresses& addresses, const FilterTopics& topics) {
+    co_return co_await boost::asio::async_compose<decltype(boost::asio::use_awaitable), void(std::exception_ptr, Logs)>(
+        [&](auto&& self) {
+            boost::asio::post(workers_, [&, self = std::move(self)]() mutable {
+                const LogFilter log_filter = [&](const Log& log) { return match_log(log, addresses, topics); };
+                Logs filtered_block_logs;
+                try {
+                    uint32_t log_index{0};
+                    for (const auto& [tx_id, chunk] : block_chunks.chunks) {
+                        const auto first_chunk_log = filtered_block_logs.size();
+                        const auto num_chunk_logs = cbor_decode(chunk, filtered_block_logs, log_filter);
+                        if (!num_chunk_logs) {
+                            break;
+                        }
+                        for (auto i{first_chunk_log}; i < filtered_block_logs.size(); ++i) {
+                            filtered_block_logs[i].index += log_index;
+                            filtered_block_logs[i].tx_index = tx_id;
+                        }
+                        log_index += static_cast<uint32_t>(*num_chunk_logs);
                     }
+                } catch (...) {
+                    self.complete(std::current_exception(), Logs{});
+                    return;
                 }
-                if (!matches_subtopics) {
-                    SILK_TRACE << "No subtopic matches";
-                    matches = false;
+                self.complete(std::exception_ptr{}, std::move(filtered_block_logs));
+            });
+        },
+        boost::asio::use_awaitable);
+}
+
+bool EthereumRpcApi::match_log(const Log& log, const FilterAddresses& addresses, const FilterTopics& topics) {
+    if (!addresses.empty() && std::find(addresses.begin(), addresses.end(), log.address) == addresses.end()) {
+        SILK_DEBUG << "skipped log for address: 0x" << silkworm::to_hex(log.address);
+        return false;
+    }
+    if (!topics.empty()) {
+        if (topics.size() > log.topics.size()) {
+            SILK_DEBUG << "#topics: " << topics.size() << " #log.topics: " << log.topics.size();
+            return false;
+        }
+        for (size_t i{0}; i < topics.size(); i++) {
+            SILK_DEBUG << "log.topics[i]: " << log.topics[i];
+            const auto& subtopics = topics[i];
+            auto matches_subtopics = subtopics.empty();  // empty rule set == wildcard
+            SILK_TRACE << "matches_subtopics: " << std::boolalpha << matches_subtopics;
+            for (const auto& topic : subtopics) {
+                SILK_DEBUG << "topic: " << topic;
+                if (log.topics[i] == topic) {
+                    matches_subtopics = true;
+                    SILK_TRACE << "matches_subtopics: " << matches_subtopics;
                     break;
                 }
             }
+            if (!matches_subtopics) {
+                SILK_TRACE << "No subtopic matches";
+                return false;
+            }
         }
+    }
+    return true;
+}
+
+void EthereumRpcApi::filter_logs(std::vector<Log>&& logs, FilterAddresses& addresses, FilterTopics& topics, std::vector<Log>& filtered_logs) {
+    SILK_DEBUG << "addresses: " << addresses;
+    for (auto& log : logs) {
+        SILK_DEBUG << "log: " << log;
+        const auto matches = match_log(log, addresses, topics);
         SILK_DEBUG << "matches: " << matches;
         if (matches) {
             filtered_logs.push_back(std::move(log));
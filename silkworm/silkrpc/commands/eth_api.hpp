@@ -16,6 +16,11 @@
 
 #pragma once
 
+#include <cstddef>
+#include <limits>
+#include <utility>
+#include <vector>
+
 #include <silkworm/infra/concurrency/coroutine.hpp>
 
 #include <boost/asio/awaitable.hpp>
@@ -35,6 +40,7 @@
 #include <silkworm/silkrpc/ethdb/kv/state_cache.hpp>
 #include <silkworm/silkrpc/ethdb/transaction.hpp>
 #include <silkworm/silkrpc/ethdb/transaction_database.hpp>
+#include <silkworm/silkrpc/json/request_view.hpp>
 #include <silkworm/silkrpc/json/types.hpp>
 #include <silkworm/silkrpc/txpool/miner.hpp>
 #include <silkworm/silkrpc/txpool/transaction_pool.hpp>
@@ -69,31 +75,42 @@ class EthereumRpcApi {
     EthereumRpcApi& operator=(const EthereumRpcApi&) = delete;
 
   protected:
+    //! Max number of logs returned by eth_getLogs, the query fails as soon as more logs are matched
+    static constexpr std::size_t kMaxGetLogsResults{100'000};
+
+    //! Max number of blocks whose logs are decoded and filtered at the same time
+    static constexpr std::size_t kMaxLogBlocksInFlight{16};
+
+    //! The raw log chunks of one block, each one paired with its transaction index
+    struct BlockLogChunks {
+        std::uint64_t block_number{0};
+        std::vector<std::pair<uint32_t, silkworm::Bytes>> chunks;
+    };
+
+    static bool match_log(const Log& log, const FilterAddresses& addresses, const FilterTopics& topics);
     static void filter_logs(std::vector<Log>&& logs, FilterAddresses& addresses, FilterTopics& topics, std::vector<Log>& filtered_logs);
 
     awaitable<void> get_logs(ethdb::TransactionDatabase& tx_database, std::uint64_t start, std::uint64_t end,
-                             FilterAddresses& addresses, FilterTopics& topics, std::vector<Log>& logs);
+                             FilterAddresses& addresses, FilterTopics& topics, std::vector<Log>& logs,
+                             std::size_t max_logs = std::numeric_limits<std::size_t>::max());
+    awaitable<Logs> decode_block_logs(const BlockLogChunks& block_chunks, const FilterAddresses& addresses, const FilterTopics& topics);
 
     awaitable<void> handle_eth_block_number(const nlohmann::json& request, nlohmann::json& reply);
     awaitable<void> handle_eth_chain_id(const nlohmann::json& request, nlohmann::json& reply);
     awaitable<void> handle_eth_protocol_version(const nlohmann::json& request, nlohmann::json& reply);
     awaitable<void> handle_eth_syncing(const nlohmann::json& request, nlohmann::json& reply);
     awaitable<void> handle_eth_gas_price(const nlohmann::json& request, nlohmann::json& reply);
-    awaitable<void> handle_eth_get_block_by_hash(const nlohmann::json& request, nlohmann::json& reply);
-    awaitable<void> handle_eth_get_block_by_number(const nlohmann::json& request, nlohmann::json& reply);
     awaitable<void> handle_eth_get_block_transaction_count_by_hash(const nlohmann::json& request, nlohmann::json& reply);
     awaitable<void> handle_eth_get_block_transaction_count_by_number(const nlohmann::json& request, nlohmann::json& reply);
     awaitable<void> handle_eth_get_uncle_by_block_hash_and_index(const nlohmann::json& request, nlohmann::json& reply);
     awaitable<void> handle_eth_get_uncle_by_block_number_and_index(const nlohmann::json& request, nlohmann::json& reply);
     awaitable<void> handle_eth_get_uncle_count_by_block_hash(const nlohmann::json& request, nlohmann::json& reply);
     awaitable<void> handle_eth_get_uncle_count_by_block_number(const nlohmann::json& request, nlohmann::json& reply);
-    awaitable<void> handle_eth_get_transaction_by_hash(const nlohmann::json& request, nlohmann::json& reply);
     awaitable<void> handle_eth_get_transaction_by_block_hash_and_index(const nlohmann::json& request, nlohmann::json& reply);
     awaitable<void> handle_eth_get_transaction_by_block_number_and_index(const nlohmann::json& request, nlohmann::json& reply);
     awaitable<void> handle_eth_get_raw_transaction_by_hash(const nlohmann::json& request, nlohmann::json& reply);
     awaitable<void> handle_eth_get_raw_transaction_by_block_hash_and_index(const nlohmann::json& request, nlohmann::json& reply);
     awaitable<void> handle_eth_get_raw_transaction_by_block_number_and_index(const nlohmann::json& request, nlohmann::json& reply);
-    awaitable<void> handle_eth_get_transaction_receipt(const nlohmann::json& request, nlohmann::json& reply);
     awaitable<void> handle_eth_estimate_gas(const nlohmann::json& request, nlohmann::json& reply);
     awaitable<void> handle_eth_get_balance(const nlohmann::json& request, nlohmann::json& reply);
     awaitable<void> handle_eth_get_code(const nlohmann::json& request, nlohmann::json& reply);
@@ -107,7 +124,6 @@ class EthereumRpcApi {
     awaitable<void> handle_eth_get_filter_logs(const nlohmann::json& request, nlohmann::json& reply);
     awaitable<void> handle_eth_get_filter_changes(const nlohmann::json& request, nlohmann::json& reply);
     awaitable<void> handle_eth_uninstall_filter(const nlohmann::json& request, nlohmann::json& reply);
-    awaitable<void> handle_eth_send_raw_transaction(const nlohmann::json& request, nlohmann::json& reply);
     awaitable<void> handle_eth_send_transaction(const nlohmann::json& request, nlohmann::json& reply);
     awaitable<void> handle_eth_sign_transaction(const nlohmann::json& request, nlohmann::json& reply);
     awaitable<void> handle_eth_get_proof(const nlohmann::json& request, nlohmann::json& reply);
@@ -124,8 +140,13 @@ class EthereumRpcApi {
     awaitable<void> handle_eth_call_many(const nlohmann::json& request, nlohmann::json& reply);
 
     // GLAZE format routine
-    awaitable<void> handle_eth_get_logs(const nlohmann::json& request, std::string& reply);
-    awaitable<void> handle_eth_call(const nlohmann::json& request, std::string& reply);
+    awaitable<void> handle_eth_get_logs(const json::RequestView& request, std::string& reply);
+    awaitable<void> handle_eth_call(const json::RequestView& request, std::string& reply);
+    awaitable<void> handle_eth_get_block_by_hash(const json::RequestView& request, std::string& reply);
+    awaitable<void> handle_eth_get_block_by_number(const json::RequestView& request, std::string& reply);
+    awaitable<void> handle_eth_get_transaction_by_hash(const json::RequestView& request, std::string& reply);
+    awaitable<void> handle_eth_get_transaction_receipt(const json::RequestView& request, std::string& reply);
+    awaitable<void> handle_eth_send_raw_transaction(const json::RequestView& request, std::string& reply);
 
     boost::asio::io_context& io_context_;
     BlockCache* block_cache_;
@@ -16,19 +16,33 @@
 
 #include "eth_api.hpp"
 
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
 #include <thread>
+#include <utility>
+#include <vector>
 
 #include <boost/asio/co_spawn.hpp>
 #include <boost/asio/thread_pool.hpp>
+#include <boost/endian/conversion.hpp>
 #include <catch2/catch.hpp>
 #include <nlohmann/json.hpp>
 
+#include <silkworm/core/types/bloom.hpp>
+#include <silkworm/infra/concurrency/private_service.hpp>
+#include <silkworm/node/db/tables.hpp>
+#include <silkworm/node/db/util.hpp>
+#include <silkworm/silkrpc/ethdb/bitmap.hpp>
 #include <silkworm/silkrpc/test/api_test_base.hpp>
 
 namespace silkworm::rpc::commands {
 
 using boost::asio::awaitable;
 using Catch::Matchers::Message;
+using evmc::literals::operator""_address;
+using evmc::literals::operator""_bytes32;
 
 //! Utility class to expose handle hooks publicly just for tests
 class EthereumRpcApi_ForTest : public EthereumRpcApi {
@@ -36,13 +50,227 @@ class EthereumRpcApi_ForTest : public EthereumRpcApi {
     explicit EthereumRpcApi_ForTest(boost::asio::io_context& ioc, boost::asio::thread_pool& workers)
         : EthereumRpcApi{ioc, workers} {}
 
+    static constexpr std::size_t kMaxGetLogsResults{EthereumRpcApi::kMaxGetLogsResults};
+    static constexpr std::size_t kMaxLogBlocksInFlight{EthereumRpcApi::kMaxLogBlocksInFlight};
+
     // MSVC doesn't support using access declarations properly, so explicitly forward these public accessors
     awaitable<void> eth_block_number(const nlohmann::json& request, nlohmann::json& reply) {
         co_await EthereumRpcApi::handle_eth_block_number(request, reply);
     }
-    awaitable<void> eth_send_raw_transaction(const nlohmann::json& request, nlohmann::json& reply) {
+    awaitable<void> eth_send_raw_transaction(const json::RequestView& request, std::string& reply) {
         co_await EthereumRpcApi::handle_eth_send_raw_transaction(request, reply);
     }
+    awaitable<void> eth_get_logs(const json::RequestView& request, std::string& reply) {
+        co_await EthereumRpcApi::handle_eth_get_logs(request, reply);
+    }
+    awaitable<void> get_logs(ethdb::TransactionDatabase& tx_database, std::uint64_t start, std::uint64_t end,
+                             FilterAddresses& addresses, FilterTopics& topics, std::vector<Log>& logs) {
+        co_await EthereumRpcApi::get_logs(tx_database, start, end, addresses, topics, logs);
+    }
+};
+
+//! Database tables in memory, keeping track of the keys sought by cursors
+class InMemoryTables {
+  public:
+    void put(const std::string& table, Bytes key, Bytes value) { tables_[table][std::move(key)] = std::move(value); }
+
+    [[nodiscard]] const std::map<Bytes, Bytes>& table(const std::string& name) const {
+        static const std::map<Bytes, Bytes> kEmptyTable;
+        const auto it{tables_.find(name)};
+        return it != tables_.end() ? it->second : kEmptyTable;
+    }
+
+    void record_seek(const std::string& table, ByteView key) {
+        std::scoped_lock lock{seeks_mutex_};
+        seeks_.emplace_back(table, key);
+    }
+
+    //! Keys sought in the given table, in order
+    [[nodiscard]] std::vector<Bytes> seeks(const std::string& table) const {
+        std::scoped_lock lock{seeks_mutex_};
+        std::vector<Bytes> keys;
+        for (const auto& [name, key] : seeks_) {
+            if (name == table) {
+                keys.push_back(key);
+            }
+        }
+        return keys;
+    }
+
+  private:
+    std::map<std::string, std::map<Bytes, Bytes>> tables_;
+    mutable std::mutex seeks_mutex_;
+    std::vector<std::pair<std::string, Bytes>> seeks_;
+};
+
+class InMemoryCursor : public ethdb::CursorDupSort {
+  public:
+    explicit InMemoryCursor(InMemoryTables& tables) : tables_{tables} {}
+
+    [[nodiscard]] uint32_t cursor_id() const override { return 0; }
+
+    awaitable<void> open_cursor(const std::string& table_name, bool /*is_dup_sorted*/) override {
+        table_name_ = table_name;
+        table_ = &tables_.table(table_name);
+        it_ = table_->end();
+        co_return;
+    }
+
+    awaitable<void> close_cursor() override { co_return; }
+
+    awaitable<KeyValue> seek(ByteView key) override {
+        tables_.record_seek(table_name_, key);
+        it_ = table_->lower_bound(Bytes{key});
+        co_return current();
+    }
+
+    awaitable<KeyValue> seek_exact(ByteView key) override {
+        tables_.record_seek(table_name_, key);
+        it_ = table_->find(Bytes{key});
+        co_return current();
+    }
+
+    awaitable<KeyValue> next() override {
+        if (it_ != table_->end()) {
+            ++it_;
+        }
+        co_return current();
+    }
+
+    awaitable<KeyValue> next_dup() override { co_return KeyValue{}; }
+
+    awaitable<Bytes> seek_both(ByteView /*key*/, ByteView /*value*/) override { co_return Bytes{}; }
+
+    awaitable<KeyValue> seek_both_exact(ByteView /*key*/, ByteView /*value*/) override { co_return KeyValue{}; }
+
+  private:
+    [[nodiscard]] KeyValue current() const {
+        return it_ != table_->end() ? KeyValue{it_->first, it_->second} : KeyValue{};
+    }
+
+    InMemoryTables& tables_;
+    std::string table_name_;
+    const std::map<Bytes, Bytes>* table_{nullptr};
+    std::map<Bytes, Bytes>::const_iterator it_;
+};
+
+class InMemoryTransaction : public ethdb::Transaction {
+  public:
+    explicit InMemoryTransaction(InMemoryTables& tables) : tables_{tables} {}
+
+    [[nodiscard]] uint64_t view_id() const override { return 0; }
+
+    awaitable<void> open() override { co_return; }
+
+    awaitable<std::shared_ptr<ethdb::Cursor>> cursor(const std::string& table) override {
+        auto cursor = std::make_shared<InMemoryCursor>(tables_);
+        co_await cursor->open_cursor(table, false);
+        co_return cursor;
+    }
+
+    awaitable<std::shared_ptr<ethdb::CursorDupSort>> cursor_dup_sort(const std::string& table) override {
+        auto cursor = std::make_shared<InMemoryCursor>(tables_);
+        co_await cursor->open_cursor(table, true);
+        co_return cursor;
+    }
+
+    std::shared_ptr<silkworm::State> create_state(boost::asio::any_io_executor&, const core::rawdb::DatabaseReader&, uint64_t) override {
+        return nullptr;
+    }
+
+    std::shared_ptr<node::ChainStorage> create_storage(const core::rawdb::DatabaseReader&, ethbackend::BackEnd*) override {
+        return nullptr;
+    }
+
+    awaitable<void> close() override { co_return; }
+
+  private:
+    InMemoryTables& tables_;
+};
+
+//! Database backed by the in-memory tables, used in place of the remote database for RPC-level tests
+class InMemoryDatabase : public ethdb::Database {
+  public:
+    explicit InMemoryDatabase(InMemoryTables& tables) : tables_{tables} {}
+
+    awaitable<std::unique_ptr<ethdb::Transaction>> begin() override {
+        co_return std::make_unique<InMemoryTransaction>(tables_);
+    }
+
+  private:
+    InMemoryTables& tables_;
+};
+
+//! Canonical blocks with one transaction each and their logs, indexed by LogAddressIndex and BloomBits
+class LogsChain {
+  public:
+    LogsChain(boost::asio::io_context& io_context, InMemoryTables& tables)
+        : block_cache_{must_use_shared_service<BlockCache>(io_context)}, tables_{tables} {}
+
+    //! Add a block with the given number of logs from the given address in its only transaction
+    void add_block(BlockNum block_number, const evmc::address& address, std::size_t num_logs = 1) {
+        auto block_with_hash{std::make_shared<BlockWithHash>()};
+        block_with_hash->block.header.number = block_number;
+        block_with_hash->block.transactions.resize(1);
+        block_with_hash->block.transactions[0].nonce = block_number;
+        block_with_hash->hash = block_hash(block_number);
+        tables_.put(db::table::kCanonicalHashesName, db::block_key(block_number), Bytes{block_with_hash->hash.bytes, kHashLength});
+        block_cache_->insert(block_with_hash->hash, block_with_hash);
+
+        // CBOR array of [address, topics, data] items
+        Bytes logs;
+        if (num_logs < 24) {
+            logs.push_back(static_cast<uint8_t>(0x80 + num_logs));
+        } else {
+            logs.push_back(0x9a);
+            logs.resize(logs.size() + sizeof(uint32_t));
+            boost::endian::store_big_u32(&logs[1], static_cast<uint32_t>(num_logs));
+        }
+        for (std::size_t i{0}; i < num_logs; ++i) {
+            logs += *from_hex("8354");
+            logs += ByteView{address.bytes, kAddressLength};
+            logs += *from_hex("80f6");
+        }
+        tables_.put(db::table::kLogsName, db::log_key(block_number, 0), logs);
+
+        address_blocks_[address].add(static_cast<uint32_t>(block_number));
+    }
+
+    //! Write the LogAddressIndex bitmaps of the blocks added so far
+    void index_addresses() {
+        for (const auto& [address, bitmap] : address_blocks_) {
+            Bytes key{address.bytes, kAddressLength};
+            key += *from_hex("ffffffff");
+            Bytes value(bitmap.getSizeInBytes(), '\0');
+            bitmap.write(reinterpret_cast<char*>(value.data()));
+            tables_.put(db::table::kLogAddressIndexName, key, value);
+        }
+    }
+
+    //! Set the bloom bits of the given address in the given blocks of BloomBits section 0 and mark it as indexed
+    void index_bloom_bits(const evmc::address& address, const std::vector<BlockNum>& block_numbers) {
+        const auto head_block_number{db::kBloomBitsSectionSize - 1};
+        tables_.put(db::table::kCanonicalHashesName, db::block_key(head_block_number), Bytes{block_hash(head_block_number).bytes, kHashLength});
+        tables_.put(db::table::kBloomBitsIndexName, db::block_key(0), Bytes{block_hash(head_block_number).bytes, kHashLength});
+        for (const auto bit : m3_2048_bits(ByteView{address.bytes, kAddressLength})) {
+            Bytes row(db::kBloomBitsSectionSize / 8, '\0');
+            for (const auto block_number : block_numbers) {
+                row[block_number / 8] |= static_cast<uint8_t>(0x80u >> (block_number % 8));
+            }
+            tables_.put(db::table::kBloomBitsName, db::bloom_bits_key(bit, 0), row);
+        }
+    }
+
+    static evmc::bytes32 block_hash(BlockNum block_number) {
+        evmc::bytes32 hash;
+        boost::endian::store_big_u64(&hash.bytes[kHashLength - sizeof(uint64_t)], block_number + 1);
+        return hash;
+    }
+
+  private:
+    BlockCache* block_cache_;
+    InMemoryTables& tables_;
+    std::map<evmc::address, roaring::Roaring> address_blocks_;
 };
 
 using EthereumRpcApiTest = test::JsonApiWithWorkersTestBase<EthereumRpcApi_ForTest>;
@@ -81,36 +309,168 @@ TEST_CASE_METHOD(EthereumRpcApiTest, "handle_eth_block_number fails if request e
 }
 
 TEST_CASE_METHOD(EthereumRpcApiTest, "handle_eth_send_raw_transaction fails rlp parsing", "[silkrpc][eth_api]") {
-    nlohmann::json reply;
-
-    run<&EthereumRpcApi_ForTest::eth_send_raw_transaction>(
-        R"({
+    const std::string content{R"({
             "jsonrpc": "2.0",
             "id": 1,
             "method": "eth_sendRawTransaction",
             "params": ["0xd46ed67c5d32be8d46e8dd67c5d32be8058bb8eb970870f072445675058bb8eb970870f0724456"]
-        })"_json,
-        reply);
-    CHECK(reply == R"({
+        })"};
+    const auto request{json::RequestView::make(content)};
+    REQUIRE(request);
+    std::string reply;
+
+    run<&EthereumRpcApi_ForTest::eth_send_raw_transaction>(*request, reply);
+    CHECK(nlohmann::json::parse(reply) == R"({
         "error":{"code":-32000,"message":"rlp: input exceeds encoded length"},"id":1,"jsonrpc":"2.0"
     })"_json);
 }
 
 TEST_CASE_METHOD(EthereumRpcApiTest, "handle_eth_send_raw_transaction fails wrong number digit", "[silkrpc][eth_api]") {
-    nlohmann::json reply;
-
-    run<&EthereumRpcApi_ForTest::eth_send_raw_transaction>(
-        R"({
+    const std::string content{R"({
             "jsonrpc": "2.0",
             "id": 1,
             "method": "eth_sendRawTransaction",
             "params": ["0xd46ed67c5d32be8d46e8dd67c5d32be8058bb8eb970870f072445675058bb8eb970870f072445"]
-        })"_json,
-        reply);
-    CHECK(reply == R"({
+        })"};
+    const auto request{json::RequestView::make(content)};
+    REQUIRE(request);
+    std::string reply;
+
+    run<&EthereumRpcApi_ForTest::eth_send_raw_transaction>(*request, reply);
+    CHECK(nlohmann::json::parse(reply) == R"({
         "error":{"code":-32000,"message":"rlp: unexpected EIP-2178 serialization"},"id":1,"jsonrpc":"2.0"
     })"_json);
 }
+
+TEST_CASE_METHOD(EthereumRpcApiTest, "get_logs uses bloom bits to prefilter the index bitmaps", "[silkrpc][eth_api]") {
+    const auto rare_address{0x22341ae42d6dd7384bc8584e50419ea3ac75b83f_address};
+    const auto other_address{0xe7fb22dfef11920312e4989a3a2b81e2ebf05986_address};
+
+    InMemoryTables tables;
+    LogsChain chain{io_context_, tables};
+    chain.add_block(3, other_address);
+    chain.add_block(10, rare_address);
+    chain.add_block(20, other_address);
+    chain.index_addresses();
+
+    InMemoryTransaction txn{tables};
+    ethdb::TransactionDatabase tx_database{txn};
+    FilterAddresses addresses{rare_address};
+    FilterTopics topics;
+    std::vector<Log> logs;
+
+    const auto read_log_blocks = [&]() {
+        std::vector<BlockNum> block_numbers;
+        for (const auto& key : tables.seeks(db::table::kLogsName)) {
+            block_numbers.push_back(boost::endian::load_big_u64(key.data()));
+        }
+        return block_numbers;
+    };
+
+    SECTION("bloom false positives are dropped by the address bitmap") {
+        // Saturated blooms: the rare address bits are set in blocks not containing any log from it
+        chain.index_bloom_bits(rare_address, {3, 10, 20});
+        run<&EthereumRpcApi_ForTest::get_logs>(tx_database, 0, 100, addresses, topics, logs);
+        REQUIRE(logs.size() == 1);
+        CHECK(logs[0].block_number == 10);
+        CHECK(logs[0].address == rare_address);
+        CHECK(read_log_blocks() == std::vector<BlockNum>{10});
+    }
+
+    SECTION("no bitmap is read when bloom bits rule out the whole range") {
+        chain.index_bloom_bits(rare_address, {});
+        run<&EthereumRpcApi_ForTest::get_logs>(tx_database, 0, 100, addresses, topics, logs);
+        CHECK(logs.empty());
+        CHECK(tables.seeks(db::table::kLogAddressIndexName).empty());
+        CHECK(read_log_blocks().empty());
+    }
+
+    SECTION("bitmaps only when the indexed section is not canonical") {
+        chain.index_bloom_bits(rare_address, {});
+        tables.put(db::table::kCanonicalHashesName, db::block_key(db::kBloomBitsSectionSize - 1), Bytes(kHashLength, 0xFF));
+        run<&EthereumRpcApi_ForTest::get_logs>(tx_database, 0, 100, addresses, topics, logs);
+        REQUIRE(logs.size() == 1);
+        CHECK(logs[0].block_number == 10);
+    }
+
+    SECTION("bitmaps only when the BloomBits index is not populated") {
+        run<&EthereumRpcApi_ForTest::get_logs>(tx_database, 0, 100, addresses, topics, logs);
+        REQUIRE(logs.size() == 1);
+        CHECK(logs[0].block_number == 10);
+        CHECK(read_log_blocks() == std::vector<BlockNum>{10});
+    }
+}
+
+TEST_CASE_METHOD(EthereumRpcApiTest, "handle_eth_get_logs returns logs in block order across batches", "[silkrpc][eth_api]") {
+    const auto address{0x22341ae42d6dd7384bc8584e50419ea3ac75b83f_address};
+
+    // Blocks span several decode batches, earlier blocks have more logs so that their decoding takes longer
+    constexpr BlockNum kNumBlocks{2 * EthereumRpcApi_ForTest::kMaxLogBlocksInFlight + 8};
+    InMemoryTables tables;
+    LogsChain chain{io_context_, tables};
+    for (BlockNum block_number{1}; block_number <= kNumBlocks; ++block_number) {
+        chain.add_block(block_number, address, kNumBlocks + 1 - block_number);
+    }
+    chain.index_addresses();
+    add_private_service<ethdb::Database>(io_context_, std::make_unique<InMemoryDatabase>(tables));
+
+    const std::string content{R"({
+            "jsonrpc": "2.0",
+            "id": 1,
+            "method": "eth_getLogs",
+            "params": [{"fromBlock": "0x0", "toBlock": "0x64", "address": ["0x22341ae42d6dd7384bc8584e50419ea3ac75b83f"]}]
+        })"};
+    const auto request{json::RequestView::make(content)};
+    REQUIRE(request);
+    std::string reply;
+
+    run<&EthereumRpcApi_ForTest::eth_get_logs>(*request, reply);
+    const auto reply_json = nlohmann::json::parse(reply);
+    REQUIRE(reply_json.contains("result"));
+    const auto& result = reply_json["result"];
+    REQUIRE(result.size() == kNumBlocks * (kNumBlocks + 1) / 2);
+    BlockNum expected_block_number{1};
+    std::size_t block_logs{0};
+    for (const auto& log : result) {
+        const auto block_number = std::stoull(log["blockNumber"].get<std::string>(), nullptr, 16);
+        if (block_logs == kNumBlocks + 1 - expected_block_number) {
+            ++expected_block_number;
+            block_logs = 0;
+        }
+        CHECK(block_number == expected_block_number);
+        ++block_logs;
+    }
+    CHECK(expected_block_number == kNumBlocks);
+}
+
+TEST_CASE_METHOD(EthereumRpcApiTest, "handle_eth_get_logs fails if too many logs match", "[silkrpc][eth_api]") {
+    const auto address{0x22341ae42d6dd7384bc8584e50419ea3ac75b83f_address};
+
+    constexpr std::size_t kNumBlocks{5};
+    constexpr std::size_t kLogsPerBlock{EthereumRpcApi_ForTest::kMaxGetLogsResults / kNumBlocks + 1};
+    InMemoryTables tables;
+    LogsChain chain{io_context_, tables};
+    for (BlockNum block_number{1}; block_number <= kNumBlocks; ++block_number) {
+        chain.add_block(block_number, address, kLogsPerBlock);
+    }
+    chain.index_addresses();
+    add_private_service<ethdb::Database>(io_context_, std::make_unique<InMemoryDatabase>(tables));
+
+    const std::string content{R"({
+            "jsonrpc": "2.0",
+            "id": 1,
+            "method": "eth_getLogs",
+            "params": [{"fromBlock": "0x0", "toBlock": "0x64", "address": ["0x22341ae42d6dd7384bc8584e50419ea3ac75b83f"]}]
+        })"};
+    const auto request{json::RequestView::make(content)};
+    REQUIRE(request);
+    std::string reply;
+
+    run<&EthereumRpcApi_ForTest::eth_get_logs>(*request, reply);
+    CHECK(nlohmann::json::parse(reply) == R"({
+        "error":{"code":-32005,"message":"query returned more than 100000 results"},"id":1,"jsonrpc":"2.0"
+    })"_json);
+}
 #endif  // SILKWORM_SANITIZE
 
 }  // namespace silkworm::rpc::commands
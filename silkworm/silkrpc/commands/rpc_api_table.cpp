@@ -115,21 +115,17 @@ void RpcApiTable::add_eth_handlers() {
     method_handlers_[http::method::k_eth_protocolVersion] = &commands::RpcApi::handle_eth_protocol_version;
     method_handlers_[http::method::k_eth_syncing] = &commands::RpcApi::handle_eth_syncing;
     method_handlers_[http::method::k_eth_gasPrice] = &commands::RpcApi::handle_eth_gas_price;
-    method_handlers_[http::method::k_eth_getBlockByHash] = &commands::RpcApi::handle_eth_get_block_by_hash;
-    method_handlers_[http::method::k_eth_getBlockByNumber] = &commands::RpcApi::handle_eth_get_block_by_number;
     method_handlers_[http::method::k_eth_getBlockTransactionCountByHash] = &commands::RpcApi::handle_eth_get_block_transaction_count_by_hash;
     method_handlers_[http::method::k_eth_getBlockTransactionCountByNumber] = &commands::RpcApi::handle_eth_get_block_transaction_count_by_number;
     method_handlers_[http::method::k_eth_getUncleByBlockHashAndIndex] = &commands::RpcApi::handle_eth_get_uncle_by_block_hash_and_index;
     method_handlers_[http::method::k_eth_getUncleByBlockNumberAndIndex] = &commands::RpcApi::handle_eth_get_uncle_by_block_number_and_index;
     method_handlers_[http::method::k_eth_getUncleCountByBlockHash] = &commands::RpcApi::handle_eth_get_uncle_count_by_block_hash;
     method_handlers_[http::method::k_eth_getUncleCountByBlockNumber] = &commands::RpcApi::handle_eth_get_uncle_count_by_block_number;
-    method_handlers_[http::method::k_eth_getTransactionByHash] = &commands::RpcApi::handle_eth_get_transaction_by_hash;
     method_handlers_[http::method::k_eth_getTransactionByBlockHashAndIndex] = &commands::RpcApi::handle_eth_get_transaction_by_block_hash_and_index;
     method_handlers_[http::method::k_eth_getTransactionByBlockNumberAndIndex] = &commands::RpcApi::handle_eth_get_transaction_by_block_number_and_index;
     method_handlers_[http::method::k_eth_getRawTransactionByHash] = &commands::RpcApi::handle_eth_get_raw_transaction_by_hash;
     method_handlers_[http::method::k_eth_getRawTransactionByBlockHashAndIndex] = &commands::RpcApi::handle_eth_get_raw_transaction_by_block_hash_and_index;
     method_handlers_[http::method::k_eth_getRawTransactionByBlockNumberAndIndex] = &commands::RpcApi::handle_eth_get_raw_transaction_by_block_number_and_index;
-    method_handlers_[http::method::k_eth_getTransactionReceipt] = &commands::RpcApi::handle_eth_get_transaction_receipt;
     method_handlers_[http::method::k_eth_estimateGas] = &commands::RpcApi::handle_eth_estimate_gas;
     method_handlers_[http::method::k_eth_getBalance] = &commands::RpcApi::handle_eth_get_balance;
     method_handlers_[http::method::k_eth_getCode] = &commands::RpcApi::handle_eth_get_code;
@@ -143,7 +139,6 @@ void RpcApiTable::add_eth_handlers() {
     method_handlers_[http::method::k_eth_getFilterLogs] = &commands::RpcApi::handle_eth_get_filter_logs;
     method_handlers_[http::method::k_eth_getFilterChanges] = &commands::RpcApi::handle_eth_get_filter_changes;
     method_handlers_[http::method::k_eth_uninstallFilter] = &commands::RpcApi::handle_eth_uninstall_filter;
-    method_handlers_[http::method::k_eth_sendRawTransaction] = &commands::RpcApi::handle_eth_send_raw_transaction;
     method_handlers_[http::method::k_eth_sendTransaction] = &commands::RpcApi::handle_eth_send_transaction;
     method_handlers_[http::method::k_eth_signTransaction] = &commands::RpcApi::handle_eth_sign_transaction;
     method_handlers_[http::method::k_eth_getProof] = &commands::RpcApi::handle_eth_get_proof;
@@ -164,6 +159,11 @@ void RpcApiTable::add_eth_handlers() {
     // GLAZE methods
     method_handlers_glaze_[http::method::k_eth_getLogs] = &commands::RpcApi::handle_eth_get_logs;
     method_handlers_glaze_[http::method::k_eth_call] = &commands::RpcApi::handle_eth_call;
+    method_handlers_glaze_[http::method::k_eth_getBlockByHash] = &commands::RpcApi::handle_eth_get_block_by_hash;
+    method_handlers_glaze_[http::method::k_eth_getBlockByNumber] = &commands::RpcApi::handle_eth_get_block_by_number;
+    method_handlers_glaze_[http::method::k_eth_getTransactionByHash] = &commands::RpcApi::handle_eth_get_transaction_by_hash;
+    method_handlers_glaze_[http::method::k_eth_getTransactionReceipt] = &commands::RpcApi::handle_eth_get_transaction_receipt;
+    method_handlers_glaze_[http::method::k_eth_sendRawTransaction] = &commands::RpcApi::handle_eth_send_raw_transaction;
 }
 
 void RpcApiTable::add_net_handlers() {
@@ -26,6 +26,7 @@
 #include <nlohmann/json.hpp>
 
 #include <silkworm/silkrpc/commands/rpc_api.hpp>
+#include <silkworm/silkrpc/json/request_view.hpp>
 #include <silkworm/silkrpc/json/stream.hpp>
 
 namespace silkworm::rpc::commands {
@@ -33,7 +34,7 @@ namespace silkworm::rpc::commands {
 class RpcApiTable {
   public:
     using HandleMethod = boost::asio::awaitable<void> (RpcApi::*)(const nlohmann::json&, nlohmann::json&);
-    using HandleMethodGlaze = boost::asio::awaitable<void> (RpcApi::*)(const nlohmann::json&, std::string&);
+    using HandleMethodGlaze = boost::asio::awaitable<void> (RpcApi::*)(const json::RequestView&, std::string&);
     using HandleStream = boost::asio::awaitable<void> (RpcApi::*)(const nlohmann::json&, json::Stream&);
 
     explicit RpcApiTable(const std::string& api_spec);
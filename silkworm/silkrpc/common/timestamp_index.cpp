@@ -0,0 +1,92 @@
+/*
+   Copyright 2023 The Silkworm Authors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#include "timestamp_index.hpp"
+
+#include <optional>
+
+#include <silkworm/infra/common/log.hpp>
+
+namespace silkworm::rpc {
+
+boost::asio::awaitable<uint64_t> TimestampIndex::find_block_number(uint64_t timestamp, uint64_t head_block_number, TimestampReader read_timestamp) {
+    // Narrow the search using the indexed blocks closest to the timestamp: lower one not newer, upper one newer
+    std::optional<uint64_t> lower, upper;
+    {
+        std::scoped_lock lock{mutex_};
+        const auto it = block_number_by_timestamp_.upper_bound(timestamp);
+        if (it != block_number_by_timestamp_.end()) {
+            upper = it->second;
+        }
+        if (it != block_number_by_timestamp_.begin()) {
+            lower = std::prev(it)->second;
+        }
+    }
+    // Indexed blocks can be above the chain head only after some unwind deeper than the max reorg depth
+    if (lower && *lower > head_block_number) {
+        lower.reset();
+    }
+    if (upper && *upper > head_block_number) {
+        upper.reset();
+    }
+
+    if (!lower) {
+        if (co_await block_timestamp(0, head_block_number, read_timestamp) > timestamp) {
+            co_return 0;
+        }
+        lower = 0;
+    }
+    if (!upper) {
+        if (co_await block_timestamp(head_block_number, head_block_number, read_timestamp) <= timestamp) {
+            co_return head_block_number;
+        }
+        upper = head_block_number;
+    }
+
+    // Binary search within the unknown interval, where timestamp(lower) <= timestamp < timestamp(upper)
+    uint64_t probes{0};
+    while (*upper - *lower > 1) {
+        const uint64_t middle{*lower + (*upper - *lower) / 2};
+        if (co_await block_timestamp(middle, head_block_number, read_timestamp) <= timestamp) {
+            lower = middle;
+        } else {
+            upper = middle;
+        }
+        ++probes;
+    }
+    SILK_DEBUG << "TimestampIndex::find_block_number timestamp: " << timestamp << " block_number: " << *lower << " probes: " << probes;
+
+    co_return *lower;
+}
+
+std::size_t TimestampIndex::size() const {
+    std::scoped_lock lock{mutex_};
+    return block_number_by_timestamp_.size();
+}
+
+boost::asio::awaitable<uint64_t> TimestampIndex::block_timestamp(uint64_t block_number, uint64_t head_block_number, TimestampReader read_timestamp) {
+    const uint64_t timestamp{co_await read_timestamp(block_number)};
+    if (block_number + kMaxReorgDepth <= head_block_number) {
+        std::scoped_lock lock{mutex_};
+        if (block_number_by_timestamp_.size() >= max_entries_) {
+            block_number_by_timestamp_.clear();  // just start over, the hottest ranges will be indexed again quickly
+        }
+        block_number_by_timestamp_.emplace(timestamp, block_number);
+    }
+    co_return timestamp;
+}
+
+}  // namespace silkworm::rpc
@@ -0,0 +1,67 @@
+/*
+   Copyright 2023 The Silkworm Authors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <mutex>
+
+#include <silkworm/infra/concurrency/coroutine.hpp>
+
+#include <absl/functional/function_ref.h>
+#include <boost/asio/awaitable.hpp>
+
+namespace silkworm::rpc {
+
+//! \brief In-memory index of block timestamps, shared among the execution contexts
+//! \details Block timestamps are strictly increasing, so the index keeps the known (timestamp, block number) pairs
+//! sorted by timestamp and uses them to narrow any timestamp search down to the unknown interval. Just blocks deep
+//! enough below the chain head to be unaffected by reorgs are indexed, so the index is extended as the chain grows.
+class TimestampIndex {
+  public:
+    using TimestampReader = absl::FunctionRef<boost::asio::awaitable<uint64_t>(uint64_t)>;
+
+    //! Blocks closer than this to the chain head are never indexed
+    static constexpr uint64_t kMaxReorgDepth{128};
+
+    //! Default max number of indexed blocks, i.e. the index takes few tens of MB at most
+    static constexpr std::size_t kDefaultMaxEntries{1 << 20};
+
+    explicit TimestampIndex(std::size_t max_entries = kDefaultMaxEntries) : max_entries_{max_entries} {}
+
+    TimestampIndex(const TimestampIndex&) = delete;
+    TimestampIndex& operator=(const TimestampIndex&) = delete;
+
+    //! \brief Find the highest block number in [0, head_block_number] whose timestamp is not greater than the specified one
+    //! \param read_timestamp reads the timestamp of any block in the range, called just for blocks not indexed yet
+    //! \return the matching block number or zero if even the first block is newer than the specified timestamp
+    boost::asio::awaitable<uint64_t> find_block_number(uint64_t timestamp, uint64_t head_block_number, TimestampReader read_timestamp);
+
+    [[nodiscard]] std::size_t size() const;
+
+  private:
+    //! Read the block timestamp and add it to the index, if the block is deep enough
+    boost::asio::awaitable<uint64_t> block_timestamp(uint64_t block_number, uint64_t head_block_number, TimestampReader read_timestamp);
+
+    std::size_t max_entries_;
+
+    mutable std::mutex mutex_;
+    std::map<uint64_t, uint64_t> block_number_by_timestamp_;
+};
+
+}  // namespace silkworm::rpc
@@ -0,0 +1,119 @@
+/*
+   Copyright 2023 The Silkworm Authors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#include "timestamp_index.hpp"
+
+#include <vector>
+
+#include <catch2/catch.hpp>
+
+#include <silkworm/silkrpc/test/context_test_base.hpp>
+
+namespace silkworm::rpc {
+
+struct TimestampIndexTest : test::ContextTestBase {
+    //! Block timestamps: 1000 blocks w/ 12s spacing starting at 1000
+    std::vector<uint64_t> timestamps = [] {
+        std::vector<uint64_t> v(1'000);
+        for (std::size_t i{0}; i < v.size(); ++i) {
+            v[i] = 1'000 + i * 12;
+        }
+        return v;
+    }();
+    std::size_t reads{0};
+
+    uint64_t find(TimestampIndex& index, uint64_t timestamp) {
+        const uint64_t head_block_number{timestamps.size() - 1};
+        return spawn_and_wait(index.find_block_number(timestamp, head_block_number, [&](uint64_t n) -> boost::asio::awaitable<uint64_t> {
+            ++reads;
+            co_return timestamps.at(n);
+        }));
+    }
+};
+
+#ifndef SILKWORM_SANITIZE
+TEST_CASE_METHOD(TimestampIndexTest, "TimestampIndex::find_block_number", "[silkrpc][common][timestamp_index]") {
+    TimestampIndex index;
+
+    SECTION("before first block") {
+        CHECK(find(index, 999) == 0);
+    }
+    SECTION("first block") {
+        CHECK(find(index, 1'000) == 0);
+        CHECK(find(index, 1'011) == 0);
+    }
+    SECTION("exact block timestamp") {
+        CHECK(find(index, 1'000 + 500 * 12) == 500);
+    }
+    SECTION("between block timestamps") {
+        CHECK(find(index, 1'000 + 500 * 12 + 5) == 500);
+        CHECK(find(index, 1'000 + 500 * 12 - 1) == 499);
+    }
+    SECTION("at or after head block") {
+        CHECK(find(index, 1'000 + 999 * 12) == 999);
+        CHECK(find(index, 1'000'000) == 999);
+    }
+    SECTION("same result w/ index warm") {
+        for (uint64_t block_number{0}; block_number < timestamps.size(); block_number += 37) {
+            CHECK(find(index, timestamps[block_number] + 1) == block_number);
+        }
+        for (uint64_t block_number{0}; block_number < timestamps.size(); block_number += 37) {
+            CHECK(find(index, timestamps[block_number] + 1) == block_number);
+        }
+    }
+}
+
+TEST_CASE_METHOD(TimestampIndexTest, "TimestampIndex: indexed blocks are not read again", "[silkrpc][common][timestamp_index]") {
+    TimestampIndex index;
+
+    CHECK(find(index, 1'000 + 300 * 12) == 300);
+    const auto first_reads{reads};
+    CHECK(first_reads > 0);
+    CHECK(index.size() > 0);
+
+    reads = 0;
+    CHECK(find(index, 1'000 + 300 * 12) == 300);
+    CHECK(reads == 0);
+
+    reads = 0;
+    CHECK(find(index, 1'000 + 301 * 12) == 301);
+    CHECK(reads < first_reads);
+}
+
+TEST_CASE_METHOD(TimestampIndexTest, "TimestampIndex: recent blocks are not indexed", "[silkrpc][common][timestamp_index]") {
+    TimestampIndex index;
+
+    CHECK(find(index, 1'000 + 990 * 12) == 990);
+    const auto first_reads{reads};
+
+    // Blocks closer than max reorg depth to chain head must be read again
+    reads = 0;
+    CHECK(find(index, 1'000 + 990 * 12) == 990);
+    CHECK(reads > 0);
+    CHECK(reads < first_reads);
+}
+
+TEST_CASE_METHOD(TimestampIndexTest, "TimestampIndex: max entries", "[silkrpc][common][timestamp_index]") {
+    TimestampIndex index{4};
+
+    for (uint64_t block_number{0}; block_number < 800; block_number += 13) {
+        CHECK(find(index, timestamps[block_number]) == block_number);
+        CHECK(index.size() <= 4);
+    }
+}
+#endif  // SILKWORM_SANITIZE
+
+}  // namespace silkworm::rpc
@@ -22,8 +22,12 @@
 #include <stack>
 #include <string>
 
+#include <boost/asio/co_spawn.hpp>
 #include <boost/asio/compose.hpp>
+#include <boost/asio/deferred.hpp>
+#include <boost/asio/experimental/parallel_group.hpp>
 #include <boost/asio/post.hpp>
+#include <boost/asio/this_coro.hpp>
 #include <boost/asio/use_awaitable.hpp>
 #include <evmc/hex.hpp>
 #include <evmc/instructions.h>
@@ -35,11 +39,15 @@
 #include <silkworm/core/common/util.hpp>
 #include <silkworm/core/protocol/ethash_rule_set.hpp>
 #include <silkworm/infra/common/log.hpp>
+#include <silkworm/infra/concurrency/parallel_group_utils.hpp>
+#include <silkworm/node/db/tables.hpp>
 #include <silkworm/silkrpc/common/util.hpp>
 #include <silkworm/silkrpc/core/cached_chain.hpp>
 #include <silkworm/silkrpc/core/rawdb/chain.hpp>
+#include <silkworm/silkrpc/ethdb/bitmap.hpp>
 #include <silkworm/silkrpc/json/call.hpp>
 #include <silkworm/silkrpc/json/types.hpp>
+#include <silkworm/silkrpc/stagedsync/stages.hpp>
 
 namespace silkworm::rpc::trace {
 
@@ -1126,9 +1134,15 @@ void IntraBlockStateTracer::on_reward_granted(const silkworm::CallResult& result
 }
 
 awaitable<std::vector<Trace>> TraceCallExecutor::trace_block(const BlockWithHash& block_with_hash, Filter& filter, json::Stream* stream) {
+    const auto trace_call_results = co_await trace_block_transactions(block_with_hash.block, {false, true, false});
+    co_return co_await filter_block_traces(block_with_hash, trace_call_results, filter, stream);
+}
+
+awaitable<std::vector<Trace>> TraceCallExecutor::filter_block_traces(const BlockWithHash& block_with_hash,
+                                                                     const std::vector<TraceCallResult>& trace_call_results,
+                                                                     Filter& filter, json::Stream* stream) {
     std::vector<Trace> traces;
 
-    const auto trace_call_results = co_await trace_block_transactions(block_with_hash.block, {false, true, false});
     for (std::uint64_t pos = 0; pos < trace_call_results.size(); pos++) {
         rpc::Transaction transaction{block_with_hash.block.transactions[pos]};
         if (!transaction.from) {
@@ -1550,25 +1564,69 @@ awaitable<void> TraceCallExecutor::trace_filter(const TraceFilter& trace_filter,
     filter.after = trace_filter.after;
     filter.count = trace_filter.count;
 
-    auto block_number = from_block_with_hash->block.header.number;
-    auto block_with_hash = from_block_with_hash;
-    while (block_number++ <= to_block_with_hash->block.header.number) {
-        const Block block{*block_with_hash, {}, false};
-        SILK_INFO << "TraceCallExecutor::trace_filter: processing "
-                  << " block_number: " << block_number - 1
-                  << " block: " << block;
+    const auto from_block_number = from_block_with_hash->block.header.number;
+    const auto to_block_number = to_block_with_hash->block.header.number;
 
-        co_await trace_block(*block_with_hash, filter, stream);
+    // Use the call trace indexes (if any) to replay only the blocks where some filtered account is involved in calls
+    std::optional<roaring::Roaring> indexed_block_numbers;
+    uint64_t last_indexed_block_number{0};
+    if (!filter.from_addresses.empty() || !filter.to_addresses.empty()) {
+        last_indexed_block_number = co_await stages::get_sync_stage_progress(database_reader_, stages::kCallTraces);
+        if (last_indexed_block_number >= from_block_number) {
+            const auto last_block_number = std::min(last_indexed_block_number, to_block_number);
+            indexed_block_numbers = co_await ethdb::bitmap::from_addresses(database_reader_, db::table::kCallFromIndexName,
+                                                                           trace_filter.from_addresses, from_block_number, last_block_number);
+            *indexed_block_numbers |= co_await ethdb::bitmap::from_addresses(database_reader_, db::table::kCallToIndexName,
+                                                                             trace_filter.to_addresses, from_block_number, last_block_number);
+            SILK_DEBUG << "TraceCallExecutor::trace_filter: indexed blocks #" << indexed_block_numbers->cardinality();
+        }
+    }
 
-        if (filter.count == 0) {
+    // Blocks are replayed in batches on the workers, but their traces are filtered and streamed in block order. Batch size
+    // doubles up to the in-flight limit, so that few blocks are executed in excess when after/count stop the range early
+    const auto current_executor = co_await boost::asio::this_coro::executor;
+    const TraceConfig trace_config{false, true, false};
+    std::size_t batch_size{1};
+    auto block_number = from_block_number;
+    while (block_number <= to_block_number && filter.count > 0) {
+        std::vector<std::shared_ptr<BlockWithHash>> batch;
+        batch.reserve(batch_size);
+        for (; block_number <= to_block_number && batch.size() < batch_size; ++block_number) {
+            if (indexed_block_numbers && block_number <= last_indexed_block_number &&
+                !indexed_block_numbers->contains(gsl::narrow<uint32_t>(block_number))) {
+                continue;
+            }
+
+            if (block_number == from_block_number) {
+                batch.push_back(from_block_with_hash);
+            } else if (block_number == to_block_number) {
+                batch.push_back(to_block_with_hash);
+            } else {
+                batch.push_back(co_await core::read_block_by_number(block_cache_, database_reader_, block_number));
+            }
+        }
+        if (batch.empty()) {
             break;
         }
 
-        if (block_number == to_block_with_hash->block.header.number) {
-            block_with_hash = to_block_with_hash;
-        } else {
-            block_with_hash = co_await core::read_block_by_number(block_cache_, database_reader_, block_number);
+        using TraceBlockOperation = decltype(boost::asio::co_spawn(current_executor, trace_block_transactions(batch[0]->block, trace_config), boost::asio::deferred));
+        std::vector<TraceBlockOperation> operations;
+        operations.reserve(batch.size());
+        for (const auto& block_with_hash : batch) {
+            SILK_INFO << "TraceCallExecutor::trace_filter: processing "
+                      << " block_number: " << block_with_hash->block.header.number
+                      << " block: " << Block{*block_with_hash, {}, false};
+            operations.push_back(boost::asio::co_spawn(current_executor, trace_block_transactions(block_with_hash->block, trace_config), boost::asio::deferred));
+        }
+        auto [order, exceptions, batch_results] = co_await boost::asio::experimental::make_parallel_group(std::move(operations))
+                                                      .async_wait(boost::asio::experimental::wait_for_all(), boost::asio::use_awaitable);
+        concurrency::rethrow_first_exception_if_any(exceptions, order);
+
+        for (std::size_t i{0}; i < batch.size() && filter.count > 0; ++i) {
+            co_await filter_block_traces(*batch[i], batch_results[i], filter, stream);
         }
+
+        batch_size = std::min(batch_size * 2, kMaxBlocksInFlight);
     }
 
     stream->close_array();
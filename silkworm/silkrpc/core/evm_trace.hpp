@@ -483,7 +483,13 @@ class TraceCallExecutor {
     boost::asio::awaitable<TraceOperationsResult> trace_operations(const TransactionWithBlock& transaction_with_block);
     boost::asio::awaitable<void> trace_filter(const TraceFilter& trace_filter, json::Stream* stream);
 
+    //! Max number of blocks replayed concurrently by trace_filter, which bounds the memory held by pending block traces
+    static constexpr std::size_t kMaxBlocksInFlight{16};
+
   private:
+    boost::asio::awaitable<std::vector<Trace>> filter_block_traces(const BlockWithHash& block_with_hash,
+                                                                   const std::vector<TraceCallResult>& trace_call_results,
+                                                                   Filter& filter, json::Stream* stream);
     boost::asio::awaitable<TraceCallResult> execute(std::uint64_t block_number, const silkworm::Block& block,
                                                     const rpc::Transaction& transaction, std::int32_t index, const TraceConfig& config);
 
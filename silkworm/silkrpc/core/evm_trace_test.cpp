@@ -16,11 +16,15 @@
 
 #include "evm_trace.hpp"
 
+#include <algorithm>
+#include <numeric>
 #include <string>
 #include <utility>
+#include <vector>
 
 #include <boost/asio/co_spawn.hpp>
 #include <boost/asio/thread_pool.hpp>
+#include <boost/endian/conversion.hpp>
 #include <catch2/catch.hpp>
 #include <evmc/instructions.h>
 #include <gmock/gmock.h>
@@ -30,6 +34,7 @@
 #include <silkworm/infra/test_util/log.hpp>
 #include <silkworm/node/db/tables.hpp>
 #include <silkworm/silkrpc/common/util.hpp>
+#include <silkworm/silkrpc/stagedsync/stages.hpp>
 #include <silkworm/silkrpc/test/context_test_base.hpp>
 #include <silkworm/silkrpc/test/dummy_transaction.hpp>
 #include <silkworm/silkrpc/test/mock_cursor.hpp>
@@ -43,6 +48,7 @@ using evmc::literals::operator""_address;
 using evmc::literals::operator""_bytes32;
 
 using testing::_;
+using testing::Invoke;
 using testing::InvokeWithoutArgs;
 
 static Bytes kZeroKey{*silkworm::from_hex("0000000000000000")};
@@ -5275,42 +5281,6 @@ TEST_CASE_METHOD(TraceCallExecutorTest, "TraceCallExecutor::trace_filter") {
           "toBlock": "0x6DDD03"
         })"_json;
 
-        // TransactionDatabase::get_one: TABLE CanonicalHeader
-        static Bytes kCanonicalHeaderKey3{*silkworm::from_hex("00000000006ddd04")};
-        static Bytes kCanonicalHeaderValue3{*silkworm::from_hex("1b9ac5d63ba5c6a7e0c40a339499eef9b8b45fa247e701516f35a2357ccdaf1e")};
-        EXPECT_CALL(db_reader, get_one(db::table::kCanonicalHashesName, silkworm::ByteView{kCanonicalHeaderKey3}))
-            .WillOnce(InvokeWithoutArgs([]() -> boost::asio::awaitable<Bytes> {
-                co_return kCanonicalHeaderValue3;
-            }));
-
-        // TransactionDatabase::get: TABLE Header
-        static Bytes kHeaderKey2{*silkworm::from_hex("00000000006ddd041b9ac5d63ba5c6a7e0c40a339499eef9b8b45fa247e701516f35a2357ccdaf1e")};
-        static Bytes kHeaderValue2{*silkworm::from_hex(
-            "f9025ba0a316f156582fb5fba2166910becdb6342965a801fa473e18cd6a0c06143cac1aa01dcc4de8dec75d7aab85b567b6ccd41ad312"
-            "451b948a7413f0a142fd40d49347940000000000000000000000000000000000000000a000636fe848d9d0dd8d3fe77deef0286329b01f"
-            "4e971501d1dc481365deea77bfa056e81f171bcc55a6ff8345e692c0f86e5b48e01b996cadc001622fb5e363b421a056e81f171bcc55a6"
-            "ff8345e692c0f86e5b48e01b996cadc001622fb5e363b421b9010000000000000000000000000000000000000000000000000000000000"
-            "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000"
-            "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000"
-            "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000"
-            "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000"
-            "000000000000000001836ddd048401c9c380808462ca3c74b8614e65746865726d696e6420312e31332e332d302d306533323839663535"
-            "2d3230a499270541450663356185c61f970959545219dee7616763658a87d3c80730c32cca058d57ccc16cc0b0ca4269c4dee474ee3612"
-            "f83cbf54f9fbffddba6d154401a00000000000000000000000000000000000000000000000000000000000000000880000000000000000"
-            "07")};
-        EXPECT_CALL(db_reader, get_one(db::table::kHeadersName, silkworm::ByteView{kHeaderKey2}))
-            .WillOnce(InvokeWithoutArgs([]() -> boost::asio::awaitable<Bytes> {
-                co_return kHeaderValue2;
-            }));
-
-        // TransactionDatabase::get: TABLE BlockBody
-        static Bytes kBlockBodyKey2{*silkworm::from_hex("00000000006ddd041b9ac5d63ba5c6a7e0c40a339499eef9b8b45fa247e701516f35a2357ccdaf1e")};
-        static Bytes kBlockBodyValue2{*silkworm::from_hex("c78405c62e6f02c0")};
-        EXPECT_CALL(db_reader, get_one(db::table::kBlockBodiesName, silkworm::ByteView{kBlockBodyKey2}))
-            .WillOnce(InvokeWithoutArgs([]() -> boost::asio::awaitable<Bytes> {
-                co_return kBlockBodyValue2;
-            }));
-
         BlockCache block_cache;
         std::shared_ptr<test::MockCursorDupSort> mock_cursor = std::make_shared<test::MockCursorDupSort>();
         test::DummyTransaction tx{0, mock_cursor};
@@ -5359,41 +5329,17 @@ TEST_CASE_METHOD(TraceCallExecutorTest, "TraceCallExecutor::trace_filter") {
           "fromAddress": ["0x2031832e54a2200bf678286f560f49a950db2ad5"]
         })"_json;
 
-        // TransactionDatabase::get_one: TABLE CanonicalHeader
-        static Bytes kCanonicalHeaderKey3{*silkworm::from_hex("00000000006ddd04")};
-        static Bytes kCanonicalHeaderValue3{*silkworm::from_hex("1b9ac5d63ba5c6a7e0c40a339499eef9b8b45fa247e701516f35a2357ccdaf1e")};
-        EXPECT_CALL(db_reader, get_one(db::table::kCanonicalHashesName, silkworm::ByteView{kCanonicalHeaderKey3}))
-            .WillOnce(InvokeWithoutArgs([]() -> boost::asio::awaitable<Bytes> {
-                co_return kCanonicalHeaderValue3;
+        // TransactionDatabase::get: TABLE SyncStageProgress
+        static const Bytes kCallTracesStageKey{stages::kCallTraces};
+        static const Bytes kCallTracesStageValue{*silkworm::from_hex("00000000006ddd03")};
+        EXPECT_CALL(db_reader, get(db::table::kSyncStageProgressName, silkworm::ByteView{kCallTracesStageKey}))
+            .WillOnce(InvokeWithoutArgs([]() -> boost::asio::awaitable<KeyValue> {
+                co_return KeyValue{kCallTracesStageKey, kCallTracesStageValue};
             }));
 
-        // TransactionDatabase::get: TABLE Header
-        static Bytes kHeaderKey2{*silkworm::from_hex("00000000006ddd041b9ac5d63ba5c6a7e0c40a339499eef9b8b45fa247e701516f35a2357ccdaf1e")};
-        static Bytes kHeaderValue2{*silkworm::from_hex(
-            "f9025ba0a316f156582fb5fba2166910becdb6342965a801fa473e18cd6a0c06143cac1aa01dcc4de8dec75d7aab85b567b6ccd41ad312"
-            "451b948a7413f0a142fd40d49347940000000000000000000000000000000000000000a000636fe848d9d0dd8d3fe77deef0286329b01f"
-            "4e971501d1dc481365deea77bfa056e81f171bcc55a6ff8345e692c0f86e5b48e01b996cadc001622fb5e363b421a056e81f171bcc55a6"
-            "ff8345e692c0f86e5b48e01b996cadc001622fb5e363b421b9010000000000000000000000000000000000000000000000000000000000"
-            "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000"
-            "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000"
-            "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000"
-            "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000"
-            "000000000000000001836ddd048401c9c380808462ca3c74b8614e65746865726d696e6420312e31332e332d302d306533323839663535"
-            "2d3230a499270541450663356185c61f970959545219dee7616763658a87d3c80730c32cca058d57ccc16cc0b0ca4269c4dee474ee3612"
-            "f83cbf54f9fbffddba6d154401a00000000000000000000000000000000000000000000000000000000000000000880000000000000000"
-            "07")};
-        EXPECT_CALL(db_reader, get_one(db::table::kHeadersName, silkworm::ByteView{kHeaderKey2}))
-            .WillOnce(InvokeWithoutArgs([]() -> boost::asio::awaitable<Bytes> {
-                co_return kHeaderValue2;
-            }));
-
-        // TransactionDatabase::get: TABLE BlockBody
-        static Bytes kBlockBodyKey2{*silkworm::from_hex("00000000006ddd041b9ac5d63ba5c6a7e0c40a339499eef9b8b45fa247e701516f35a2357ccdaf1e")};
-        static Bytes kBlockBodyValue2{*silkworm::from_hex("c78405c62e6f02c0")};
-        EXPECT_CALL(db_reader, get_one(db::table::kBlockBodiesName, silkworm::ByteView{kBlockBodyKey2}))
-            .WillOnce(InvokeWithoutArgs([]() -> boost::asio::awaitable<Bytes> {
-                co_return kBlockBodyValue2;
-            }));
+        // TransactionDatabase::walk: TABLE CallFromIndex (no block indexed for fromAddress, so no block replayed)
+        EXPECT_CALL(db_reader, walk(db::table::kCallFromIndexName, _, _, _))
+            .WillOnce(InvokeWithoutArgs([]() -> boost::asio::awaitable<void> { co_return; }));
 
         BlockCache block_cache;
         std::shared_ptr<test::MockCursorDupSort> mock_cursor = std::make_shared<test::MockCursorDupSort>();
@@ -5417,40 +5363,11 @@ TEST_CASE_METHOD(TraceCallExecutorTest, "TraceCallExecutor::trace_filter") {
           "fromAddress": ["0x2031832e54a2200bf678286f560f49a950db2ad5"]
         })"_json;
 
-        // TransactionDatabase::get_one: TABLE CanonicalHeader
-        static Bytes kCanonicalHeaderKey3{*silkworm::from_hex("00000000006ddd04")};
-        static Bytes kCanonicalHeaderValue3{*silkworm::from_hex("1b9ac5d63ba5c6a7e0c40a339499eef9b8b45fa247e701516f35a2357ccdaf1e")};
-        EXPECT_CALL(db_reader, get_one(db::table::kCanonicalHashesName, silkworm::ByteView{kCanonicalHeaderKey3}))
-            .WillOnce(InvokeWithoutArgs([]() -> boost::asio::awaitable<Bytes> {
-                co_return kCanonicalHeaderValue3;
-            }));
-
-        // TransactionDatabase::get: TABLE Header
-        static Bytes kHeaderKey2{*silkworm::from_hex("00000000006ddd041b9ac5d63ba5c6a7e0c40a339499eef9b8b45fa247e701516f35a2357ccdaf1e")};
-        static Bytes kHeaderValue2{*silkworm::from_hex(
-            "f9025ba0a316f156582fb5fba2166910becdb6342965a801fa473e18cd6a0c06143cac1aa01dcc4de8dec75d7aab85b567b6ccd41ad312"
-            "451b948a7413f0a142fd40d49347940000000000000000000000000000000000000000a000636fe848d9d0dd8d3fe77deef0286329b01f"
-            "4e971501d1dc481365deea77bfa056e81f171bcc55a6ff8345e692c0f86e5b48e01b996cadc001622fb5e363b421a056e81f171bcc55a6"
-            "ff8345e692c0f86e5b48e01b996cadc001622fb5e363b421b9010000000000000000000000000000000000000000000000000000000000"
-            "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000"
-            "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000"
-            "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000"
-            "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000"
-            "000000000000000001836ddd048401c9c380808462ca3c74b8614e65746865726d696e6420312e31332e332d302d306533323839663535"
-            "2d3230a499270541450663356185c61f970959545219dee7616763658a87d3c80730c32cca058d57ccc16cc0b0ca4269c4dee474ee3612"
-            "f83cbf54f9fbffddba6d154401a00000000000000000000000000000000000000000000000000000000000000000880000000000000000"
-            "07")};
-        EXPECT_CALL(db_reader, get_one(db::table::kHeadersName, silkworm::ByteView{kHeaderKey2}))
-            .WillOnce(InvokeWithoutArgs([]() -> boost::asio::awaitable<Bytes> {
-                co_return kHeaderValue2;
-            }));
-
-        // TransactionDatabase::get: TABLE BlockBody
-        static Bytes kBlockBodyKey2{*silkworm::from_hex("00000000006ddd041b9ac5d63ba5c6a7e0c40a339499eef9b8b45fa247e701516f35a2357ccdaf1e")};
-        static Bytes kBlockBodyValue2{*silkworm::from_hex("c78405c62e6f02c0")};
-        EXPECT_CALL(db_reader, get_one(db::table::kBlockBodiesName, silkworm::ByteView{kBlockBodyKey2}))
-            .WillOnce(InvokeWithoutArgs([]() -> boost::asio::awaitable<Bytes> {
-                co_return kBlockBodyValue2;
+        // TransactionDatabase::get: TABLE SyncStageProgress (no call trace index available)
+        static const Bytes kCallTracesStageKey{stages::kCallTraces};
+        EXPECT_CALL(db_reader, get(db::table::kSyncStageProgressName, silkworm::ByteView{kCallTracesStageKey}))
+            .WillOnce(InvokeWithoutArgs([]() -> boost::asio::awaitable<KeyValue> {
+                co_return KeyValue{};
             }));
 
         BlockCache block_cache;
@@ -5532,42 +5449,6 @@ TEST_CASE_METHOD(TraceCallExecutorTest, "TraceCallExecutor::trace_filter") {
           "after": 0
         })"_json;
 
-        // TransactionDatabase::get_one: TABLE CanonicalHeader
-        static Bytes kCanonicalHeaderKey3{*silkworm::from_hex("00000000006ddd04")};
-        static Bytes kCanonicalHeaderValue3{*silkworm::from_hex("1b9ac5d63ba5c6a7e0c40a339499eef9b8b45fa247e701516f35a2357ccdaf1e")};
-        EXPECT_CALL(db_reader, get_one(db::table::kCanonicalHashesName, silkworm::ByteView{kCanonicalHeaderKey3}))
-            .WillOnce(InvokeWithoutArgs([]() -> boost::asio::awaitable<Bytes> {
-                co_return kCanonicalHeaderValue3;
-            }));
-
-        // TransactionDatabase::get: TABLE Header
-        static Bytes kHeaderKey2{*silkworm::from_hex("00000000006ddd041b9ac5d63ba5c6a7e0c40a339499eef9b8b45fa247e701516f35a2357ccdaf1e")};
-        static Bytes kHeaderValue2{*silkworm::from_hex(
-            "f9025ba0a316f156582fb5fba2166910becdb6342965a801fa473e18cd6a0c06143cac1aa01dcc4de8dec75d7aab85b567b6ccd41ad312"
-            "451b948a7413f0a142fd40d49347940000000000000000000000000000000000000000a000636fe848d9d0dd8d3fe77deef0286329b01f"
-            "4e971501d1dc481365deea77bfa056e81f171bcc55a6ff8345e692c0f86e5b48e01b996cadc001622fb5e363b421a056e81f171bcc55a6"
-            "ff8345e692c0f86e5b48e01b996cadc001622fb5e363b421b9010000000000000000000000000000000000000000000000000000000000"
-            "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000"
-            "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000"
-            "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000"
-            "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000"
-            "000000000000000001836ddd048401c9c380808462ca3c74b8614e65746865726d696e6420312e31332e332d302d306533323839663535"
-            "2d3230a499270541450663356185c61f970959545219dee7616763658a87d3c80730c32cca058d57ccc16cc0b0ca4269c4dee474ee3612"
-            "f83cbf54f9fbffddba6d154401a00000000000000000000000000000000000000000000000000000000000000000880000000000000000"
-            "07")};
-        EXPECT_CALL(db_reader, get_one(db::table::kHeadersName, silkworm::ByteView{kHeaderKey2}))
-            .WillOnce(InvokeWithoutArgs([]() -> boost::asio::awaitable<Bytes> {
-                co_return kHeaderValue2;
-            }));
-
-        // TransactionDatabase::get: TABLE BlockBody
-        static Bytes kBlockBodyKey2{*silkworm::from_hex("00000000006ddd041b9ac5d63ba5c6a7e0c40a339499eef9b8b45fa247e701516f35a2357ccdaf1e")};
-        static Bytes kBlockBodyValue2{*silkworm::from_hex("c78405c62e6f02c0")};
-        EXPECT_CALL(db_reader, get_one(db::table::kBlockBodiesName, silkworm::ByteView{kBlockBodyKey2}))
-            .WillOnce(InvokeWithoutArgs([]() -> boost::asio::awaitable<Bytes> {
-                co_return kBlockBodyValue2;
-            }));
-
         BlockCache block_cache;
         std::shared_ptr<test::MockCursorDupSort> mock_cursor = std::make_shared<test::MockCursorDupSort>();
         test::DummyTransaction tx{0, mock_cursor};
@@ -5616,42 +5497,6 @@ TEST_CASE_METHOD(TraceCallExecutorTest, "TraceCallExecutor::trace_filter") {
           "after": 1
         })"_json;
 
-        // TransactionDatabase::get_one: TABLE CanonicalHeader
-        static Bytes kCanonicalHeaderKey3{*silkworm::from_hex("00000000006ddd04")};
-        static Bytes kCanonicalHeaderValue3{*silkworm::from_hex("1b9ac5d63ba5c6a7e0c40a339499eef9b8b45fa247e701516f35a2357ccdaf1e")};
-        EXPECT_CALL(db_reader, get_one(db::table::kCanonicalHashesName, silkworm::ByteView{kCanonicalHeaderKey3}))
-            .WillOnce(InvokeWithoutArgs([]() -> boost::asio::awaitable<Bytes> {
-                co_return kCanonicalHeaderValue3;
-            }));
-
-        // TransactionDatabase::get: TABLE Header
-        static Bytes kHeaderKey2{*silkworm::from_hex("00000000006ddd041b9ac5d63ba5c6a7e0c40a339499eef9b8b45fa247e701516f35a2357ccdaf1e")};
-        static Bytes kHeaderValue2{*silkworm::from_hex(
-            "f9025ba0a316f156582fb5fba2166910becdb6342965a801fa473e18cd6a0c06143cac1aa01dcc4de8dec75d7aab85b567b6ccd41ad312"
-            "451b948a7413f0a142fd40d49347940000000000000000000000000000000000000000a000636fe848d9d0dd8d3fe77deef0286329b01f"
-            "4e971501d1dc481365deea77bfa056e81f171bcc55a6ff8345e692c0f86e5b48e01b996cadc001622fb5e363b421a056e81f171bcc55a6"
-            "ff8345e692c0f86e5b48e01b996cadc001622fb5e363b421b9010000000000000000000000000000000000000000000000000000000000"
-            "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000"
-            "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000"
-            "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000"
-            "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000"
-            "000000000000000001836ddd048401c9c380808462ca3c74b8614e65746865726d696e6420312e31332e332d302d306533323839663535"
-            "2d3230a499270541450663356185c61f970959545219dee7616763658a87d3c80730c32cca058d57ccc16cc0b0ca4269c4dee474ee3612"
-            "f83cbf54f9fbffddba6d154401a00000000000000000000000000000000000000000000000000000000000000000880000000000000000"
-            "07")};
-        EXPECT_CALL(db_reader, get_one(db::table::kHeadersName, silkworm::ByteView{kHeaderKey2}))
-            .WillOnce(InvokeWithoutArgs([]() -> boost::asio::awaitable<Bytes> {
-                co_return kHeaderValue2;
-            }));
-
-        // TransactionDatabase::get: TABLE BlockBody
-        static Bytes kBlockBodyKey2{*silkworm::from_hex("00000000006ddd041b9ac5d63ba5c6a7e0c40a339499eef9b8b45fa247e701516f35a2357ccdaf1e")};
-        static Bytes kBlockBodyValue2{*silkworm::from_hex("c78405c62e6f02c0")};
-        EXPECT_CALL(db_reader, get_one(db::table::kBlockBodiesName, silkworm::ByteView{kBlockBodyKey2}))
-            .WillOnce(InvokeWithoutArgs([]() -> boost::asio::awaitable<Bytes> {
-                co_return kBlockBodyValue2;
-            }));
-
         BlockCache block_cache;
         std::shared_ptr<test::MockCursorDupSort> mock_cursor = std::make_shared<test::MockCursorDupSort>();
         test::DummyTransaction tx{0, mock_cursor};
@@ -5681,6 +5526,99 @@ TEST_CASE_METHOD(TraceCallExecutorTest, "TraceCallExecutor::trace_filter") {
     }
 }
 
+//! Canonical empty blocks in the block cache, so that trace_filter yields just one reward trace per block
+static void add_empty_blocks(BlockCache& block_cache, test::MockDatabaseReader& db_reader, BlockNum max_block_number,
+                             std::vector<BlockNum>& read_block_numbers) {
+    const auto block_hash = [](BlockNum block_number) {
+        evmc::bytes32 hash;
+        boost::endian::store_big_u64(&hash.bytes[kHashLength - sizeof(uint64_t)], block_number);
+        return hash;
+    };
+    for (BlockNum block_number{1}; block_number <= max_block_number; ++block_number) {
+        auto block_with_hash{std::make_shared<BlockWithHash>()};
+        block_with_hash->block.header.number = block_number;
+        block_with_hash->block.header.beneficiary.bytes[kAddressLength - 1] = static_cast<uint8_t>(block_number);
+        block_with_hash->hash = block_hash(block_number);
+        block_cache.insert(block_with_hash->hash, block_with_hash);
+    }
+    EXPECT_CALL(db_reader, get_one(db::table::kCanonicalHashesName, _))
+        .WillRepeatedly(Invoke([=, &read_block_numbers](const std::string&, silkworm::ByteView key) -> boost::asio::awaitable<Bytes> {
+            const auto block_number = boost::endian::load_big_u64(key.data());
+            if (block_number == 0) {
+                co_return kZeroHeader;
+            }
+            read_block_numbers.push_back(block_number);
+            const auto hash{block_hash(block_number)};
+            co_return Bytes{hash.bytes, kHashLength};
+        }));
+    EXPECT_CALL(db_reader, get_one(db::table::kConfigName, silkworm::ByteView{kConfigKey}))
+        .WillRepeatedly(InvokeWithoutArgs([]() -> boost::asio::awaitable<Bytes> {
+            co_return kConfigValue;
+        }));
+}
+
+TEST_CASE_METHOD(TraceCallExecutorTest, "TraceCallExecutor::trace_filter block ranges") {
+    StringWriter string_writer(4096);
+    json::Stream stream(string_writer);
+
+    test::MockDatabaseReader db_reader;
+    boost::asio::thread_pool workers{4};
+    BlockCache block_cache;
+    std::vector<BlockNum> read_block_numbers;
+    add_empty_blocks(block_cache, db_reader, 100, read_block_numbers);
+
+    std::shared_ptr<test::MockCursorDupSort> mock_cursor = std::make_shared<test::MockCursorDupSort>();
+    test::DummyTransaction tx{0, mock_cursor};
+    TraceCallExecutor executor{block_cache, db_reader, workers, tx};
+
+    const auto trace_block_numbers = [&]() {
+        const auto json = nlohmann::json::parse(string_writer.get_content());
+        std::vector<BlockNum> block_numbers;
+        for (const auto& trace : json["result"]) {
+            block_numbers.push_back(trace["blockNumber"].get<BlockNum>());
+        }
+        return block_numbers;
+    };
+
+    SECTION("traces streamed in block order across batches") {
+        // Blocks span several replay batches, the last one partially filled
+        constexpr BlockNum kToBlock{0x28};
+        static_assert(kToBlock > 2 * TraceCallExecutor::kMaxBlocksInFlight);
+        TraceFilter trace_filter = R"({
+            "fromBlock": "0x1",
+            "toBlock": "0x28"
+        })"_json;
+
+        stream.open_object();
+        spawn_and_wait(executor.trace_filter(trace_filter, &stream));
+        stream.close_object();
+        stream.close();
+
+        std::vector<BlockNum> expected_block_numbers(kToBlock);
+        std::iota(expected_block_numbers.begin(), expected_block_numbers.end(), 1);
+        CHECK(trace_block_numbers() == expected_block_numbers);
+    }
+
+    SECTION("after and count stop the range early") {
+        TraceFilter trace_filter = R"({
+            "fromBlock": "0x1",
+            "toBlock": "0x64",
+            "after": 3,
+            "count": 2
+        })"_json;
+
+        stream.open_object();
+        spawn_and_wait(executor.trace_filter(trace_filter, &stream));
+        stream.close_object();
+        stream.close();
+
+        CHECK(trace_block_numbers() == std::vector<BlockNum>{4, 5});
+        // Batches of 1, 2 and 4 blocks are replayed, then the range stops: no block after #7 is read except toBlock
+        std::erase(read_block_numbers, 100);
+        CHECK(*std::max_element(read_block_numbers.begin(), read_block_numbers.end()) == 7);
+    }
+}
+
 TEST_CASE("VmTrace json serialization") {
     silkworm::test_util::SetLogVerbosityGuard log_guard{log::Level::kNone};
 
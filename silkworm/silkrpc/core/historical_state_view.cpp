@@ -0,0 +1,108 @@
+/*
+   Copyright 2023 The Silkworm Authors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#include "historical_state_view.hpp"
+
+#include <silkworm/core/common/lru_cache.hpp>
+#include <silkworm/node/db/util.hpp>
+#include <silkworm/silkrpc/common/util.hpp>
+
+namespace silkworm::rpc {
+
+//! Max number of heights whose views are kept for sharing
+static constexpr std::size_t kMaxSharedViews{32};
+
+static silkworm::Bytes storage_key(const evmc::address& address, uint64_t incarnation, const evmc::bytes32& location_hash) {
+    silkworm::Bytes key{silkworm::db::storage_prefix(full_view(address), incarnation)};
+    key.append(full_view(location_hash));
+    return key;
+}
+
+static silkworm::Bytes storage_location_key(const evmc::address& address, const evmc::bytes32& location_hash) {
+    silkworm::Bytes key{full_view(address)};
+    key.append(full_view(location_hash));
+    return key;
+}
+
+std::shared_ptr<HistoricalStateView> HistoricalStateView::shared(uint64_t view_id, uint64_t block_number) {
+    static lru_cache<uint64_t, std::shared_ptr<HistoricalStateView>> views{kMaxSharedViews, /*thread_safe=*/true};
+
+    // Views are replaced when database view changes: concurrent requests on the previous one just stop sharing
+    const auto view = views.get_as_copy(block_number);
+    if (view && (*view)->view_id() == view_id) {
+        return *view;
+    }
+    auto new_view = std::make_shared<HistoricalStateView>(view_id, block_number);
+    views.put(block_number, new_view);
+    return new_view;
+}
+
+std::optional<HistoricalStateView::HistoryValue> HistoricalStateView::find_account(const evmc::address& address) const {
+    std::scoped_lock lock{mutex_};
+    const auto it = accounts_.find(address);
+    if (it == accounts_.end()) {
+        return std::nullopt;
+    }
+    return it->second;
+}
+
+void HistoricalStateView::insert_account(const evmc::address& address, const HistoryValue& value) {
+    std::scoped_lock lock{mutex_};
+    accounts_.emplace(address, value);
+}
+
+std::optional<HistoricalStateView::HistoryValue> HistoricalStateView::find_storage(const evmc::address& address, uint64_t incarnation,
+                                                                                   const evmc::bytes32& location_hash) const {
+    const auto key{storage_key(address, incarnation, location_hash)};
+    std::scoped_lock lock{mutex_};
+    const auto it = storage_.find(key);
+    if (it == storage_.end()) {
+        return std::nullopt;
+    }
+    return it->second;
+}
+
+void HistoricalStateView::insert_storage(const evmc::address& address, uint64_t incarnation, const evmc::bytes32& location_hash,
+                                         const HistoryValue& value) {
+    auto key{storage_key(address, incarnation, location_hash)};
+    std::scoped_lock lock{mutex_};
+    storage_.emplace(std::move(key), value);
+}
+
+std::optional<std::optional<uint64_t>> HistoricalStateView::find_storage_change_block(const evmc::address& address,
+                                                                                      const evmc::bytes32& location_hash) const {
+    const auto key{storage_location_key(address, location_hash)};
+    std::scoped_lock lock{mutex_};
+    const auto it = storage_change_blocks_.find(key);
+    if (it == storage_change_blocks_.end()) {
+        return std::nullopt;
+    }
+    return it->second;
+}
+
+void HistoricalStateView::insert_storage_change_block(const evmc::address& address, const evmc::bytes32& location_hash,
+                                                      std::optional<uint64_t> change_block) {
+    auto key{storage_location_key(address, location_hash)};
+    std::scoped_lock lock{mutex_};
+    storage_change_blocks_.emplace(std::move(key), change_block);
+}
+
+std::size_t HistoricalStateView::size() const {
+    std::scoped_lock lock{mutex_};
+    return accounts_.size() + storage_.size() + storage_change_blocks_.size();
+}
+
+}  // namespace silkworm::rpc
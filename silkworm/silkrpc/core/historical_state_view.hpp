@@ -0,0 +1,84 @@
+/*
+   Copyright 2023 The Silkworm Authors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <unordered_map>
+
+#include <evmc/evmc.hpp>
+
+#include <silkworm/core/common/base.hpp>
+
+namespace silkworm::rpc {
+
+//! \brief Memoized historical state values resolved at one block number within one database view
+//! \details History lookups (i.e. history bitmap seek plus change set read) for the same accounts and storage locations
+//! are repeated many times when replaying old blocks. Resolved values are immutable within the same database view, so
+//! they can be shared by all the state readers at this height, even across concurrent requests. Thread-safe.
+class HistoricalStateView {
+  public:
+    //! Resolved history value: std::nullopt means no change after the block, i.e. current state must be used
+    using HistoryValue = std::optional<silkworm::Bytes>;
+
+    HistoricalStateView(uint64_t view_id, uint64_t block_number) : view_id_{view_id}, block_number_{block_number} {}
+
+    HistoricalStateView(const HistoricalStateView&) = delete;
+    HistoricalStateView& operator=(const HistoricalStateView&) = delete;
+
+    //! \brief Get the view at the specified height for the specified database view, shared among concurrent requests
+    //! \remarks Views are kept in a process-wide LRU cache holding at most one view for each height
+    static std::shared_ptr<HistoricalStateView> shared(uint64_t view_id, uint64_t block_number);
+
+    [[nodiscard]] uint64_t view_id() const { return view_id_; }
+    [[nodiscard]] uint64_t block_number() const { return block_number_; }
+
+    //! Memoized history value for the account, std::nullopt if not resolved yet
+    [[nodiscard]] std::optional<HistoryValue> find_account(const evmc::address& address) const;
+    void insert_account(const evmc::address& address, const HistoryValue& value);
+
+    //! Memoized history value for the storage location, std::nullopt if not resolved yet
+    [[nodiscard]] std::optional<HistoryValue> find_storage(const evmc::address& address, uint64_t incarnation,
+                                                           const evmc::bytes32& location_hash) const;
+    void insert_storage(const evmc::address& address, uint64_t incarnation, const evmc::bytes32& location_hash,
+                        const HistoryValue& value);
+
+    //! \brief Memoized change block decoded from the storage history bitmap, std::nullopt if not decoded yet
+    //! \details Storage history does not depend on incarnation, so this is reused when the value for another
+    //! incarnation of the same location is resolved
+    [[nodiscard]] std::optional<std::optional<uint64_t>> find_storage_change_block(const evmc::address& address,
+                                                                                   const evmc::bytes32& location_hash) const;
+    void insert_storage_change_block(const evmc::address& address, const evmc::bytes32& location_hash,
+                                     std::optional<uint64_t> change_block);
+
+    [[nodiscard]] std::size_t size() const;
+
+  private:
+    uint64_t view_id_;
+    uint64_t block_number_;
+
+    mutable std::mutex mutex_;
+    std::unordered_map<evmc::address, HistoryValue> accounts_;
+    std::map<silkworm::Bytes, HistoryValue> storage_;
+    std::map<silkworm::Bytes, std::optional<uint64_t>> storage_change_blocks_;
+};
+
+}  // namespace silkworm::rpc
@@ -0,0 +1,82 @@
+/*
+   Copyright 2023 The Silkworm Authors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#include "historical_state_view.hpp"
+
+#include <catch2/catch.hpp>
+
+namespace silkworm::rpc {
+
+using evmc::literals::operator""_address, evmc::literals::operator""_bytes32;
+
+static const evmc::address kAddress{0x8e4d1ea201b908ab5e1f5a1c3f9f1b4f6c1e9cf1_address};
+static const evmc::bytes32 kLocation{0x0000000000000000000000000000000000000000000000000000000000000001_bytes32};
+
+TEST_CASE("HistoricalStateView::find_account", "[silkrpc][core][historical_state_view]") {
+    HistoricalStateView view{1, 100};
+    CHECK(!view.find_account(kAddress));
+
+    view.insert_account(kAddress, std::nullopt);
+    const auto no_change{view.find_account(kAddress)};
+    REQUIRE(no_change);
+    CHECK(!*no_change);
+
+    HistoricalStateView other_view{1, 100};
+    other_view.insert_account(kAddress, silkworm::Bytes{0x01, 0x02});
+    const auto change{other_view.find_account(kAddress)};
+    REQUIRE(change);
+    CHECK(*change == silkworm::Bytes{0x01, 0x02});
+}
+
+TEST_CASE("HistoricalStateView::find_storage", "[silkrpc][core][historical_state_view]") {
+    HistoricalStateView view{1, 100};
+    CHECK(!view.find_storage(kAddress, 1, kLocation));
+
+    view.insert_storage(kAddress, 1, kLocation, silkworm::Bytes{0x03});
+    const auto value{view.find_storage(kAddress, 1, kLocation)};
+    REQUIRE(value);
+    CHECK(*value == silkworm::Bytes{0x03});
+    CHECK(!view.find_storage(kAddress, 2, kLocation));
+    CHECK(!view.find_storage(kAddress, 1, evmc::bytes32{}));
+
+    CHECK(!view.find_storage_change_block(kAddress, kLocation));
+    view.insert_storage_change_block(kAddress, kLocation, 120);
+    const auto change_block{view.find_storage_change_block(kAddress, kLocation)};
+    REQUIRE(change_block);
+    CHECK(*change_block == 120);
+    CHECK(view.size() == 2);
+}
+
+TEST_CASE("HistoricalStateView::shared", "[silkrpc][core][historical_state_view]") {
+    const auto view1{HistoricalStateView::shared(1, 1'000)};
+    CHECK(view1->view_id() == 1);
+    CHECK(view1->block_number() == 1'000);
+
+    SECTION("same database view and height") {
+        CHECK(HistoricalStateView::shared(1, 1'000) == view1);
+    }
+    SECTION("different height") {
+        CHECK(HistoricalStateView::shared(1, 1'001) != view1);
+    }
+    SECTION("different database view") {
+        const auto view2{HistoricalStateView::shared(2, 1'000)};
+        CHECK(view2 != view1);
+        CHECK(view2->view_id() == 2);
+        CHECK(HistoricalStateView::shared(2, 1'000) == view2);
+    }
+}
+
+}  // namespace silkworm::rpc
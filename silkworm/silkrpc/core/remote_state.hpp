@@ -17,8 +17,10 @@
 #pragma once
 
 #include <iostream>
+#include <memory>
 #include <optional>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include <silkworm/infra/concurrency/coroutine.hpp>
@@ -29,6 +31,7 @@
 
 #include <silkworm/core/common/util.hpp>
 #include <silkworm/core/state/state.hpp>
+#include <silkworm/silkrpc/core/historical_state_view.hpp>
 #include <silkworm/silkrpc/core/rawdb/accessors.hpp>
 #include <silkworm/silkrpc/core/state_reader.hpp>
 
@@ -36,8 +39,9 @@ namespace silkworm::rpc::state {
 
 class AsyncRemoteState {
   public:
-    explicit AsyncRemoteState(const core::rawdb::DatabaseReader& db_reader, uint64_t block_number)
-        : db_reader_(db_reader), block_number_(block_number), state_reader_{db_reader} {}
+    explicit AsyncRemoteState(const core::rawdb::DatabaseReader& db_reader, uint64_t block_number,
+                              std::shared_ptr<HistoricalStateView> historical_view = nullptr)
+        : db_reader_(db_reader), block_number_(block_number), state_reader_{db_reader, std::move(historical_view)} {}
 
     boost::asio::awaitable<std::optional<silkworm::Account>> read_account(const evmc::address& address) const noexcept;
 
@@ -69,8 +73,9 @@ class AsyncRemoteState {
 
 class RemoteState : public silkworm::State {
   public:
-    explicit RemoteState(boost::asio::any_io_executor& executor, const core::rawdb::DatabaseReader& db_reader, uint64_t block_number)
-        : executor_(executor), async_state_{db_reader, block_number} {}
+    explicit RemoteState(boost::asio::any_io_executor& executor, const core::rawdb::DatabaseReader& db_reader, uint64_t block_number,
+                         std::shared_ptr<HistoricalStateView> historical_view = nullptr)
+        : executor_(executor), async_state_{db_reader, block_number, std::move(historical_view)} {}
 
     std::optional<silkworm::Account> read_account(const evmc::address& address) const noexcept override;
 
@@ -79,6 +79,31 @@ boost::asio::awaitable<std::optional<silkworm::Bytes>> StateReader::read_code(co
 }
 
 boost::asio::awaitable<std::optional<silkworm::Bytes>> StateReader::read_historical_account(const evmc::address& address, uint64_t block_number) const {
+    if (!is_memoized(block_number)) {
+        co_return co_await lookup_historical_account(address, block_number);
+    }
+    if (auto value{historical_view_->find_account(address)}) {
+        co_return std::move(*value);
+    }
+    auto value{co_await lookup_historical_account(address, block_number)};
+    historical_view_->insert_account(address, value);
+    co_return value;
+}
+
+boost::asio::awaitable<std::optional<silkworm::Bytes>> StateReader::read_historical_storage(const evmc::address& address, uint64_t incarnation,
+                                                                                            const evmc::bytes32& location_hash, uint64_t block_number) const {
+    if (!is_memoized(block_number)) {
+        co_return co_await lookup_historical_storage(address, incarnation, location_hash, block_number);
+    }
+    if (auto value{historical_view_->find_storage(address, incarnation, location_hash)}) {
+        co_return std::move(*value);
+    }
+    auto value{co_await lookup_historical_storage(address, incarnation, location_hash, block_number)};
+    historical_view_->insert_storage(address, incarnation, location_hash, value);
+    co_return value;
+}
+
+boost::asio::awaitable<std::optional<silkworm::Bytes>> StateReader::lookup_historical_account(const evmc::address& address, uint64_t block_number) const {
     const auto account_history_key{silkworm::db::account_history_key(address, block_number)};
     SILK_DEBUG << "StateReader::read_historical_account account_history_key: " << account_history_key;
     const auto kv_pair{co_await db_reader_.get(db::table::kAccountHistoryName, account_history_key)};
@@ -111,26 +136,22 @@ boost::asio::awaitable<std::optional<silkworm::Bytes>> StateReader::read_histori
     co_return value;
 }
 
-boost::asio::awaitable<std::optional<silkworm::Bytes>> StateReader::read_historical_storage(const evmc::address& address, uint64_t incarnation,
-                                                                                            const evmc::bytes32& location_hash, uint64_t block_number) const {
-    const auto storage_history_key{silkworm::db::storage_history_key(address, location_hash, block_number)};
-    SILK_DEBUG << "StateReader::read_historical_storage storage_history_key: " << storage_history_key;
-    const auto kv_pair{co_await db_reader_.get(db::table::kStorageHistoryName, storage_history_key)};
-
-    const auto location_hash_view{full_view(location_hash)};
-    if (kv_pair.key.substr(0, silkworm::kAddressLength) != full_view(address) ||
-        kv_pair.key.substr(silkworm::kAddressLength, silkworm::kHashLength) != location_hash_view) {
-        co_return std::nullopt;
+boost::asio::awaitable<std::optional<silkworm::Bytes>> StateReader::lookup_historical_storage(const evmc::address& address, uint64_t incarnation,
+                                                                                              const evmc::bytes32& location_hash, uint64_t block_number) const {
+    std::optional<uint64_t> change_block;
+    if (!is_memoized(block_number)) {
+        change_block = co_await lookup_storage_change_block(address, location_hash, block_number);
+    } else if (const auto memoized_change_block{historical_view_->find_storage_change_block(address, location_hash)}) {
+        change_block = *memoized_change_block;
+    } else {
+        change_block = co_await lookup_storage_change_block(address, location_hash, block_number);
+        historical_view_->insert_storage_change_block(address, location_hash, change_block);
     }
-
-    const auto bitmap{silkworm::db::bitmap::parse(kv_pair.value)};
-    SILK_DEBUG << "StateReader::read_historical_storage bitmap: " << bitmap.toString();
-
-    const auto change_block{silkworm::db::bitmap::seek(bitmap, block_number)};
     if (!change_block) {
         co_return std::nullopt;
     }
 
+    const auto location_hash_view{full_view(location_hash)};
     const auto storage_change_key{silkworm::db::storage_change_key(*change_block, address, incarnation)};
     SILK_DEBUG << "StateReader::read_historical_storage storage_change_key: " << storage_change_key;
     const auto location_subkey{location_hash_view};
@@ -140,4 +161,22 @@ boost::asio::awaitable<std::optional<silkworm::Bytes>> StateReader::read_histori
 
     co_return value;
 }
+
+boost::asio::awaitable<std::optional<uint64_t>> StateReader::lookup_storage_change_block(const evmc::address& address, const evmc::bytes32& location_hash,
+                                                                                         uint64_t block_number) const {
+    const auto storage_history_key{silkworm::db::storage_history_key(address, location_hash, block_number)};
+    SILK_DEBUG << "StateReader::read_historical_storage storage_history_key: " << storage_history_key;
+    const auto kv_pair{co_await db_reader_.get(db::table::kStorageHistoryName, storage_history_key)};
+
+    if (kv_pair.key.substr(0, silkworm::kAddressLength) != full_view(address) ||
+        kv_pair.key.substr(silkworm::kAddressLength, silkworm::kHashLength) != full_view(location_hash)) {
+        co_return std::nullopt;
+    }
+
+    const auto bitmap{silkworm::db::bitmap::parse(kv_pair.value)};
+    SILK_DEBUG << "StateReader::read_historical_storage bitmap: " << bitmap.toString();
+
+    co_return silkworm::db::bitmap::seek(bitmap, block_number);
+}
+
 }  // namespace silkworm::rpc
@@ -16,7 +16,9 @@
 
 #pragma once
 
+#include <memory>
 #include <optional>
+#include <utility>
 
 #include <silkworm/infra/concurrency/coroutine.hpp>
 
@@ -26,6 +28,7 @@
 #include <silkworm/core/common/util.hpp>
 #include <silkworm/core/types/account.hpp>
 #include <silkworm/silkrpc/common/util.hpp>
+#include <silkworm/silkrpc/core/historical_state_view.hpp>
 #include <silkworm/silkrpc/core/rawdb/accessors.hpp>
 
 namespace silkworm::rpc {
@@ -36,6 +39,10 @@ class StateReader {
   public:
     explicit StateReader(const core::rawdb::DatabaseReader& db_reader) : db_reader_(db_reader) {}
 
+    //! Historical reads at the height of the specified view are memoized into it
+    StateReader(const core::rawdb::DatabaseReader& db_reader, std::shared_ptr<HistoricalStateView> historical_view)
+        : db_reader_(db_reader), historical_view_(std::move(historical_view)) {}
+
     StateReader(const StateReader&) = delete;
     StateReader& operator=(const StateReader&) = delete;
 
@@ -52,7 +59,20 @@ class StateReader {
                                                                                     const evmc::bytes32& location_hash, uint64_t block_number) const;
 
   private:
+    [[nodiscard]] bool is_memoized(uint64_t block_number) const {
+        return historical_view_ && historical_view_->block_number() == block_number;
+    }
+
+    [[nodiscard]] awaitable<std::optional<silkworm::Bytes>> lookup_historical_account(const evmc::address& address, uint64_t block_number) const;
+
+    [[nodiscard]] awaitable<std::optional<silkworm::Bytes>> lookup_historical_storage(const evmc::address& address, uint64_t incarnation,
+                                                                                      const evmc::bytes32& location_hash, uint64_t block_number) const;
+
+    [[nodiscard]] awaitable<std::optional<uint64_t>> lookup_storage_change_block(const evmc::address& address, const evmc::bytes32& location_hash,
+                                                                                 uint64_t block_number) const;
+
     const core::rawdb::DatabaseReader& db_reader_;
+    std::shared_ptr<HistoricalStateView> historical_view_;
 };
 
 }  // namespace silkworm::rpc
@@ -216,6 +216,42 @@ TEST_CASE_METHOD(StateReaderTest, "StateReader::read_code") {
         }
     }
 }
+TEST_CASE_METHOD(StateReaderTest, "StateReader::read_historical_account memoized") {
+    StateReader memoizing_reader{database_reader_, std::make_shared<HistoricalStateView>(1, core::kEarliestBlockNumber)};
+
+    // Set the call expectations: history is looked up just once
+    // 1. DatabaseReader::get call on kAccountHistory returns the account bitmap
+    EXPECT_CALL(database_reader_, get(db::table::kAccountHistoryName, _)).WillOnce(InvokeWithoutArgs([]() -> boost::asio::awaitable<KeyValue> {
+        co_return KeyValue{silkworm::Bytes{full_view(kZeroAddress)}, kEncodedAccountHistory};
+    }));
+    // 2. DatabaseReader::get_both_range call on kPlainAccountChangeSet returns the account data
+    EXPECT_CALL(database_reader_, get_both_range(db::table::kAccountChangeSetName, _, _)).WillOnce(InvokeWithoutArgs([]() -> boost::asio::awaitable<std::optional<silkworm::Bytes>> { co_return kEncodedAccount; }));
+
+    // Execute the test: calling read_historical_account twice should return the same value
+    const auto value1{spawn_and_wait(memoizing_reader.read_historical_account(kZeroAddress, core::kEarliestBlockNumber))};
+    const auto value2{spawn_and_wait(memoizing_reader.read_historical_account(kZeroAddress, core::kEarliestBlockNumber))};
+    CHECK(value1 == kEncodedAccount);
+    CHECK(value2 == kEncodedAccount);
+}
+
+TEST_CASE_METHOD(StateReaderTest, "StateReader::read_historical_storage memoized") {
+    StateReader memoizing_reader{database_reader_, std::make_shared<HistoricalStateView>(1, core::kEarliestBlockNumber)};
+
+    // Set the call expectations: history bitmap is decoded just once, change set is read once per incarnation
+    // 1. DatabaseReader::get call on kStorageHistory returns the storage bitmap
+    EXPECT_CALL(database_reader_, get(db::table::kStorageHistoryName, _)).WillOnce(InvokeWithoutArgs([]() -> boost::asio::awaitable<KeyValue> {
+        co_return KeyValue{
+            silkworm::db::storage_history_key(kZeroAddress, kLocationHash, core::kEarliestBlockNumber),
+            kEncodedStorageHistory};
+    }));
+    // 2. DatabaseReader::get_both_range call on kPlainAccountChangeSet the storage location value
+    EXPECT_CALL(database_reader_, get_both_range(db::table::kStorageChangeSetName, _, _)).Times(2).WillRepeatedly(InvokeWithoutArgs([]() -> boost::asio::awaitable<std::optional<silkworm::Bytes>> { co_return kStorageLocation; }));
+
+    // Execute the test: calling read_historical_storage again should return the same value
+    CHECK(spawn_and_wait(memoizing_reader.read_historical_storage(kZeroAddress, 0, kLocationHash, core::kEarliestBlockNumber)) == kStorageLocation);
+    CHECK(spawn_and_wait(memoizing_reader.read_historical_storage(kZeroAddress, 0, kLocationHash, core::kEarliestBlockNumber)) == kStorageLocation);
+    CHECK(spawn_and_wait(memoizing_reader.read_historical_storage(kZeroAddress, 1, kLocationHash, core::kEarliestBlockNumber)) == kStorageLocation);
+}
 #endif  // SILKWORM_SANITIZE
 
 }  // namespace silkworm::rpc
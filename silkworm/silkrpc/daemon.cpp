@@ -31,6 +31,7 @@
 #include <silkworm/infra/common/log.hpp>
 #include <silkworm/infra/concurrency/private_service.hpp>
 #include <silkworm/infra/concurrency/shared_service.hpp>
+#include <silkworm/silkrpc/common/timestamp_index.hpp>
 #include <silkworm/silkrpc/ethbackend/remote_backend.hpp>
 #include <silkworm/silkrpc/ethdb/file/local_database.hpp>
 #include <silkworm/silkrpc/ethdb/kv/remote_database.hpp>
@@ -44,6 +45,9 @@ constexpr auto kRpcMaxReceiveMessageSize{64 * 1024 * 1024};  // 64 MiB
 //! The path to 'chaindata' folder relative to Silkworm data directory.
 static constexpr const char kChaindataRelativePath[]{"/chaindata"};
 
+//! The path to 'snapshots' folder relative to Silkworm data directory.
+static constexpr const char kSnapshotsRelativePath[]{"/snapshots"};
+
 //! The maximum number of concurrent readers allowed for MDBX datastore.
 static constexpr const int kDatabaseMaxReaders{32000};
 
@@ -197,6 +201,15 @@ Daemon::Daemon(DaemonSettings settings, std::shared_ptr<mdbx::env_managed> chain
             .shared = true,
             .max_readers = kDatabaseMaxReaders};
         *chaindata_env_ = silkworm::db::open_env(db_config);
+
+        // Activate the local snapshot access (if available) to serve block data not present in chaindata
+        const std::filesystem::path snapshots_path{settings_.datadir->string() + kSnapshotsRelativePath};
+        if (std::filesystem::exists(snapshots_path)) {
+            snapshot_repository_ = std::make_unique<snapshot::SnapshotRepository>(snapshot::SnapshotSettings{
+                .repository_dir = snapshots_path,
+                .no_downloader = true});
+            snapshot_repository_->reopen_folder();
+        }
     } else if (chaindata_env) {
         // Use the existing chaindata environment
         chaindata_env_ = std::move(chaindata_env);
@@ -222,7 +235,7 @@ void Daemon::add_private_services() {
 
         std::unique_ptr<ethdb::Database> database;
         if (chaindata_env_) {
-            database = std::make_unique<ethdb::file::LocalDatabase>(chaindata_env_);
+            database = std::make_unique<ethdb::file::LocalDatabase>(chaindata_env_, snapshot_repository_.get());
         } else {
             database = std::make_unique<ethdb::kv::RemoteDatabase>(grpc_context, grpc_channel);
         }
@@ -242,6 +255,8 @@ void Daemon::add_shared_services() {
     auto block_cache = std::make_shared<BlockCache>();
     // Create the unique state cache to be shared among the execution contexts
     auto state_cache = std::make_shared<ethdb::kv::CoherentStateCache>();
+    // Create the unique block timestamp index to be shared among the execution contexts
+    auto timestamp_index = std::make_shared<TimestampIndex>();
     // Create the unique filter storage to be shared among the execution contexts
     auto filter_storage = std::make_shared<FilterStorage>(context_pool_.num_contexts() * kDefaultFilterStorageSize);
 
@@ -252,6 +267,7 @@ void Daemon::add_shared_services() {
         add_shared_service(io_context, block_cache);
         add_shared_service<ethdb::kv::StateCache>(io_context, state_cache);
         add_shared_service(io_context, filter_storage);
+        add_shared_service(io_context, timestamp_index);
     }
 }
 
@@ -25,6 +25,7 @@
 #include <silkworm/infra/common/log.hpp>
 #include <silkworm/infra/grpc/client/client_context_pool.hpp>
 #include <silkworm/infra/grpc/common/version.hpp>
+#include <silkworm/node/snapshot/repository.hpp>
 #include <silkworm/silkrpc/common/constants.hpp>
 #include <silkworm/silkrpc/ethdb/kv/state_changes_stream.hpp>
 #include <silkworm/silkrpc/http/server.hpp>
@@ -84,6 +85,9 @@ class Daemon {
     //! The chaindata MDBX environment or \code nullptr if working remotely
     std::shared_ptr<mdbx::env_managed> chaindata_env_;
 
+    //! The snapshot repository or \code nullptr if working remotely or snapshots are not available
+    std::unique_ptr<snapshot::SnapshotRepository> snapshot_repository_;
+
     //! The JSON RPC API services.
     std::vector<std::unique_ptr<http::Server>> rpc_services_;
 
@@ -0,0 +1,166 @@
+/*
+   Copyright 2023 The Silkworm Authors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#include "bloom_bits.hpp"
+
+#include <algorithm>
+#include <array>
+#include <map>
+#include <optional>
+#include <vector>
+
+#include <gsl/narrow>
+
+#include <silkworm/core/types/bloom.hpp>
+#include <silkworm/infra/common/log.hpp>
+#include <silkworm/node/db/tables.hpp>
+#include <silkworm/node/db/util.hpp>
+
+namespace silkworm::rpc::ethdb::bloom_bits {
+
+//! Length in bytes of one section row in BloomBits
+static constexpr size_t kRowLength{db::kBloomBitsSectionSize / 8};
+
+using Row = std::array<uint8_t, kRowLength>;
+
+//! Groups of values to be AND-ed, values in each group are OR-ed and each value is the AND of its 3 bloom bits
+using Criteria = std::vector<std::vector<std::array<uint16_t, 3>>>;
+
+static Criteria make_criteria(const FilterAddresses& addresses, const FilterTopics& topics) {
+    Criteria criteria;
+    if (!addresses.empty()) {
+        auto& group = criteria.emplace_back();
+        for (const auto& address : addresses) {
+            group.push_back(m3_2048_bits(ByteView{address.bytes, kAddressLength}));
+        }
+    }
+    for (const auto& subtopics : topics) {
+        if (subtopics.empty()) {
+            continue;  // empty rule set == wildcard
+        }
+        auto& group = criteria.emplace_back();
+        for (const auto& topic : subtopics) {
+            group.push_back(m3_2048_bits(ByteView{topic.bytes, kHashLength}));
+        }
+    }
+    return criteria;
+}
+
+static awaitable<Row> read_row(const core::rawdb::DatabaseReader& db_reader, uint16_t bit, uint64_t section,
+                               std::map<uint16_t, Row>& section_rows) {
+    if (const auto it{section_rows.find(bit)}; it != section_rows.end()) {
+        co_return it->second;
+    }
+    const auto value{co_await db_reader.get_one(db::table::kBloomBitsName, db::bloom_bits_key(bit, section))};
+    Row row{};  // all-zero rows are not stored
+    if (!value.empty()) {
+        if (const auto decompressed{db::decompress_bloom_bits_row(value, kRowLength)}) {
+            std::copy(decompressed->cbegin(), decompressed->cend(), row.begin());
+        } else {
+            SILK_WARN << "invalid BloomBits row size: " << value.size() << " bit: " << bit << " section: " << section;
+            row.fill(0xFF);  // keep all blocks as candidates
+        }
+    }
+    section_rows.emplace(bit, row);
+    co_return row;
+}
+
+//! Whether the section has been indexed on the current canonical chain, i.e. its stored head is the canonical one
+static awaitable<bool> is_canonical_section(const core::rawdb::DatabaseReader& db_reader, uint64_t section) {
+    const auto section_head{co_await db_reader.get_one(db::table::kBloomBitsIndexName, db::block_key(section))};
+    if (section_head.size() != kHashLength) {
+        co_return false;
+    }
+    const uint64_t head_block_number{(section + 1) * db::kBloomBitsSectionSize - 1};
+    const auto canonical_head{co_await db_reader.get_one(db::table::kCanonicalHashesName, db::block_key(head_block_number))};
+    if (canonical_head != section_head) {
+        SILK_DEBUG << "bloom_bits::match section: " << section << " not on the canonical chain";
+        co_return false;
+    }
+    co_return true;
+}
+
+//! Row of the candidate blocks in the section or std::nullopt if the section cannot be matched by its bloom bits
+static awaitable<std::optional<Row>> match_section(const core::rawdb::DatabaseReader& db_reader, const Criteria& criteria,
+                                                   uint64_t section) {
+    if (!co_await is_canonical_section(db_reader, section)) {
+        co_return std::nullopt;
+    }
+    std::map<uint16_t, Row> section_rows;
+    Row section_row;
+    section_row.fill(0xFF);
+    for (const auto& group : criteria) {
+        Row group_row{};
+        for (const auto& bits : group) {
+            Row value_row;
+            value_row.fill(0xFF);
+            for (const auto bit : bits) {
+                const auto row{co_await read_row(db_reader, bit, section, section_rows)};
+                for (size_t i{0}; i < kRowLength; ++i) {
+                    value_row[i] &= row[i];
+                }
+            }
+            for (size_t i{0}; i < kRowLength; ++i) {
+                group_row[i] |= value_row[i];
+            }
+        }
+        for (size_t i{0}; i < kRowLength; ++i) {
+            section_row[i] &= group_row[i];
+        }
+    }
+    co_return section_row;
+}
+
+bool has_criteria(const FilterAddresses& addresses, const FilterTopics& topics) {
+    return !addresses.empty() || std::any_of(topics.cbegin(), topics.cend(), [](const auto& subtopics) { return !subtopics.empty(); });
+}
+
+awaitable<Match> match(const core::rawdb::DatabaseReader& db_reader, const FilterAddresses& addresses,
+                       const FilterTopics& topics, uint64_t start, uint64_t end) {
+    SILK_DEBUG << "bloom_bits::match #addresses: " << addresses.size() << " #topics: " << topics.size() << " start: " << start << " end: " << end;
+    Match result{{}, start};
+    const auto criteria{make_criteria(addresses, topics)};
+    for (uint64_t section{start / db::kBloomBitsSectionSize}; section <= end / db::kBloomBitsSectionSize; ++section) {
+        std::optional<Row> section_row;
+        try {
+            section_row = co_await match_section(db_reader, criteria, section);
+        } catch (const std::exception& e) {
+            // e.g. remote KV serving a database where these tables are not populated
+            SILK_WARN << "bloom_bits::match section: " << section << " lookup failed: " << e.what();
+        }
+        if (!section_row) {
+            break;
+        }
+
+        const uint64_t first_block{section * db::kBloomBitsSectionSize};
+        for (size_t i{0}; i < kRowLength; ++i) {
+            if (!(*section_row)[i]) {
+                continue;
+            }
+            for (unsigned j{0}; j < 8; ++j) {
+                const uint64_t block_number{first_block + i * 8 + j};
+                if (((*section_row)[i] & (0x80u >> j)) && block_number >= start && block_number <= end) {
+                    result.block_numbers.add(gsl::narrow<uint32_t>(block_number));
+                }
+            }
+        }
+        result.next_block = first_block + db::kBloomBitsSectionSize;
+    }
+    SILK_DEBUG << "bloom_bits::match #candidates: " << result.block_numbers.cardinality() << " next_block: " << result.next_block;
+    co_return result;
+}
+
+}  // namespace silkworm::rpc::ethdb::bloom_bits
@@ -0,0 +1,53 @@
+/*
+   Copyright 2023 The Silkworm Authors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#pragma once
+
+#include <cstdint>
+
+#include <silkworm/infra/concurrency/coroutine.hpp>
+
+#include <boost/asio/awaitable.hpp>
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wold-style-cast"
+#pragma GCC diagnostic ignored "-Wconversion"
+#pragma GCC diagnostic ignored "-Wsign-conversion"
+#include <roaring/roaring.hh>
+#pragma GCC diagnostic pop
+
+#include <silkworm/silkrpc/core/rawdb/accessors.hpp>
+#include <silkworm/silkrpc/types/filter.hpp>
+
+namespace silkworm::rpc::ethdb::bloom_bits {
+
+using boost::asio::awaitable;
+
+//! Candidate blocks selected by the BloomBits index
+struct Match {
+    roaring::Roaring block_numbers;  // Superset of the blocks with some matching log within the indexed sections
+    uint64_t next_block{0};          // First block not covered by the indexed sections
+};
+
+//! Whether the filter criteria can narrow the candidate blocks, i.e. some address or topic is specified
+bool has_criteria(const FilterAddresses& addresses, const FilterTopics& topics);
+
+//! Match the blocks in [start, end] whose logs bloom may contain any of the addresses and, for each topic position,
+//! any of the topics. Sections are matched in order up to the first one not indexed yet, indexed on a non-canonical
+//! chain or whose lookup fails: blocks from there on are left to the caller
+awaitable<Match> match(const core::rawdb::DatabaseReader& db_reader, const FilterAddresses& addresses,
+                       const FilterTopics& topics, uint64_t start, uint64_t end);
+
+}  // namespace silkworm::rpc::ethdb::bloom_bits
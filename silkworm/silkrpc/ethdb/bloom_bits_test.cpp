@@ -0,0 +1,162 @@
+/*
+   Copyright 2023 The Silkworm Authors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#include "bloom_bits.hpp"
+
+#include <map>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <boost/asio/co_spawn.hpp>
+#include <boost/asio/thread_pool.hpp>
+#include <boost/asio/use_future.hpp>
+#include <catch2/catch.hpp>
+#include <gmock/gmock.h>
+
+#include <silkworm/core/types/bloom.hpp>
+#include <silkworm/node/db/tables.hpp>
+#include <silkworm/node/db/util.hpp>
+#include <silkworm/silkrpc/test/mock_database_reader.hpp>
+
+namespace silkworm::rpc::ethdb::bloom_bits {
+
+using testing::_;
+using testing::Invoke;
+using evmc::literals::operator""_address;
+using evmc::literals::operator""_bytes32;
+
+//! BloomBits tables in memory, rows are built setting the bloom bits of the given values in the given blocks and
+//! served compressed as stored by the BloomBits stage
+class BloomBitsTables {
+  public:
+    void add_section(uint64_t section) {
+        data_[{db::table::kBloomBitsIndexName, db::block_key(section)}] = Bytes(kHashLength, 0x01);
+        set_canonical_head(section, Bytes(kHashLength, 0x01));
+    }
+
+    void set_canonical_head(uint64_t section, const Bytes& head_hash) {
+        const uint64_t head_block_number{(section + 1) * db::kBloomBitsSectionSize - 1};
+        data_[{db::table::kCanonicalHashesName, db::block_key(head_block_number)}] = head_hash;
+    }
+
+    void add_value(ByteView value, uint64_t block_number) {
+        const uint64_t section{block_number / db::kBloomBitsSectionSize};
+        const uint64_t index{block_number % db::kBloomBitsSectionSize};
+        for (const auto bit : m3_2048_bits(value)) {
+            auto& row{data_[{db::table::kBloomBitsName, db::bloom_bits_key(bit, section)}]};
+            row.resize(db::kBloomBitsSectionSize / 8);
+            row[index / 8] |= static_cast<uint8_t>(0x80u >> (index % 8));
+        }
+    }
+
+    boost::asio::awaitable<Bytes> get_one(const std::string& table, ByteView key) const {
+        const auto it{data_.find({table, Bytes{key}})};
+        if (it == data_.end()) {
+            co_return Bytes{};
+        }
+        co_return table == db::table::kBloomBitsName ? db::compress_bloom_bits_row(it->second) : it->second;
+    }
+
+  private:
+    std::map<std::pair<std::string, Bytes>, Bytes> data_;
+};
+
+TEST_CASE("bloom_bits::has_criteria", "[silkrpc][ethdb][bloom_bits]") {
+    CHECK(!has_criteria({}, {}));
+    CHECK(!has_criteria({}, {{}, {}}));
+    CHECK(has_criteria({0x22341ae42d6dd7384bc8584e50419ea3ac75b83f_address}, {}));
+    CHECK(has_criteria({}, {{}, {0x04491edcd115127caedbd478e2e7895ed80c7847e903431f94f9cfa579cad47f_bytes32}}));
+}
+
+TEST_CASE("bloom_bits::match", "[silkrpc][ethdb][bloom_bits]") {
+    const auto address_a{0x22341ae42d6dd7384bc8584e50419ea3ac75b83f_address};
+    const auto address_b{0xe7fb22dfef11920312e4989a3a2b81e2ebf05986_address};
+    const auto topic_a{0x04491edcd115127caedbd478e2e7895ed80c7847e903431f94f9cfa579cad47f_bytes32};
+    const auto topic_b{0x7f1fef85c4b037150d3675218e0cdb7cf38fea354759471e309f3354918a442f_bytes32};
+
+    // Section 0 is indexed: address A with topic A in block 5, address B with topic B in block 7
+    BloomBitsTables tables;
+    tables.add_section(0);
+    tables.add_value(ByteView{address_a.bytes, kAddressLength}, 5);
+    tables.add_value(ByteView{topic_a.bytes, kHashLength}, 5);
+    tables.add_value(ByteView{address_b.bytes, kAddressLength}, 7);
+    tables.add_value(ByteView{topic_b.bytes, kHashLength}, 7);
+
+    boost::asio::thread_pool pool{1};
+    test::MockDatabaseReader db_reader;
+    EXPECT_CALL(db_reader, get_one(_, _)).WillRepeatedly(Invoke([&](const std::string& table, ByteView key) {
+        return tables.get_one(table, key);
+    }));
+
+    const auto run_match = [&](const FilterAddresses& addresses, const FilterTopics& topics, uint64_t start, uint64_t end) {
+        return boost::asio::co_spawn(pool, match(db_reader, addresses, topics, start, end), boost::asio::use_future).get();
+    };
+
+    SECTION("single address") {
+        const auto result{run_match({address_a}, {}, 0, 10'000)};
+        CHECK(result.block_numbers == roaring::Roaring::bitmapOf(1, 5));
+        CHECK(result.next_block == db::kBloomBitsSectionSize);
+    }
+
+    SECTION("any address") {
+        const auto result{run_match({address_a, address_b}, {}, 0, 10'000)};
+        CHECK(result.block_numbers == roaring::Roaring::bitmapOf(2, 5, 7));
+    }
+
+    SECTION("address and topic") {
+        CHECK(run_match({address_a}, {{topic_a}}, 0, 10'000).block_numbers == roaring::Roaring::bitmapOf(1, 5));
+        CHECK(run_match({address_a}, {{topic_b}}, 0, 10'000).block_numbers.isEmpty());
+        CHECK(run_match({}, {{}, {topic_b}}, 0, 10'000).block_numbers == roaring::Roaring::bitmapOf(1, 7));
+    }
+
+    SECTION("range bounds") {
+        CHECK(run_match({address_a, address_b}, {}, 6, 10).block_numbers == roaring::Roaring::bitmapOf(1, 7));
+        CHECK(run_match({address_a, address_b}, {}, 0, 6).block_numbers == roaring::Roaring::bitmapOf(1, 5));
+    }
+
+    SECTION("not indexed section") {
+        const auto result{run_match({address_a}, {}, db::kBloomBitsSectionSize + 1, 10'000)};
+        CHECK(result.block_numbers.isEmpty());
+        CHECK(result.next_block == db::kBloomBitsSectionSize + 1);
+    }
+
+    SECTION("section indexed on a non-canonical chain") {
+        tables.set_canonical_head(0, Bytes(kHashLength, 0x02));
+        const auto result{run_match({address_a}, {}, 0, 10'000)};
+        CHECK(result.block_numbers.isEmpty());
+        CHECK(result.next_block == 0);
+    }
+}
+
+TEST_CASE("bloom_bits::match falls back when lookup fails", "[silkrpc][ethdb][bloom_bits]") {
+    const auto address{0x22341ae42d6dd7384bc8584e50419ea3ac75b83f_address};
+
+    boost::asio::thread_pool pool{1};
+    test::MockDatabaseReader db_reader;
+    EXPECT_CALL(db_reader, get_one(db::table::kBloomBitsIndexName, _))
+        .WillOnce(Invoke([](const std::string&, ByteView) -> boost::asio::awaitable<Bytes> {
+            throw std::runtime_error{"unknown table BloomBitsIndex"};
+            co_return Bytes{};
+        }));
+
+    const auto result{boost::asio::co_spawn(pool, match(db_reader, {address}, {}, 10, 10'000), boost::asio::use_future).get()};
+    CHECK(result.block_numbers.isEmpty());
+    CHECK(result.next_block == 10);
+}
+
+}  // namespace silkworm::rpc::ethdb::bloom_bits
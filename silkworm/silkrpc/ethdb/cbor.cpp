@@ -41,8 +41,8 @@ class LogCborListener : public cbor::listener {
     };
 
   public:
-    explicit LogCborListener(std::vector<Log>& logs)
-        : state_(ProcessingState::kWaitNLogs), logs_(logs), current_log_{} {}
+    explicit LogCborListener(std::vector<Log>& logs, const LogFilter* filter = nullptr)
+        : state_(ProcessingState::kWaitNLogs), logs_(logs), filter_(filter), current_log_{} {}
 
     void on_integer(int) override {
         throw std::invalid_argument("Log CBOR: unexpected format(on_integer)");
@@ -112,11 +112,12 @@ class LogCborListener : public cbor::listener {
                 state_ = ProcessingState::kWaitData;
             }
         } else if (state_ == ProcessingState::kWaitData) {
-            current_log_.data.resize(static_cast<std::vector<evmc::bytes32>::size_type>(size));
-            std::memcpy(current_log_.data.data(), data, static_cast<size_t>(size));
-            logs_.emplace_back(std::move(current_log_));
-            current_log_.topics.clear();
-            state_ = ProcessingState::kWaitNFields;
+            if (accept_current_log()) {
+                current_log_.data.resize(static_cast<std::vector<evmc::bytes32>::size_type>(size));
+                std::memcpy(current_log_.data.data(), data, static_cast<size_t>(size));
+                logs_.emplace_back(std::move(current_log_));
+            }
+            start_next_log();
         } else {
             throw std::invalid_argument("Log CBOR: unexpected format(on_bytes bad state)");
         }
@@ -150,21 +151,38 @@ class LogCborListener : public cbor::listener {
     }
 
     void on_null() override {
-        current_log_.data = silkworm::Bytes{};
-        logs_.emplace_back(std::move(current_log_));
-        current_log_.topics.clear();
-        state_ = ProcessingState::kWaitNFields;
+        if (accept_current_log()) {
+            current_log_.data = silkworm::Bytes{};
+            logs_.emplace_back(std::move(current_log_));
+        }
+        start_next_log();
     }
 
-    bool success() {
-        return std::cmp_equal(logs_.size(), num_logs_);
+    bool success() const {
+        return std::cmp_equal(num_decoded_logs_, num_logs_);
     }
 
+    std::size_t num_decoded_logs() const { return num_decoded_logs_; }
+
   private:
+    bool accept_current_log() {
+        current_log_.index = static_cast<uint32_t>(num_decoded_logs_);
+        return filter_ == nullptr || (*filter_)(current_log_);
+    }
+
+    void start_next_log() {
+        ++num_decoded_logs_;
+        current_log_.topics.clear();
+        current_log_.data.clear();
+        state_ = ProcessingState::kWaitNFields;
+    }
+
     ProcessingState state_;
     int num_logs_{0};
     int num_topics_{0};
+    std::size_t num_decoded_logs_{0};
     std::vector<Log>& logs_;
+    const LogFilter* filter_;
 
     Log current_log_;
     int current_topic_{0};
@@ -186,6 +204,23 @@ bool cbor_decode(const silkworm::Bytes& bytes, std::vector<Log>& logs) {
     return decode_success;
 }
 
+std::optional<std::size_t> cbor_decode(const silkworm::Bytes& bytes, std::vector<Log>& logs, const LogFilter& filter) {
+    if (bytes.empty()) {
+        return std::nullopt;
+    }
+    // The decoder reads directly from the input bytes and the filter avoids copying data of the rejected logs
+    const void* data = static_cast<const void*>(bytes.data());
+    cbor::input input(const_cast<void*>(data), static_cast<int>(bytes.size()));
+    LogCborListener listener(logs, &filter);
+    cbor::decoder decoder(input, listener);
+    decoder.run();
+    if (!listener.success()) {
+        SILK_ERROR << "cbor_decode<std::vector<Log>> unexpected cbor: wrong number of logs";
+        return std::nullopt;
+    }
+    return listener.num_decoded_logs();
+}
+
 bool cbor_decode(const silkworm::Bytes& bytes, std::vector<Receipt>& receipts) {
     if (bytes.empty()) {
         return false;
@@ -16,6 +16,9 @@
 
 #pragma once
 
+#include <cstddef>
+#include <functional>
+#include <optional>
 #include <vector>
 
 #include <silkworm/core/common/util.hpp>
@@ -26,6 +29,13 @@ namespace silkworm::rpc {
 
 [[nodiscard]] bool cbor_decode(const silkworm::Bytes& bytes, std::vector<Log>& logs);
 
+//! Predicate on address and topics of one log, applied before its data gets copied
+using LogFilter = std::function<bool(const Log&)>;
+
+//! Decode the logs accepted by the filter appending them to logs, each with index set to its position in the chunk.
+//! Return the number of logs in the chunk (either accepted or not) or std::nullopt if decoding fails
+[[nodiscard]] std::optional<std::size_t> cbor_decode(const silkworm::Bytes& bytes, std::vector<Log>& logs, const LogFilter& filter);
+
 [[nodiscard]] bool cbor_decode(const silkworm::Bytes& bytes, std::vector<Receipt>& receipts);
 
 }  // namespace silkworm::rpc
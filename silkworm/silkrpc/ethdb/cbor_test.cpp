@@ -112,6 +112,45 @@ TEST_CASE("decode logs from CBOR 4", "[silkrpc][ethdb][cbor]") {
     CHECK(silkworm::to_hex(logs[0].data) == "000000000000000000000000000000000000000000084595161401484a000000");
 }
 
+TEST_CASE("decode logs with filter", "[silkrpc][ethdb][cbor]") {
+    test_util::SetLogVerbosityGuard log_guard{log::Level::kNone};
+    const auto bytes = *silkworm::from_hex(
+        "82"
+        "83540715a7794a1dc8e42615f059dd6e406a6594651a80f6"
+        "8354007fb8417eb9ad4d958b050fc3720d5b46a2c053805000110011001100110011001100110011");
+    Logs logs{};
+
+    SECTION("accept all") {
+        const auto num_logs = cbor_decode(bytes, logs, [](const Log&) { return true; });
+        CHECK(num_logs == 2u);
+        CHECK(logs.size() == 2);
+        CHECK(logs[0].index == 0);
+        CHECK(logs[1].index == 1);
+        CHECK(logs[1].data == *silkworm::from_hex("00110011001100110011001100110011"));
+    }
+
+    SECTION("accept by address") {
+        const auto num_logs = cbor_decode(bytes, logs, [](const Log& log) {
+            return log.address == 0x007fb8417eb9ad4d958b050fc3720d5b46a2c053_address;
+        });
+        CHECK(num_logs == 2u);
+        CHECK(logs.size() == 1);
+        CHECK(logs[0].address == 0x007fb8417eb9ad4d958b050fc3720d5b46a2c053_address);
+        CHECK(logs[0].index == 1);
+        CHECK(logs[0].data == *silkworm::from_hex("00110011001100110011001100110011"));
+    }
+
+    SECTION("reject all") {
+        const auto num_logs = cbor_decode(bytes, logs, [](const Log&) { return false; });
+        CHECK(num_logs == 2u);
+        CHECK(logs.empty());
+    }
+
+    SECTION("incorrect bytes") {
+        CHECK(!cbor_decode(*silkworm::from_hex("81"), logs, [](const Log&) { return true; }));
+    }
+}
+
 TEST_CASE("decode logs from incorrect bytes", "[silkrpc][ethdb][cbor]") {
     test_util::SetLogVerbosityGuard log_guard{log::Level::kNone};
     Logs logs{};
@@ -21,6 +21,7 @@
 #include <utility>
 
 #include <silkworm/node/db/mdbx.hpp>
+#include <silkworm/node/snapshot/repository.hpp>
 #include <silkworm/silkrpc/ethdb/database.hpp>
 #include <silkworm/silkrpc/ethdb/transaction.hpp>
 
@@ -28,7 +29,8 @@ namespace silkworm::rpc::ethdb::file {
 
 class LocalDatabase : public Database {
   public:
-    explicit LocalDatabase(std::shared_ptr<mdbx::env_managed> chaindata_env);
+    explicit LocalDatabase(std::shared_ptr<mdbx::env_managed> chaindata_env,
+                           const snapshot::SnapshotRepository* snapshot_repository = nullptr);
 
     ~LocalDatabase() override;
 
@@ -39,6 +41,7 @@ class LocalDatabase : public Database {
 
   private:
     std::shared_ptr<mdbx::env_managed> chaindata_env_;
+    const snapshot::SnapshotRepository* snapshot_repository_;
 };
 
 }  // namespace silkworm::rpc::ethdb::file
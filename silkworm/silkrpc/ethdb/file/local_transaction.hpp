@@ -27,6 +27,7 @@
 #include <boost/asio/awaitable.hpp>
 
 #include <silkworm/node/db/mdbx.hpp>
+#include <silkworm/node/snapshot/repository.hpp>
 #include <silkworm/silkrpc/ethdb/cursor.hpp>
 #include <silkworm/silkrpc/ethdb/file/local_cursor.hpp>
 #include <silkworm/silkrpc/ethdb/kv/cached_database.hpp>
@@ -36,8 +37,13 @@ namespace silkworm::rpc::ethdb::file {
 
 class LocalTransaction : public Transaction {
   public:
-    explicit LocalTransaction(std::shared_ptr<mdbx::env_managed> chaindata_env)
-        : chaindata_env_{std::move(chaindata_env)}, last_cursor_id_{0}, txn_{*chaindata_env_} {}
+    explicit LocalTransaction(std::shared_ptr<mdbx::env_managed> chaindata_env,
+                              const snapshot::SnapshotRepository* snapshot_repository = nullptr)
+        : chaindata_env_{std::move(chaindata_env)}, last_cursor_id_{0}, txn_{*chaindata_env_} {
+        if (snapshot_repository) {
+            snapshot_reader_ = std::make_unique<SnapshotReader>(*snapshot_repository);
+        }
+    }
 
     ~LocalTransaction() override = default;
 
@@ -53,6 +59,8 @@ class LocalTransaction : public Transaction {
 
     std::shared_ptr<node::ChainStorage> create_storage(const DatabaseReader& db_reader, ethbackend::BackEnd* backend) override;
 
+    [[nodiscard]] const SnapshotReader* snapshot_reader() const override { return snapshot_reader_.get(); }
+
     boost::asio::awaitable<void> close() override;
 
   private:
@@ -64,6 +72,7 @@ class LocalTransaction : public Transaction {
     std::shared_ptr<mdbx::env_managed> chaindata_env_;
     uint32_t last_cursor_id_;
     db::ROTxn txn_;
+    std::unique_ptr<SnapshotReader> snapshot_reader_;
 };
 
 }  // namespace silkworm::rpc::ethdb::file
@@ -16,11 +16,31 @@
 
 #include "remote_cursor.hpp"
 
+#include <gsl/util>
+
 #include <silkworm/infra/common/log.hpp>
 #include <silkworm/silkrpc/common/clock_time.hpp>
 
 namespace silkworm::rpc::ethdb::kv {
 
+boost::asio::awaitable<remote::Pair> TxRpcGate::write_and_read(TxRpc& tx_rpc, const remote::Cursor& request) {
+    while (busy_) {
+        auto waiter = idle_.waiter();
+        co_await waiter();
+    }
+    busy_ = true;
+    auto _ = gsl::finally([&]() {
+        busy_ = false;
+        idle_.notify_all();
+    });
+    // Copy the reply because the stream reuses the same buffer for the next request
+    co_return co_await tx_rpc.write_and_read(request);
+}
+
+boost::asio::awaitable<remote::Pair> RemoteCursor::write_and_read(const remote::Cursor& request) {
+    co_return co_await tx_gate_.write_and_read(tx_rpc_, request);
+}
+
 boost::asio::awaitable<void> RemoteCursor::open_cursor(const std::string& table_name, bool is_dup_sorted) {
     const auto start_time = clock_time::now();
     if (cursor_id_ == 0) {
@@ -32,7 +52,7 @@ boost::asio::awaitable<void> RemoteCursor::open_cursor(const std::string& table_
             open_message.set_op(remote::Op::OPEN);
         }
         open_message.set_bucket_name(table_name);
-        cursor_id_ = (co_await tx_rpc_.write_and_read(open_message)).cursor_id();
+        cursor_id_ = (co_await write_and_read(open_message)).cursor_id();
         SILK_DEBUG << "RemoteCursor::open_cursor cursor: " << cursor_id_ << " for table: " << table_name;
     }
     SILK_DEBUG << "RemoteCursor::open_cursor [" << table_name << "] c=" << cursor_id_ << " t=" << clock_time::since(start_time);
@@ -46,7 +66,7 @@ boost::asio::awaitable<KeyValue> RemoteCursor::seek(silkworm::ByteView key) {
     seek_message.set_op(remote::Op::SEEK);
     seek_message.set_cursor(cursor_id_);
     seek_message.set_k(key.data(), key.length());
-    auto seek_pair = co_await tx_rpc_.write_and_read(seek_message);
+    auto seek_pair = co_await write_and_read(seek_message);
     const auto k = silkworm::bytes_of_string(seek_pair.k());
     const auto v = silkworm::bytes_of_string(seek_pair.v());
     SILK_DEBUG << "RemoteCursor::seek k: " << k << " v: " << v << " c=" << cursor_id_ << " t=" << clock_time::since(start_time);
@@ -60,7 +80,7 @@ boost::asio::awaitable<KeyValue> RemoteCursor::seek_exact(silkworm::ByteView key
     seek_message.set_op(remote::Op::SEEK_EXACT);
     seek_message.set_cursor(cursor_id_);
     seek_message.set_k(key.data(), key.length());
-    auto seek_pair = co_await tx_rpc_.write_and_read(seek_message);
+    auto seek_pair = co_await write_and_read(seek_message);
     const auto k = silkworm::bytes_of_string(seek_pair.k());
     const auto v = silkworm::bytes_of_string(seek_pair.v());
     SILK_DEBUG << "RemoteCursor::seek_exact k: " << k << " v: " << v << " c=" << cursor_id_ << " t=" << clock_time::since(start_time);
@@ -72,7 +92,7 @@ boost::asio::awaitable<KeyValue> RemoteCursor::next() {
     auto next_message = remote::Cursor{};
     next_message.set_op(remote::Op::NEXT);
     next_message.set_cursor(cursor_id_);
-    auto next_pair = co_await tx_rpc_.write_and_read(next_message);
+    auto next_pair = co_await write_and_read(next_message);
     const auto k = silkworm::bytes_of_string(next_pair.k());
     const auto v = silkworm::bytes_of_string(next_pair.v());
     SILK_DEBUG << "RemoteCursor::next k: " << k << " v: " << v << " c=" << cursor_id_ << " t=" << clock_time::since(start_time);
@@ -84,7 +104,7 @@ boost::asio::awaitable<KeyValue> RemoteCursor::next_dup() {
     auto next_message = remote::Cursor{};
     next_message.set_op(remote::Op::NEXT_DUP);
     next_message.set_cursor(cursor_id_);
-    auto next_pair = co_await tx_rpc_.write_and_read(next_message);
+    auto next_pair = co_await write_and_read(next_message);
     const auto k = silkworm::bytes_of_string(next_pair.k());
     const auto v = silkworm::bytes_of_string(next_pair.v());
     SILK_DEBUG << "RemoteCursor::next k: " << k << " v: " << v << " c=" << cursor_id_ << " t=" << clock_time::since(start_time);
@@ -99,7 +119,7 @@ boost::asio::awaitable<silkworm::Bytes> RemoteCursor::seek_both(silkworm::ByteVi
     seek_message.set_cursor(cursor_id_);
     seek_message.set_k(key.data(), key.length());
     seek_message.set_v(value.data(), value.length());
-    auto seek_pair = co_await tx_rpc_.write_and_read(seek_message);
+    auto seek_pair = co_await write_and_read(seek_message);
     const auto k = silkworm::bytes_of_string(seek_pair.k());
     const auto v = silkworm::bytes_of_string(seek_pair.v());
     SILK_DEBUG << "RemoteCursor::seek_both k: " << k << " v: " << v << " c=" << cursor_id_ << " t=" << clock_time::since(start_time);
@@ -114,7 +134,7 @@ boost::asio::awaitable<KeyValue> RemoteCursor::seek_both_exact(silkworm::ByteVie
     seek_message.set_cursor(cursor_id_);
     seek_message.set_k(key.data(), key.length());
     seek_message.set_v(value.data(), value.length());
-    auto seek_pair = co_await tx_rpc_.write_and_read(seek_message);
+    auto seek_pair = co_await write_and_read(seek_message);
     const auto k = silkworm::bytes_of_string(seek_pair.k());
     const auto v = silkworm::bytes_of_string(seek_pair.v());
     SILK_DEBUG << "RemoteCursor::seek_both_exact k: " << k << " v: " << v << " c=" << cursor_id_ << " t=" << clock_time::since(start_time);
@@ -129,7 +149,7 @@ boost::asio::awaitable<void> RemoteCursor::close_cursor() {
         auto close_message = remote::Cursor{};
         close_message.set_op(remote::Op::CLOSE);
         close_message.set_cursor(cursor_id_);
-        co_await tx_rpc_.write_and_read(close_message);
+        co_await write_and_read(close_message);
         SILK_DEBUG << "RemoteCursor::close_cursor cursor: " << cursor_id_;
         cursor_id_ = 0;
     }
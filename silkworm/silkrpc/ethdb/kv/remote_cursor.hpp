@@ -27,15 +27,27 @@
 #include <boost/asio/use_awaitable.hpp>
 
 #include <silkworm/core/common/util.hpp>
+#include <silkworm/infra/concurrency/awaitable_condition_variable.hpp>
 #include <silkworm/silkrpc/common/util.hpp>
 #include <silkworm/silkrpc/ethdb/cursor.hpp>
 #include <silkworm/silkrpc/ethdb/kv/rpc.hpp>
 
 namespace silkworm::rpc::ethdb::kv {
 
+//! Serializes the requests sent on one Tx stream, which supports just one request in flight
+//! Needed when concurrent coroutines (running on the same single-threaded executor) share the transaction
+class TxRpcGate {
+  public:
+    boost::asio::awaitable<remote::Pair> write_and_read(TxRpc& tx_rpc, const remote::Cursor& request);
+
+  private:
+    bool busy_{false};
+    concurrency::AwaitableConditionVariable idle_;
+};
+
 class RemoteCursor : public CursorDupSort {
   public:
-    explicit RemoteCursor(TxRpc& tx_rpc) : tx_rpc_(tx_rpc), cursor_id_{0} {}
+    RemoteCursor(TxRpc& tx_rpc, TxRpcGate& tx_gate) : tx_rpc_(tx_rpc), tx_gate_(tx_gate), cursor_id_{0} {}
 
     uint32_t cursor_id() const override { return cursor_id_; };
 
@@ -56,7 +68,10 @@ class RemoteCursor : public CursorDupSort {
     boost::asio::awaitable<KeyValue> seek_both_exact(silkworm::ByteView key, silkworm::ByteView value) override;
 
   private:
+    boost::asio::awaitable<remote::Pair> write_and_read(const remote::Cursor& request);
+
     TxRpc& tx_rpc_;
+    TxRpcGate& tx_gate_;
     uint32_t cursor_id_;
 };
 
@@ -62,7 +62,8 @@ struct RemoteCursorTest : test::KVTestBase {
     }
 
     TxRpc tx_rpc_{*stub_, grpc_context_};
-    RemoteCursor remote_cursor_{tx_rpc_};
+    TxRpcGate tx_gate_;
+    RemoteCursor remote_cursor_{tx_rpc_, tx_gate_};
 };
 
 #ifndef SILKWORM_SANITIZE
@@ -724,6 +725,39 @@ TEST_CASE_METHOD(RemoteCursorTest, "RemoteCursor::seek_both_exact", "[silkrpc][e
                              test::exception_has_cancelled_grpc_status_code());
     }
 }
+
+TEST_CASE_METHOD(RemoteCursorTest, "TxRpcGate::write_and_read", "[silkrpc][ethdb][kv][remote_cursor]") {
+    SECTION("concurrent requests are serialized") {
+        RemoteCursor other_cursor{tx_rpc_, tx_gate_};
+
+        // Set the call expectations: the second request must be written only after the first reply has been read
+        testing::InSequence sequence;
+        // 1. AsyncReaderWriter<remote::Cursor, remote::Pair>::Write call to open cursor on table1 succeeds
+        EXPECT_CALL(reader_writer_, Write(
+                                        AllOf(Property(&remote::Cursor::op, Eq(remote::Op::OPEN)), Property(&remote::Cursor::bucket_name, Eq("table1"))), _))
+            .WillOnce(test::write_success(grpc_context_));
+        // 2. AsyncReaderWriter<remote::Cursor, remote::Pair>::Read call succeeds setting the cursor ID for table1
+        remote::Pair open_pair1;
+        open_pair1.set_cursor_id(3);
+        EXPECT_CALL(reader_writer_, Read).WillOnce(test::read_success_with(grpc_context_, open_pair1));
+        // 3. AsyncReaderWriter<remote::Cursor, remote::Pair>::Write call to open cursor on table2 succeeds
+        EXPECT_CALL(reader_writer_, Write(
+                                        AllOf(Property(&remote::Cursor::op, Eq(remote::Op::OPEN)), Property(&remote::Cursor::bucket_name, Eq("table2"))), _))
+            .WillOnce(test::write_success(grpc_context_));
+        // 4. AsyncReaderWriter<remote::Cursor, remote::Pair>::Read call succeeds setting the cursor ID for table2
+        remote::Pair open_pair2;
+        open_pair2.set_cursor_id(4);
+        EXPECT_CALL(reader_writer_, Read).WillOnce(test::read_success_with(grpc_context_, open_pair2));
+
+        // Execute the test: opening two cursors concurrently on the same Tx stream should succeed
+        auto open_result1 = spawn(remote_cursor_.open_cursor("table1", false));
+        auto open_result2 = spawn(other_cursor.open_cursor("table2", false));
+        CHECK_NOTHROW(open_result1.get());
+        CHECK_NOTHROW(open_result2.get());
+        CHECK(remote_cursor_.cursor_id() == 3);
+        CHECK(other_cursor.cursor_id() == 4);
+    }
+}
 #endif  // SILKWORM_SANITIZE
 
 }  // namespace silkworm::rpc::ethdb::kv
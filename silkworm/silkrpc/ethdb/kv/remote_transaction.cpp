@@ -38,33 +38,29 @@ boost::asio::awaitable<std::shared_ptr<CursorDupSort>> RemoteTransaction::cursor
 boost::asio::awaitable<void> RemoteTransaction::close() {
     co_await tx_rpc_.writes_done_and_finish();
     cursors_.clear();
+    dup_cursors_.clear();
     view_id_ = 0;
 }
 
 boost::asio::awaitable<std::shared_ptr<CursorDupSort>> RemoteTransaction::get_cursor(const std::string& table, bool is_cursor_sorted) {
-    if (is_cursor_sorted) {
-        auto cursor_it = dup_cursors_.find(table);
-        if (cursor_it != dup_cursors_.end()) {
-            co_return cursor_it->second;
-        }
-    } else {
-        auto cursor_it = cursors_.find(table);
-        if (cursor_it != cursors_.end()) {
-            co_return cursor_it->second;
+    // A cursor is idle when referenced only by the pool: concurrent coroutines (e.g. parallel block replays) sharing
+    // this transaction must not interleave their seek/next sequences on the same cursor, so each one gets its own
+    auto& pools = is_cursor_sorted ? dup_cursors_ : cursors_;
+    for (const auto& cursor : pools[table]) {
+        if (cursor.use_count() == 1) {
+            co_return cursor;
         }
     }
-    auto cursor = std::make_shared<RemoteCursor>(tx_rpc_);
+    auto cursor = std::make_shared<RemoteCursor>(tx_rpc_, tx_gate_);
     co_await cursor->open_cursor(table, is_cursor_sorted);
-    if (is_cursor_sorted) {
-        dup_cursors_[table] = cursor;
-    } else {
-        cursors_[table] = cursor;
-    }
+    pools[table].push_back(cursor);
     co_return cursor;
 }
 
 std::shared_ptr<silkworm::State> RemoteTransaction::create_state(boost::asio::any_io_executor& executor, const DatabaseReader& db_reader, uint64_t block_number) {
-    return std::make_shared<silkworm::rpc::state::RemoteState>(executor, db_reader, block_number);
+    // Remote state reads history at the next block, so share memoized values for that height among all states in this view
+    auto historical_view{HistoricalStateView::shared(view_id_, block_number + 1)};
+    return std::make_shared<silkworm::rpc::state::RemoteState>(executor, db_reader, block_number, std::move(historical_view));
 }
 
 std::shared_ptr<node::ChainStorage> RemoteTransaction::create_storage(const DatabaseReader& db_reader, ethbackend::BackEnd* backend) {
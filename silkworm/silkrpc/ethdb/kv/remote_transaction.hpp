@@ -20,6 +20,7 @@
 #include <memory>
 #include <string>
 #include <type_traits>
+#include <vector>
 
 #include <silkworm/infra/concurrency/coroutine.hpp>
 
@@ -57,11 +58,14 @@ class RemoteTransaction : public Transaction {
     boost::asio::awaitable<void> close() override;
 
   private:
+    //! Get an idle cursor on the table or open a new one, so that concurrent users never share the position of a cursor
     boost::asio::awaitable<std::shared_ptr<CursorDupSort>> get_cursor(const std::string& table, bool is_cursor_dup_sort);
 
-    std::map<std::string, std::shared_ptr<CursorDupSort>> cursors_;
-    std::map<std::string, std::shared_ptr<CursorDupSort>> dup_cursors_;
+    using CursorPool = std::vector<std::shared_ptr<CursorDupSort>>;
+    std::map<std::string, CursorPool> cursors_;
+    std::map<std::string, CursorPool> dup_cursors_;
     TxRpc tx_rpc_;
+    TxRpcGate tx_gate_;
     uint64_t view_id_{0};
 };
 
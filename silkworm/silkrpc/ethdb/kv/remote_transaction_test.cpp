@@ -203,10 +203,56 @@ TEST_CASE_METHOD(RemoteTransactionTest, "RemoteTransaction::cursor", "[silkrpc][
         std::shared_ptr<Cursor> cursor1;
         CHECK_NOTHROW(cursor1 = spawn_and_wait(remote_tx_.cursor("table1")));
         CHECK(cursor1->cursor_id() == 0x23);
-        // 2. opening another cursor on the same table should succeed and cursor should have expected cursor ID
+        const auto* cursor1_address = cursor1.get();
+        cursor1.reset();
+        // 2. opening another cursor on the same table after releasing the first one should reuse it
         std::shared_ptr<Cursor> cursor2;
         CHECK_NOTHROW(cursor2 = spawn_and_wait(remote_tx_.cursor("table1")));
         CHECK(cursor2->cursor_id() == 0x23);
+        CHECK(cursor2.get() == cursor1_address);
+
+        // Execute the test postconditions:
+        // close the transaction succeeds
+        CHECK_NOTHROW(spawn_and_wait(remote_tx_.close()));
+    }
+    SECTION("success w/ cursor in use") {
+        // Set the call expectations:
+        // 1. remote::KV::StubInterface::PrepareAsyncTxRaw call succeeds
+        expect_request_async_tx(/*ok=*/true);
+        // 2. AsyncReaderWriter<remote::Cursor, remote::Pair>::Read calls succeed w/ specified transaction and cursor IDs
+        remote::Pair tx_id_pair;
+        tx_id_pair.set_view_id(4);
+        remote::Pair cursor_id_pair1;
+        cursor_id_pair1.set_cursor_id(0x23);
+        remote::Pair cursor_id_pair2;
+        cursor_id_pair2.set_cursor_id(0x24);
+        EXPECT_CALL(reader_writer_, Read)
+            .WillOnce(test::read_success_with(grpc_context_, tx_id_pair))
+            .WillOnce(test::read_success_with(grpc_context_, cursor_id_pair1))
+            .WillOnce(test::read_success_with(grpc_context_, cursor_id_pair2));
+        // 3. AsyncReaderWriter<remote::Cursor, remote::Pair>::Write calls succeed
+        EXPECT_CALL(reader_writer_, Write(_, _))
+            .WillOnce(test::write_success(grpc_context_))
+            .WillOnce(test::write_success(grpc_context_));
+        // 4. AsyncReaderWriter<remote::Cursor, remote::Pair>::WritesDone call succeeds
+        EXPECT_CALL(reader_writer_, WritesDone).WillOnce(test::writes_done_success(grpc_context_));
+        // 5. AsyncReaderWriter<remote::Cursor, remote::Pair>::Finish call succeeds w/ status OK
+        EXPECT_CALL(reader_writer_, Finish).WillOnce(test::finish_streaming_ok(grpc_context_));
+
+        // Execute the test preconditions:
+        // open a new transaction w/ expected transaction ID
+        REQUIRE_NOTHROW(spawn_and_wait(remote_tx_.open()));
+        REQUIRE(remote_tx_.view_id() == 4);
+
+        // Execute the test:
+        // 1. opening a cursor should succeed and cursor should have expected cursor ID
+        std::shared_ptr<Cursor> cursor1;
+        CHECK_NOTHROW(cursor1 = spawn_and_wait(remote_tx_.cursor("table1")));
+        CHECK(cursor1->cursor_id() == 0x23);
+        // 2. opening another cursor on the same table while the first one is in use should open a new cursor
+        std::shared_ptr<Cursor> cursor2;
+        CHECK_NOTHROW(cursor2 = spawn_and_wait(remote_tx_.cursor("table1")));
+        CHECK(cursor2->cursor_id() == 0x24);
 
         // Execute the test postconditions:
         // close the transaction succeeds
@@ -310,10 +356,56 @@ TEST_CASE_METHOD(RemoteTransactionTest, "RemoteTransaction::cursor_dup_sort", "[
         std::shared_ptr<Cursor> cursor1;
         CHECK_NOTHROW(cursor1 = spawn_and_wait(remote_tx_.cursor_dup_sort("table1")));
         CHECK(cursor1->cursor_id() == 0x23);
-        // 2. opening another cursor on the same table should succeed and cursor should have expected cursor ID
+        const auto* cursor1_address = cursor1.get();
+        cursor1.reset();
+        // 2. opening another cursor on the same table after releasing the first one should reuse it
         std::shared_ptr<Cursor> cursor2;
         CHECK_NOTHROW(cursor2 = spawn_and_wait(remote_tx_.cursor_dup_sort("table1")));
         CHECK(cursor2->cursor_id() == 0x23);
+        CHECK(cursor2.get() == cursor1_address);
+
+        // Execute the test postconditions:
+        // close the transaction succeeds
+        CHECK_NOTHROW(spawn_and_wait(remote_tx_.close()));
+    }
+    SECTION("success w/ cursor in use") {
+        // Set the call expectations:
+        // 1. remote::KV::StubInterface::PrepareAsyncTxRaw call succeeds
+        expect_request_async_tx(/*ok=*/true);
+        // 2. AsyncReaderWriter<remote::Cursor, remote::Pair>::Read calls succeed w/ specified transaction and cursor IDs
+        remote::Pair tx_id_pair;
+        tx_id_pair.set_view_id(4);
+        remote::Pair cursor_id_pair1;
+        cursor_id_pair1.set_cursor_id(0x23);
+        remote::Pair cursor_id_pair2;
+        cursor_id_pair2.set_cursor_id(0x24);
+        EXPECT_CALL(reader_writer_, Read)
+            .WillOnce(test::read_success_with(grpc_context_, tx_id_pair))
+            .WillOnce(test::read_success_with(grpc_context_, cursor_id_pair1))
+            .WillOnce(test::read_success_with(grpc_context_, cursor_id_pair2));
+        // 3. AsyncReaderWriter<remote::Cursor, remote::Pair>::Write calls succeed
+        EXPECT_CALL(reader_writer_, Write(_, _))
+            .WillOnce(test::write_success(grpc_context_))
+            .WillOnce(test::write_success(grpc_context_));
+        // 4. AsyncReaderWriter<remote::Cursor, remote::Pair>::WritesDone call succeeds
+        EXPECT_CALL(reader_writer_, WritesDone).WillOnce(test::writes_done_success(grpc_context_));
+        // 5. AsyncReaderWriter<remote::Cursor, remote::Pair>::Finish call succeeds w/ status OK
+        EXPECT_CALL(reader_writer_, Finish).WillOnce(test::finish_streaming_ok(grpc_context_));
+
+        // Execute the test preconditions:
+        // open a new transaction w/ expected transaction ID
+        REQUIRE_NOTHROW(spawn_and_wait(remote_tx_.open()));
+        REQUIRE(remote_tx_.view_id() == 4);
+
+        // Execute the test:
+        // 1. opening a cursor should succeed and cursor should have expected cursor ID
+        std::shared_ptr<Cursor> cursor1;
+        CHECK_NOTHROW(cursor1 = spawn_and_wait(remote_tx_.cursor_dup_sort("table1")));
+        CHECK(cursor1->cursor_id() == 0x23);
+        // 2. opening another cursor on the same table while the first one is in use should open a new cursor
+        std::shared_ptr<Cursor> cursor2;
+        CHECK_NOTHROW(cursor2 = spawn_and_wait(remote_tx_.cursor_dup_sort("table1")));
+        CHECK(cursor2->cursor_id() == 0x24);
 
         // Execute the test postconditions:
         // close the transaction succeeds
@@ -24,6 +24,7 @@
 #include <silkworm/core/common/util.hpp>
 #include <silkworm/infra/common/log.hpp>
 #include <silkworm/infra/grpc/common/conversion.hpp>
+#include <silkworm/infra/metrics/metrics.hpp>
 #include <silkworm/node/db/tables.hpp>
 #include <silkworm/silkrpc/common/util.hpp>
 #include <silkworm/silkrpc/core/rawdb/util.hpp>
@@ -31,6 +32,13 @@
 
 namespace silkworm::rpc::ethdb::kv {
 
+//! Cache lookup outcomes exposed as metrics: the hit ratio is hits / (hits + misses)
+static metrics::Counter& cache_lookup_counter(const char* cache, const char* result) {
+    return metrics::Registry::instance().counter("silkworm_rpc_state_cache_lookups_total",
+                                                 "Number of lookups in the coherent state cache",
+                                                 {{"cache", cache}, {"result", result}});
+}
+
 CoherentStateView::CoherentStateView(Transaction& txn, CoherentStateCache* cache) : txn_(txn), cache_(cache) {}
 
 boost::asio::awaitable<std::optional<silkworm::Bytes>> CoherentStateView::get(const silkworm::Bytes& key) {
@@ -231,6 +239,8 @@ boost::asio::awaitable<std::optional<silkworm::Bytes>> CoherentStateCache::get(c
     const auto kv_it = cache.find(kv);
     if (kv_it != cache.end()) {
         ++state_hit_count_;
+        static auto& state_hit_counter{cache_lookup_counter("state", "hit")};
+        state_hit_counter.increment();
 
         SILK_DEBUG << "Hit in state cache key=" << key << " value=" << kv_it->value;
 
@@ -243,6 +253,8 @@ boost::asio::awaitable<std::optional<silkworm::Bytes>> CoherentStateCache::get(c
     }
 
     ++state_miss_count_;
+    static auto& state_miss_counter{cache_lookup_counter("state", "miss")};
+    state_miss_counter.increment();
 
     TransactionDatabase tx_database{txn};
     const auto value = co_await tx_database.get_one(db::table::kPlainStateName, key);
@@ -273,6 +285,8 @@ boost::asio::awaitable<std::optional<silkworm::Bytes>> CoherentStateCache::get_c
     const auto kv_it = code_cache.find(kv);
     if (kv_it != code_cache.end()) {
         ++code_hit_count_;
+        static auto& code_hit_counter{cache_lookup_counter("code", "hit")};
+        code_hit_counter.increment();
 
         SILK_DEBUG << "Hit in code cache key=" << key << " value=" << kv_it->value;
 
@@ -285,6 +299,8 @@ boost::asio::awaitable<std::optional<silkworm::Bytes>> CoherentStateCache::get_c
     }
 
     ++code_miss_count_;
+    static auto& code_miss_counter{cache_lookup_counter("code", "miss")};
+    code_miss_counter.increment();
 
     TransactionDatabase tx_database{txn};
     const auto value = co_await tx_database.get_one(db::table::kCodeName, key);
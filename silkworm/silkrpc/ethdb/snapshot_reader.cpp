@@ -0,0 +1,178 @@
+/*
+   Copyright 2023 The Silkworm Authors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#include "snapshot_reader.hpp"
+
+#include <silkworm/core/common/endian.hpp>
+#include <silkworm/core/common/util.hpp>
+#include <silkworm/infra/common/log.hpp>
+#include <silkworm/node/db/tables.hpp>
+#include <silkworm/node/db/util.hpp>
+
+namespace silkworm::rpc::ethdb {
+
+//! Size of the database key composed by block number and block hash
+static constexpr std::size_t kBlockKeyLength{sizeof(BlockNum) + kHashLength};
+
+bool SnapshotReader::is_number_keyed(const std::string& table) {
+    return table == db::table::kCanonicalHashesName || table == db::table::kHeadersName ||
+           table == db::table::kBlockBodiesName || table == db::table::kSendersName ||
+           table == db::table::kBlockTransactionsName;
+}
+
+std::optional<Bytes> SnapshotReader::get_one(const std::string& table, ByteView key) const {
+    if (table == db::table::kCanonicalHashesName && key.size() == sizeof(BlockNum)) {
+        return read_canonical_hash(endian::load_big_u64(key.data()));
+    }
+    if (key.size() == kBlockKeyLength) {
+        const BlockNum block_number{endian::load_big_u64(key.data())};
+        const ByteView block_hash{key.substr(sizeof(BlockNum))};
+        if (table == db::table::kHeadersName) {
+            return read_header_rlp(block_number, block_hash);
+        }
+        if (table == db::table::kBlockBodiesName) {
+            return read_body_rlp(block_number, block_hash);
+        }
+        if (table == db::table::kSendersName) {
+            return read_senders(block_number, block_hash);
+        }
+    }
+    if (key.size() == kHashLength) {
+        if (table == db::table::kHeaderNumbersName) {
+            return read_header_number(key);
+        }
+        if (table == db::table::kTxLookupName) {
+            return read_txn_block_number(key);
+        }
+    }
+    return std::nullopt;
+}
+
+bool SnapshotReader::walk(const std::string& table, ByteView start_key, const core::rawdb::Walker& w) const {
+    if (table == db::table::kBlockTransactionsName && start_key.size() == sizeof(uint64_t)) {
+        return walk_transactions(endian::load_big_u64(start_key.data()), w);
+    }
+    return false;
+}
+
+std::optional<Bytes> SnapshotReader::read_canonical_hash(BlockNum block_number) const {
+    const auto header_rlp{read_header_rlp(block_number, {})};
+    if (!header_rlp) {
+        return std::nullopt;
+    }
+    const auto block_hash{keccak256(*header_rlp)};
+    return Bytes{block_hash.bytes, kHashLength};
+}
+
+std::optional<Bytes> SnapshotReader::read_header_rlp(BlockNum block_number, ByteView block_hash) const {
+    const auto header_snapshot{repository_.find_header_segment(block_number)};
+    if (!header_snapshot) {
+        return std::nullopt;
+    }
+    auto header_rlp{header_snapshot->header_rlp_by_number(block_number)};
+    // Snapshots contain only canonical headers, so any other header must be looked up in database
+    if (header_rlp && !block_hash.empty() && ByteView{keccak256(*header_rlp).bytes, kHashLength} != block_hash) {
+        return std::nullopt;
+    }
+    return header_rlp;
+}
+
+std::optional<Bytes> SnapshotReader::read_body_rlp(BlockNum block_number, ByteView block_hash) const {
+    const auto body_snapshot{repository_.find_body_segment(block_number)};
+    if (!body_snapshot || !is_canonical(block_number, block_hash)) {
+        return std::nullopt;
+    }
+    return body_snapshot->body_rlp_by_number(block_number);
+}
+
+std::optional<Bytes> SnapshotReader::read_senders(BlockNum block_number, ByteView block_hash) const {
+    const auto body_snapshot{repository_.find_body_segment(block_number)};
+    const auto tx_snapshot{repository_.find_tx_segment(block_number)};
+    if (!body_snapshot || !tx_snapshot || !is_canonical(block_number, block_hash)) {
+        return std::nullopt;
+    }
+    const auto stored_body{body_snapshot->body_by_number(block_number)};
+    if (!stored_body) {
+        return std::nullopt;
+    }
+    Bytes senders_data;
+    // 1 system txn at the beginning of block and 1 at the end
+    if (stored_body->txn_count > 2) {
+        const auto senders{tx_snapshot->txn_senders_range(stored_body->base_txn_id + 1, stored_body->txn_count - 2)};
+        senders_data.reserve(senders.size() * kAddressLength);
+        for (const auto& sender : senders) {
+            senders_data.append(sender.bytes, kAddressLength);
+        }
+    }
+    return senders_data;
+}
+
+std::optional<Bytes> SnapshotReader::read_header_number(ByteView block_hash) const {
+    const Hash hash{block_hash};
+    std::optional<BlockNum> block_number;
+    repository_.view_header_segments([&](const snapshot::HeaderSnapshot* snapshot) -> bool {
+        const auto header{snapshot->header_by_hash(hash)};
+        if (header) {
+            block_number = header->number;
+        }
+        return block_number.has_value();
+    });
+    if (!block_number) {
+        return std::nullopt;
+    }
+    return db::block_key(*block_number);
+}
+
+std::optional<Bytes> SnapshotReader::read_txn_block_number(ByteView txn_hash) const {
+    const auto block_number = repository_.find_block_number(Hash{txn_hash});
+    if (!block_number) {
+        return std::nullopt;
+    }
+    return db::block_key(*block_number);
+}
+
+bool SnapshotReader::walk_transactions(uint64_t base_txn_id, const core::rawdb::Walker& w) const {
+    const snapshot::TransactionSnapshot* tx_snapshot{nullptr};
+    repository_.view_tx_segments([&](const snapshot::TransactionSnapshot* snapshot) -> bool {
+        const auto idx_txn_hash{snapshot->idx_txn_hash()};
+        if (idx_txn_hash && idx_txn_hash->base_data_id() <= base_txn_id &&
+            base_txn_id < idx_txn_hash->base_data_id() + snapshot->item_count()) {
+            tx_snapshot = snapshot;
+        }
+        return tx_snapshot != nullptr;
+    });
+    if (!tx_snapshot) {
+        return false;
+    }
+
+    // Transactions of one block never span multiple segments, so walking up to the segment end is enough
+    const auto max_txn_count{tx_snapshot->idx_txn_hash()->base_data_id() + tx_snapshot->item_count() - base_txn_id};
+    Bytes txn_id_key(sizeof(uint64_t), '\0');
+    Bytes txn_rlp;
+    tx_snapshot->for_each_txn_rlp(base_txn_id, max_txn_count, [&](uint64_t i, ByteView txn_rlp_view) -> bool {
+        endian::store_big_u64(txn_id_key.data(), base_txn_id + i);
+        txn_rlp = txn_rlp_view;
+        return w(txn_id_key, txn_rlp);
+    });
+    return true;
+}
+
+bool SnapshotReader::is_canonical(BlockNum block_number, ByteView block_hash) const {
+    const auto canonical_hash{read_canonical_hash(block_number)};
+    return canonical_hash && *canonical_hash == block_hash;
+}
+
+}  // namespace silkworm::rpc::ethdb
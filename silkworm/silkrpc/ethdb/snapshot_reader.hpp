@@ -0,0 +1,63 @@
+/*
+   Copyright 2023 The Silkworm Authors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#pragma once
+
+#include <optional>
+#include <string>
+
+#include <silkworm/core/common/base.hpp>
+#include <silkworm/node/snapshot/repository.hpp>
+#include <silkworm/silkrpc/core/rawdb/accessors.hpp>
+
+namespace silkworm::rpc::ethdb {
+
+//! SnapshotReader serves the immutable block data (canonical hashes, headers, bodies, transactions, senders and
+//! transaction lookup) directly from the memory-mapped snapshot segments using the same key/value layout of the
+//! corresponding MDBX tables, so that RPC accessors work unchanged when blocks live only in snapshots
+class SnapshotReader {
+  public:
+    explicit SnapshotReader(const snapshot::SnapshotRepository& repository) : repository_(repository) {}
+
+    SnapshotReader(const SnapshotReader&) = delete;
+    SnapshotReader& operator=(const SnapshotReader&) = delete;
+
+    //! Check if the specified table is keyed by block number (or txn id): if so, snapshots must be looked up
+    //! *before* the database, otherwise (keyed by hash) only as fallback when the key is not found in database
+    [[nodiscard]] static bool is_number_keyed(const std::string& table);
+
+    //! Get the value for key in the specified table from snapshots or std::nullopt if not present in snapshots
+    [[nodiscard]] std::optional<Bytes> get_one(const std::string& table, ByteView key) const;
+
+    //! Walk the specified table from start_key within snapshots returning false if start_key is not in snapshots
+    bool walk(const std::string& table, ByteView start_key, const core::rawdb::Walker& w) const;
+
+  private:
+    [[nodiscard]] std::optional<Bytes> read_canonical_hash(BlockNum block_number) const;
+    [[nodiscard]] std::optional<Bytes> read_header_rlp(BlockNum block_number, ByteView block_hash) const;
+    [[nodiscard]] std::optional<Bytes> read_body_rlp(BlockNum block_number, ByteView block_hash) const;
+    [[nodiscard]] std::optional<Bytes> read_senders(BlockNum block_number, ByteView block_hash) const;
+    [[nodiscard]] std::optional<Bytes> read_header_number(ByteView block_hash) const;
+    [[nodiscard]] std::optional<Bytes> read_txn_block_number(ByteView txn_hash) const;
+    bool walk_transactions(uint64_t base_txn_id, const core::rawdb::Walker& w) const;
+
+    //! Check if the specified block hash is the canonical one at given height stored in snapshots
+    [[nodiscard]] bool is_canonical(BlockNum block_number, ByteView block_hash) const;
+
+    const snapshot::SnapshotRepository& repository_;
+};
+
+}  // namespace silkworm::rpc::ethdb
@@ -0,0 +1,163 @@
+/*
+   Copyright 2023 The Silkworm Authors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#include "snapshot_reader.hpp"
+
+#include <filesystem>
+#include <memory>
+
+#include <boost/asio/co_spawn.hpp>
+#include <boost/asio/io_context.hpp>
+#include <boost/asio/use_future.hpp>
+#include <catch2/catch.hpp>
+
+#include <silkworm/core/common/util.hpp>
+#include <silkworm/infra/common/directories.hpp>
+#include <silkworm/infra/test_util/log.hpp>
+#include <silkworm/node/db/mdbx.hpp>
+#include <silkworm/node/db/tables.hpp>
+#include <silkworm/node/db/util.hpp>
+#include <silkworm/node/snapshot/index.hpp>
+#include <silkworm/node/test/snapshots.hpp>
+#include <silkworm/silkrpc/core/rawdb/chain.hpp>
+#include <silkworm/silkrpc/ethdb/file/local_transaction.hpp>
+#include <silkworm/silkrpc/ethdb/transaction_database.hpp>
+
+namespace silkworm::rpc::ethdb {
+
+TEST_CASE("SnapshotReader::is_number_keyed", "[silkrpc][ethdb][snapshot_reader]") {
+    CHECK(SnapshotReader::is_number_keyed(db::table::kCanonicalHashesName));
+    CHECK(SnapshotReader::is_number_keyed(db::table::kHeadersName));
+    CHECK(SnapshotReader::is_number_keyed(db::table::kBlockBodiesName));
+    CHECK(SnapshotReader::is_number_keyed(db::table::kSendersName));
+    CHECK(SnapshotReader::is_number_keyed(db::table::kBlockTransactionsName));
+    CHECK(!SnapshotReader::is_number_keyed(db::table::kHeaderNumbersName));
+    CHECK(!SnapshotReader::is_number_keyed(db::table::kTxLookupName));
+    CHECK(!SnapshotReader::is_number_keyed(db::table::kPlainStateName));
+}
+
+TEST_CASE("SnapshotReader: no snapshots", "[silkrpc][ethdb][snapshot_reader]") {
+    test_util::SetLogVerbosityGuard guard{log::Level::kNone};
+    TemporaryDirectory tmp_dir;
+    snapshot::SnapshotRepository repository{snapshot::SnapshotSettings{tmp_dir.path()}};
+    repository.reopen_folder();
+    SnapshotReader reader{repository};
+
+    const auto block_hash{0xbef48d7de01f2d7ea1a7e4d1ed401f73d6d0257a364f6770b25ba51a123ac35f_bytes32};
+    const ByteView block_hash_bytes{block_hash.bytes, kHashLength};
+
+    SECTION("get_one") {
+        CHECK(!reader.get_one(db::table::kCanonicalHashesName, db::block_key(1'500'013)));
+        CHECK(!reader.get_one(db::table::kHeadersName, db::block_key(1'500'013, block_hash.bytes)));
+        CHECK(!reader.get_one(db::table::kBlockBodiesName, db::block_key(1'500'013, block_hash.bytes)));
+        CHECK(!reader.get_one(db::table::kSendersName, db::block_key(1'500'013, block_hash.bytes)));
+        CHECK(!reader.get_one(db::table::kHeaderNumbersName, block_hash_bytes));
+        CHECK(!reader.get_one(db::table::kTxLookupName, block_hash_bytes));
+    }
+
+    SECTION("get_one: table not served by snapshots") {
+        CHECK(!reader.get_one(db::table::kPlainStateName, block_hash_bytes));
+    }
+
+    SECTION("walk") {
+        bool walked{false};
+        core::rawdb::Walker walker = [&](Bytes&, Bytes&) {
+            walked = true;
+            return true;
+        };
+        CHECK(!reader.walk(db::table::kBlockTransactionsName, db::block_key(7'341'273), walker));
+        CHECK(!reader.walk(db::table::kPlainStateName, db::block_key(7'341'273), walker));
+        CHECK(!walked);
+    }
+}
+
+//! Run the task to completion on the calling thread, the one owning the local read-only transaction
+template <typename T>
+static T run(boost::asio::io_context& io_context, boost::asio::awaitable<T> task) {
+    auto result = boost::asio::co_spawn(io_context, std::move(task), boost::asio::use_future);
+    io_context.restart();
+    io_context.run();
+    return result.get();
+}
+
+TEST_CASE("SnapshotReader: local mode", "[silkrpc][ethdb][snapshot_reader]") {
+    test_util::SetLogVerbosityGuard guard{log::Level::kNone};
+    boost::asio::io_context io_context;
+
+    // The sample snapshots for mainnet block 1'500'013 under a block range the repository can parse, plus indexes
+    TemporaryDirectory snapshots_dir;
+    silkworm::test::SampleHeaderSnapshotFile header_snapshot_file{};
+    silkworm::test::SampleBodySnapshotFile body_snapshot_file{};
+    silkworm::test::SampleTransactionSnapshotFile txn_snapshot_file{};
+    auto copy_segment = [&](const std::filesystem::path& sample_path, snapshot::SnapshotType type) {
+        auto segment_path{snapshot::SnapshotPath::from(snapshots_dir.path(), 1, 1'500'000, 1'501'000, type)};
+        std::filesystem::copy_file(sample_path, segment_path.path());
+        return segment_path;
+    };
+    snapshot::HeaderIndex{copy_segment(header_snapshot_file.path(), snapshot::SnapshotType::headers)}.build();
+    snapshot::BodyIndex{copy_segment(body_snapshot_file.path(), snapshot::SnapshotType::bodies)}.build();
+    snapshot::TransactionIndex{copy_segment(txn_snapshot_file.path(), snapshot::SnapshotType::transactions)}.build();
+
+    snapshot::SnapshotRepository repository{snapshot::SnapshotSettings{snapshots_dir.path()}};
+    repository.reopen_folder();
+    REQUIRE(repository.max_block_available() >= 1'500'013);
+
+    // Empty chaindata: all block data must come from snapshots
+    TemporaryDirectory chaindata_dir;
+    auto chaindata_env = std::make_shared<mdbx::env_managed>(
+        db::open_env(db::EnvConfig{.path = chaindata_dir.path().string(), .create = true, .in_memory = true}));
+    {
+        db::RWTxn rw_txn{*chaindata_env};
+        db::table::check_or_create_chaindata_tables(rw_txn);
+        rw_txn.commit_and_stop();
+    }
+    file::LocalTransaction tx{chaindata_env, &repository};
+    TransactionDatabase db_reader{tx};
+
+    const auto block_hash{0xbef48d7de01f2d7ea1a7e4d1ed401f73d6d0257a364f6770b25ba51a123ac35f_bytes32};
+
+    SECTION("block") {
+        CHECK(run(io_context, core::rawdb::read_canonical_block_hash(db_reader, 1'500'013)) == block_hash);
+        const auto header{run(io_context, core::rawdb::read_header_by_number(db_reader, 1'500'013))};
+        CHECK(header.number == 1'500'013);
+        CHECK(header.hash() == block_hash);
+        // Keyed by hash: served by snapshots as fallback when missing in chaindata
+        CHECK(run(io_context, core::rawdb::read_header_number(db_reader, block_hash)) == 1'500'013);
+    }
+
+    SECTION("body") {
+        const auto body_rlp{run(io_context, core::rawdb::read_body_rlp(db_reader, block_hash, 1'500'013))};
+        ByteView body_rlp_view{body_rlp};
+        const auto stored_body{db::detail::decode_stored_block_body(body_rlp_view)};
+        CHECK(stored_body.base_txn_id == 7'341'273);
+        CHECK(stored_body.txn_count == 1);
+        CHECK(stored_body.ommers.empty());
+    }
+
+    SECTION("transaction") {
+        const auto tx_snapshot{repository.find_tx_segment(1'500'013)};
+        REQUIRE(tx_snapshot);
+        const auto expected_txn{tx_snapshot->txn_by_id(7'341'273)};
+        REQUIRE(expected_txn);
+
+        const auto transactions{run(io_context, core::rawdb::read_canonical_transactions(db_reader, 7'341'273, 1))};
+        REQUIRE(transactions.size() == 1);
+        CHECK(transactions[0] == *expected_txn);
+        CHECK(run(io_context, core::rawdb::read_block_number_by_transaction_hash(db_reader, expected_txn->hash())) == 1'500'013);
+    }
+}
+
+}  // namespace silkworm::rpc::ethdb
@@ -30,6 +30,7 @@
 #include <silkworm/silkrpc/core/rawdb/accessors.hpp>
 #include <silkworm/silkrpc/ethbackend/backend.hpp>
 #include <silkworm/silkrpc/ethdb/cursor.hpp>
+#include <silkworm/silkrpc/ethdb/snapshot_reader.hpp>
 
 namespace silkworm::rpc::ethdb {
 
@@ -56,6 +57,9 @@ class Transaction {
 
     virtual std::shared_ptr<node::ChainStorage> create_storage(const DatabaseReader& db_reader, ethbackend::BackEnd* backend) = 0;
 
+    //! The reader for block data stored in snapshots or nullptr if snapshots are not locally available
+    [[nodiscard]] virtual const SnapshotReader* snapshot_reader() const { return nullptr; }
+
     virtual boost::asio::awaitable<void> close() = 0;
 };
 
@@ -32,9 +32,25 @@ awaitable<KeyValue> TransactionDatabase::get(const std::string& table, ByteView
 }
 
 awaitable<silkworm::Bytes> TransactionDatabase::get_one(const std::string& table, ByteView key) const {
+    // Immutable block data keyed by number is looked up in snapshots first, then in database
+    const auto snapshot_reader{tx_.snapshot_reader()};
+    const bool is_number_keyed{SnapshotReader::is_number_keyed(table)};
+    if (snapshot_reader && is_number_keyed) {
+        auto value{snapshot_reader->get_one(table, key)};
+        if (value) {
+            co_return std::move(*value);
+        }
+    }
     const auto cursor = co_await tx_.cursor(table);
     SILK_TRACE << "TransactionDatabase::get_one cursor_id: " << cursor->cursor_id();
     const auto kv_pair = co_await cursor->seek_exact(key);
+    // Immutable block data keyed by hash is looked up in snapshots only if not found in database
+    if (snapshot_reader && !is_number_keyed && kv_pair.value.empty()) {
+        auto value{snapshot_reader->get_one(table, key)};
+        if (value) {
+            co_return std::move(*value);
+        }
+    }
     co_return kv_pair.value;
 }
 
@@ -51,6 +67,12 @@ awaitable<std::optional<Bytes>> TransactionDatabase::get_both_range(const std::s
 }
 
 awaitable<void> TransactionDatabase::walk(const std::string& table, ByteView start_key, uint32_t fixed_bits, core::rawdb::Walker w) const {
+    // Immutable block data (i.e. block transactions) is walked in snapshots if present
+    const auto snapshot_reader{tx_.snapshot_reader()};
+    if (snapshot_reader && snapshot_reader->walk(table, start_key, w)) {
+        co_return;
+    }
+
     const auto fixed_bytes = (fixed_bits + 7) / CHAR_BIT;
     SILK_TRACE << "TransactionDatabase::walk fixed_bits: " << fixed_bits << " fixed_bytes: " << fixed_bytes;
     const auto shift_bits = fixed_bits & 7;
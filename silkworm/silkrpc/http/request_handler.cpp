@@ -23,6 +23,7 @@
 #include "request_handler.hpp"
 
 #include <iostream>
+#include <unordered_map>
 #include <vector>
 
 #include <boost/asio/write.hpp>
@@ -31,6 +32,7 @@
 #include <nlohmann/json.hpp>
 
 #include <silkworm/infra/common/log.hpp>
+#include <silkworm/infra/metrics/metrics.hpp>
 #include <silkworm/silkrpc/commands/eth_api.hpp>
 #include <silkworm/silkrpc/common/clock_time.hpp>
 #include <silkworm/silkrpc/http/header.hpp>
@@ -38,6 +40,18 @@
 
 namespace silkworm::rpc::http {
 
+//! Latency histogram of the specified method, cached per thread to avoid locking the registry for each request
+static metrics::Histogram& method_latency_histogram(const std::string& method) {
+    thread_local std::unordered_map<std::string, metrics::Histogram*> histograms;
+    auto& histogram = histograms[method];
+    if (!histogram) {
+        histogram = &metrics::Registry::instance().histogram(
+            "silkworm_rpc_request_duration_seconds", "Duration of JSON-RPC requests by method", {{"method", method}},
+            /*scale=*/1e-6);
+    }
+    return *histogram;
+}
+
 boost::asio::awaitable<void> RequestHandler::handle(const http::Request& request) {
     auto start = clock_time::now();
 
@@ -48,6 +62,33 @@ boost::asio::awaitable<void> RequestHandler::handle(const http::Request& request
     } else {
         SILK_DEBUG << "handle_user_request content: " << request.content;
 
+        // Single requests for glaze handlers are served on demand, i.e. without building the request JSON DOM
+        const auto request_view = json::RequestView::make(request.content);
+        const auto json_glaze_handler = request_view ? rpc_api_table_.find_json_glaze_handler(std::string{request_view->method()}) : std::nullopt;
+        if (json_glaze_handler) {
+            const auto error = co_await is_request_authorized(request);
+            if (error.has_value()) {
+                reply.content = make_json_error(request_view->id(), 403, error.value()).dump() + "\n";
+                reply.status = http::StatusType::unauthorized;
+            } else {
+                metrics::ScopedTimer timer{method_latency_histogram(std::string{request_view->method()})};
+                co_await handle_request(*json_glaze_handler, *request_view, reply);
+                reply.content += "\n";
+            }
+            co_await do_write(reply);
+            SILK_INFO << "handle_user_request t=" << clock_time::since(start) << "ns";
+            co_return;
+        }
+
+        // Batch items are split over the request content, so that each one is served as a single request
+        const auto batch_items = json::array_items(request.content);
+        if (batch_items) {
+            co_await handle_batch(request, *batch_items, reply);
+            co_await do_write(reply);
+            SILK_INFO << "handle_user_request t=" << clock_time::since(start) << "ns";
+            co_return;
+        }
+
         const auto request_json = nlohmann::json::parse(request.content);
 
         if (request_json.is_object()) {
@@ -66,32 +107,12 @@ boost::asio::awaitable<void> RequestHandler::handle(const http::Request& request
                 }
             }
         } else {
-            std::string batch_reply_content = "[";
-            bool first_element = true;
-            for (auto& item : request_json.items()) {
-                const auto& item_json = item.value();
-                if (!item_json.contains("id")) {
-                    reply.content = "\n";
-                    reply.status = http::StatusType::ok;
-                } else {
-                    auto request_id = item_json["id"].get<uint32_t>();
-                    const auto error = co_await is_request_authorized(request);
-                    if (error.has_value()) {
-                        reply.content = make_json_error(request_id, 403, error.value()).dump() + "\n";
-                        reply.status = http::StatusType::unauthorized;
-                    } else {
-                        if (first_element) {
-                            first_element = false;
-                        } else {
-                            batch_reply_content += ",";
-                        }
-                        co_await handle_request_and_create_reply(item_json, reply);
-                        batch_reply_content += reply.content;
-                    }
-                }
+            // Not an array according to the batch scanner, hence serialize the items back just to get their content
+            std::vector<std::string> item_contents;
+            for (const auto& item : request_json.items()) {
+                item_contents.push_back(item.value().dump());
             }
-            batch_reply_content += "]\n";
-            reply.content = batch_reply_content;
+            co_await handle_batch(request, std::vector<std::string_view>(item_contents.cbegin(), item_contents.cend()), reply);
         }
     }
 
@@ -100,6 +121,56 @@ boost::asio::awaitable<void> RequestHandler::handle(const http::Request& request
     SILK_INFO << "handle_user_request t=" << clock_time::since(start) << "ns";
 }
 
+boost::asio::awaitable<void> RequestHandler::handle_batch(const http::Request& request, const std::vector<std::string_view>& items, http::Reply& reply) {
+    std::string batch_reply_content = "[";
+    bool first_element = true;
+    for (const auto item : items) {
+        const bool has_reply = co_await handle_batch_item(request, item, reply);
+        if (!has_reply) continue;
+        if (first_element) {
+            first_element = false;
+        } else {
+            batch_reply_content += ",";
+        }
+        batch_reply_content += reply.content;
+    }
+    batch_reply_content += "]\n";
+    reply.content = std::move(batch_reply_content);
+}
+
+boost::asio::awaitable<bool> RequestHandler::handle_batch_item(const http::Request& request, std::string_view item, http::Reply& reply) {
+    // Items for glaze handlers are served on demand over their own content, i.e. without building any JSON DOM
+    const auto request_view = json::RequestView::make(item);
+    const auto json_glaze_handler = request_view ? rpc_api_table_.find_json_glaze_handler(std::string{request_view->method()}) : std::nullopt;
+    if (json_glaze_handler) {
+        const auto error = co_await is_request_authorized(request);
+        if (error.has_value()) {
+            reply.content = make_json_error(request_view->id(), 403, error.value()).dump() + "\n";
+            reply.status = http::StatusType::unauthorized;
+            co_return false;
+        }
+        metrics::ScopedTimer timer{method_latency_histogram(std::string{request_view->method()})};
+        co_await handle_request(*json_glaze_handler, *request_view, reply);
+        co_return true;
+    }
+
+    const auto item_json = nlohmann::json::parse(item);
+    if (!item_json.contains("id")) {
+        reply.content = "\n";
+        reply.status = http::StatusType::ok;
+        co_return false;
+    }
+    const auto request_id = item_json["id"].get<uint32_t>();
+    const auto error = co_await is_request_authorized(request);
+    if (error.has_value()) {
+        reply.content = make_json_error(request_id, 403, error.value()).dump() + "\n";
+        reply.status = http::StatusType::unauthorized;
+        co_return false;
+    }
+    co_await handle_request_and_create_reply(item_json, reply);
+    co_return true;
+}
+
 boost::asio::awaitable<void> RequestHandler::handle_request_and_create_reply(const nlohmann::json& request_json, http::Reply& reply) {
     const auto request_id = request_json["id"].get<uint32_t>();
     if (!request_json.contains("method")) {
@@ -116,18 +187,30 @@ boost::asio::awaitable<void> RequestHandler::handle_request_and_create_reply(con
     }
 
     // Dispatch JSON handlers in this order: 1) glaze JSON 2) nlohmann JSON 3) JSON streaming
+    // Latency is tracked just for available methods, so that metric labels cannot grow unbounded
     const auto json_glaze_handler = rpc_api_table_.find_json_glaze_handler(method);
     if (json_glaze_handler) {
-        co_await handle_request(request_id, *json_glaze_handler, request_json, reply);
+        // Requests not viewable on demand (e.g. escaped method name) have already been parsed, so serialize them back
+        const auto request_content = request_json.dump();
+        const auto request_view = json::RequestView::make(request_content);
+        if (!request_view) {
+            reply.content = make_json_error(request_id, -32600, "invalid request").dump();
+            reply.status = http::StatusType::bad_request;
+            co_return;
+        }
+        metrics::ScopedTimer timer{method_latency_histogram(method)};
+        co_await handle_request(*json_glaze_handler, *request_view, reply);
         co_return;
     }
     const auto json_handler = rpc_api_table_.find_json_handler(method);
     if (json_handler) {
+        metrics::ScopedTimer timer{method_latency_histogram(method)};
         co_await handle_request(request_id, *json_handler, request_json, reply);
         co_return;
     }
     const auto stream_handler = rpc_api_table_.find_stream_handler(method);
     if (stream_handler) {
+        metrics::ScopedTimer timer{method_latency_histogram(method)};
         co_await handle_request(*stream_handler, request_json);
         co_return;
     }
@@ -138,11 +221,12 @@ boost::asio::awaitable<void> RequestHandler::handle_request_and_create_reply(con
     co_return;
 }
 
-boost::asio::awaitable<void> RequestHandler::handle_request(uint32_t request_id, commands::RpcApiTable::HandleMethodGlaze handler, const nlohmann::json& request_json, http::Reply& reply) {
+boost::asio::awaitable<void> RequestHandler::handle_request(commands::RpcApiTable::HandleMethodGlaze handler, const json::RequestView& request, http::Reply& reply) {
+    const auto request_id = request.id();
     try {
         std::string reply_json;
         reply_json.reserve(2048);
-        co_await (rpc_api_.*handler)(request_json, reply_json);
+        co_await (rpc_api_.*handler)(request, reply_json);
         reply.status = http::StatusType::ok;
         reply.content = std::move(reply_json);
     } catch (const std::exception& e) {
@@ -19,7 +19,9 @@
 #include <map>
 #include <memory>
 #include <string>
+#include <string_view>
 #include <utility>
+#include <vector>
 
 #include <silkworm/infra/concurrency/coroutine.hpp>
 
@@ -54,12 +56,17 @@ class RequestHandler {
   private:
     boost::asio::awaitable<std::optional<std::string>> is_request_authorized(const http::Request& request);
 
+    //! Handle the items of a batch request given their raw JSON text, building the batch reply content
+    boost::asio::awaitable<void> handle_batch(const http::Request& request, const std::vector<std::string_view>& items, http::Reply& reply);
+
+    //! Handle one item of a batch request given its raw JSON text, returning true if the reply goes into the batch reply
+    boost::asio::awaitable<bool> handle_batch_item(const http::Request& request, std::string_view item, http::Reply& reply);
+
     boost::asio::awaitable<void> handle_request_and_create_reply(const nlohmann::json& request_json, http::Reply& reply);
 
     boost::asio::awaitable<void> handle_request(uint32_t request_id,
                                                 commands::RpcApiTable::HandleMethod handler, const nlohmann::json& request_json, http::Reply& reply);
-    boost::asio::awaitable<void> handle_request(uint32_t request_id,
-                                                commands::RpcApiTable::HandleMethodGlaze handler, const nlohmann::json& request_json, http::Reply& reply);
+    boost::asio::awaitable<void> handle_request(commands::RpcApiTable::HandleMethodGlaze handler, const json::RequestView& request, http::Reply& reply);
     boost::asio::awaitable<void> handle_request(commands::RpcApiTable::HandleStream handler, const nlohmann::json& request_json);
     boost::asio::awaitable<void> do_write(http::Reply& reply);
     boost::asio::awaitable<void> write_headers();
@@ -15,6 +15,7 @@
 */
 
 #include <cstring>
+#include <span>
 #include <utility>
 
 #include <silkworm/core/common/util.hpp>
@@ -22,6 +23,7 @@
 #include <silkworm/silkrpc/common/util.hpp>
 
 #include "filter.hpp"
+#include "glaze.hpp"
 #include "types.hpp"
 
 namespace silkworm::rpc {
@@ -84,4 +86,139 @@ void to_json(nlohmann::json& json, const Block& b) {
     }
 }
 
+struct GlazeJsonBlock {
+    char number[int64Size];
+    char hash[hashSize];
+    char parent_hash[hashSize];
+    char nonce[int64Size];
+    char sha3_uncles[hashSize];
+    char logs_bloom[bloomSize];
+    char transactions_root[hashSize];
+    std::optional<std::string> withdrawals_root;
+    char state_root[hashSize];
+    char receipts_root[hashSize];
+    char miner[addressSize];
+    char difficulty[int256Size];
+    char total_difficulty[int256Size];
+    std::string extra_data;
+    char mix_hash[hashSize];
+    char size[int64Size];
+    char gas_limit[int64Size];
+    char gas_used[int64Size];
+    std::optional<std::string> base_fee_per_gas;
+    char timestamp[int64Size];
+    std::variant<std::vector<std::string>, std::vector<GlazeJsonTransaction>> transactions;
+    std::vector<std::string> uncles;
+    std::optional<std::vector<GlazeJsonWithdrawal>> withdrawals;
+    struct glaze {
+        using T = GlazeJsonBlock;
+        static constexpr auto value = glz::object(
+            "number", &T::number,
+            "hash", &T::hash,
+            "parentHash", &T::parent_hash,
+            "nonce", &T::nonce,
+            "sha3Uncles", &T::sha3_uncles,
+            "logsBloom", &T::logs_bloom,
+            "transactionsRoot", &T::transactions_root,
+            "withdrawalsRoot", &T::withdrawals_root,
+            "stateRoot", &T::state_root,
+            "receiptsRoot", &T::receipts_root,
+            "miner", &T::miner,
+            "difficulty", &T::difficulty,
+            "totalDifficulty", &T::total_difficulty,
+            "extraData", &T::extra_data,
+            "mixHash", &T::mix_hash,
+            "size", &T::size,
+            "gasLimit", &T::gas_limit,
+            "gasUsed", &T::gas_used,
+            "baseFeePerGas", &T::base_fee_per_gas,
+            "timestamp", &T::timestamp,
+            "transactions", &T::transactions,
+            "uncles", &T::uncles,
+            "withdrawals", &T::withdrawals);
+    };
+};
+
+struct GlazeJsonBlockRsp {
+    char jsonrpc[jsonVersionSize] = "2.0";
+    uint32_t id;
+    GlazeJsonBlock block;
+    struct glaze {
+        using T = GlazeJsonBlockRsp;
+        static constexpr auto value = glz::object(
+            "jsonrpc", &T::jsonrpc,
+            "id", &T::id,
+            "result", &T::block);
+    };
+};
+
+void make_glaze_json_content(std::string& reply, uint32_t id, const Block& b) {
+    GlazeJsonBlockRsp block_json_data{};
+    block_json_data.id = id;
+
+    const auto& header = b.block.header;
+    auto& item = block_json_data.block;
+    to_quantity(std::span(item.number), header.number);
+    to_hex(std::span(item.hash), b.hash);
+    to_hex(std::span(item.parent_hash), header.parent_hash);
+    to_hex(std::span(item.nonce), ByteView{header.nonce.data(), header.nonce.size()});
+    to_hex(std::span(item.sha3_uncles), header.ommers_hash);
+    to_hex(std::span(item.logs_bloom), full_view(header.logs_bloom));
+    to_hex(std::span(item.transactions_root), header.transactions_root);
+    if (header.withdrawals_root) {
+        item.withdrawals_root = "0x" + silkworm::to_hex(*header.withdrawals_root);
+    }
+    to_hex(std::span(item.state_root), header.state_root);
+    to_hex(std::span(item.receipts_root), header.receipts_root);
+    to_hex(std::span(item.miner), header.beneficiary);
+    to_quantity(std::span(item.difficulty), header.difficulty);
+    to_quantity(std::span(item.total_difficulty), b.total_difficulty);
+    item.extra_data = "0x" + silkworm::to_hex(header.extra_data);
+    to_hex(std::span(item.mix_hash), header.prev_randao);
+    to_quantity(std::span(item.size), b.get_block_size());
+    to_quantity(std::span(item.gas_limit), header.gas_limit);
+    to_quantity(std::span(item.gas_used), header.gas_used);
+    if (header.base_fee_per_gas) {
+        item.base_fee_per_gas = to_quantity(*header.base_fee_per_gas);
+    }
+    to_quantity(std::span(item.timestamp), header.timestamp);
+
+    const auto& transactions = b.block.transactions;
+    if (b.full_tx) {
+        std::vector<GlazeJsonTransaction> json_transactions(transactions.size());
+        char block_hash[hashSize];
+        to_hex(std::span(block_hash), b.hash);
+        for (std::size_t i{0}; i < transactions.size(); ++i) {
+            auto& json_txn = json_transactions[i];
+            make_glaze_json_transaction(json_txn, transactions[i]);
+            to_quantity(std::span(json_txn.gas_price), transactions[i].effective_gas_price(header.base_fee_per_gas.value_or(0)));
+            make_glaze_json_quoted(json_txn.block_hash, block_hash);
+            make_glaze_json_quoted(json_txn.block_number, item.number);
+            make_glaze_json_quoted(json_txn.transaction_index, to_quantity(i).c_str());
+        }
+        item.transactions = std::move(json_transactions);
+    } else {
+        std::vector<std::string> transaction_hashes;
+        transaction_hashes.reserve(transactions.size());
+        for (const auto& transaction : transactions) {
+            const auto ethash_hash{hash_of_transaction(transaction)};
+            transaction_hashes.push_back("0x" + silkworm::to_hex({ethash_hash.bytes, silkworm::kHashLength}));
+        }
+        item.transactions = std::move(transaction_hashes);
+    }
+    item.uncles.reserve(b.block.ommers.size());
+    for (const auto& ommer : b.block.ommers) {
+        item.uncles.push_back("0x" + silkworm::to_hex(ommer.hash()));
+    }
+    if (b.block.withdrawals) {
+        std::vector<GlazeJsonWithdrawal> withdrawals(b.block.withdrawals->size());
+        for (std::size_t i{0}; i < withdrawals.size(); ++i) {
+            make_glaze_json_withdrawal(withdrawals[i], (*b.block.withdrawals)[i]);
+        }
+        item.withdrawals = std::move(withdrawals);
+    }
+
+    glz::write_json(block_json_data, reply);
+}
+
 }  // namespace silkworm::rpc
@@ -19,6 +19,8 @@
 #include <catch2/catch.hpp>
 #include <evmc/evmc.hpp>
 
+#include <silkworm/silkrpc/json/types.hpp>
+
 namespace silkworm::rpc {
 
 TEST_CASE("serialize block with baseFeePerGas", "[silkrpc][to_json]") {
@@ -216,4 +218,47 @@ TEST_CASE("serialize EIP-2718 block", "[silkrpc][to_json]") {
     })"_json);
 }
 
+TEST_CASE("make glaze json content for block", "[silkrpc][make_glaze_json_content]") {
+    const char* rlp_hex{
+        "f90319f90211a00000000000000000000000000000000000000000000000000000000000000000a01dcc4de8dec75d7aab85b567b6ccd4"
+        "1ad312451b948a7413f0a142fd40d49347948888f1f195afa192cfee860698584c030f4c9db1a0ef1552a40b7165c3cd773806b9e0c165"
+        "b75356e0314bf0706f279c729f51e017a0e6e49996c7ec59f7a23d22b83239a60151512c65613bf84a0d7da336399ebc4aa0cafe75574d"
+        "59780665a97fbfd11365c7545aa8f1abf4e5e12e8243334ef7286bb9010000000000000000000000000000000000000000000000000000"
+        "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000"
+        "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000"
+        "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000"
+        "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000"
+        "000000000000000000000083020000820200832fefd882a410845506eb0796636f6f6c65737420626c6f636b206f6e20636861696ea0bd"
+        "4472abb6659ebe3ee06ee4d7b72a00a9f4d001caca51342001075469aff49888a13a5a8c8f2bb1c4f90101f85f800a82c35094095e7bae"
+        "a6a6c7c4c2dfeb977efac326af552d870a801ba09bea4c4daac7c7c52e093e6a4c35dbbcf8856f1af7b059ba20253e70848d094fa08a8f"
+        "ae537ce25ed8cb5af9adac3f141af69bd515bd2ba031522df09b97dd72b1b89e01f89b01800a8301e24194095e7baea6a6c7c4c2dfeb97"
+        "7efac326af552d878080f838f7940000000000000000000000000000000000000001e1a000000000000000000000000000000000000000"
+        "0000000000000000000000000001a03dbacc8d0259f2508625e97fdfc57cd85fdd16e5821bc2c10bdd1a52649e8335a0476e10695b183a"
+        "87b0aa292a7f4b78ef0c3fbe62aa2c42c84e1d9c3da159ef14c0"};
+    silkworm::Bytes rlp_bytes{*silkworm::from_hex(rlp_hex)};
+    silkworm::ByteView view{rlp_bytes};
+
+    silkworm::rpc::Block rpc_block;
+    REQUIRE(silkworm::rlp::decode(view, rpc_block.block));
+    rpc_block.block.withdrawals = std::vector<silkworm::Withdrawal>{
+        {.index = 6, .validator_index = 12, .address = 0x8888f1f195afa192cfee860698584c030f4c9db1_address, .amount = 10'000},
+    };
+    rpc_block.block.header.base_fee_per_gas = 7;
+
+    // glaze and nlohmann serializations must be equivalent, whatever the order of the fields
+    SECTION("transaction hashes") {
+        rpc_block.full_tx = false;
+        std::string reply;
+        make_glaze_json_content(reply, 1, rpc_block);
+        CHECK(nlohmann::json::parse(reply) == make_json_content(1, rpc_block));
+    }
+
+    SECTION("full transactions") {
+        rpc_block.full_tx = true;
+        std::string reply;
+        make_glaze_json_content(reply, 1, rpc_block);
+        CHECK(nlohmann::json::parse(reply) == make_json_content(1, rpc_block));
+    }
+}
+
 }  // namespace silkworm::rpc
@@ -0,0 +1,99 @@
+/*
+   Copyright 2023 The Silkworm Authors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#include "glaze.hpp"
+
+#include <span>
+
+#include <silkworm/core/common/endian.hpp>
+#include <silkworm/core/common/util.hpp>
+#include <silkworm/silkrpc/common/util.hpp>
+
+namespace silkworm::rpc {
+
+void make_glaze_json_log(GlazeJsonLogItem& item, const Log& log) {
+    to_hex(std::span(item.address), log.address);
+    to_hex(std::span(item.tx_hash), log.tx_hash);
+    to_hex(std::span(item.block_hash), log.block_hash);
+    to_quantity(std::span(item.block_number), log.block_number);
+    to_quantity(std::span(item.tx_index), log.tx_index);
+    to_quantity(std::span(item.index), log.index);
+    item.removed = log.removed;
+    item.data = "0x" + silkworm::to_hex(log.data);
+    item.topics.reserve(log.topics.size());
+    for (const auto& t : log.topics) {
+        item.topics.push_back("0x" + silkworm::to_hex(t));
+    }
+}
+
+void make_glaze_json_transaction(GlazeJsonTransaction& item, const silkworm::Transaction& transaction) {
+    if (!transaction.from) {
+        (const_cast<silkworm::Transaction&>(transaction)).recover_sender();
+    }
+    if (transaction.from) {
+        item.from = "0x" + silkworm::to_hex(*transaction.from);
+    }
+    to_quantity(std::span(item.gas), transaction.gas_limit);
+    const auto ethash_hash{hash_of_transaction(transaction)};
+    to_hex(std::span(item.hash), ByteView{ethash_hash.bytes, silkworm::kHashLength});
+    item.input = "0x" + silkworm::to_hex(transaction.data);
+    to_quantity(std::span(item.nonce), transaction.nonce);
+    if (transaction.to) {
+        char to[addressSize];
+        to_hex(std::span(to), *transaction.to);
+        make_glaze_json_quoted(item.to, to);
+    } else {
+        item.to.str = "null";
+    }
+    to_quantity(std::span(item.type), static_cast<uint64_t>(transaction.type));
+
+    if (transaction.type == silkworm::TransactionType::kDynamicFee) {
+        item.max_priority_fee_per_gas = to_quantity(transaction.max_priority_fee_per_gas);
+        item.max_fee_per_gas = to_quantity(transaction.max_fee_per_gas);
+    }
+    if (transaction.type != silkworm::TransactionType::kLegacy) {
+        item.chain_id = to_quantity(*transaction.chain_id);
+        to_quantity(std::span(item.v), static_cast<uint64_t>(transaction.odd_y_parity));
+        std::vector<GlazeJsonAccessListEntry> access_list;  // EIP2930
+        access_list.reserve(transaction.access_list.size());
+        for (const auto& entry : transaction.access_list) {
+            GlazeJsonAccessListEntry& json_entry = access_list.emplace_back();
+            to_hex(std::span(json_entry.address), entry.account);
+            json_entry.storage_keys.reserve(entry.storage_keys.size());
+            for (const auto& storage_key : entry.storage_keys) {
+                json_entry.storage_keys.push_back("0x" + silkworm::to_hex(storage_key));
+            }
+        }
+        item.access_list = std::move(access_list);
+    } else {
+        if (transaction.chain_id) {
+            item.chain_id = to_quantity(*transaction.chain_id);
+        }
+        to_quantity(std::span(item.v), silkworm::endian::to_big_compact(transaction.v()));
+    }
+    to_quantity(std::span(item.value), transaction.value);
+    to_quantity(std::span(item.r), silkworm::endian::to_big_compact(transaction.r));
+    to_quantity(std::span(item.s), silkworm::endian::to_big_compact(transaction.s));
+}
+
+void make_glaze_json_withdrawal(GlazeJsonWithdrawal& item, const Withdrawal& withdrawal) {
+    to_quantity(std::span(item.index), withdrawal.index);
+    to_quantity(std::span(item.validator_index), withdrawal.validator_index);
+    to_hex(std::span(item.address), withdrawal.address);
+    to_quantity(std::span(item.amount), withdrawal.amount);
+}
+
+}  // namespace silkworm::rpc
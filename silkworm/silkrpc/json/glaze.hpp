@@ -0,0 +1,141 @@
+/*
+   Copyright 2023 The Silkworm Authors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#pragma once
+
+#include <optional>
+#include <string>
+#include <variant>
+#include <vector>
+
+#include <silkworm/core/types/transaction.hpp>
+#include <silkworm/core/types/withdrawal.hpp>
+#include <silkworm/silkrpc/json/types.hpp>
+#include <silkworm/silkrpc/types/log.hpp>
+
+// Glaze models of the JSON objects shared by multiple replies: each model is filled from the corresponding type and
+// written straight into the reply buffer, so no intermediate JSON DOM is built. Optional members left empty are skipped.
+
+namespace silkworm::rpc {
+
+struct GlazeJsonLogItem {
+    char address[addressSize];
+    char tx_hash[hashSize];
+    char block_hash[hashSize];
+    char block_number[int64Size];
+    char tx_index[int64Size];
+    char index[int64Size];
+    std::string data;
+    bool removed;
+    std::vector<std::string> topics;
+
+    struct glaze {
+        using T = GlazeJsonLogItem;
+        static constexpr auto value = glz::object(
+            "address", &T::address,
+            "transactionHash", &T::tx_hash,
+            "blockHash", &T::block_hash,
+            "blockNumber", &T::block_number,
+            "transactionIndex", &T::tx_index,
+            "logIndex", &T::index,
+            "data", &T::data,
+            "removed", &T::removed,
+            "topics", &T::topics);
+    };
+};
+
+struct GlazeJsonAccessListEntry {
+    char address[addressSize];
+    std::vector<std::string> storage_keys;
+
+    struct glaze {
+        using T = GlazeJsonAccessListEntry;
+        static constexpr auto value = glz::object(
+            "address", &T::address,
+            "storageKeys", &T::storage_keys);
+    };
+};
+
+struct GlazeJsonTransaction {
+    std::optional<std::string> from;
+    char gas[int64Size];
+    char hash[hashSize];
+    std::string input;
+    char nonce[int64Size];
+    glz::raw_json to;
+    char type[int64Size];
+    std::optional<std::string> max_priority_fee_per_gas;
+    std::optional<std::string> max_fee_per_gas;
+    std::optional<std::string> chain_id;
+    char v[int256Size];
+    std::optional<std::vector<GlazeJsonAccessListEntry>> access_list;
+    char value[int256Size];
+    char r[int256Size];
+    char s[int256Size];
+    char gas_price[int256Size];
+    glz::raw_json block_hash;
+    glz::raw_json block_number;
+    glz::raw_json transaction_index;
+
+    struct glaze {
+        using T = GlazeJsonTransaction;
+        static constexpr auto value = glz::object(
+            "from", &T::from,
+            "gas", &T::gas,
+            "hash", &T::hash,
+            "input", &T::input,
+            "nonce", &T::nonce,
+            "to", &T::to,
+            "type", &T::type,
+            "maxPriorityFeePerGas", &T::max_priority_fee_per_gas,
+            "maxFeePerGas", &T::max_fee_per_gas,
+            "chainId", &T::chain_id,
+            "v", &T::v,
+            "accessList", &T::access_list,
+            "value", &T::value,
+            "r", &T::r,
+            "s", &T::s,
+            "gasPrice", &T::gas_price,
+            "blockHash", &T::block_hash,
+            "blockNumber", &T::block_number,
+            "transactionIndex", &T::transaction_index);
+    };
+};
+
+struct GlazeJsonWithdrawal {
+    char index[int64Size];
+    char validator_index[int64Size];
+    char address[addressSize];
+    char amount[int64Size];
+
+    struct glaze {
+        using T = GlazeJsonWithdrawal;
+        static constexpr auto value = glz::object(
+            "index", &T::index,
+            "validatorIndex", &T::validator_index,
+            "address", &T::address,
+            "amount", &T::amount);
+    };
+};
+
+void make_glaze_json_log(GlazeJsonLogItem& item, const Log& log);
+
+//! Fills all the transaction fields except gasPrice, blockHash, blockNumber and transactionIndex
+void make_glaze_json_transaction(GlazeJsonTransaction& item, const silkworm::Transaction& transaction);
+
+void make_glaze_json_withdrawal(GlazeJsonWithdrawal& item, const Withdrawal& withdrawal);
+
+}  // namespace silkworm::rpc
@@ -0,0 +1,130 @@
+/*
+   Copyright 2023 The Silkworm Authors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#include <string>
+
+#include <benchmark/benchmark.h>
+
+#include <silkworm/core/common/test_util.hpp>
+#include <silkworm/silkrpc/json/types.hpp>
+
+namespace silkworm::rpc {
+
+//! A block with full transactions, i.e. the typical eth_getBlockByNumber(number, true) reply
+static Block sample_block() {
+    Block block;
+    block.block.header.number = 17'000'000;
+    block.block.header.gas_limit = 30'000'000;
+    block.block.header.base_fee_per_gas = 30'000'000'000;
+    block.block.header.extra_data = *from_hex("6265617665726275696c642e6f7267");
+    const auto transactions{test::sample_transactions()};
+    for (size_t i{0}; i < 100; ++i) {
+        block.block.transactions.push_back(transactions[i % transactions.size()]);
+        block.block.transactions.back().nonce = i;
+        block.block.transactions.back().from = 0x007fb8417eb9ad4d958b050fc3720d5b46a2c053_address;
+    }
+    block.full_tx = true;
+    return block;
+}
+
+static void json_block_nlohmann(benchmark::State& state) {
+    const Block block{sample_block()};
+    int64_t bytes{0};
+    for ([[maybe_unused]] auto _ : state) {
+        const std::string reply{make_json_content(1, block).dump()};
+        bytes += static_cast<int64_t>(reply.size());
+        benchmark::DoNotOptimize(reply.data());
+    }
+    state.SetBytesProcessed(bytes);
+}
+
+BENCHMARK(json_block_nlohmann);
+
+static void json_block_glaze(benchmark::State& state) {
+    const Block block{sample_block()};
+    int64_t bytes{0};
+    std::string reply;
+    for ([[maybe_unused]] auto _ : state) {
+        reply.clear();
+        make_glaze_json_content(reply, 1, block);
+        bytes += static_cast<int64_t>(reply.size());
+        benchmark::DoNotOptimize(reply.data());
+    }
+    state.SetBytesProcessed(bytes);
+}
+
+BENCHMARK(json_block_glaze);
+
+//! A receipt carrying a few logs, i.e. the typical eth_getTransactionReceipt reply
+static Receipt sample_receipt() {
+    Receipt receipt{
+        .success = true,
+        .cumulative_gas_used = 454'647,
+        .tx_hash = 0x374f3a049e006f36f6cf91b02a3b0ee16c858af2f75858733eb0e927b5b7126c_bytes32,
+        .gas_used = 52'000,
+        .block_hash = 0xb02a3b0ee16c858afaa34bcd6770b3c20ee56aa2f75858733eb0e927b5b7126f_bytes32,
+        .block_number = 17'000'000,
+        .tx_index = 3,
+        .from = 0x007fb8417eb9ad4d958b050fc3720d5b46a2c053_address,
+        .to = 0x0715a7794a1dc8e42615f059dd6e406a6594651a_address,
+        .type = 2,
+        .effective_gas_price = 30'000'000'000,
+    };
+    for (uint32_t i{0}; i < 4; ++i) {
+        receipt.logs.push_back(Log{
+            .address = 0x0715a7794a1dc8e42615f059dd6e406a6594651a_address,
+            .topics = {0xddf252ad1be2c89b69c2b068fc378daa952ba7f163c4a11628f55a4df523b3ef_bytes32},
+            .data = Bytes(32, 0xab),
+            .block_number = receipt.block_number,
+            .tx_hash = receipt.tx_hash,
+            .tx_index = receipt.tx_index,
+            .block_hash = receipt.block_hash,
+            .index = i,
+        });
+    }
+    receipt.bloom = bloom_from_logs(receipt.logs);
+    return receipt;
+}
+
+static void json_receipt_nlohmann(benchmark::State& state) {
+    const Receipt receipt{sample_receipt()};
+    int64_t bytes{0};
+    for ([[maybe_unused]] auto _ : state) {
+        const std::string reply{make_json_content(1, receipt).dump()};
+        bytes += static_cast<int64_t>(reply.size());
+        benchmark::DoNotOptimize(reply.data());
+    }
+    state.SetBytesProcessed(bytes);
+}
+
+BENCHMARK(json_receipt_nlohmann);
+
+static void json_receipt_glaze(benchmark::State& state) {
+    const Receipt receipt{sample_receipt()};
+    int64_t bytes{0};
+    std::string reply;
+    for ([[maybe_unused]] auto _ : state) {
+        reply.clear();
+        make_glaze_json_content(reply, 1, receipt);
+        bytes += static_cast<int64_t>(reply.size());
+        benchmark::DoNotOptimize(reply.data());
+    }
+    state.SetBytesProcessed(bytes);
+}
+
+BENCHMARK(json_receipt_glaze);
+
+}  // namespace silkworm::rpc
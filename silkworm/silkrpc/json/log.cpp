@@ -23,6 +23,7 @@
 #include <silkworm/core/common/util.hpp>
 #include <silkworm/silkrpc/common/util.hpp>
 
+#include "glaze.hpp"
 #include "types.hpp"
 
 namespace silkworm::rpc {
@@ -74,32 +75,6 @@ void from_json(const nlohmann::json& json, Log& log) {
     }
 }
 
-struct GlazeJsonLogItem {
-    char address[addressSize];
-    char tx_hash[hashSize];
-    char block_hash[hashSize];
-    char block_number[int64Size];
-    char tx_index[int64Size];
-    char index[int64Size];
-    char data[dataSize];
-    bool removed;
-    std::vector<std::string> topics;
-
-    struct glaze {
-        using T = GlazeJsonLogItem;
-        static constexpr auto value = glz::object(
-            "address", &T::address,
-            "transactionHash", &T::tx_hash,
-            "blockHash", &T::block_hash,
-            "blockNumber", &T::block_number,
-            "transactionIndex", &T::tx_index,
-            "logIndex", &T::index,
-            "data", &T::data,
-            "removed", &T::removed,
-            "topics", &T::topics);
-    };
-};
-
 struct GlazeJsonLog {
     char jsonrpc[jsonVersionSize] = "2.0";
     uint32_t id;
@@ -120,19 +95,7 @@ void make_glaze_json_content(std::string& reply, uint32_t id, const Logs& logs)
     log_json_data.id = id;
 
     for (const auto& l : logs) {
-        GlazeJsonLogItem item{};
-        to_hex(std::span(item.address), l.address);
-        to_hex(std::span(item.tx_hash), l.tx_hash);
-        to_hex(std::span(item.block_hash), l.block_hash);
-        to_quantity(std::span(item.block_number), l.block_number);
-        to_quantity(std::span(item.tx_index), l.tx_index);
-        to_quantity(std::span(item.index), l.index);
-        item.removed = l.removed;
-        to_hex(item.data, l.data);
-        for (const auto& t : l.topics) {
-            item.topics.push_back("0x" + silkworm::to_hex(t));
-        }
-        log_json_data.log_json_list.push_back(item);
+        make_glaze_json_log(log_json_data.log_json_list.emplace_back(), l);
     }
 
     glz::write_json(log_json_data, reply);
@@ -17,12 +17,14 @@
 #include "receipt.hpp"
 
 #include <cstring>
+#include <span>
 #include <utility>
 
 #include <silkworm/core/common/util.hpp>
 #include <silkworm/infra/common/log.hpp>
 #include <silkworm/silkrpc/common/util.hpp>
 
+#include "glaze.hpp"
 #include "types.hpp"
 
 namespace silkworm::rpc {
@@ -48,6 +50,86 @@ void to_json(nlohmann::json& json, const Receipt& receipt) {
     json["status"] = to_quantity(receipt.success ? 1 : 0);
 }
 
+struct GlazeJsonReceipt {
+    char block_hash[hashSize];
+    char block_number[int64Size];
+    char tx_hash[hashSize];
+    char tx_index[int64Size];
+    char from[addressSize];
+    char to[addressSize];
+    char type[int64Size];
+    char gas_used[int64Size];
+    char cumulative_gas_used[int64Size];
+    char effective_gas_price[int256Size];
+    glz::raw_json contract_address;
+    std::vector<GlazeJsonLogItem> logs;
+    char logs_bloom[bloomSize];
+    char status[int64Size];
+    struct glaze {
+        using T = GlazeJsonReceipt;
+        static constexpr auto value = glz::object(
+            "blockHash", &T::block_hash,
+            "blockNumber", &T::block_number,
+            "transactionHash", &T::tx_hash,
+            "transactionIndex", &T::tx_index,
+            "from", &T::from,
+            "to", &T::to,
+            "type", &T::type,
+            "gasUsed", &T::gas_used,
+            "cumulativeGasUsed", &T::cumulative_gas_used,
+            "effectiveGasPrice", &T::effective_gas_price,
+            "contractAddress", &T::contract_address,
+            "logs", &T::logs,
+            "logsBloom", &T::logs_bloom,
+            "status", &T::status);
+    };
+};
+
+struct GlazeJsonReceiptRsp {
+    char jsonrpc[jsonVersionSize] = "2.0";
+    uint32_t id;
+    GlazeJsonReceipt receipt;
+    struct glaze {
+        using T = GlazeJsonReceiptRsp;
+        static constexpr auto value = glz::object(
+            "jsonrpc", &T::jsonrpc,
+            "id", &T::id,
+            "result", &T::receipt);
+    };
+};
+
+void make_glaze_json_content(std::string& reply, uint32_t id, const Receipt& receipt) {
+    GlazeJsonReceiptRsp receipt_json_data{};
+    receipt_json_data.id = id;
+
+    auto& item = receipt_json_data.receipt;
+    to_hex(std::span(item.block_hash), receipt.block_hash);
+    to_quantity(std::span(item.block_number), receipt.block_number);
+    to_hex(std::span(item.tx_hash), receipt.tx_hash);
+    to_quantity(std::span(item.tx_index), receipt.tx_index);
+    to_hex(std::span(item.from), receipt.from.value_or(evmc::address{}));
+    to_hex(std::span(item.to), receipt.to.value_or(evmc::address{}));
+    to_quantity(std::span(item.type), static_cast<uint64_t>(receipt.type ? receipt.type.value() : 0));
+    to_quantity(std::span(item.gas_used), receipt.gas_used);
+    to_quantity(std::span(item.cumulative_gas_used), receipt.cumulative_gas_used);
+    to_quantity(std::span(item.effective_gas_price), receipt.effective_gas_price);
+    if (receipt.contract_address) {
+        char contract_address[addressSize];
+        to_hex(std::span(contract_address), receipt.contract_address);
+        make_glaze_json_quoted(item.contract_address, contract_address);
+    } else {
+        item.contract_address.str = "null";
+    }
+    item.logs.reserve(receipt.logs.size());
+    for (const auto& log : receipt.logs) {
+        make_glaze_json_log(item.logs.emplace_back(), log);
+    }
+    to_hex(std::span(item.logs_bloom), full_view(receipt.bloom));
+    to_quantity(std::span(item.status), uint64_t{receipt.success ? 1u : 0u});
+
+    glz::write_json(receipt_json_data, reply);
+}
+
 void from_json(const nlohmann::json& json, Receipt& receipt) {
     SILK_TRACE << "from_json<Receipt> json: " << json.dump();
     if (json.is_array()) {
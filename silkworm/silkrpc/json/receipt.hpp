@@ -16,6 +16,8 @@
 
 #pragma once
 
+#include <string>
+
 #include <nlohmann/json.hpp>
 
 #include <silkworm/silkrpc/types/receipt.hpp>
@@ -25,4 +27,6 @@ namespace silkworm::rpc {
 void to_json(nlohmann::json& json, const Receipt& receipt);
 void from_json(const nlohmann::json& json, Receipt& receipt);
 
+void make_glaze_json_content(std::string& reply, uint32_t id, const Receipt& receipt);
+
 }  // namespace silkworm::rpc
@@ -19,6 +19,8 @@
 #include <catch2/catch.hpp>
 #include <evmc/evmc.hpp>
 
+#include <silkworm/silkrpc/json/types.hpp>
+
 namespace silkworm::rpc {
 
 using Catch::Matchers::Message;
@@ -143,4 +145,47 @@ TEST_CASE("serialize receipt", "[silkworm::json][to_json]") {
     })"_json);
 }
 
+TEST_CASE("make glaze json content for receipt", "[silkrpc][make_glaze_json_content]") {
+    Receipt r{
+        true,
+        454647,
+        silkworm::Bloom{},
+        Logs{},
+        0x374f3a049e006f36f6cf91b02a3b0ee16c858af2f75858733eb0e927b5b7126c_bytes32,
+        0x0715a7794a1dc8e42615f059dd6e406a6594651a_address,
+        10,
+        0xb02a3b0ee16c858afaa34bcd6770b3c20ee56aa2f75858733eb0e927b5b7126f_bytes32,
+        5000000,
+        3,
+        0x22ea9f6b28db76a7162054c05ed812deb2f519cd_address,
+        0x22ea9f6b28db76a7162054c05ed812deb2f519cd_address,
+        1,
+        2000000000};
+    r.logs.push_back(Log{
+        .address = 0x0715a7794a1dc8e42615f059dd6e406a6594651a_address,
+        .topics = {0x374f3a049e006f36f6cf91b02a3b0ee16c858af2f75858733eb0e927b5b7126c_bytes32},
+        .data = Bytes(4'000, 0xab),  // larger than any fixed-size field
+        .block_number = 5000000,
+        .tx_hash = 0x374f3a049e006f36f6cf91b02a3b0ee16c858af2f75858733eb0e927b5b7126c_bytes32,
+        .tx_index = 3,
+        .block_hash = 0xb02a3b0ee16c858afaa34bcd6770b3c20ee56aa2f75858733eb0e927b5b7126f_bytes32,
+        .index = 12,
+    });
+    r.bloom = bloom_from_logs(r.logs);
+
+    // glaze and nlohmann serializations must be equivalent, whatever the order of the fields
+    SECTION("contract creation") {
+        std::string reply;
+        make_glaze_json_content(reply, 1, r);
+        CHECK(nlohmann::json::parse(reply) == make_json_content(1, r));
+    }
+
+    SECTION("no contract creation") {
+        r.contract_address = evmc::address{};
+        std::string reply;
+        make_glaze_json_content(reply, 1, r);
+        CHECK(nlohmann::json::parse(reply) == make_json_content(1, r));
+    }
+}
+
 }  // namespace silkworm::rpc
@@ -0,0 +1,186 @@
+/*
+   Copyright 2023 The Silkworm Authors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#include "request_view.hpp"
+
+#include <cctype>
+#include <charconv>
+
+namespace silkworm::rpc::json {
+
+static constexpr auto npos{std::string_view::npos};
+
+static bool is_whitespace(char c) {
+    return c == ' ' || c == '\t' || c == '\n' || c == '\r';
+}
+
+static size_t skip_whitespace(std::string_view s, size_t pos) {
+    while (pos < s.size() && is_whitespace(s[pos])) ++pos;
+    return pos;
+}
+
+//! Position past the end of the JSON string starting at pos, npos if unterminated
+static size_t skip_string(std::string_view s, size_t pos) {
+    for (++pos; pos < s.size(); ++pos) {
+        if (s[pos] == '\\') {
+            ++pos;  // skip escaped char
+        } else if (s[pos] == '"') {
+            return pos + 1;
+        }
+    }
+    return npos;
+}
+
+//! Position past the end of the JSON literal or number starting at pos, npos if malformed
+static size_t skip_scalar(std::string_view s, size_t pos) {
+    for (const std::string_view literal : {"true", "false", "null"}) {
+        if (s.substr(pos, literal.size()) == literal) return pos + literal.size();
+    }
+    const size_t start{pos};
+    while (pos < s.size() && (std::isdigit(static_cast<unsigned char>(s[pos])) || s[pos] == '-' || s[pos] == '+' ||
+                              s[pos] == '.' || s[pos] == 'e' || s[pos] == 'E')) {
+        ++pos;
+    }
+    return pos == start ? npos : pos;
+}
+
+//! \brief Position past the end of the JSON value starting at pos, npos if malformed
+//! \remarks Nested values are just skipped matching their brackets: they are fully validated only if parsed later on
+static size_t skip_value(std::string_view s, size_t pos) {
+    if (pos >= s.size()) return npos;
+    if (s[pos] == '"') return skip_string(s, pos);
+    if (s[pos] != '{' && s[pos] != '[') return skip_scalar(s, pos);
+
+    size_t depth{0};
+    while (pos < s.size()) {
+        const char c{s[pos]};
+        if (c == '"') {
+            pos = skip_string(s, pos);
+            if (pos == npos) return npos;
+            continue;
+        }
+        if (c == '{' || c == '[') {
+            ++depth;
+        } else if (c == '}' || c == ']') {
+            if (--depth == 0) return pos + 1;
+        }
+        ++pos;
+    }
+    return npos;
+}
+
+static std::optional<uint32_t> uint32_value(std::string_view raw) {
+    uint32_t value{0};
+    const auto [ptr, ec] = std::from_chars(raw.data(), raw.data() + raw.size(), value);
+    if (ec != std::errc{} || ptr != raw.data() + raw.size()) return std::nullopt;
+    return value;
+}
+
+std::optional<RequestView> RequestView::make(std::string_view content) {
+    size_t pos{skip_whitespace(content, 0)};
+    if (pos >= content.size() || content[pos] != '{') return std::nullopt;
+    pos = skip_whitespace(content, pos + 1);
+
+    std::optional<uint32_t> id;
+    std::optional<std::string_view> method;
+    std::string_view params;
+    if (pos < content.size() && content[pos] == '}') {
+        ++pos;
+    } else {
+        while (true) {
+            if (pos >= content.size() || content[pos] != '"') return std::nullopt;
+            const size_t key_end{skip_string(content, pos)};
+            if (key_end == npos) return std::nullopt;
+            const std::string_view key{content.substr(pos + 1, key_end - pos - 2)};
+
+            pos = skip_whitespace(content, key_end);
+            if (pos >= content.size() || content[pos] != ':') return std::nullopt;
+            pos = skip_whitespace(content, pos + 1);
+            const size_t value_end{skip_value(content, pos)};
+            if (value_end == npos) return std::nullopt;
+            const std::string_view value{content.substr(pos, value_end - pos)};
+
+            // Duplicate members are allowed: the last one wins as in full parsing
+            if (key == "id") {
+                id = uint32_value(value);
+                if (!id) return std::nullopt;
+            } else if (key == "method") {
+                method = string_value(value);
+                if (!method) return std::nullopt;
+            } else if (key == "params") {
+                params = value;
+            }
+
+            pos = skip_whitespace(content, value_end);
+            if (pos >= content.size()) return std::nullopt;
+            if (content[pos] == '}') {
+                ++pos;
+                break;
+            }
+            if (content[pos] != ',') return std::nullopt;
+            pos = skip_whitespace(content, pos + 1);
+        }
+    }
+    if (skip_whitespace(content, pos) != content.size()) return std::nullopt;
+
+    // Notifications (i.e. no id) and invalid requests (i.e. no method) are left to full parsing
+    if (!id || !method) return std::nullopt;
+
+    return RequestView{content, *id, *method, params};
+}
+
+std::optional<std::vector<std::string_view>> RequestView::param_items() const {
+    return array_items(params_);
+}
+
+nlohmann::json RequestView::parse_params() const {
+    if (params_.empty()) return nlohmann::json{};
+    return nlohmann::json::parse(params_);
+}
+
+std::optional<std::vector<std::string_view>> array_items(std::string_view raw) {
+    size_t pos{skip_whitespace(raw, 0)};
+    if (pos >= raw.size() || raw[pos] != '[') return std::nullopt;
+
+    std::vector<std::string_view> items;
+    pos = skip_whitespace(raw, pos + 1);
+    if (pos < raw.size() && raw[pos] == ']') {
+        return skip_whitespace(raw, pos + 1) == raw.size() ? std::make_optional(items) : std::nullopt;
+    }
+    while (pos < raw.size()) {
+        const size_t item_end{skip_value(raw, pos)};
+        if (item_end == npos) return std::nullopt;
+        items.push_back(raw.substr(pos, item_end - pos));
+
+        pos = skip_whitespace(raw, item_end);
+        if (pos >= raw.size()) return std::nullopt;
+        if (raw[pos] == ']') {
+            return skip_whitespace(raw, pos + 1) == raw.size() ? std::make_optional(items) : std::nullopt;
+        }
+        if (raw[pos] != ',') return std::nullopt;
+        pos = skip_whitespace(raw, pos + 1);
+    }
+    return std::nullopt;
+}
+
+std::optional<std::string_view> string_value(std::string_view raw) {
+    if (raw.size() < 2 || raw.front() != '"' || raw.back() != '"') return std::nullopt;
+    const std::string_view value{raw.substr(1, raw.size() - 2)};
+    if (value.find('\\') != npos) return std::nullopt;
+    return value;
+}
+
+}  // namespace silkworm::rpc::json
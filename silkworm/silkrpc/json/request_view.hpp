@@ -0,0 +1,72 @@
+/*
+   Copyright 2023 The Silkworm Authors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#pragma once
+
+#include <cstdint>
+#include <optional>
+#include <string_view>
+#include <vector>
+
+#include <nlohmann/json.hpp>
+
+namespace silkworm::rpc::json {
+
+//! \brief On-demand view over a single JSON-RPC request object
+//! \details id, method and raw params are located by just one scan of the request content, so no JSON DOM gets built
+//! unless some handler asks for it. The viewed content must outlive the view.
+class RequestView {
+  public:
+    //! \brief Scans the specified content looking for a JSON-RPC request object
+    //! \return the request view or std::nullopt if content is not a request object having an unsigned integer id and
+    //! a method name without escape sequences: callers should fall back to full parsing in such case
+    static std::optional<RequestView> make(std::string_view content);
+
+    [[nodiscard]] std::string_view content() const { return content_; }
+    [[nodiscard]] uint32_t id() const { return id_; }
+    [[nodiscard]] std::string_view method() const { return method_; }
+
+    //! Raw JSON text of the params member, empty if missing
+    [[nodiscard]] std::string_view params() const { return params_; }
+
+    //! \brief Raw JSON text of each params array item, to decode typed parameters without building any DOM
+    //! \return the array items or std::nullopt if params is not an array
+    [[nodiscard]] std::optional<std::vector<std::string_view>> param_items() const;
+
+    //! \brief Parses params into a full DOM, for handlers still decoding parameters with nlohmann
+    //! \return the params DOM or null if params is missing
+    [[nodiscard]] nlohmann::json parse_params() const;
+
+  private:
+    RequestView(std::string_view content, uint32_t id, std::string_view method, std::string_view params)
+        : content_{content}, id_{id}, method_{method}, params_{params} {}
+
+    std::string_view content_;
+    uint32_t id_;
+    std::string_view method_;
+    std::string_view params_;
+};
+
+//! \brief Raw JSON text of each item of the specified raw JSON array, surrounding whitespace allowed
+//! \return the array items or std::nullopt if raw is not an array
+//! \remarks Items are just delimited, not validated: e.g. this splits a batch request without building any DOM
+std::optional<std::vector<std::string_view>> array_items(std::string_view raw);
+
+//! \brief Content of the specified raw JSON string (i.e. without the enclosing quotes)
+//! \return the string content or std::nullopt if raw is not a JSON string or contains escape sequences
+std::optional<std::string_view> string_value(std::string_view raw);
+
+}  // namespace silkworm::rpc::json
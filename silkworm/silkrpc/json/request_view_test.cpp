@@ -0,0 +1,146 @@
+/*
+   Copyright 2023 The Silkworm Authors
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+*/
+
+#include "request_view.hpp"
+
+#include <catch2/catch.hpp>
+
+namespace silkworm::rpc::json {
+
+TEST_CASE("RequestView::make", "[rpc][json][request_view]") {
+    SECTION("valid request") {
+        const std::string content{R"({"jsonrpc":"2.0","id":7,"method":"eth_getLogs","params":[{"fromBlock":"0x1"}]})"};
+        const auto request{RequestView::make(content)};
+        REQUIRE(request);
+        CHECK(request->id() == 7);
+        CHECK(request->method() == "eth_getLogs");
+        CHECK(request->params() == R"([{"fromBlock":"0x1"}])");
+        CHECK(request->content() == content);
+    }
+    SECTION("valid request w/ whitespaces and member reordering") {
+        const std::string content{" {\n\t\"params\" : [ \"0x1\" , true ] ,\"method\": \"eth_call\", \"id\" : 1 }\r\n"};
+        const auto request{RequestView::make(content)};
+        REQUIRE(request);
+        CHECK(request->id() == 1);
+        CHECK(request->method() == "eth_call");
+        CHECK(request->params() == R"([ "0x1" , true ])");
+    }
+    SECTION("valid request w/ nested brackets and escapes in strings") {
+        const std::string content{R"({"id":2,"params":[{"a":"}]\"["},[[]]],"method":"m"})"};
+        const auto request{RequestView::make(content)};
+        REQUIRE(request);
+        CHECK(request->method() == "m");
+        CHECK(request->params() == R"([{"a":"}]\"["},[[]]])");
+    }
+    SECTION("valid request w/o params") {
+        const auto request{RequestView::make(R"({"id":3,"method":"eth_blockNumber"})")};
+        REQUIRE(request);
+        CHECK(request->params().empty());
+        CHECK(request->parse_params().is_null());
+        CHECK(!request->param_items());
+    }
+    SECTION("duplicate members: last wins") {
+        const auto request{RequestView::make(R"({"id":1,"method":"a","id":2,"method":"b"})")};
+        REQUIRE(request);
+        CHECK(request->id() == 2);
+        CHECK(request->method() == "b");
+    }
+    SECTION("fallback cases") {
+        CHECK(!RequestView::make(""));
+        CHECK(!RequestView::make("[]"));
+        CHECK(!RequestView::make(R"([{"id":1,"method":"m"}])"));
+        CHECK(!RequestView::make("{}"));
+        CHECK(!RequestView::make(R"({"method":"m"})"));
+        CHECK(!RequestView::make(R"({"id":1})"));
+        CHECK(!RequestView::make(R"({"id":"1","method":"m"})"));
+        CHECK(!RequestView::make(R"({"id":-1,"method":"m"})"));
+        CHECK(!RequestView::make(R"({"id":1.5,"method":"m"})"));
+        CHECK(!RequestView::make(R"({"id":4294967296,"method":"m"})"));
+        CHECK(!RequestView::make(R"({"id":1,"method":"eth_call"})"));
+        CHECK(!RequestView::make(R"({"id":1,"method":"m","params":[})"));
+        CHECK(!RequestView::make(R"({"id":1,"method":"m",})"));
+        CHECK(!RequestView::make(R"({"id":1,"method":"m"} {})"));
+        CHECK(!RequestView::make(R"({"id":1 "method":"m"})"));
+        CHECK(!RequestView::make(R"({"id":1,"method":"m","params":nope})"));
+    }
+}
+
+TEST_CASE("RequestView::param_items", "[rpc][json][request_view]") {
+    SECTION("empty array") {
+        const auto request{RequestView::make(R"({"id":1,"method":"m","params":[ ]})")};
+        REQUIRE(request);
+        const auto items{request->param_items()};
+        REQUIRE(items);
+        CHECK(items->empty());
+    }
+    SECTION("heterogeneous array") {
+        const auto request{RequestView::make(R"({"id":1,"method":"m","params":["0x01", {"a":[1,2]}, null, -1.5e3]})")};
+        REQUIRE(request);
+        const auto items{request->param_items()};
+        REQUIRE(items);
+        CHECK(*items == std::vector<std::string_view>{R"("0x01")", R"({"a":[1,2]})", "null", "-1.5e3"});
+    }
+    SECTION("not an array") {
+        const auto request{RequestView::make(R"({"id":1,"method":"m","params":{"a":1}})")};
+        REQUIRE(request);
+        CHECK(!request->param_items());
+        CHECK(request->parse_params() == R"({"a":1})"_json);
+    }
+}
+
+TEST_CASE("RequestView::parse_params", "[rpc][json][request_view]") {
+    const auto request{RequestView::make(R"({"id":1,"method":"m","params":["0x01",false]})")};
+    REQUIRE(request);
+    CHECK(request->parse_params() == R"(["0x01",false])"_json);
+}
+
+TEST_CASE("array_items", "[rpc][json][request_view]") {
+    SECTION("batch request w/ surrounding whitespaces") {
+        const std::string_view batch{" [{\"id\":1,\"method\":\"a\"}, {\"id\":2,\"method\":\"b\",\"params\":[\"]\"]}]\n"};
+        const auto items{array_items(batch)};
+        REQUIRE(items);
+        REQUIRE(items->size() == 2);
+        CHECK((*items)[0] == R"({"id":1,"method":"a"})");
+        CHECK((*items)[1] == R"({"id":2,"method":"b","params":["]"]})");
+        // Items are views over the batch content, so that requests can be viewed in turn
+        const auto request{RequestView::make((*items)[1])};
+        REQUIRE(request);
+        CHECK(request->id() == 2);
+        CHECK(request->method() == "b");
+    }
+    SECTION("empty array") {
+        const auto items{array_items(" [ ] ")};
+        REQUIRE(items);
+        CHECK(items->empty());
+    }
+    SECTION("not an array") {
+        CHECK(!array_items(""));
+        CHECK(!array_items(R"({"id":1,"method":"m"})"));
+        CHECK(!array_items("[1,2"));
+        CHECK(!array_items("[1,2] 3"));
+        CHECK(!array_items("[1 2]"));
+    }
+}
+
+TEST_CASE("string_value", "[rpc][json][request_view]") {
+    CHECK(string_value(R"("0xabcd")") == "0xabcd");
+    CHECK(string_value(R"("")") == "");
+    CHECK(!string_value("0x01"));
+    CHECK(!string_value(R"(")"));
+    CHECK(!string_value(R"("a\"b")"));
+}
+
+}  // namespace silkworm::rpc::json
@@ -17,12 +17,14 @@
 #include "transaction.hpp"
 
 #include <cstring>
+#include <span>
 #include <utility>
 
 #include <silkworm/core/common/util.hpp>
 #include <silkworm/silkrpc/common/util.hpp>
 
 #include "filter.hpp"
+#include "glaze.hpp"
 
 namespace silkworm {
 
@@ -83,4 +85,39 @@ void to_json(nlohmann::json& json, const Transaction& transaction) {
     }
 }
 
+struct GlazeJsonTransactionRsp {
+    char jsonrpc[jsonVersionSize] = "2.0";
+    uint32_t id;
+    GlazeJsonTransaction transaction;
+    struct glaze {
+        using T = GlazeJsonTransactionRsp;
+        static constexpr auto value = glz::object(
+            "jsonrpc", &T::jsonrpc,
+            "id", &T::id,
+            "result", &T::transaction);
+    };
+};
+
+void make_glaze_json_content(std::string& reply, uint32_t id, const Transaction& transaction) {
+    GlazeJsonTransactionRsp transaction_json_data{};
+    transaction_json_data.id = id;
+
+    auto& item = transaction_json_data.transaction;
+    make_glaze_json_transaction(item, transaction);
+    to_quantity(std::span(item.gas_price), transaction.effective_gas_price());
+    if (transaction.queued_in_pool) {
+        item.block_hash.str = "null";
+        item.block_number.str = "null";
+        item.transaction_index.str = "null";
+    } else {
+        char block_hash[hashSize];
+        to_hex(std::span(block_hash), transaction.block_hash);
+        make_glaze_json_quoted(item.block_hash, block_hash);
+        make_glaze_json_quoted(item.block_number, to_quantity(transaction.block_number).c_str());
+        make_glaze_json_quoted(item.transaction_index, to_quantity(transaction.transaction_index).c_str());
+    }
+
+    glz::write_json(transaction_json_data, reply);
+}
+
 }  // namespace silkworm::rpc
@@ -16,6 +16,8 @@
 
 #pragma once
 
+#include <string>
+
 #include <nlohmann/json.hpp>
 
 #include <silkworm/silkrpc/json/types.hpp>
@@ -31,4 +33,6 @@ namespace silkworm::rpc {
 
 void to_json(nlohmann::json& json, const Transaction& transaction);
 
+void make_glaze_json_content(std::string& reply, uint32_t id, const Transaction& transaction);
+
 }  // namespace silkworm::rpc
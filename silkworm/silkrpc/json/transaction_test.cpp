@@ -19,6 +19,8 @@
 #include <catch2/catch.hpp>
 #include <evmc/evmc.hpp>
 
+#include <silkworm/silkrpc/json/types.hpp>
+
 namespace silkworm::rpc {
 
 using Catch::Matchers::Message;
@@ -281,4 +283,51 @@ TEST_CASE("serialize EIP-1559 transaction (type=2)", "[silkrpc][to_json]") {
     })"_json);
 }
 
+TEST_CASE("make glaze json content for transaction", "[silkrpc][make_glaze_json_content]") {
+    Transaction txn{};
+    static_cast<silkworm::Transaction&>(txn) = silkworm::Transaction{
+        {.type = TransactionType::kDynamicFee,
+         .chain_id = 1,
+         .nonce = 0,
+         .max_priority_fee_per_gas = 50'000 * kGiga,
+         .max_fee_per_gas = 50'000 * kGiga,
+         .gas_limit = 21'000,
+         .to = 0x5df9b87991262f6ba471f09758cde1c0fc1de734_address,
+         .value = 31337,
+         .data = *from_hex("001122aabbcc"),
+         .access_list = {{0xde0b295669a9fd93d5f28d9ec85e40f4cb697bae_address,
+                          {0x0000000000000000000000000000000000000000000000000000000000000003_bytes32}}}},
+        true,                                                                                                    // odd_y_parity
+        intx::from_string<intx::uint256>("0x88ff6cf0fefd94db46111149ae4bfc179e9b94721fffd821d38d16464b3f71d0"),  // r
+        intx::from_string<intx::uint256>("0x45e0aff800961cfce805daef7016b9b675c137a6a41a548f7b60a3484c06a33a"),  // s
+        0x007fb8417eb9ad4d958b050fc3720d5b46a2c053_address,                                                      // from
+    };
+    txn.block_base_fee_per_gas = 7;
+
+    // glaze and nlohmann serializations must be equivalent, whatever the order of the fields
+    SECTION("mined transaction") {
+        txn.block_hash = 0x374f3a049e006f36f6cf91b02a3b0ee16c858af2f75858733eb0e927b5b7126c_bytes32;
+        txn.block_number = 123'456;
+        txn.transaction_index = 3;
+        std::string reply;
+        make_glaze_json_content(reply, 1, txn);
+        CHECK(nlohmann::json::parse(reply) == make_json_content(1, txn));
+    }
+
+    SECTION("pending transaction") {
+        txn.queued_in_pool = true;
+        std::string reply;
+        make_glaze_json_content(reply, 1, txn);
+        CHECK(nlohmann::json::parse(reply) == make_json_content(1, txn));
+    }
+
+    SECTION("contract creation legacy transaction") {
+        static_cast<silkworm::Transaction&>(txn) = silkworm::Transaction{};
+        txn.from = 0x007fb8417eb9ad4d958b050fc3720d5b46a2c053_address;
+        std::string reply;
+        make_glaze_json_content(reply, 1, txn);
+        CHECK(nlohmann::json::parse(reply) == make_json_content(1, txn));
+    }
+}
+
 }  // namespace silkworm::rpc
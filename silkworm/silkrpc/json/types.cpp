@@ -16,8 +16,10 @@
 
 #include "types.hpp"
 
+#include <algorithm>
 #include <cstring>
 #include <span>
+#include <stdexcept>
 #include <utility>
 
 #include <boost/endian/conversion.hpp>
@@ -50,12 +52,16 @@ void to_hex(std::span<char> hex_bytes, silkworm::ByteView bytes) {
 void to_hex_no_leading_zeros(std::span<char> hex_bytes, silkworm::ByteView bytes) {
     static const char* kHexDigits{"0123456789abcdef"};
     size_t len = bytes.length();
-    if (len * 2 + 2 + 1 > hex_bytes.size()) {
+    // "0x" prefix, at least one digit ("0x0" for empty input) and the null terminator
+    if (std::max(len * 2, size_t{1}) + 2 + 1 > hex_bytes.size()) {
         throw std::invalid_argument("to_hex_no_leading_zeros: hex_bytes too small");
     }
     char* dest = hex_bytes.data();
     *dest++ = '0';
     *dest++ = 'x';
+    if (len == 0) {
+        *dest++ = '0';
+    }
 
     bool found_nonzero{false};
     for (size_t i{0}; i < len; ++i) {
@@ -533,4 +539,36 @@ void make_glaze_json_error(std::string& reply, uint32_t id, const RevertError& e
     glz::write_json(glaze_json_revert, reply);
 }
 
+void make_glaze_json_null_content(std::string& reply, uint32_t id) {
+    reply = R"({"jsonrpc":"2.0","id":)" + std::to_string(id) + R"(,"result":null})";
+}
+
+struct GlazeJsonHash {
+    char jsonrpc[jsonVersionSize] = "2.0";
+    uint32_t id;
+    char result[hashSize];
+    struct glaze {
+        using T = GlazeJsonHash;
+        static constexpr auto value = glz::object(
+            "jsonrpc", &T::jsonrpc,
+            "id", &T::id,
+            "result", &T::result);
+    };
+};
+
+void make_glaze_json_content(std::string& reply, uint32_t id, const evmc::bytes32& hash) {
+    GlazeJsonHash glaze_json_hash;
+    glaze_json_hash.id = id;
+    to_hex(std::span(glaze_json_hash.result), hash);
+    glz::write_json(glaze_json_hash, reply);
+}
+
+void make_glaze_json_quoted(glz::raw_json& json, const char* value) {
+    json.str.clear();
+    json.str.reserve(std::strlen(value) + 2);
+    json.str.push_back('"');
+    json.str.append(value);
+    json.str.push_back('"');
+}
+
 }  // namespace silkworm::rpc
@@ -85,6 +85,8 @@ inline constexpr auto hashSize = 128;
 inline constexpr auto int64Size = 32;
 inline constexpr auto dataSize = 4096;
 inline constexpr auto ethCallResultFixedSize = 2048;
+inline constexpr auto int256Size = 128;
+inline constexpr auto bloomSize = 1024;
 
 void to_json(nlohmann::json& json, const PeerInfo& peer_info);
 
@@ -140,6 +142,11 @@ nlohmann::json make_json_error(uint32_t id, const RevertError& error);
 // GLAZE
 void make_glaze_json_error(std::string& reply, uint32_t id, int error_id, const std::string& message);
 void make_glaze_json_error(std::string& reply, uint32_t id, const RevertError& error);
+void make_glaze_json_null_content(std::string& reply, uint32_t id);
+void make_glaze_json_content(std::string& reply, uint32_t id, const evmc::bytes32& hash);
+
+//! Sets the specified string value quoted into raw JSON, for fields which may be either a string or null
+void make_glaze_json_quoted(glz::raw_json& json, const char* value);
 
 }  // namespace silkworm::rpc
 
@@ -17,6 +17,7 @@
 #include "types.hpp"
 
 #include <optional>
+#include <stdexcept>
 #include <string>
 #include <vector>
 
@@ -61,6 +62,18 @@ TEST_CASE("convert positive uint256 to quantity(buff)", "[silkrpc][to_quantity]"
     CHECK(strcmp(positive_quantity, "0x64") == 0);
 }
 
+TEST_CASE("convert empty bytes to quantity(buff)", "[silkrpc][to_quantity]") {
+    SECTION("buffer large enough") {
+        char empty_quantity[4];
+        to_quantity(empty_quantity, silkworm::ByteView{});
+        CHECK(strcmp(empty_quantity, "0x0") == 0);
+    }
+    SECTION("buffer too small") {
+        char empty_quantity[3];
+        CHECK_THROWS_AS(to_quantity(empty_quantity, silkworm::ByteView{}), std::invalid_argument);
+    }
+}
+
 TEST_CASE("serialize empty address using to_hex(char *)", "[silkrpc][to_json]") {
     evmc::address address{};
     char address_zero[64];
@@ -19,6 +19,7 @@
 #include <silkworm/infra/concurrency/private_service.hpp>
 #include <silkworm/infra/concurrency/shared_service.hpp>
 #include <silkworm/silkrpc/common/block_cache.hpp>
+#include <silkworm/silkrpc/common/timestamp_index.hpp>
 #include <silkworm/silkrpc/core/filter_storage.hpp>
 #include <silkworm/silkrpc/ethbackend/remote_backend.hpp>
 #include <silkworm/silkrpc/ethdb/kv/remote_database.hpp>
@@ -36,6 +37,7 @@ ContextTestBase::ContextTestBase()
       context_thread_{[&]() { context_.execute_loop(); }} {
     add_shared_service(io_context_, std::make_shared<BlockCache>());
     add_shared_service(io_context_, std::make_shared<FilterStorage>(1024));
+    add_shared_service(io_context_, std::make_shared<TimestampIndex>());
     add_shared_service<ethdb::kv::StateCache>(io_context_, std::make_shared<ethdb::kv::CoherentStateCache>());
     auto grpc_channel{::grpc::CreateChannel("localhost:12345", ::grpc::InsecureChannelCredentials())};
     add_private_service<ethdb::Database>(io_context_, std::make_unique<ethdb::kv::RemoteDatabase>(grpc_context_, grpc_channel));
@@ -16,10 +16,16 @@
 
 #include "body_sequence.hpp"
 
+#include <future>
+
+#include <silkworm/core/common/cast.hpp>
 #include <silkworm/core/common/random_number.hpp>
 #include <silkworm/core/common/singleton.hpp>
 #include <silkworm/core/protocol/validation.hpp>
+#include <silkworm/core/rlp/decode.hpp>
+#include <silkworm/infra/common/decoding_exception.hpp>
 #include <silkworm/infra/common/log.hpp>
+#include <silkworm/infra/concurrency/thread_pool.hpp>
 #include <silkworm/sync/sentry_client.hpp>
 
 namespace silkworm {
@@ -59,35 +65,128 @@ size_t BodySequence::outstanding_requests(time_point_t tp) const {
     return (requested_bodies + kMaxBlocksPerMessage - 1) / kMaxBlocksPerMessage;
 }
 
-Penalty BodySequence::accept_requested_bodies(BlockBodiesPacket66& packet, const PeerId&) {
+//! runs compute_range(begin, end) over [0, count) in chunks, on a pool of workers if there are enough items
+template <class F>
+static void compute_in_chunks(size_t count, F compute_range) {
+    static constexpr size_t kBodiesPerTask{16};
+    static ThreadPool workers{std::max(std::thread::hardware_concurrency() / 2, 1u)};
+
+    if (count <= kBodiesPerTask) {
+        compute_range(0, count);
+        return;
+    }
+
+    std::vector<std::future<void>> tasks;
+    for (size_t begin = 0; begin < count; begin += kBodiesPerTask) {
+        tasks.push_back(workers.submit(compute_range, begin, std::min(begin + kBodiesPerTask, count)));
+    }
+    for (auto& task : tasks) {
+        task.get();
+    }
+}
+
+//! splits the next RLP item (header included) from the input
+static ByteView next_rlp_item(ByteView& from) {
+    const ByteView item{from};
+    const auto header{rlp::decode_header(from)};
+    success_or_throw(header, "BodySequence: invalid block bodies RLP");
+    const size_t header_length{item.length() - from.length()};
+    from.remove_prefix(header->payload_length);
+    return item.substr(0, header_length + header->payload_length);
+}
+
+//! returns the payload of a RLP list item
+static ByteView list_payload(ByteView item) {
+    const auto header{rlp::decode_header(item)};
+    success_or_throw(header, "BodySequence: invalid block bodies RLP");
+    if (!header->list) {
+        throw DecodingException(DecodingError::kUnexpectedString, "BodySequence: invalid block bodies RLP");
+    }
+    return item.substr(0, header->payload_length);
+}
+
+std::vector<BodyRoots> BodySequence::compute_roots(const BlockBodiesPacket66& packet) {
+    std::vector<BodyRoots> roots(packet.request.size());
+    compute_in_chunks(packet.request.size(), [&packet, &roots](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+            roots[i].ommers_hash = protocol::compute_ommers_hash(packet.request[i]);
+            roots[i].transactions_root = protocol::compute_transaction_root(packet.request[i]);
+        }
+    });
+    return roots;
+}
+
+std::vector<BodyRoots> BodySequence::compute_roots(ByteView packet_rlp) {
+    // packet: [request-id, [[transactions, ommers, (withdrawals)], ...]]
+    ByteView packet{list_payload(packet_rlp)};
+    next_rlp_item(packet);  // request-id
+    ByteView bodies{list_payload(next_rlp_item(packet))};
+
+    // bodies items: ommers and transactions are hashed straight from their wire encoding
+    std::vector<std::pair<ByteView, ByteView>> items;
+    while (!bodies.empty()) {
+        ByteView body{list_payload(next_rlp_item(bodies))};
+        const ByteView transactions_rlp{next_rlp_item(body)};
+        const ByteView ommers_rlp{next_rlp_item(body)};
+        items.emplace_back(transactions_rlp, ommers_rlp);
+    }
+
+    std::vector<BodyRoots> roots(items.size());
+    std::vector<std::optional<DecodingError>> errors(items.size());
+    compute_in_chunks(items.size(), [&items, &roots, &errors](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+            roots[i].ommers_hash = bit_cast<evmc_bytes32>(keccak256(items[i].second));
+            const auto transactions_root{protocol::compute_transaction_root(items[i].first)};
+            if (transactions_root) {
+                roots[i].transactions_root = *transactions_root;
+            } else {
+                errors[i] = transactions_root.error();
+            }
+        }
+    });
+    for (const auto& error : errors) {
+        if (error) {
+            throw DecodingException(*error, "BodySequence: invalid transactions RLP");
+        }
+    }
+    return roots;
+}
+
+Penalty BodySequence::accept_requested_bodies(BlockBodiesPacket66& packet, const PeerId& peer_id) {
+    return accept_requested_bodies(packet, compute_roots(packet), peer_id);
+}
+
+Penalty BodySequence::accept_requested_bodies(BlockBodiesPacket66& packet, const std::vector<BodyRoots>& roots,
+                                              const PeerId&) {
+    SILKWORM_ASSERT(roots.size() == packet.request.size());
     Penalty penalty = NoPenalty;
     BlockNum start_block = std::numeric_limits<BlockNum>::max();
     size_t count = 0;
 
     statistics_.received_items += packet.request.size();
 
-    // Find matching requests and completing BodyRequest
-    auto matching_requests = body_requests_.find_by_request_id(packet.requestId);
-
-    for (auto& body : packet.request) {
-        Hash oh = protocol::compute_ommers_hash(body);
-        Hash tr = protocol::compute_transaction_root(body);
+    // Find matching requests and index them by roots (more blocks can share them, e.g. empty ones)
+    // in increasing height order, so that the lowest one is matched first
+    std::unordered_map<BodyRoots, std::vector<IncreasingHeightOrderedRequestContainer::Iter>> matching_requests;
+    auto requests_by_id = body_requests_.find_by_request_id(packet.requestId);
+    for (auto elem = requests_by_id.rbegin(); elem != requests_by_id.rend(); ++elem) {
+        const BlockHeader& header = (*elem)->second.header;
+        matching_requests[{header.ommers_hash, header.transactions_root}].push_back(*elem);
+    }
 
+    for (size_t i = 0; i < packet.request.size(); ++i) {
+        auto& body = packet.request[i];
         auto exact_request = body_requests_.end();  // = no request
 
-        auto r = std::find_if(matching_requests.begin(), matching_requests.end(), [&oh, &tr](const auto& elem) {
-            const BodyRequest& request = elem->second;
-            return (request.header.ommers_hash == oh && request.header.transactions_root == tr);
-        });
-
-        if (r != matching_requests.end()) {
+        auto r = matching_requests.find(roots[i]);
+        if (r != matching_requests.end() && !r->second.empty()) {
             // found
-            exact_request = *r;
+            exact_request = r->second.back();
 
-            matching_requests.erase(r);
+            r->second.pop_back();
         } else {
             // not found, can be a response to "past" request upon same bodies?
-            exact_request = body_requests_.find_by_hash(oh, tr);
+            exact_request = body_requests_.find_by_hash(roots[i].ommers_hash, roots[i].transactions_root);
 
             if (exact_request == body_requests_.end()) {
                 // penalty = BadBlockPenalty; // Erigon doesn't penalize the peer maybe because can be a late response but
@@ -117,10 +216,12 @@ Penalty BodySequence::accept_requested_bodies(BlockBodiesPacket66& packet, const
                << packet.request.size() << " received";
 
     // Process remaining elements in matching_requests invalidating corresponding BodyRequest
-    for (auto& elem : matching_requests) {
-        BodyRequest& request = elem->second;
-        request.request_id = 0;
-        request.request_time = time_point_t();
+    for (auto& [_, remaining_requests] : matching_requests) {
+        for (auto& elem : remaining_requests) {
+            BodyRequest& request = elem->second;
+            body_requests_.set_request_id(elem, 0);
+            request.request_time = time_point_t();
+        }
     }
 
     return penalty;
@@ -177,8 +278,8 @@ auto BodySequence::renew_stale_requests(GetBlockBodiesPacket66& packet, BlockNum
     BlockNum start_block = std::numeric_limits<BlockNum>::max();
     size_t count = 0;
 
-    for (auto& br : body_requests_) {
-        BodyRequest& past_request = br.second;
+    for (auto br = body_requests_.begin(); br != body_requests_.end(); ++br) {
+        BodyRequest& past_request = br->second;
 
         if (past_request.request_id == 0 || past_request.ready || tp - past_request.request_time < timeout)
             continue;
@@ -186,7 +287,7 @@ auto BodySequence::renew_stale_requests(GetBlockBodiesPacket66& packet, BlockNum
         if (!fulfill_from_announcements(past_request)) {
             packet.request.push_back(past_request.block_hash);
             past_request.request_time = tp;
-            past_request.request_id = packet.requestId;
+            body_requests_.set_request_id(br, packet.requestId);
 
             min_block = std::max(min_block, past_request.block_height);
 
@@ -214,8 +315,8 @@ void BodySequence::make_new_requests(GetBlockBodiesPacket66& packet, BlockNum& m
     BlockNum start_block = std::numeric_limits<BlockNum>::max();
     size_t count = 0;
 
-    for (auto& br : body_requests_) {
-        BodyRequest& new_request = br.second;
+    for (auto br = body_requests_.begin(); br != body_requests_.end(); ++br) {
+        BodyRequest& new_request = br->second;
 
         if (new_request.request_id != 0 || new_request.ready)  // already requested or ready
             continue;
@@ -223,7 +324,6 @@ void BodySequence::make_new_requests(GetBlockBodiesPacket66& packet, BlockNum& m
         if (!fulfill_from_announcements(new_request)) {
             packet.request.push_back(new_request.block_hash);
             new_request.request_time = tp;
-            new_request.request_id = packet.requestId;
 
             min_block = std::max(min_block, new_request.block_height);  // the min block the peer must have (so it is our max)
 
@@ -233,7 +333,7 @@ void BodySequence::make_new_requests(GetBlockBodiesPacket66& packet, BlockNum& m
             //            << ", hash= " << new_request.block_hash;
         }
 
-        new_request.request_id = packet.requestId;
+        body_requests_.set_request_id(br, packet.requestId);
 
         if (packet.request.size() >= kMaxBlocksPerMessage) break;
     }
@@ -282,10 +382,9 @@ bool BodySequence::fulfill_from_announcements(BodyRequest& request) {
 
 void BodySequence::request_nack(const GetBlockBodiesPacket66& packet) {
     seconds_t timeout = SentryClient::kRequestDeadline;
-    for (auto& br : body_requests_) {
-        BodyRequest& past_request = br.second;
-        if (past_request.request_id == packet.requestId)
-            past_request.request_time -= timeout;
+    for (auto& br : body_requests_.find_by_request_id(packet.requestId)) {
+        BodyRequest& past_request = br->second;
+        past_request.request_time -= timeout;
     }
     last_nack_ = std::chrono::system_clock::now();
     statistics_.requested_items -= packet.request.size();
@@ -346,32 +445,62 @@ size_t BodySequence::AnnouncedBlocks::size() {
     return blocks_.size();
 }
 
-auto BodySequence::IncreasingHeightOrderedRequestContainer::find_by_request_id(uint64_t request_id) -> std::list<Iter> {
-    std::list<Impl::iterator> matching_requests;
-    for (auto elem = begin(); elem != end(); elem++) {
-        const BodyRequest& request = elem->second;
-        if (request.request_id == request_id) matching_requests.push_back(elem);
+auto BodySequence::IncreasingHeightOrderedRequestContainer::emplace(BlockNum bn, BodyRequest&& request) -> Iter {
+    auto elem = requests_.emplace(bn, std::move(request));
+    const BodyRequest& inserted = elem->second;
+    by_roots_[{inserted.header.ommers_hash, inserted.header.transactions_root}].insert(elem);
+    if (inserted.request_id != 0) by_request_id_[inserted.request_id].insert(elem);
+    return elem;
+}
+
+auto BodySequence::IncreasingHeightOrderedRequestContainer::erase(Iter request) -> Iter {
+    set_request_id(request, 0);
+
+    const BodyRoots roots{request->second.header.ommers_hash, request->second.header.transactions_root};
+    if (auto same_roots = by_roots_.find(roots); same_roots != by_roots_.end()) {
+        same_roots->second.erase(request);
+        if (same_roots->second.empty()) by_roots_.erase(same_roots);
     }
-    return matching_requests;
+
+    return requests_.erase(request);
 }
 
-auto BodySequence::IncreasingHeightOrderedRequestContainer::find_by_hash(Hash oh, Hash tr) -> Iter {
-    auto r = std::find_if(begin(), end(), [&oh, &tr](const auto& elem) {
-        const BodyRequest& request = elem.second;
-        return (request.header.ommers_hash == oh && request.header.transactions_root == tr);
-    });
+void BodySequence::IncreasingHeightOrderedRequestContainer::set_request_id(Iter request, uint64_t request_id) {
+    uint64_t& current_id = request->second.request_id;
+    if (current_id == request_id) return;
+
+    if (current_id != 0) {
+        if (auto same_id = by_request_id_.find(current_id); same_id != by_request_id_.end()) {
+            same_id->second.erase(request);
+            if (same_id->second.empty()) by_request_id_.erase(same_id);
+        }
+    }
+    if (request_id != 0) by_request_id_[request_id].insert(request);
+
+    current_id = request_id;
+}
 
-    return r;
+auto BodySequence::IncreasingHeightOrderedRequestContainer::find_by_request_id(uint64_t request_id) const
+    -> std::vector<Iter> {
+    auto same_id = by_request_id_.find(request_id);
+    if (same_id == by_request_id_.end()) return {};
+    return {same_id->second.begin(), same_id->second.end()};
+}
+
+auto BodySequence::IncreasingHeightOrderedRequestContainer::find_by_hash(Hash oh, Hash tr) -> Iter {
+    auto same_roots = by_roots_.find({oh, tr});
+    if (same_roots == by_roots_.end() || same_roots->second.empty()) return requests_.end();
+    return *same_roots->second.begin();  // the lowest one
 }
 
 BlockNum BodySequence::IncreasingHeightOrderedRequestContainer::lowest_block() const {
-    if (empty()) return 0;
-    return begin()->first;
+    if (requests_.empty()) return 0;
+    return requests_.begin()->first;
 }
 
 BlockNum BodySequence::IncreasingHeightOrderedRequestContainer::highest_block() const {
-    if (empty()) return 0;
-    return rbegin()->first;
+    if (requests_.empty()) return 0;
+    return requests_.rbegin()->first;
 }
 
 const Download_Statistics& BodySequence::statistics() const {
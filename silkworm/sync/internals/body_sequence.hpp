@@ -16,7 +16,9 @@
 
 #pragma once
 
-#include <list>
+#include <set>
+#include <unordered_map>
+#include <vector>
 
 #include <silkworm/node/db/access_layer.hpp>
 #include <silkworm/sync/messages/outbound_get_block_bodies.hpp>
@@ -71,6 +73,17 @@ class BodySequence {
     //! core functionalities: process received bodies
     Penalty accept_requested_bodies(BlockBodiesPacket66&, const PeerId&);
 
+    //! core functionalities: process received bodies whose roots have been computed ahead (see compute_roots)
+    Penalty accept_requested_bodies(BlockBodiesPacket66&, const std::vector<BodyRoots>&, const PeerId&);
+
+    //! computes ommers hash and transactions root of each received body, spreading work on a pool of workers;
+    //! it is thread safe, so it can be called out of the thread processing the bodies
+    static std::vector<BodyRoots> compute_roots(const BlockBodiesPacket66&);
+
+    //! as above, but hashing ommers and transactions straight from the RLP-encoded packet as received, so saving
+    //! their re-encoding; throws DecodingException if the packet is not well-formed
+    static std::vector<BodyRoots> compute_roots(ByteView packet_rlp);
+
     //! core functionalities: process received block announcement
     Penalty accept_new_block(const Block&, const PeerId&);
 
@@ -125,15 +138,44 @@ class BodySequence {
     };
 
     // using IncreasingHeightOrderedMap = std::map<BlockNum, BodyRequest>; // default ordering: less<BlockNum>
-    struct IncreasingHeightOrderedRequestContainer : public std::multimap<BlockNum, BodyRequest> {
-        using Impl = std::map<BlockNum, BodyRequest>;
+    // requests are also indexed by request id and by roots, so the underlying multimap is only reachable
+    // through the methods below that keep the indexes in sync
+    class IncreasingHeightOrderedRequestContainer {
+      public:
+        using Impl = std::multimap<BlockNum, BodyRequest>;
         using Iter = Impl::iterator;
+        using ConstIter = Impl::const_iterator;
+
+        Iter emplace(BlockNum bn, BodyRequest&& request);
+        Iter erase(Iter request);
+        void set_request_id(Iter request, uint64_t request_id);
 
-        std::list<Iter> find_by_request_id(uint64_t request_id);
+        [[nodiscard]] std::vector<Iter> find_by_request_id(uint64_t request_id) const;
         Iter find_by_hash(Hash oh, Hash tr);
+        Iter find(BlockNum bn) { return requests_.find(bn); }
 
         [[nodiscard]] BlockNum lowest_block() const;
         [[nodiscard]] BlockNum highest_block() const;
+
+        Iter begin() { return requests_.begin(); }
+        Iter end() { return requests_.end(); }
+        [[nodiscard]] ConstIter begin() const { return requests_.begin(); }
+        [[nodiscard]] ConstIter end() const { return requests_.end(); }
+
+        [[nodiscard]] size_t size() const { return requests_.size(); }
+        [[nodiscard]] bool empty() const { return requests_.empty(); }
+
+      private:
+        struct IncreasingHeight {
+            bool operator()(const Iter& lhs, const Iter& rhs) const {
+                return lhs->first != rhs->first ? lhs->first < rhs->first : &lhs->second < &rhs->second;
+            }
+        };
+        using IterSet = std::set<Iter, IncreasingHeight>;
+
+        Impl requests_;
+        std::unordered_map<uint64_t, IterSet> by_request_id_;  // requests not yet issued (id 0) are not indexed
+        std::unordered_map<BodyRoots, IterSet> by_roots_;
     };
 
     IncreasingHeightOrderedRequestContainer body_requests_;
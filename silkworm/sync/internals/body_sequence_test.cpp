@@ -22,6 +22,7 @@
 
 #include <silkworm/core/chain/genesis.hpp>
 #include <silkworm/core/common/cast.hpp>
+#include <silkworm/infra/common/decoding_exception.hpp>
 #include <silkworm/node/db/genesis.hpp>
 #include <silkworm/node/test/context.hpp>
 #include <silkworm/sync/sentry_client.hpp>
@@ -479,6 +480,32 @@ TEST_CASE("body downloading", "[silkworm][sync][BodySequence]") {
         REQUIRE(statistic.rejected_items() == 0);
     }
 
+    SECTION("should compute roots of many bodies on workers") {
+        BlockBodiesPacket66 response_packet;
+        response_packet.request.resize(BodySequence::kMaxBlocksPerMessage, block1);
+
+        auto roots = BodySequence::compute_roots(response_packet);
+
+        REQUIRE(roots.size() == response_packet.request.size());
+        REQUIRE(std::all_of(roots.begin(), roots.end(), [&header1](const BodyRoots& r) {
+            return r.ommers_hash == header1.ommers_hash && r.transactions_root == header1.transactions_root;
+        }));
+    }
+
+    SECTION("should compute the same roots from the packet RLP") {
+        BlockBodiesPacket66 response_packet;
+        response_packet.requestId = 1234;
+        response_packet.request.resize(BodySequence::kMaxBlocksPerMessage, block1);
+        Bytes packet_rlp;
+        rlp::encode(packet_rlp, response_packet);
+
+        auto roots = BodySequence::compute_roots(packet_rlp);
+
+        REQUIRE(roots == BodySequence::compute_roots(response_packet));
+        REQUIRE_THROWS_AS(BodySequence::compute_roots(ByteView{packet_rlp}.substr(0, packet_rlp.size() - 1)),
+                          DecodingException);
+    }
+
     SECTION("accepting and using an announced block") {
         // accepting announcement
         PeerId peer_id{byte_ptr_cast("1")};
@@ -17,12 +17,14 @@
 #pragma once
 
 #include <map>
+#include <optional>
 #include <queue>
 #include <set>
 #include <span>
 #include <stack>
 #include <vector>
 
+#include <silkworm/core/protocol/validation.hpp>
 #include <silkworm/node/db/access_layer.hpp>
 
 #include "priority_queue.hpp"
@@ -40,6 +42,7 @@ struct Link {
     std::vector<std::shared_ptr<Link>> next;  // Reverse of parentHash,allows iter.over links in asc. block height order
     bool persisted = false;                   // Whether this link comes from the database record
     bool preverified = false;                 // Ancestor of pre-verified header
+    std::optional<ValidationResult> seal_validation;  // Result of seal validation done ahead of verify()
 
     Link(BlockHeader h, bool persisted_) {
         blockHeight = h.number;
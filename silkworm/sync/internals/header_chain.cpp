@@ -16,11 +16,16 @@
 
 #include "header_chain.hpp"
 
+#include <algorithm>
+#include <future>
+#include <vector>
+
 #include <gsl/util>
 
 #include <silkworm/core/common/as_range.hpp>
 #include <silkworm/core/common/random_number.hpp>
 #include <silkworm/core/common/singleton.hpp>
+#include <silkworm/core/protocol/ethash_epoch_cache.hpp>
 #include <silkworm/infra/common/environment.hpp>
 #include <silkworm/infra/common/log.hpp>
 #include <silkworm/node/db/db_utils.hpp>
@@ -37,7 +42,9 @@ class segment_cut_and_paste_error : public std::logic_error {
     explicit segment_cut_and_paste_error(const std::string& reason) : std::logic_error(reason) {}
 };
 
-HeaderChain::HeaderChain(const ChainConfig& chain_config) : HeaderChain(protocol::rule_set_factory(chain_config)) {}
+HeaderChain::HeaderChain(const ChainConfig& chain_config) : HeaderChain(protocol::rule_set_factory(chain_config)) {
+    is_ethash_ = chain_config.protocol_rule_set == protocol::RuleSetType::kEthash;
+}
 
 HeaderChain::HeaderChain(protocol::RuleSetPtr rule_set)
     : highest_in_db_(0),
@@ -149,6 +156,8 @@ Headers HeaderChain::withdraw_stable_headers() {
     OldestFirstLinkQueue assessing_list = insert_list_;  // use move() operation if it is assured that after the move
     insert_list_.clear();                                // the container is empty and can be reused
 
+    verify_seals_ahead(assessing_list);
+
     while (!assessing_list.empty()) {
         // Choose a link at top
         auto link = assessing_list.top();  // from lower block numbers to higher block numbers
@@ -231,8 +240,16 @@ auto HeaderChain::verify(const Link& link) -> VerificationResult {
         return Skip;
     }
 
+    bool with_seal_check = true;
+    if (link.seal_validation) {
+        if (*link.seal_validation != ValidationResult::kOk) {
+            return Skip;
+        }
+        with_seal_check = false;
+    }
+
     bool with_future_timestamp_check = true;
-    auto result = rule_set_->validate_block_header(*link.header, chain_state_, with_future_timestamp_check);
+    auto result = rule_set_->validate_block_header(*link.header, chain_state_, with_future_timestamp_check, with_seal_check);
 
     if (result != ValidationResult::kOk) {
         if (result == ValidationResult::kUnknownParent) {
@@ -247,6 +264,73 @@ auto HeaderChain::verify(const Link& link) -> VerificationResult {
     return Accept;
 }
 
+// Seal validation (e.g. PoW) is the most expensive part of header verification and doesn't depend on other headers,
+// so the seals of the links that withdraw_stable_headers() is going to verify are validated ahead on a worker pool;
+// verify() then consumes the results in ascending height order
+void HeaderChain::verify_seals_ahead(const OldestFirstLinkQueue& links) {
+    static constexpr size_t kMinLinksToVerifyInParallel{16};
+
+    std::vector<std::shared_ptr<Link>> links_to_verify;
+    std::vector<std::shared_ptr<Link>> to_visit(links.begin(), links.end());
+    while (!to_visit.empty()) {
+        auto link = to_visit.back();
+        to_visit.pop_back();
+        // links waiting for pre-verification will not be verified, nor their descendants
+        if (link->blockHeight <= last_preverified_hash_ && !link->preverified) continue;
+        if (!link->preverified && !link->seal_validation) links_to_verify.push_back(link);
+        to_visit.insert(to_visit.end(), link->next.begin(), link->next.end());
+    }
+    if (links_to_verify.empty()) return;
+
+    auto highest_link = std::max_element(links_to_verify.begin(), links_to_verify.end(), LinkOlderThan{});
+    precompute_next_epoch(*(*highest_link)->header);
+
+    if (links_to_verify.size() < kMinLinksToVerifyInParallel) return;  // verify() will do it, not worth the overhead
+
+    if (!seal_verification_pool_) {
+        seal_verification_pool_ = std::make_unique<ThreadPool>();
+    }
+
+    const size_t tasks_count = seal_verification_pool_->get_thread_count();
+    const size_t links_per_task = (links_to_verify.size() + tasks_count - 1) / tasks_count;
+    std::vector<std::future<void>> results;
+    for (size_t begin = 0; begin < links_to_verify.size(); begin += links_per_task) {
+        const size_t end = std::min(begin + links_per_task, links_to_verify.size());
+        results.push_back(seal_verification_pool_->submit([&, begin, end] {
+            for (size_t i = begin; i < end; ++i) {
+                auto& link = links_to_verify[i];
+                link->seal_validation = rule_set_->validate_seal(*link->header);
+            }
+        }));
+    }
+    for (auto& result : results) {
+        result.get();
+    }
+
+    SILK_TRACE << "HeaderChain: verified " << links_to_verify.size() << " seals in parallel";
+}
+
+// Building an ethash epoch context takes seconds, so it is done in the background before the headers need it
+void HeaderChain::precompute_next_epoch(const BlockHeader& header) {
+    static constexpr BlockNum kPrecomputeDistance{ethash::epoch_length / 3};
+
+    if (!is_ethash_ || header.difficulty == 0) return;  // not PoW or past the Merge
+
+    const BlockNum height = header.number;
+    const int next_epoch = static_cast<int>(height / ethash::epoch_length) + 1;
+    if (next_epoch <= precomputed_epoch_) return;
+    if (static_cast<BlockNum>(next_epoch) * ethash::epoch_length - height > kPrecomputeDistance) return;
+
+    if (!seal_verification_pool_) {
+        seal_verification_pool_ = std::make_unique<ThreadPool>();
+    }
+    seal_verification_pool_->push_task([next_epoch] {
+        protocol::EthashEpochCache::instance().get(next_epoch);
+    });
+    precomputed_epoch_ = next_epoch;
+    SILK_TRACE << "HeaderChain: precomputing ethash epoch " << next_epoch;
+}
+
 // reduce persistedLinksQueue and remove links
 void HeaderChain::reduce_persisted_links_to(size_t limit) {
     if (persisted_link_queue_.size() <= limit) return;
@@ -17,9 +17,11 @@
 #pragma once
 
 #include <cstdio>
+#include <memory>
 
 #include <silkworm/core/common/lru_cache.hpp>
 #include <silkworm/core/protocol/rule_set.hpp>
+#include <silkworm/infra/concurrency/thread_pool.hpp>
 #include <silkworm/node/common/preverified_hashes.hpp>
 #include <silkworm/sync/messages/outbound_get_block_headers.hpp>
 
@@ -153,6 +155,8 @@ class HeaderChain {
         Accept
     };
     VerificationResult verify(const Link& link);
+    void verify_seals_ahead(const OldestFirstLinkQueue& links);
+    void precompute_next_epoch(const BlockHeader& header);
 
     void connect(std::shared_ptr<Link>, Segment::Slice, std::shared_ptr<Anchor>);
     auto extend_down(Segment::Slice, std::shared_ptr<Anchor>) -> RequestMoreHeaders;
@@ -174,6 +178,9 @@ class HeaderChain {
     lru_cache<Hash, Ignore> seen_announces_;
     std::vector<Announce> announces_to_do_;
     protocol::RuleSetPtr rule_set_;
+    std::unique_ptr<ThreadPool> seal_verification_pool_;  // Created on first use
+    bool is_ethash_{false};                               // Whether ethash epoch contexts should be precomputed
+    int precomputed_epoch_{-1};
     CustomHeaderOnlyChainState chain_state_;
     time_point_t last_skeleton_request_;
     time_point_t last_nack_;
@@ -56,7 +56,7 @@ class DummyRuleSet : public protocol::IRuleSet {
 
     ValidationResult validate_ommers(const Block&, const BlockState&) override { return ValidationResult::kOk; }
 
-    ValidationResult validate_block_header(const BlockHeader&, const BlockState&, bool) override { return ValidationResult::kOk; }
+    ValidationResult validate_block_header(const BlockHeader&, const BlockState&, bool, bool) override { return ValidationResult::kOk; }
 
     ValidationResult validate_seal(const BlockHeader&) override { return ValidationResult::kOk; }
 
@@ -17,6 +17,7 @@
 #include "header_chain.hpp"
 
 #include <algorithm>
+#include <atomic>
 
 #include <catch2/catch.hpp>
 
@@ -41,6 +42,8 @@ class HeaderChainForTest : public HeaderChain {
     using HeaderChain::links_;
     using HeaderChain::pending_links;
     using HeaderChain::reduce_links_to;
+    using HeaderChain::verify;
+    using HeaderChain::verify_seals_ahead;
 };
 
 // TESTs related to HeaderList::split_into_segments
@@ -1598,4 +1601,67 @@ TEST_CASE("HeaderChain - process_segment - (8) sibling with anchor invalidation
     }
 }
 
+// Seals are valid if the nonce is zero
+class SealCountingRuleSet : public protocol::IRuleSet {
+  public:
+    ValidationResult pre_validate_block_body(const Block&, const BlockState&) override { return ValidationResult::kOk; }
+
+    ValidationResult validate_ommers(const Block&, const BlockState&) override { return ValidationResult::kOk; }
+
+    ValidationResult validate_block_header(const BlockHeader& header, const BlockState&, bool, bool with_seal_check) override {
+        return with_seal_check ? validate_seal(header) : ValidationResult::kOk;
+    }
+
+    ValidationResult validate_seal(const BlockHeader& header) override {
+        ++seal_validations;
+        return header.nonce == BlockHeader::NonceType{} ? ValidationResult::kOk : ValidationResult::kInvalidSeal;
+    }
+
+    void finalize(IntraBlockState&, const Block&) override {}
+
+    evmc::address get_beneficiary(const BlockHeader&) override { return {}; }
+
+    std::atomic<size_t> seal_validations{0};
+};
+
+TEST_CASE("HeaderChain - verify_seals_ahead") {
+    test_util::SetLogVerbosityGuard guard{log::Level::kNone};
+
+    auto rule_set = std::make_unique<SealCountingRuleSet>();
+    auto& seal_validations = rule_set->seal_validations;
+    HeaderChainForTest chain(std::move(rule_set));
+
+    // a chain of links with a bad seal in the middle
+    std::vector<std::shared_ptr<Link>> links;
+    BlockHeader header;
+    for (BlockNum number = 1; number <= 100; ++number) {
+        header.number = number;
+        header.parent_hash = header.hash();
+        header.nonce[0] = (number == 50) ? 1 : 0;
+        links.push_back(std::make_shared<Link>(header, false));
+        if (links.size() > 1) {
+            links[links.size() - 2]->next.push_back(links.back());
+        }
+    }
+
+    OldestFirstLinkQueue assessing_list;
+    assessing_list.push(links.front());
+    chain.verify_seals_ahead(assessing_list);
+
+    CHECK(seal_validations == links.size());
+    for (const auto& link : links) {
+        REQUIRE(link->seal_validation.has_value());
+        CHECK((*link->seal_validation == ValidationResult::kOk) == (link->blockHeight != 50));
+    }
+
+    // results are consumed by verify() without validating the seals again
+    CHECK(chain.verify(*links[0]) == HeaderChain::Accept);
+    CHECK(chain.verify(*links[49]) == HeaderChain::Skip);
+    CHECK(seal_validations == links.size());
+
+    // seals already validated are not validated again
+    chain.verify_seals_ahead(assessing_list);
+    CHECK(seal_validations == links.size());
+}
+
 }  // namespace silkworm
@@ -92,4 +92,23 @@ struct Announce {
     BlockNum number = 0;
 };
 
+// The header fields a block body must match: used to pair received bodies with requests
+struct BodyRoots {
+    Hash ommers_hash;
+    Hash transactions_root;
+
+    bool operator==(const BodyRoots&) const = default;
+};
+
 }  // namespace silkworm
+
+namespace std {
+
+template <>
+struct hash<silkworm::BodyRoots> {  // to use BodyRoots with std::unordered_set/map
+    size_t operator()(const silkworm::BodyRoots& roots) const noexcept {
+        return std::hash<silkworm::Hash>{}(roots.transactions_root) ^ std::hash<silkworm::Hash>{}(roots.ommers_hash);
+    }
+};
+
+}  // namespace std
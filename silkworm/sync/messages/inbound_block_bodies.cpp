@@ -25,14 +25,16 @@ namespace silkworm {
 
 InboundBlockBodies::InboundBlockBodies(ByteView data, PeerId peer_id)
     : peerId_(std::move(peer_id)) {
+    const ByteView packet_rlp{data};
     success_or_throw(rlp::decode(data, packet_));
+    roots_ = BodySequence::compute_roots(packet_rlp);  // here, so hashing is out of the thread that processes bodies
     SILK_TRACE << "Received message " << *this;
 }
 
 void InboundBlockBodies::execute(db::ROAccess, HeaderChain&, BodySequence& bs, SentryClient& sentry) {
     SILK_TRACE << "Processing message " << *this;
 
-    Penalty penalty = bs.accept_requested_bodies(packet_, peerId_);
+    Penalty penalty = bs.accept_requested_bodies(packet_, roots_, peerId_);
 
     if (penalty != Penalty::NoPenalty) {
         SILK_TRACE << "Replying to " << identify(*this) << " with penalize_peer";
@@ -16,6 +16,8 @@
 
 #pragma once
 
+#include <vector>
+
 #include <silkworm/sync/internals/types.hpp>
 #include <silkworm/sync/packets/block_bodies_packet.hpp>
 
@@ -36,6 +38,7 @@ class InboundBlockBodies : public InboundMessage {
   private:
     PeerId peerId_;
     BlockBodiesPacket66 packet_;
+    std::vector<BodyRoots> roots_;  // of each body in packet_
 };
 
 }  // namespace silkworm